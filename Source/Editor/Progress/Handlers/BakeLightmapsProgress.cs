@@ -10,10 +10,15 @@ namespace FlaxEditor.Progress.Handlers
     /// <seealso cref="FlaxEditor.Progress.ProgressHandler" />
     public sealed class BakeLightmapsProgress : ProgressHandler
     {
+        /// <summary>
+        /// Gets a value indicating whether lightmaps baking is supported. Devices that cannot bake lightmaps on GPU use the CPU baking backend.
+        /// </summary>
+        public static bool CanBake => true;
+
         /// <summary>
         /// Gets a value indicating whether GPU lightmaps baking is supported on this device.
         /// </summary>
-        public static bool CanBake
+        public static bool CanBakeOnGPU
         {
             get
             {
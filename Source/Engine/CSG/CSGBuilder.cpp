@@ -4,10 +4,11 @@
 #include "CSGMesh.h"
 #include "CSGData.h"
 #include "Engine/Level/Level.h"
-#include "Engine/Level/SceneQuery.h"
 #include "Engine/Level/Actor.h"
+#include "Engine/Level/Scene/Scene.h"
 #include "Engine/Core/Log.h"
 #include "Engine/Core/Types/TimeSpan.h"
+#include "Engine/Core/Collections/Dictionary.h"
 #include "Engine/Graphics/Models/ModelData.h"
 #include "Engine/Content/Content.h"
 #include "Engine/Content/Assets/Model.h"
@@ -18,6 +19,9 @@
 #include "Engine/Engine/Engine.h"
 #include "Engine/Engine/EngineService.h"
 #include "Engine/Serialization/MemoryWriteStream.h"
+#include "Engine/Threading/JobSystem.h"
+#include "Engine/Utilities/Crc.h"
+#include "Engine/Profiler/ProfilerCPU.h"
 #if USE_EDITOR
 #include "Editor/Editor.h"
 #endif
@@ -31,11 +35,18 @@ using namespace CSG;
 
 struct BuildData;
 
+namespace CSG
+{
+    struct SceneCache;
+}
+
 namespace CSGBuilderImpl
 {
     Array<Scene*> ScenesToRebuild;
+    Dictionary<Scene*, SceneCache*> ScenesCache;
 
     void onSceneUnloading(Scene* scene, const Guid& sceneId);
+    void clearCache(Scene* scene);
     bool buildInner(Scene* scene, BuildData& data);
     void build(Scene* scene);
     bool generateRawDataAsset(Scene* scene, RawData& meshData, Guid& assetId, const String& assetPath);
@@ -53,6 +64,7 @@ class CSGBuilderService : public EngineService
 
     bool Init() override;
     void Update() override;
+    void Dispose() override;
 };
 
 CSGBuilderService CSGBuilderServiceInstance;
@@ -63,6 +75,7 @@ void CSGBuilderImpl::onSceneUnloading(Scene* scene, const Guid& sceneId)
 {
     // Ensure to remove scene (prevent crashes)
     ScenesToRebuild.Remove(scene);
+    clearCache(scene);
 }
 
 bool CSGBuilderService::Init()
@@ -118,53 +131,207 @@ void Builder::Build(Scene* scene, float timeoutMs)
 
 namespace CSG
 {
-    typedef Dictionary<Actor*, Mesh*> MeshesLookup;
+    struct BrushCache
+    {
+        Brush* Brush;
+        Mode Mode;
+        uint32 Hash;
+        int32 BuildIndex;
+        bool Dirty;
+        Array<Surface> Surfaces;
+        Mesh* Mesh = nullptr;
+
+        ~BrushCache()
+        {
+            SAFE_DELETE(Mesh);
+        }
+    };
+
+    struct SubtreeCache
+    {
+        uint32 Hash = 0;
+        int32 BuildIndex = 0;
+
+        // The combined mesh of the actor subtree (null if empty)
+        Mesh* Result = nullptr;
 
-    bool walkTree(Actor* actor, MeshesArray& meshes, MeshesLookup& cache)
+        // The meshes to combine with the parent subtree mesh (brushes found before any additive brush)
+        Array<Mesh*> ParentOperations;
+
+        ~SubtreeCache()
+        {
+            SAFE_DELETE(Result);
+            ParentOperations.ClearDelete();
+        }
+    };
+
+    struct SceneCache
+    {
+        int32 BuildIndex = 0;
+        Dictionary<Guid, BrushCache*> Brushes;
+        Dictionary<Guid, SubtreeCache*> Subtrees;
+
+        ~SceneCache()
+        {
+            Brushes.ClearDelete();
+            Subtrees.ClearDelete();
+        }
+    };
+
+    // Node of the actors tree that contains any CSG brush
+    struct CombineNode
+    {
+        Actor* Actor;
+        BrushCache* Brush;
+        SubtreeCache* Cache;
+        int32 FirstChild;
+        int32 ChildrenCount;
+        int32 Depth;
+        bool Dirty;
+    };
+
+    struct CombineTree
+    {
+        SceneCache* Cache;
+        Array<CombineNode> Nodes;
+        Array<int32> Children;
+        Array<BrushCache*> DirtyBrushes;
+        Array<Array<int32>> DirtyNodesPerDepth;
+        int32 BrushesCount = 0;
+        bool HasAnyBrush = false;
+    };
+
+    FORCE_INLINE Mesh* CloneMesh(const Mesh* mesh)
+    {
+        return mesh ? New<Mesh>(*mesh) : nullptr;
+    }
+
+    BrushCache* cacheBrush(CombineTree& tree, Brush* brush)
+    {
+        // Skip subtract/common meshes from the beginning (they have no effect)
+        if (!brush->CanUseCSG())
+            return nullptr;
+        const Mode mode = brush->GetBrushMode();
+        if (!tree.HasAnyBrush && mode != Mode::Additive)
+        {
+            LOG(Info, "Skipping CSG brush '{0}'", dynamic_cast<Actor*>(brush)->ToString());
+            return nullptr;
+        }
+        tree.HasAnyBrush = true;
+        tree.BrushesCount++;
+
+        // Brush mesh is keyed by the brush surfaces (world-space planes with the brush transform and dimensions applied) and surface parameters
+        Array<Surface> surfaces;
+        brush->GetSurfaces(surfaces);
+        uint32 hash = Crc::MemCrc32(&mode, sizeof(mode));
+        hash = Crc::MemCrc32(surfaces.Get(), surfaces.Count() * sizeof(Surface), hash);
+
+        const Guid id = brush->GetBrushID();
+        BrushCache* entry;
+        if (!tree.Cache->Brushes.TryGet(id, entry))
+        {
+            entry = New<BrushCache>();
+            tree.Cache->Brushes.Add(id, entry);
+        }
+        else if (entry->Brush == brush && entry->Hash == hash && entry->Mode == mode && entry->Surfaces.Count() == surfaces.Count() && Platform::MemoryCompare(entry->Surfaces.Get(), surfaces.Get(), surfaces.Count() * sizeof(Surface)) == 0)
+        {
+            entry->BuildIndex = tree.Cache->BuildIndex;
+            entry->Dirty = false;
+            return entry;
+        }
+        entry->Brush = brush;
+        entry->Mode = mode;
+        entry->Hash = hash;
+        entry->BuildIndex = tree.Cache->BuildIndex;
+        entry->Dirty = true;
+        entry->Surfaces.Swap(surfaces);
+        tree.DirtyBrushes.Add(entry);
+        return entry;
+    }
+
+    int32 walkTree(CombineTree& tree, Actor* actor, int32 depth, uint32& hash)
     {
         // Check if actor is a brush
-        auto brush = dynamic_cast<Brush*>(actor);
-        if (brush)
+        BrushCache* brush = nullptr;
+        if (auto b = dynamic_cast<Brush*>(actor))
+            brush = cacheBrush(tree, b);
+
+        // Visit children (skip subtrees without brushes)
+        Array<int32, InlinedAllocation<32>> children;
+        uint32 childrenHash = 0;
+        for (int32 i = 0; i < actor->Children.Count(); i++)
         {
-            // Check if can build it
-            if (brush->CanUseCSG())
+            uint32 childHash;
+            const int32 childIndex = walkTree(tree, actor->Children[i], depth + 1, childHash);
+            if (childIndex != INVALID_INDEX)
             {
-                // Skip subtract/common meshes from the beginning (they have no effect)
-                if (meshes.Count() > 0 || brush->GetBrushMode() == Mode::Additive)
-                {
-                    // Create new mesh and build for given brush
-                    auto mesh = New<CSG::Mesh>();
-                    mesh->Build(brush);
-
-                    // Save results
-                    meshes.Add(mesh);
-                    cache.Add(actor, mesh);
-                }
-                else
-                {
-                    // Info
-                    LOG(Info, "Skipping CSG brush '{0}'", actor->ToString());
-                }
+                children.Add(childIndex);
+                childrenHash = Crc::MemCrc32(&childHash, sizeof(childHash), childrenHash);
             }
         }
+        if (!brush && children.IsEmpty())
+            return INVALID_INDEX;
 
-        return true;
+        // Subtree is dirty if any of its brushes or the children layout has changed
+        const Guid id = actor->GetID();
+        hash = Crc::MemCrc32(&id, sizeof(id));
+        if (brush)
+            hash = Crc::MemCrc32(&brush->Hash, sizeof(brush->Hash), hash);
+        hash = Crc::MemCrc32(&childrenHash, sizeof(childrenHash), hash);
+        SubtreeCache* cache;
+        bool dirty = brush && brush->Dirty;
+        if (!tree.Cache->Subtrees.TryGet(id, cache))
+        {
+            cache = New<SubtreeCache>();
+            tree.Cache->Subtrees.Add(id, cache);
+            dirty = true;
+        }
+        dirty |= cache->Hash != hash;
+        for (int32 i = 0; i < children.Count() && !dirty; i++)
+            dirty = tree.Nodes[children[i]].Dirty;
+        cache->Hash = hash;
+        cache->BuildIndex = tree.Cache->BuildIndex;
+
+        const int32 nodeIndex = tree.Nodes.Count();
+        auto& node = tree.Nodes.AddOne();
+        node.Actor = actor;
+        node.Brush = brush;
+        node.Cache = cache;
+        node.FirstChild = tree.Children.Count();
+        node.ChildrenCount = children.Count();
+        node.Depth = depth;
+        node.Dirty = dirty;
+        tree.Children.Add(children.Get(), children.Count());
+        if (dirty)
+        {
+            if (tree.DirtyNodesPerDepth.Count() <= depth)
+                tree.DirtyNodesPerDepth.Resize(depth + 1);
+            tree.DirtyNodesPerDepth[depth].Add(nodeIndex);
+        }
+        return nodeIndex;
     }
 
-    Mesh* Combine(Actor* actor, MeshesLookup& cache, Mesh* combineParent)
+    void Combine(const CombineTree& tree, const CombineNode& node)
     {
-        ASSERT(actor);
+        // Combines the brushes in the same way as the actors tree would be traversed recursively but uses the cached subtrees results (cloned since CSG operations modify both meshes)
+        auto cache = node.Cache;
+        SAFE_DELETE(cache->Result);
+        cache->ParentOperations.ClearDelete();
         Mesh* result = nullptr;
-        Mesh* myBrush = nullptr;
-        cache.TryGet(actor, myBrush);
+        Mesh* myBrush = node.Brush ? CloneMesh(node.Brush->Mesh) : nullptr;
 
         // Get first child mesh with valid data (has additive brush)
         int32 childIndex = 0;
-        while (childIndex < actor->Children.Count())
+        while (childIndex < node.ChildrenCount)
         {
-            auto child = Combine(actor->Children[childIndex], cache, combineParent);
-
+            const SubtreeCache* childCache = tree.Nodes[tree.Children[node.FirstChild + childIndex]].Cache;
             childIndex++;
+
+            // Child operations go to the same parent as this subtree ones
+            for (const Mesh* operation : childCache->ParentOperations)
+                cache->ParentOperations.Add(CloneMesh(operation));
+
+            Mesh* child = CloneMesh(childCache->Result);
             if (child)
             {
                 // If brush was based on additive brush or current actor is a brush we can stop searching
@@ -175,11 +342,8 @@ namespace CSG
                     break;
                 }
 
-                if (combineParent)
-                {
-                    // Combine
-                    combineParent->PerformOperation(child);
-                }
+                // Combine with parent
+                cache->ParentOperations.Add(child);
             }
         }
 
@@ -191,22 +355,28 @@ namespace CSG
             {
                 // Combine with first child
                 myBrush->PerformOperation(result);
+                Delete(result);
 
                 // Set this actor brush as a result
                 result = myBrush;
             }
 
             // Merge with the other children
-            while (childIndex < actor->Children.Count())
+            for (; childIndex < node.ChildrenCount; childIndex++)
             {
-                auto child = Combine(actor->Children[childIndex], cache, result);
-                if (child)
+                const SubtreeCache* childCache = tree.Nodes[tree.Children[node.FirstChild + childIndex]].Cache;
+                for (const Mesh* operation : childCache->ParentOperations)
                 {
-                    // Combine
+                    Mesh* child = CloneMesh(operation);
                     result->PerformOperation(child);
+                    Delete(child);
+                }
+                if (childCache->Result)
+                {
+                    Mesh* child = CloneMesh(childCache->Result);
+                    result->PerformOperation(child);
+                    Delete(child);
                 }
-
-                childIndex++;
             }
         }
         else
@@ -215,53 +385,110 @@ namespace CSG
             result = myBrush;
         }
 
-        return result;
+        cache->Result = result;
     }
 
-    Mesh* Combine(Scene* scene, MeshesLookup& cache)
+    Mesh* Combine(Scene* scene, SceneCache* sceneCache, int32& brushesCount, int32& rebuiltBrushesCount)
     {
 #if CSG_USE_SCENE_LOCKS
 		auto Level = Level::Instance();
 		Level->Lock();
 #endif
 
-        Mesh* result = Combine(scene, cache, nullptr);
+        // Gather the brushes and find the modified subtrees
+        CombineTree tree;
+        tree.Cache = sceneCache;
+        sceneCache->BuildIndex++;
+        uint32 rootHash;
+        const int32 rootIndex = walkTree(tree, scene, 0, rootHash);
+        brushesCount = tree.BrushesCount;
+        rebuiltBrushesCount = tree.DirtyBrushes.Count();
+
+        // Build meshes for the modified brushes
+        Function<void(int32)> buildBrushJob = [&tree](int32 i)
+        {
+            PROFILE_CPU_NAMED("CSG Brush");
+            auto brush = tree.DirtyBrushes[i];
+            if (!brush->Mesh)
+                brush->Mesh = New<Mesh>();
+            brush->Mesh->Build(brush->Brush, brush->Surfaces);
+        };
+        JobSystem::Execute(buildBrushJob, tree.DirtyBrushes.Count());
+
+        // Combine modified subtrees from the deepest ones (subtrees at the same depth are independent)
+        for (int32 depth = tree.DirtyNodesPerDepth.Count() - 1; depth >= 0; depth--)
+        {
+            const auto& nodes = tree.DirtyNodesPerDepth[depth];
+            Function<void(int32)> combineJob = [&tree, &nodes](int32 i)
+            {
+                PROFILE_CPU_NAMED("CSG Combine");
+                Combine(tree, tree.Nodes[nodes[i]]);
+            };
+            JobSystem::Execute(combineJob, nodes.Count());
+        }
 
 #if CSG_USE_SCENE_LOCKS
 		Level->Unlock();
 #endif
 
-        return result;
+        // Remove cached data of the deleted brushes and actors
+        for (auto i = sceneCache->Brushes.Begin(); i.IsNotEnd(); ++i)
+        {
+            if (i->Value->BuildIndex != sceneCache->BuildIndex)
+            {
+                Delete(i->Value);
+                sceneCache->Brushes.Remove(i);
+            }
+        }
+        for (auto i = sceneCache->Subtrees.Begin(); i.IsNotEnd(); ++i)
+        {
+            if (i->Value->BuildIndex != sceneCache->BuildIndex)
+            {
+                Delete(i->Value);
+                sceneCache->Subtrees.Remove(i);
+            }
+        }
+
+        return rootIndex != INVALID_INDEX ? tree.Nodes[rootIndex].Cache->Result : nullptr;
     }
 }
 
+void CSGBuilderImpl::clearCache(Scene* scene)
+{
+    SceneCache* cache;
+    if (ScenesCache.TryGet(scene, cache))
+    {
+        ScenesCache.Remove(scene);
+        Delete(cache);
+    }
+}
+
+void CSGBuilderService::Dispose()
+{
+    ScenesCache.ClearDelete();
+}
+
 struct BuildData
 {
-    MeshesArray meshes;
-    MeshesLookup cache;
+    int32 BrushesCount = 0;
+    int32 RebuiltBrushesCount = 0;
     Guid outputModelAssetId = Guid::Empty;
     Guid outputRawDataAssetId = Guid::Empty;
     Guid outputCollisionDataAssetId = Guid::Empty;
-
-    BuildData(int32 meshesCapacity = 32)
-        : meshes(meshesCapacity * 32)
-        , cache(meshesCapacity * 4)
-    {
-    }
 };
 
 bool CSGBuilderImpl::buildInner(Scene* scene, BuildData& data)
 {
-    // Setup CSG meshes list and build them
+    // Get the cached meshes from the previous build of this scene (only the modified brushes and subtrees are rebuilt)
+    SceneCache* cache;
+    if (!ScenesCache.TryGet(scene, cache))
     {
-        Function<bool(Actor*, MeshesArray&, MeshesLookup&)> treeWalkFunction(walkTree);
-        SceneQuery::TreeExecute<Array<CSG::Mesh*>&, MeshesLookup&>(treeWalkFunction, data.meshes, data.cache);
+        cache = New<SceneCache>();
+        ScenesCache.Add(scene, cache);
     }
-    if (data.meshes.IsEmpty())
-        return false;
 
     // Process all meshes (performs actual CSG opterations on geometry in tree structure)
-    CSG::Mesh* combinedMesh = Combine(scene, data.cache);
+    const CSG::Mesh* combinedMesh = Combine(scene, cache, data.BrushesCount, data.RebuiltBrushesCount);
     if (combinedMesh == nullptr)
         return false;
 
@@ -383,9 +610,8 @@ void CSGBuilderImpl::build(Scene* scene)
     scene->CSGData.PostCSGBuild();
 
     // End
-    data.meshes.ClearDelete();
     auto endTime = DateTime::Now();
-    LOG(Info, "CSG build in {0} ms! {1} brush(es)", (endTime - startTime).GetTotalMilliseconds(), data.meshes.Count());
+    LOG(Info, "CSG build in {0} ms! {1} brush(es), {2} rebuilt", (endTime - startTime).GetTotalMilliseconds(), data.BrushesCount, data.RebuiltBrushesCount);
 }
 
 bool CSGBuilderImpl::generateRawDataAsset(Scene* scene, RawData& meshData, Guid& assetId, const String& assetPath)
@@ -7,6 +7,14 @@
 #include "Engine/Core/Log.h"
 
 void CSG::Mesh::Build(Brush* parentBrush)
+{
+    Array<Surface> surfaces;
+    if (parentBrush)
+        parentBrush->GetSurfaces(surfaces);
+    Build(parentBrush, surfaces);
+}
+
+void CSG::Mesh::Build(Brush* parentBrush, const Array<Surface>& surfaces)
 {
     struct EdgeIntersection
     {
@@ -28,17 +36,17 @@ void CSG::Mesh::Build(Brush* parentBrush)
 
     struct PointIntersection
     {
-        // TODO: optimize this shit?
+        // Most of the brush vertices are shared by 3 planes so use inlined storage to prevent allocations per point
         int32 VertexIndex;
-        Array<EdgeIntersection> Edges;
-        Array<int32> PlaneIndices;
+        Array<EdgeIntersection, InlinedAllocation<8>> Edges;
+        Array<int32, InlinedAllocation<8>> PlaneIndices;
 
         PointIntersection()
         {
             VertexIndex = INVALID_INDEX;
         }
 
-        PointIntersection(int32 vertexIndex, const Array<int32>& planes)
+        PointIntersection(int32 vertexIndex, const Array<int32, InlinedAllocation<8>>& planes)
         {
             VertexIndex = vertexIndex;
             PlaneIndices = planes;
@@ -57,7 +65,7 @@ void CSG::Mesh::Build(Brush* parentBrush)
     if (parentBrush == nullptr)
         return;
     auto mode = parentBrush->GetBrushMode();
-    parentBrush->GetSurfaces(_surfaces);
+    _surfaces = surfaces;
     int32 surfacesCount = _surfaces.Count();
     if (surfacesCount > 250)
     {
@@ -81,18 +89,18 @@ void CSG::Mesh::Build(Brush* parentBrush)
     }
 
     Array<PointIntersection> pointIntersections(surfacesCount * surfacesCount);
-    Array<int32> intersectingPlanes;
+    Array<int32, InlinedAllocation<8>> intersectingPlanes;
 
     // Find all point intersections where 3 (or more planes) intersect
     for (int32 planeIndex1 = 0; planeIndex1 < surfacesCount - 2; planeIndex1++)
     {
-        Surface plane1 = _surfaces[planeIndex1];
+        const Surface& plane1 = _surfaces[planeIndex1];
         for (int32 planeIndex2 = planeIndex1 + 1; planeIndex2 < surfacesCount - 1; planeIndex2++)
         {
-            Surface plane2 = _surfaces[planeIndex2];
+            const Surface& plane2 = _surfaces[planeIndex2];
             for (int32 planeIndex3 = planeIndex2 + 1; planeIndex3 < surfacesCount; planeIndex3++)
             {
-                Surface plane3 = _surfaces[planeIndex3];
+                const Surface& plane3 = _surfaces[planeIndex3];
                 int32 vertexIndex;
 
                 // Calculate the intersection point
@@ -202,6 +210,7 @@ void CSG::Mesh::Build(Brush* parentBrush)
 
     // TODO: snap vertices to remove gaps (snapping facctor can be defined by the parent brush)
 
+    _polygons.EnsureCapacity(surfacesCount);
     for (int32 i = 0; i < surfacesCount; i++)
     {
         Polygon polygon;
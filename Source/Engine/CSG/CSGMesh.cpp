@@ -92,36 +92,32 @@ void CSG::Mesh::Add(const Mesh* other)
     auto oPolygons = other->GetPolygons();
     auto oMeta = &other->_brushesMeta;
 
-    // Clone vertices
-    for (int32 i = 0; i < oVertices->Count(); i++)
-    {
-        _vertices.Add(oVertices->At(i));
-    }
-
-    // Clone surfaces
-    for (int32 i = 0; i < oSurfaces->Count(); i++)
-    {
-        _surfaces.Add(oSurfaces->At(i));
-    }
+    // Clone vertices and surfaces
+    _vertices.Add(oVertices->Get(), oVertices->Count());
+    _surfaces.Add(oSurfaces->Get(), oSurfaces->Count());
 
     // Clone edges
+    _edges.Resize(baseIndexEdges + oEdges->Count());
+    HalfEdge* edges = _edges.Get() + baseIndexEdges;
     for (int32 i = 0; i < oEdges->Count(); i++)
     {
-        HalfEdge edge = oEdges->At(i);
+        HalfEdge& edge = edges[i];
+        edge = oEdges->At(i);
         edge.PolygonIndex += baseIndexPolygons;
         edge.TwinIndex += baseIndexEdges;
         edge.NextIndex += baseIndexEdges;
         edge.VertexIndex += baseIndexVertices;
-        _edges.Add(edge);
     }
 
     // Clone polygons
+    _polygons.Resize(baseIndexPolygons + oPolygons->Count());
+    Polygon* polygons = _polygons.Get() + baseIndexPolygons;
     for (int32 i = 0; i < oPolygons->Count(); i++)
     {
-        Polygon polygon = oPolygons->At(i);
+        Polygon& polygon = polygons[i];
+        polygon = oPolygons->At(i);
         polygon.SurfaceIndex += baseIndexSurfaces;
         polygon.FirstEdgeIndex += baseIndexEdges;
-        _polygons.Add(polygon);
     }
 
     // Clone meta
@@ -115,6 +115,13 @@ namespace CSG
         /// <param name="parentBrush">Parent brush to use</param>
         void Build(Brush* parentBrush);
 
+        /// <summary>
+        /// Build mesh from brush using the given surfaces (eg. cached by the builder)
+        /// </summary>
+        /// <param name="parentBrush">Parent brush to use</param>
+        /// <param name="surfaces">Brush surfaces</param>
+        void Build(Brush* parentBrush, const Array<Surface>& surfaces);
+
         /// <summary>
         /// Triangulate mesh
         /// </summary>
@@ -54,6 +54,7 @@ void MaterialInstance::OnBaseSet()
 
     // Params are valid
     Params._versionHash = baseParams._versionHash;
+    Params.InvalidateBindCache();
     ParamsChanged();
 }
 
@@ -580,6 +580,35 @@ bool Model::Save(bool withMeshDataFromGpu, const StringView& path)
             }
         }
 
+        // Meshes clusters (index buffers are unchanged so clusters stay valid)
+        bool hasClusters = false;
+        for (int32 lodIndex = 0; lodIndex < LODs.Count() && !hasClusters; lodIndex++)
+        {
+            for (const auto& mesh : LODs[lodIndex].Meshes)
+                hasClusters |= mesh.GetClusters().HasItems();
+        }
+        if (hasClusters)
+        {
+            auto clustersChunk = GET_CHUNK(MODEL_CLUSTERS_CHUNK_INDEX);
+            if (clustersChunk == nullptr)
+                return true;
+            MemoryWriteStream clustersStream;
+            clustersStream.WriteInt32(1); // Version
+            clustersStream.WriteByte(LODs.Count());
+            for (int32 lodIndex = 0; lodIndex < LODs.Count(); lodIndex++)
+            {
+                const auto& lod = LODs[lodIndex];
+                clustersStream.WriteUint16(lod.Meshes.Count());
+                for (const auto& mesh : lod.Meshes)
+                {
+                    const auto& clusters = mesh.GetClusters();
+                    clustersStream.WriteInt32(clusters.Count());
+                    clustersStream.WriteBytes(clusters.Get(), clusters.Count() * sizeof(MeshCluster));
+                }
+            }
+            clustersChunk->Data.Copy(clustersStream.GetHandle(), clustersStream.GetPosition());
+        }
+
         // Download SDF data
         if (SDF.Texture)
         {
@@ -965,6 +994,40 @@ Asset::LoadResult Model::load()
         }
     }
 
+    // Load meshes clusters
+    auto clustersChunk = GetChunk(MODEL_CLUSTERS_CHUNK_INDEX);
+    if (clustersChunk && clustersChunk->IsLoaded())
+    {
+        MemoryReadStream clustersStream(clustersChunk->Get(), clustersChunk->Size());
+        int32 version;
+        clustersStream.ReadInt32(&version);
+        switch (version)
+        {
+        case 1:
+        {
+            byte clustersLods;
+            clustersStream.ReadByte(&clustersLods);
+            for (int32 lodIndex = 0; lodIndex < clustersLods; lodIndex++)
+            {
+                uint16 clustersMeshes;
+                clustersStream.ReadUint16(&clustersMeshes);
+                for (int32 meshIndex = 0; meshIndex < clustersMeshes; meshIndex++)
+                {
+                    int32 clustersCount;
+                    clustersStream.ReadInt32(&clustersCount);
+                    const auto clusters = clustersStream.Move<MeshCluster>(clustersCount);
+                    if (lodIndex < LODs.Count() && meshIndex < LODs[lodIndex].Meshes.Count())
+                        LODs[lodIndex].Meshes[meshIndex].SetClusters(ToSpan(clusters, clustersCount));
+                }
+            }
+            break;
+        }
+        default:
+            LOG(Warning, "Unknown clusters data version {0} in {1}", version, ToString());
+            break;
+        }
+    }
+
     // Load SDF
     auto chunk15 = GetChunk(15);
     if (chunk15 && chunk15->IsLoaded() && EnableModelSDF == 1)
@@ -1065,7 +1128,7 @@ bool Model::init(AssetInitData& initData)
 AssetChunksFlag Model::getChunksToPreload() const
 {
     // Note: we don't preload any LODs here because it's done by the Streaming Manager
-    return GET_CHUNK_FLAG(0) | GET_CHUNK_FLAG(15);
+    return GET_CHUNK_FLAG(0) | GET_CHUNK_FLAG(MODEL_CLUSTERS_CHUNK_INDEX) | GET_CHUNK_FLAG(15);
 }
 
 void ModelBase::SetupMaterialSlots(int32 slotsCount)
@@ -14,8 +14,10 @@
 // Chunk 1: LOD0
 // Chunk 2: LOD1
 // ..
+// Chunk 14: Clusters (optional)
 // Chunk 15: SDF
 #define MODEL_LOD_TO_CHUNK_INDEX(lod) (lod + 1)
+#define MODEL_CLUSTERS_CHUNK_INDEX 14
 
 class MeshBase;
 struct RenderContextBatch;
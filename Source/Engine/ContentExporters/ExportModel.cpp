@@ -7,6 +7,7 @@
 #include "Engine/Core/Log.h"
 #include "Engine/Content/Assets/Model.h"
 #include "Engine/Content/Assets/SkinnedModel.h"
+#include "Engine/Graphics/Models/MeshChunkData.h"
 #include "Engine/Serialization/FileWriteStream.h"
 #include "Engine/Serialization/MemoryReadStream.h"
 #include "Engine/Core/DeleteMe.h"
@@ -43,25 +44,15 @@ ExportAssetResult AssetExporters::ExportModel(ExportAssetContext& context)
     {
         auto& mesh = lod.Meshes[meshIndex];
 
-        // #MODEL_DATA_FORMAT_USAGE
-        uint32 vertices;
-        stream.ReadUint32(&vertices);
-        uint32 triangles;
-        stream.ReadUint32(&triangles);
-        uint32 indicesCount = triangles * 3;
-        bool use16BitIndexBuffer = indicesCount <= MAX_uint16;
-        uint32 ibStride = use16BitIndexBuffer ? sizeof(uint16) : sizeof(uint32);
-        if (vertices == 0 || triangles == 0)
+        MeshChunkData data;
+        if (data.Read(stream) || data.Decode())
             return ExportAssetResult::Error;
-        auto vb0 = stream.Move<VB0ElementType>(vertices);
-        auto vb1 = stream.Move<VB1ElementType>(vertices);
-        bool hasColors = stream.ReadBool();
-        VB2ElementType18* vb2 = nullptr;
-        if (hasColors)
-        {
-            vb2 = stream.Move<VB2ElementType18>(vertices);
-        }
-        auto ib = stream.Move<byte>(indicesCount * ibStride);
+        const uint32 vertices = data.Vertices;
+        const uint32 triangles = data.Triangles;
+        const bool use16BitIndexBuffer = data.Use16BitIndexBuffer;
+        const auto vb0 = data.VB0;
+        const auto vb1 = data.VB1;
+        const auto ib = data.IB;
 
         output->WriteText(StringAnsi::Format("# Mesh {0}\n", meshIndex));
 
@@ -208,6 +208,8 @@ CreateAssetResult ImportModelFile::ImportModel(CreateAssetContext& context, Mode
     context.Data.Header.Chunks[0]->Data.Copy(stream.GetHandle(), stream.GetPosition());
 
     // Pack model LODs data
+    const bool compress = options ? options->CompressGeometry : false;
+    const bool quantizePositions = compress && options->QuantizePositions;
     const auto lodCount = modelData.GetLODsCount();
     for (int32 lodIndex = 0; lodIndex < lodCount; lodIndex++)
     {
@@ -217,7 +219,7 @@ CreateAssetResult ImportModelFile::ImportModel(CreateAssetContext& context, Mode
         auto& meshes = modelData.LODs[lodIndex].Meshes;
         for (int32 meshIndex = 0; meshIndex < meshes.Count(); meshIndex++)
         {
-            if (meshes[meshIndex]->Pack2Model(&stream))
+            if (meshes[meshIndex]->Pack2Model(&stream, compress, quantizePositions))
             {
                 LOG(Warning, "Cannot pack mesh.");
                 return CreateAssetResult::Error;
@@ -230,6 +232,23 @@ CreateAssetResult ImportModelFile::ImportModel(CreateAssetContext& context, Mode
         context.Data.Header.Chunks[chunkIndex]->Data.Copy(stream.GetHandle(), stream.GetPosition());
     }
 
+    // Pack meshes clusters (optional)
+    bool hasClusters = false;
+    for (int32 lodIndex = 0; lodIndex < lodCount && !hasClusters; lodIndex++)
+    {
+        for (const MeshData* mesh : modelData.LODs[lodIndex].Meshes)
+            hasClusters |= mesh->Clusters.HasItems();
+    }
+    if (hasClusters)
+    {
+        stream.SetPosition(0);
+        if (modelData.Pack2ModelClusters(&stream))
+            return CreateAssetResult::Error;
+        if (context.AllocateChunk(MODEL_CLUSTERS_CHUNK_INDEX))
+            return CreateAssetResult::CannotAllocateChunk;
+        context.Data.Header.Chunks[MODEL_CLUSTERS_CHUNK_INDEX]->Data.Copy(stream.GetHandle(), stream.GetPosition());
+    }
+
     // Generate SDF
     if (options && options->GenerateSDF)
     {
@@ -3,6 +3,7 @@
 #pragma once
 
 #include "Engine/Core/Config/Settings.h"
+#include "Engine/Engine/Time.h"
 
 /// <summary>
 /// Time and game simulation settings container.
@@ -42,6 +43,24 @@ DECLARE_SCRIPTING_TYPE_MINIMAL(TimeSettings);
     API_FIELD(Attributes="EditorOrder(20), Limit(0.1f, 1000.0f, 0.01f), EditorDisplay(\"General\")")
     float MaxUpdateDeltaTime = 0.1f;
 
+    /// <summary>
+    /// The policy of waiting for the next tick in the engine main loop. Use FixedTick for dedicated servers to keep a stable tick rate without burning a CPU core.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(30), EditorDisplay(\"General\")")
+    FramePacingMode FramePacing = FramePacingMode::LowLatency;
+
+    /// <summary>
+    /// Enables the fixed timestep for the physics simulation. Physics is stepped always by 1/PhysicsFPS using the accumulated frame time and rigid bodies can interpolate their transformation between the steps when drawing. Allows to simulate physics at a lower rate than rendering without stutter.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(40), EditorDisplay(\"Physics\")")
+    bool PhysicsFixedTimestep = false;
+
+    /// <summary>
+    /// The maximum amount of physics steps to catch up with the frame time when using the fixed timestep (the remaining time is dropped).
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(41), Limit(1, 100), EditorDisplay(\"Physics\")")
+    int32 PhysicsMaxSteps = 4;
+
 public:
 
     /// <summary>
@@ -8,6 +8,29 @@
 #include "BoundingBox.h"
 #include "BoundingSphere.h"
 #include "BoundingFrustum.h"
+#include "Engine/Core/SIMD.h"
+#include "Engine/Core/Types/Span.h"
+
+namespace
+{
+    // Loads the component of 4 consecutive items (relative to the origin to keep the precision in large worlds)
+#define LOAD_RELATIVE(items, member, origin) SIMD::Load((float)(items[0].member - (origin)), (float)(items[1].member - (origin)), (float)(items[2].member - (origin)), (float)(items[3].member - (origin)))
+
+    // Clips the ray [tMin; tMax] range by the slab [min; max] (relative to the ray origin)
+    FORCE_INLINE void RayClipSlab(SimdVector4 min, SimdVector4 max, SimdVector4 inverse, SimdVector4& tMin, SimdVector4& tMax)
+    {
+        const SimdVector4 t1 = SIMD::Mul(min, inverse);
+        const SimdVector4 t2 = SIMD::Mul(max, inverse);
+        tMin = SIMD::Max(tMin, SIMD::Min(t1, t2));
+        tMax = SIMD::Min(tMax, SIMD::Max(t1, t2));
+    }
+
+    // Gets the mask of the slabs [min; max] (relative to the ray origin) that don't contain the ray origin
+    FORCE_INLINE int RayOutsideSlab(SimdVector4 min, SimdVector4 max)
+    {
+        return SIMD::MoveMask(SIMD::Min(SIMD::Sub(SIMD::Load(0.0f), min), max));
+    }
+}
 
 void CollisionsHelper::ClosestPointPointLine(const Float2& point, const Float2& p0, const Float2& p1, Float2& result)
 {
@@ -956,6 +979,114 @@ bool CollisionsHelper::RayIntersectsSphere(const Ray& ray, const BoundingSphere&
     return true;
 }
 
+int32 CollisionsHelper::RayIntersectsBoxes(const Ray& ray, const Span<BoundingBox>& boxes, Span<float> distances)
+{
+    ASSERT(distances.Length() >= boxes.Length());
+    const BoundingBox* b = boxes.Get();
+    float* dst = distances.Get();
+    const int32 count = boxes.Length();
+    int32 i = 0, result = 0;
+
+    // Test 4 boxes at once (the same math as RayIntersectsBox but with all boxes relative to the ray origin)
+    const Vector3 origin = ray.Position;
+    const bool parallelX = Math::IsZero(ray.Direction.X);
+    const bool parallelY = Math::IsZero(ray.Direction.Y);
+    const bool parallelZ = Math::IsZero(ray.Direction.Z);
+    const SimdVector4 inverseX = SIMD::Load(parallelX ? 0.0f : 1.0f / (float)ray.Direction.X);
+    const SimdVector4 inverseY = SIMD::Load(parallelY ? 0.0f : 1.0f / (float)ray.Direction.Y);
+    const SimdVector4 inverseZ = SIMD::Load(parallelZ ? 0.0f : 1.0f / (float)ray.Direction.Z);
+    float tMinValues[4];
+    for (; i + 4 <= count; i += 4)
+    {
+        const BoundingBox* items = b + i;
+        SimdVector4 tMin = SIMD::Load(0.0f);
+        SimdVector4 tMax = SIMD::Load(MAX_float);
+        int outside = 0;
+#define CLIP_AXIS(axis) \
+        { \
+            const SimdVector4 min = LOAD_RELATIVE(items, Minimum.axis, origin.axis); \
+            const SimdVector4 max = LOAD_RELATIVE(items, Maximum.axis, origin.axis); \
+            if (parallel##axis) \
+                outside |= RayOutsideSlab(min, max); \
+            else \
+                RayClipSlab(min, max, inverse##axis, tMin, tMax); \
+        }
+        CLIP_AXIS(X);
+        CLIP_AXIS(Y);
+        CLIP_AXIS(Z);
+#undef CLIP_AXIS
+        outside |= SIMD::MoveMask(SIMD::Sub(tMax, tMin));
+        SIMD::StoreUnaligned(tMinValues, tMin);
+        for (int32 j = 0; j < 4; j++)
+        {
+            const bool hit = (outside & (1 << j)) == 0;
+            dst[i + j] = hit ? tMinValues[j] : MAX_float;
+            result += hit ? 1 : 0;
+        }
+    }
+
+    // Test the remaining boxes
+    for (; i < count; i++)
+    {
+        Real distance;
+        const bool hit = RayIntersectsBox(ray, b[i], distance);
+        dst[i] = hit ? (float)distance : MAX_float;
+        result += hit ? 1 : 0;
+    }
+
+    return result;
+}
+
+int32 CollisionsHelper::RayIntersectsSpheres(const Ray& ray, const Span<BoundingSphere>& spheres, Span<float> distances)
+{
+    ASSERT(distances.Length() >= spheres.Length());
+    const BoundingSphere* s = spheres.Get();
+    float* dst = distances.Get();
+    const int32 count = spheres.Length();
+    int32 i = 0, result = 0;
+
+    // Test 4 spheres at once (the same math as RayIntersectsSphere but with all spheres relative to the ray origin)
+    const Vector3 origin = ray.Position;
+    const SimdVector4 zero = SIMD::Load(0.0f);
+    const SimdVector4 directionX = SIMD::Load((float)ray.Direction.X);
+    const SimdVector4 directionY = SIMD::Load((float)ray.Direction.Y);
+    const SimdVector4 directionZ = SIMD::Load((float)ray.Direction.Z);
+    float distanceValues[4];
+    for (; i + 4 <= count; i += 4)
+    {
+        const BoundingSphere* items = s + i;
+        const SimdVector4 mX = SIMD::Sub(zero, LOAD_RELATIVE(items, Center.X, origin.X));
+        const SimdVector4 mY = SIMD::Sub(zero, LOAD_RELATIVE(items, Center.Y, origin.Y));
+        const SimdVector4 mZ = SIMD::Sub(zero, LOAD_RELATIVE(items, Center.Z, origin.Z));
+        const SimdVector4 radius = SIMD::Load((float)items[0].Radius, (float)items[1].Radius, (float)items[2].Radius, (float)items[3].Radius);
+        const SimdVector4 b = SIMD::Add(SIMD::Add(SIMD::Mul(mX, directionX), SIMD::Mul(mY, directionY)), SIMD::Mul(mZ, directionZ));
+        const SimdVector4 c = SIMD::Sub(SIMD::Add(SIMD::Add(SIMD::Mul(mX, mX), SIMD::Mul(mY, mY)), SIMD::Mul(mZ, mZ)), SIMD::Mul(radius, radius));
+        const SimdVector4 discriminant = SIMD::Sub(SIMD::Mul(b, b), c);
+
+        // Ray origin outside the sphere and pointing away from it (c > 0 && b > 0) or ray missing the sphere (discriminant < 0)
+        const int outside = SIMD::MoveMask(SIMD::Sub(zero, SIMD::Min(c, b))) | SIMD::MoveMask(discriminant);
+        const SimdVector4 distance = SIMD::Max(SIMD::Sub(SIMD::Sub(zero, b), SIMD::Sqrt(SIMD::Max(discriminant, zero))), zero);
+        SIMD::StoreUnaligned(distanceValues, distance);
+        for (int32 j = 0; j < 4; j++)
+        {
+            const bool hit = (outside & (1 << j)) == 0;
+            dst[i + j] = hit ? distanceValues[j] : MAX_float;
+            result += hit ? 1 : 0;
+        }
+    }
+
+    // Test the remaining spheres
+    for (; i < count; i++)
+    {
+        Real distance;
+        const bool hit = RayIntersectsSphere(ray, s[i], distance);
+        dst[i] = hit ? (float)distance : MAX_float;
+        result += hit ? 1 : 0;
+    }
+
+    return result;
+}
+
 PlaneIntersectionType CollisionsHelper::PlaneIntersectsPoint(const Plane& plane, const Vector3& point)
 {
     const Real distance = Vector3::Dot(plane.Normal, point) + plane.D;
@@ -1289,6 +1420,103 @@ ContainmentType CollisionsHelper::FrustumContainsBox(const BoundingFrustum& frus
     return result;
 }
 
+int32 CollisionsHelper::FrustumIntersectsSpheres(const BoundingFrustum& frustum, const Span<BoundingSphere>& spheres, Span<bool> results)
+{
+    ASSERT(results.Length() >= spheres.Length());
+    const BoundingSphere* s = spheres.Get();
+    bool* dst = results.Get();
+    const int32 count = spheres.Length();
+    int32 i = 0, result = 0;
+
+    // Test 4 spheres at once against each plane (the same math as BoundingFrustum::Intersects but with spheres relative to the first one in the group)
+    SimdVector4 normalsX[6], normalsY[6], normalsZ[6];
+    for (int32 planeIndex = 0; planeIndex < 6; planeIndex++)
+    {
+        const Plane& plane = frustum._planes[planeIndex];
+        normalsX[planeIndex] = SIMD::Load((float)plane.Normal.X);
+        normalsY[planeIndex] = SIMD::Load((float)plane.Normal.Y);
+        normalsZ[planeIndex] = SIMD::Load((float)plane.Normal.Z);
+    }
+    for (; i + 4 <= count; i += 4)
+    {
+        const BoundingSphere* items = s + i;
+        const Vector3 origin = items[0].Center;
+        const SimdVector4 centerX = LOAD_RELATIVE(items, Center.X, origin.X);
+        const SimdVector4 centerY = LOAD_RELATIVE(items, Center.Y, origin.Y);
+        const SimdVector4 centerZ = LOAD_RELATIVE(items, Center.Z, origin.Z);
+        const SimdVector4 radius = SIMD::Load((float)items[0].Radius, (float)items[1].Radius, (float)items[2].Radius, (float)items[3].Radius);
+        int outside = 0;
+        for (int32 planeIndex = 0; planeIndex < 6; planeIndex++)
+        {
+            const Plane& plane = frustum._planes[planeIndex];
+            const SimdVector4 d = SIMD::Load((float)(Vector3::Dot(plane.Normal, origin) + plane.D));
+            const SimdVector4 distance = SIMD::Add(SIMD::Add(SIMD::Add(SIMD::Mul(normalsX[planeIndex], centerX), SIMD::Mul(normalsY[planeIndex], centerY)), SIMD::Mul(normalsZ[planeIndex], centerZ)), d);
+            outside |= SIMD::MoveMask(SIMD::Add(distance, radius));
+        }
+        for (int32 j = 0; j < 4; j++)
+        {
+            const bool hit = (outside & (1 << j)) == 0;
+            dst[i + j] = hit;
+            result += hit ? 1 : 0;
+        }
+    }
+
+    // Test the remaining spheres
+    for (; i < count; i++)
+    {
+        const bool hit = frustum.Intersects(s[i]);
+        dst[i] = hit;
+        result += hit ? 1 : 0;
+    }
+
+    return result;
+}
+
+int32 CollisionsHelper::FrustumsContainPoint(const Span<BoundingFrustum>& frustums, const Vector3& point, Span<bool> results)
+{
+    ASSERT(results.Length() >= frustums.Length());
+    const BoundingFrustum* f = frustums.Get();
+    bool* dst = results.Get();
+    const int32 count = frustums.Length();
+    int32 i = 0, result = 0;
+
+#if !USE_LARGE_WORLDS
+    // Test 4 frustums at once against the point (the same math as BoundingFrustum::Contains)
+    const SimdVector4 pointX = SIMD::Load(point.X);
+    const SimdVector4 pointY = SIMD::Load(point.Y);
+    const SimdVector4 pointZ = SIMD::Load(point.Z);
+    const SimdVector4 epsilon = SIMD::Load(Plane::DistanceEpsilon);
+    for (; i + 4 <= count; i += 4)
+    {
+        const BoundingFrustum* items = f + i;
+        int outside = 0;
+        for (int32 planeIndex = 0; planeIndex < 6; planeIndex++)
+        {
+#define LOAD_PLANE(member) SIMD::Load(items[0]._planes[planeIndex].member, items[1]._planes[planeIndex].member, items[2]._planes[planeIndex].member, items[3]._planes[planeIndex].member)
+            const SimdVector4 distance = SIMD::Add(SIMD::Add(SIMD::Add(SIMD::Mul(LOAD_PLANE(Normal.X), pointX), SIMD::Mul(LOAD_PLANE(Normal.Y), pointY)), SIMD::Mul(LOAD_PLANE(Normal.Z), pointZ)), LOAD_PLANE(D));
+#undef LOAD_PLANE
+            outside |= SIMD::MoveMask(SIMD::Sub(distance, epsilon));
+        }
+        for (int32 j = 0; j < 4; j++)
+        {
+            const bool hit = (outside & (1 << j)) == 0;
+            dst[i + j] = hit;
+            result += hit ? 1 : 0;
+        }
+    }
+#endif
+
+    // Test the remaining frustums (planes distances in large worlds need the double precision)
+    for (; i < count; i++)
+    {
+        const bool hit = f[i].Contains(point) != ContainmentType::Disjoint;
+        dst[i] = hit;
+        result += hit ? 1 : 0;
+    }
+
+    return result;
+}
+
 bool CollisionsHelper::LineIntersectsLine(const Float2& l1p1, const Float2& l1p2, const Float2& l2p1, const Float2& l2p2)
 {
     float q = (l1p1.Y - l2p1.Y) * (l2p2.X - l2p1.X) - (l1p1.X - l2p1.X) * (l2p2.Y - l2p1.Y);
@@ -387,6 +387,24 @@ class FLAXENGINE_API CollisionsHelper
     /// <returns>Whether the two objects intersected.</returns>
     static bool RayIntersectsSphere(const Ray& ray, const BoundingSphere& sphere, Vector3& point);
 
+    /// <summary>
+    /// Determines whether there is an intersection between a <see cref="Ray" /> and the list of <see cref="BoundingBox" /> (batched version of RayIntersectsBox that tests multiple boxes at once).
+    /// </summary>
+    /// <param name="ray">The ray to test.</param>
+    /// <param name="boxes">The boxes to test.</param>
+    /// <param name="distances">The output distances of the intersection for each box, or MAX_float if there was no intersection. Must be at least as big as the boxes list.</param>
+    /// <returns>The amount of boxes intersected by the ray.</returns>
+    static int32 RayIntersectsBoxes(const Ray& ray, const Span<BoundingBox>& boxes, Span<float> distances);
+
+    /// <summary>
+    /// Determines whether there is an intersection between a <see cref="Ray" /> and the list of <see cref="BoundingSphere" /> (batched version of RayIntersectsSphere that tests multiple spheres at once).
+    /// </summary>
+    /// <param name="ray">The ray to test.</param>
+    /// <param name="spheres">The spheres to test.</param>
+    /// <param name="distances">The output distances of the intersection for each sphere, or MAX_float if there was no intersection. Must be at least as big as the spheres list.</param>
+    /// <returns>The amount of spheres intersected by the ray.</returns>
+    static int32 RayIntersectsSpheres(const Ray& ray, const Span<BoundingSphere>& spheres, Span<float> distances);
+
     /// <summary>
     /// Determines whether there is an intersection between a <see cref="Plane" /> and a point.
     /// </summary>
@@ -541,6 +559,24 @@ class FLAXENGINE_API CollisionsHelper
 
     static ContainmentType FrustumContainsBox(const BoundingFrustum& frustum, const BoundingBox& box);
 
+    /// <summary>
+    /// Determines whether a <see cref="BoundingFrustum" /> intersects with the list of <see cref="BoundingSphere" /> (tests each sphere against the frustum planes, multiple spheres at once).
+    /// </summary>
+    /// <param name="frustum">The frustum to test.</param>
+    /// <param name="spheres">The spheres to test.</param>
+    /// <param name="results">The output results for each sphere (true if intersects with the frustum). Must be at least as big as the spheres list.</param>
+    /// <returns>The amount of spheres intersecting with the frustum.</returns>
+    static int32 FrustumIntersectsSpheres(const BoundingFrustum& frustum, const Span<BoundingSphere>& spheres, Span<bool> results);
+
+    /// <summary>
+    /// Determines whether the list of <see cref="BoundingFrustum" /> contain a point (tests multiple frustums at once).
+    /// </summary>
+    /// <param name="frustums">The frustums to test.</param>
+    /// <param name="point">The point to test.</param>
+    /// <param name="results">The output results for each frustum (true if contains or intersects with the point). Must be at least as big as the frustums list.</param>
+    /// <returns>The amount of frustums containing the point.</returns>
+    static int32 FrustumsContainPoint(const Span<BoundingFrustum>& frustums, const Vector3& point, Span<bool> results);
+
     /// <summary>
     /// Determines whether a line intersects with the other line.
     /// </summary>
@@ -5,6 +5,8 @@
 #include "Vector2.h"
 #include "Quaternion.h"
 #include "Transform.h"
+#include "../SIMD.h"
+#include "../Types/Span.h"
 #include "../Types/String.h"
 
 static_assert(sizeof(Matrix) == 4 * 4 * 4, "Invalid Matrix type size.");
@@ -189,6 +191,169 @@ void Matrix::Transpose(const Matrix& value, Matrix& result)
     result = temp;
 }
 
+#if USE_SIMD
+
+namespace
+{
+    FORCE_INLINE void MultiplyRows(const Matrix& left, SimdVector4 r0, SimdVector4 r1, SimdVector4 r2, SimdVector4 r3, Matrix& result)
+    {
+        // Load left matrix before storing the result (the same matrix can be used)
+        SimdVector4 rows[4];
+        for (int32 i = 0; i < 4; i++)
+        {
+            const float* row = left.Values[i];
+            // Note: keep the same order of the operations as the scalar code for the bit-exact results
+            rows[i] = SIMD::Add(SIMD::Add(SIMD::Add(SIMD::Mul(SIMD::Splat(row[0]), r0), SIMD::Mul(SIMD::Splat(row[1]), r1)), SIMD::Mul(SIMD::Splat(row[2]), r2)), SIMD::Mul(SIMD::Splat(row[3]), r3));
+        }
+        for (int32 i = 0; i < 4; i++)
+            SIMD::StoreUnaligned(result.Values[i], rows[i]);
+    }
+
+    // 2x2 matrix (row-major in XYZW) multiply: a * b
+    FORCE_INLINE SimdVector4 Mat2Mul(SimdVector4 a, SimdVector4 b)
+    {
+        return SIMD::Add(SIMD::Mul(a, SIMD::Shuffle<0, 3, 0, 3>(b, b)), SIMD::Mul(SIMD::Shuffle<1, 0, 3, 2>(a, a), SIMD::Shuffle<2, 1, 2, 1>(b, b)));
+    }
+
+    // 2x2 matrix adjugate multiply: adj(a) * b
+    FORCE_INLINE SimdVector4 Mat2AdjMul(SimdVector4 a, SimdVector4 b)
+    {
+        return SIMD::Sub(SIMD::Mul(SIMD::Shuffle<3, 3, 0, 0>(a, a), b), SIMD::Mul(SIMD::Shuffle<1, 1, 2, 2>(a, a), SIMD::Shuffle<2, 3, 0, 1>(b, b)));
+    }
+
+    // 2x2 matrix multiply adjugate: a * adj(b)
+    FORCE_INLINE SimdVector4 Mat2MulAdj(SimdVector4 a, SimdVector4 b)
+    {
+        return SIMD::Sub(SIMD::Mul(a, SIMD::Shuffle<3, 0, 3, 0>(b, b)), SIMD::Mul(SIMD::Shuffle<1, 0, 3, 2>(a, a), SIMD::Shuffle<2, 1, 2, 1>(b, b)));
+    }
+}
+
+void Matrix::Multiply(const Matrix& left, const Matrix& right, Matrix& result)
+{
+    MultiplyRows(left, SIMD::LoadUnaligned(right.Values[0]), SIMD::LoadUnaligned(right.Values[1]), SIMD::LoadUnaligned(right.Values[2]), SIMD::LoadUnaligned(right.Values[3]), result);
+}
+
+void Matrix::Multiply(const Span<Matrix>& left, const Matrix& right, Span<Matrix> result)
+{
+    ASSERT(result.Length() >= left.Length());
+    const SimdVector4 r0 = SIMD::LoadUnaligned(right.Values[0]);
+    const SimdVector4 r1 = SIMD::LoadUnaligned(right.Values[1]);
+    const SimdVector4 r2 = SIMD::LoadUnaligned(right.Values[2]);
+    const SimdVector4 r3 = SIMD::LoadUnaligned(right.Values[3]);
+    const Matrix* src = left.Get();
+    Matrix* dst = result.Get();
+    for (int32 i = 0; i < left.Length(); i++)
+        MultiplyRows(src[i], r0, r1, r2, r3, dst[i]);
+}
+
+void Matrix::Invert(const Matrix& value, Matrix& result)
+{
+    // Block-wise inversion with 2x2 sub-matrices (A B / C D)
+    const SimdVector4 m0 = SIMD::LoadUnaligned(value.Values[0]);
+    const SimdVector4 m1 = SIMD::LoadUnaligned(value.Values[1]);
+    const SimdVector4 m2 = SIMD::LoadUnaligned(value.Values[2]);
+    const SimdVector4 m3 = SIMD::LoadUnaligned(value.Values[3]);
+    const SimdVector4 a = SIMD::Shuffle<0, 1, 0, 1>(m0, m1);
+    const SimdVector4 b = SIMD::Shuffle<2, 3, 2, 3>(m0, m1);
+    const SimdVector4 c = SIMD::Shuffle<0, 1, 0, 1>(m2, m3);
+    const SimdVector4 d = SIMD::Shuffle<2, 3, 2, 3>(m2, m3);
+
+    // Determinants of the sub-matrices (|A| |B| |C| |D|)
+    const SimdVector4 detSub = SIMD::Sub(
+        SIMD::Mul(SIMD::Shuffle<0, 2, 0, 2>(m0, m2), SIMD::Shuffle<1, 3, 1, 3>(m1, m3)),
+        SIMD::Mul(SIMD::Shuffle<1, 3, 1, 3>(m0, m2), SIMD::Shuffle<0, 2, 0, 2>(m1, m3)));
+    const SimdVector4 detA = SIMD::Shuffle<0, 0, 0, 0>(detSub, detSub);
+    const SimdVector4 detB = SIMD::Shuffle<1, 1, 1, 1>(detSub, detSub);
+    const SimdVector4 detC = SIMD::Shuffle<2, 2, 2, 2>(detSub, detSub);
+    const SimdVector4 detD = SIMD::Shuffle<3, 3, 3, 3>(detSub, detSub);
+
+    // Adjugates of the result blocks (X Y / Z W)
+    const SimdVector4 dc = Mat2AdjMul(d, c);
+    const SimdVector4 ab = Mat2AdjMul(a, b);
+    SimdVector4 x = SIMD::Sub(SIMD::Mul(detD, a), Mat2Mul(b, dc));
+    SimdVector4 w = SIMD::Sub(SIMD::Mul(detA, d), Mat2Mul(c, ab));
+    SimdVector4 y = SIMD::Sub(SIMD::Mul(detB, c), Mat2MulAdj(d, ab));
+    SimdVector4 z = SIMD::Sub(SIMD::Mul(detC, b), Mat2MulAdj(a, dc));
+
+    // |M| = |A|*|D| + |B|*|C| - tr(adj(A)*B*adj(D)*C)
+    SimdVector4 tr = SIMD::Mul(ab, SIMD::Shuffle<0, 2, 1, 3>(dc, dc));
+    tr = SIMD::Add(tr, SIMD::Shuffle<2, 3, 0, 1>(tr, tr));
+    tr = SIMD::Add(tr, SIMD::Shuffle<1, 0, 3, 2>(tr, tr));
+    const SimdVector4 det = SIMD::Sub(SIMD::Add(SIMD::Mul(detA, detD), SIMD::Mul(detB, detC)), tr);
+    if (Math::Abs(SIMD::GetX(det)) <= 1e-12f)
+    {
+        result = Zero;
+        return;
+    }
+    const SimdVector4 invDet = SIMD::Div(SIMD::Load(1.0f, -1.0f, -1.0f, 1.0f), det);
+    x = SIMD::Mul(x, invDet);
+    y = SIMD::Mul(y, invDet);
+    z = SIMD::Mul(z, invDet);
+    w = SIMD::Mul(w, invDet);
+
+    // Apply adjugate and store
+    SIMD::StoreUnaligned(result.Values[0], SIMD::Shuffle<3, 1, 3, 1>(x, y));
+    SIMD::StoreUnaligned(result.Values[1], SIMD::Shuffle<2, 0, 2, 0>(x, y));
+    SIMD::StoreUnaligned(result.Values[2], SIMD::Shuffle<3, 1, 3, 1>(z, w));
+    SIMD::StoreUnaligned(result.Values[3], SIMD::Shuffle<2, 0, 2, 0>(z, w));
+}
+
+void Matrix::TransformPoints(const Span<Float3>& points, const Matrix& transform, Span<Float3> result)
+{
+    ASSERT(result.Length() >= points.Length());
+    const SimdVector4 r0 = SIMD::LoadUnaligned(transform.Values[0]);
+    const SimdVector4 r1 = SIMD::LoadUnaligned(transform.Values[1]);
+    const SimdVector4 r2 = SIMD::LoadUnaligned(transform.Values[2]);
+    const SimdVector4 r3 = SIMD::LoadUnaligned(transform.Values[3]);
+    const Float3* src = points.Get();
+    Float3* dst = result.Get();
+    const int32 count = points.Length();
+    if (count == 0)
+        return;
+    Float3 p = src[0];
+    for (int32 i = 0; i < count - 1; i++)
+    {
+        // Store 4 components to save on the shuffles (the overlapping W is overwritten by the next point, read it before for in-place transform)
+        const Float3 next = src[i + 1];
+        const SimdVector4 v = SIMD::Add(SIMD::Add(SIMD::Add(SIMD::Mul(SIMD::Splat(p.X), r0), SIMD::Mul(SIMD::Splat(p.Y), r1)), SIMD::Mul(SIMD::Splat(p.Z), r2)), r3);
+        SIMD::StoreUnaligned(dst + i, v);
+        p = next;
+    }
+    Float3::Transform(p, transform, dst[count - 1]);
+}
+
+#else
+
+void Matrix::Multiply(const Matrix& left, const Matrix& right, Matrix& result)
+{
+    result.M11 = left.M11 * right.M11 + left.M12 * right.M21 + left.M13 * right.M31 + left.M14 * right.M41;
+    result.M12 = left.M11 * right.M12 + left.M12 * right.M22 + left.M13 * right.M32 + left.M14 * right.M42;
+    result.M13 = left.M11 * right.M13 + left.M12 * right.M23 + left.M13 * right.M33 + left.M14 * right.M43;
+    result.M14 = left.M11 * right.M14 + left.M12 * right.M24 + left.M13 * right.M34 + left.M14 * right.M44;
+    result.M21 = left.M21 * right.M11 + left.M22 * right.M21 + left.M23 * right.M31 + left.M24 * right.M41;
+    result.M22 = left.M21 * right.M12 + left.M22 * right.M22 + left.M23 * right.M32 + left.M24 * right.M42;
+    result.M23 = left.M21 * right.M13 + left.M22 * right.M23 + left.M23 * right.M33 + left.M24 * right.M43;
+    result.M24 = left.M21 * right.M14 + left.M22 * right.M24 + left.M23 * right.M34 + left.M24 * right.M44;
+    result.M31 = left.M31 * right.M11 + left.M32 * right.M21 + left.M33 * right.M31 + left.M34 * right.M41;
+    result.M32 = left.M31 * right.M12 + left.M32 * right.M22 + left.M33 * right.M32 + left.M34 * right.M42;
+    result.M33 = left.M31 * right.M13 + left.M32 * right.M23 + left.M33 * right.M33 + left.M34 * right.M43;
+    result.M34 = left.M31 * right.M14 + left.M32 * right.M24 + left.M33 * right.M34 + left.M34 * right.M44;
+    result.M41 = left.M41 * right.M11 + left.M42 * right.M21 + left.M43 * right.M31 + left.M44 * right.M41;
+    result.M42 = left.M41 * right.M12 + left.M42 * right.M22 + left.M43 * right.M32 + left.M44 * right.M42;
+    result.M43 = left.M41 * right.M13 + left.M42 * right.M23 + left.M43 * right.M33 + left.M44 * right.M43;
+    result.M44 = left.M41 * right.M14 + left.M42 * right.M24 + left.M43 * right.M34 + left.M44 * right.M44;
+}
+
+void Matrix::Multiply(const Span<Matrix>& left, const Matrix& right, Span<Matrix> result)
+{
+    ASSERT(result.Length() >= left.Length());
+    for (int32 i = 0; i < left.Length(); i++)
+    {
+        const Matrix tmp = left.Get()[i];
+        Multiply(tmp, right, result.Get()[i]);
+    }
+}
+
 void Matrix::Invert(const Matrix& value, Matrix& result)
 {
     const float b0 = value.M31 * value.M42 - value.M32 * value.M41;
@@ -252,6 +417,15 @@ void Matrix::Invert(const Matrix& value, Matrix& result)
     result.M44 = +d44 * det;
 }
 
+void Matrix::TransformPoints(const Span<Float3>& points, const Matrix& transform, Span<Float3> result)
+{
+    ASSERT(result.Length() >= points.Length());
+    for (int32 i = 0; i < points.Length(); i++)
+        Float3::Transform(points.Get()[i], transform, result.Get()[i]);
+}
+
+#endif
+
 void Matrix::Billboard(const Float3& objectPosition, const Float3& cameraPosition, const Float3& cameraUpFloat, const Float3& cameraForwardFloat, Matrix& result)
 {
     Float3 crossed;
@@ -630,25 +630,13 @@ API_STRUCT() struct FLAXENGINE_API Matrix
     // @param left The first matrix to multiply.
     // @param right The second matrix to multiply.
     // @param result The product of the two matrices.
-    static void Multiply(const Matrix& left, const Matrix& right, Matrix& result)
-    {
-        result.M11 = left.M11 * right.M11 + left.M12 * right.M21 + left.M13 * right.M31 + left.M14 * right.M41;
-        result.M12 = left.M11 * right.M12 + left.M12 * right.M22 + left.M13 * right.M32 + left.M14 * right.M42;
-        result.M13 = left.M11 * right.M13 + left.M12 * right.M23 + left.M13 * right.M33 + left.M14 * right.M43;
-        result.M14 = left.M11 * right.M14 + left.M12 * right.M24 + left.M13 * right.M34 + left.M14 * right.M44;
-        result.M21 = left.M21 * right.M11 + left.M22 * right.M21 + left.M23 * right.M31 + left.M24 * right.M41;
-        result.M22 = left.M21 * right.M12 + left.M22 * right.M22 + left.M23 * right.M32 + left.M24 * right.M42;
-        result.M23 = left.M21 * right.M13 + left.M22 * right.M23 + left.M23 * right.M33 + left.M24 * right.M43;
-        result.M24 = left.M21 * right.M14 + left.M22 * right.M24 + left.M23 * right.M34 + left.M24 * right.M44;
-        result.M31 = left.M31 * right.M11 + left.M32 * right.M21 + left.M33 * right.M31 + left.M34 * right.M41;
-        result.M32 = left.M31 * right.M12 + left.M32 * right.M22 + left.M33 * right.M32 + left.M34 * right.M42;
-        result.M33 = left.M31 * right.M13 + left.M32 * right.M23 + left.M33 * right.M33 + left.M34 * right.M43;
-        result.M34 = left.M31 * right.M14 + left.M32 * right.M24 + left.M33 * right.M34 + left.M34 * right.M44;
-        result.M41 = left.M41 * right.M11 + left.M42 * right.M21 + left.M43 * right.M31 + left.M44 * right.M41;
-        result.M42 = left.M41 * right.M12 + left.M42 * right.M22 + left.M43 * right.M32 + left.M44 * right.M42;
-        result.M43 = left.M41 * right.M13 + left.M42 * right.M23 + left.M43 * right.M33 + left.M44 * right.M43;
-        result.M44 = left.M41 * right.M14 + left.M42 * right.M24 + left.M43 * right.M34 + left.M44 * right.M44;
-    }
+    static void Multiply(const Matrix& left, const Matrix& right, Matrix& result);
+
+    // Calculates the products of the matrices with the same matrix (result[i] = left[i] * right).
+    // @param left The matrices to multiply.
+    // @param right The second matrix to multiply.
+    // @param result The products of the matrices. Has to be at least the size of left, can point to the same memory.
+    static void Multiply(const Span<Matrix>& left, const Matrix& right, Span<Matrix> result);
 
     // Scales a matrix by the given value.
     // @param left The matrix to scale.
@@ -789,6 +777,14 @@ API_STRUCT() struct FLAXENGINE_API Matrix
     /// <param name="result">When the method completes, contains the inverse of the specified matrix.</param>
     static void Invert(const Matrix& value, Matrix& result);
 
+    /// <summary>
+    /// Transforms the points by the matrix (the same as Float3::Transform for each point).
+    /// </summary>
+    /// <param name="points">The points to transform.</param>
+    /// <param name="transform">The transformation matrix.</param>
+    /// <param name="result">The transformed points. Has to be at least the size of points, can point to the same memory.</param>
+    static void TransformPoints(const Span<Float3>& points, const Matrix& transform, Span<Float3> result);
+
     // Creates a left-handed spherical billboard that rotates around a specified object position.
     // @param objectPosition The position of the object around which the billboard will rotate.
     // @param cameraPosition The position of the camera.
@@ -6,12 +6,38 @@
 #include "Matrix.h"
 #include "Matrix3x3.h"
 #include "Math.h"
+#include "../SIMD.h"
+#include "../Types/Span.h"
 #include "../Types/String.h"
 
 Quaternion Quaternion::Zero(0, 0, 0, 0);
 Quaternion Quaternion::One(1, 1, 1, 1);
 Quaternion Quaternion::Identity(0, 0, 0, 1);
 
+#if USE_SIMD
+
+namespace
+{
+    FORCE_INLINE SimdVector4 MultiplyQuaternions(SimdVector4 l, SimdVector4 r)
+    {
+        const SimdVector4 t0 = SIMD::Mul(SIMD::Shuffle<3, 3, 3, 3>(l, l), r);
+        const SimdVector4 t1 = SIMD::Mul(SIMD::Mul(SIMD::Shuffle<0, 0, 0, 0>(l, l), SIMD::Shuffle<3, 2, 1, 0>(r, r)), SIMD::Load(1.0f, -1.0f, 1.0f, -1.0f));
+        const SimdVector4 t2 = SIMD::Mul(SIMD::Mul(SIMD::Shuffle<1, 1, 1, 1>(l, l), SIMD::Shuffle<2, 3, 0, 1>(r, r)), SIMD::Load(1.0f, 1.0f, -1.0f, -1.0f));
+        const SimdVector4 t3 = SIMD::Mul(SIMD::Mul(SIMD::Shuffle<2, 2, 2, 2>(l, l), SIMD::Shuffle<1, 0, 3, 2>(r, r)), SIMD::Load(-1.0f, 1.0f, 1.0f, -1.0f));
+        return SIMD::Add(SIMD::Add(t0, t1), SIMD::Add(t2, t3));
+    }
+
+    FORCE_INLINE float Dot(SimdVector4 a, SimdVector4 b)
+    {
+        SimdVector4 dot = SIMD::Mul(a, b);
+        dot = SIMD::Add(dot, SIMD::Shuffle<2, 3, 0, 1>(dot, dot));
+        dot = SIMD::Add(dot, SIMD::Shuffle<1, 0, 3, 2>(dot, dot));
+        return SIMD::GetX(dot);
+    }
+}
+
+#endif
+
 Quaternion::Quaternion(const Float4& value)
     : X(value.X)
     , Y(value.Y)
@@ -84,6 +110,9 @@ Float3 Quaternion::GetEuler() const
 
 void Quaternion::Multiply(const Quaternion& other)
 {
+#if USE_SIMD
+    SIMD::StoreUnaligned(Raw, MultiplyQuaternions(SIMD::LoadUnaligned(Raw), SIMD::LoadUnaligned(other.Raw)));
+#else
     const float a = Y * other.Z - Z * other.Y;
     const float b = Z * other.X - X * other.Z;
     const float c = X * other.Y - Y * other.X;
@@ -92,6 +121,7 @@ void Quaternion::Multiply(const Quaternion& other)
     Y = Y * other.W + other.Y * W + b;
     Z = Z * other.W + other.Z * W + c;
     W = W * other.W - d;
+#endif
 }
 
 Float3 Quaternion::operator*(const Float3& vector) const
@@ -101,6 +131,9 @@ Float3 Quaternion::operator*(const Float3& vector) const
 
 void Quaternion::Multiply(const Quaternion& left, const Quaternion& right, Quaternion& result)
 {
+#if USE_SIMD
+    SIMD::StoreUnaligned(result.Raw, MultiplyQuaternions(SIMD::LoadUnaligned(left.Raw), SIMD::LoadUnaligned(right.Raw)));
+#else
     const float a = left.Y * right.Z - left.Z * right.Y;
     const float b = left.Z * right.X - left.X * right.Z;
     const float c = left.X * right.Y - left.Y * right.X;
@@ -109,6 +142,25 @@ void Quaternion::Multiply(const Quaternion& left, const Quaternion& right, Quate
     result.Y = left.Y * right.W + right.Y * left.W + b;
     result.Z = left.Z * right.W + right.Z * left.W + c;
     result.W = left.W * right.W - d;
+#endif
+}
+
+void Quaternion::Multiply(const Span<Quaternion>& left, const Quaternion& right, Span<Quaternion> result)
+{
+    ASSERT(result.Length() >= left.Length());
+    const Quaternion* src = left.Get();
+    Quaternion* dst = result.Get();
+#if USE_SIMD
+    const SimdVector4 r = SIMD::LoadUnaligned(right.Raw);
+    for (int32 i = 0; i < left.Length(); i++)
+        SIMD::StoreUnaligned(dst[i].Raw, MultiplyQuaternions(SIMD::LoadUnaligned(src[i].Raw), r));
+#else
+    for (int32 i = 0; i < left.Length(); i++)
+    {
+        const Quaternion tmp = src[i];
+        Multiply(tmp, right, dst[i]);
+    }
+#endif
 }
 
 void Quaternion::Lerp(const Quaternion& start, const Quaternion& end, float amount, Quaternion& result)
@@ -473,6 +525,40 @@ void Quaternion::Slerp(const Quaternion& start, const Quaternion& end, float amo
     result.W = inverse * start.W + opposite * end.W;
 }
 
+void Quaternion::Slerp(const Span<Quaternion>& start, const Span<Quaternion>& end, float amount, Span<Quaternion> result)
+{
+    ASSERT(end.Length() >= start.Length() && result.Length() >= start.Length());
+    const Quaternion* src0 = start.Get();
+    const Quaternion* src1 = end.Get();
+    Quaternion* dst = result.Get();
+#if USE_SIMD
+    for (int32 i = 0; i < start.Length(); i++)
+    {
+        const SimdVector4 s = SIMD::LoadUnaligned(src0[i].Raw);
+        const SimdVector4 e = SIMD::LoadUnaligned(src1[i].Raw);
+        const float dot = ::Dot(s, e);
+        float opposite;
+        float inverse;
+        if (Math::Abs(dot) > 1.0f - ZeroTolerance)
+        {
+            inverse = 1.0f - amount;
+            opposite = amount * Math::Sign(dot);
+        }
+        else
+        {
+            const float acos1 = Math::Acos(Math::Abs(dot));
+            const float invSin = 1.0f / Math::Sin(acos1);
+            inverse = Math::Sin((1.0f - amount) * acos1) * invSin;
+            opposite = Math::Sin(amount * acos1) * invSin * Math::Sign(dot);
+        }
+        SIMD::StoreUnaligned(dst[i].Raw, SIMD::Add(SIMD::Mul(SIMD::Splat(inverse), s), SIMD::Mul(SIMD::Splat(opposite), e)));
+    }
+#else
+    for (int32 i = 0; i < start.Length(); i++)
+        Slerp(src0[i], src1[i], amount, dst[i]);
+#endif
+}
+
 Quaternion Quaternion::Euler(float x, float y, float z)
 {
     const float halfRoll = z * (DegreesToRadians * 0.5f);
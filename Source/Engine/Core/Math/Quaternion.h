@@ -468,6 +468,12 @@ API_STRUCT() struct FLAXENGINE_API Quaternion
     // @param result When the method completes, contains the multiplied quaternion
     static void Multiply(const Quaternion& left, const Quaternion& right, Quaternion& result);
 
+    // Multiplies the quaternions by the same quaternion (result[i] = left[i] * right)
+    // @param left The quaternions to multiply
+    // @param right The second quaternion to multiply
+    // @param result The multiplied quaternions. Has to be at least the size of left, can point to the same memory
+    static void Multiply(const Span<Quaternion>& left, const Quaternion& right, Span<Quaternion> result);
+
     // Reverses the direction of a given quaternion
     // @param value The quaternion to negate
     // @param result When the method completes, contains a quaternion facing in the opposite direction
@@ -630,6 +636,13 @@ API_STRUCT() struct FLAXENGINE_API Quaternion
     // @param result When the method completes, contains the spherical linear interpolation of the two quaternions
     static void Slerp(const Quaternion& start, const Quaternion& end, float amount, Quaternion& result);
 
+    // Interpolates between the pairs of quaternions, using spherical linear interpolation
+    // @param start Start quaternions
+    // @param end End quaternions. Has to be at least the size of start
+    // @param amount Value between 0 and 1 indicating the weight of end
+    // @param result The interpolated quaternions. Has to be at least the size of start, can point to the same memory as start or end
+    static void Slerp(const Span<Quaternion>& start, const Span<Quaternion>& end, float amount, Span<Quaternion> result);
+
     // Creates a quaternion given a yaw, pitch, and roll value (is using degrees)
     // @param x Roll (in degrees)
     // @param x Pitch (in degrees)
@@ -3,10 +3,165 @@
 #include "Transform.h"
 #include "Matrix.h"
 #include "Matrix3x3.h"
+#include "../SIMD.h"
+#include "../Types/Span.h"
 #include "../Types/String.h"
 
 Transform Transform::Identity(Vector3(0, 0, 0));
 
+#if !USE_LARGE_WORLDS
+
+namespace
+{
+    // Four transformations in SoA layout (used by the batch operations)
+    struct Transform4
+    {
+        SimdVector4 QX, QY, QZ, QW;
+        SimdVector4 SX, SY, SZ;
+        SimdVector4 TX, TY, TZ;
+
+        Transform4() = default;
+
+        explicit Transform4(const Transform& t)
+        {
+            QX = SIMD::Splat(t.Orientation.X);
+            QY = SIMD::Splat(t.Orientation.Y);
+            QZ = SIMD::Splat(t.Orientation.Z);
+            QW = SIMD::Splat(t.Orientation.W);
+            SX = SIMD::Splat(t.Scale.X);
+            SY = SIMD::Splat(t.Scale.Y);
+            SZ = SIMD::Splat(t.Scale.Z);
+            TX = SIMD::Splat(t.Translation.X);
+            TY = SIMD::Splat(t.Translation.Y);
+            TZ = SIMD::Splat(t.Translation.Z);
+        }
+
+        explicit Transform4(const Transform* t)
+        {
+            QX = SIMD::Load(t[0].Orientation.X, t[1].Orientation.X, t[2].Orientation.X, t[3].Orientation.X);
+            QY = SIMD::Load(t[0].Orientation.Y, t[1].Orientation.Y, t[2].Orientation.Y, t[3].Orientation.Y);
+            QZ = SIMD::Load(t[0].Orientation.Z, t[1].Orientation.Z, t[2].Orientation.Z, t[3].Orientation.Z);
+            QW = SIMD::Load(t[0].Orientation.W, t[1].Orientation.W, t[2].Orientation.W, t[3].Orientation.W);
+            SX = SIMD::Load(t[0].Scale.X, t[1].Scale.X, t[2].Scale.X, t[3].Scale.X);
+            SY = SIMD::Load(t[0].Scale.Y, t[1].Scale.Y, t[2].Scale.Y, t[3].Scale.Y);
+            SZ = SIMD::Load(t[0].Scale.Z, t[1].Scale.Z, t[2].Scale.Z, t[3].Scale.Z);
+            TX = SIMD::Load(t[0].Translation.X, t[1].Translation.X, t[2].Translation.X, t[3].Translation.X);
+            TY = SIMD::Load(t[0].Translation.Y, t[1].Translation.Y, t[2].Translation.Y, t[3].Translation.Y);
+            TZ = SIMD::Load(t[0].Translation.Z, t[1].Translation.Z, t[2].Translation.Z, t[3].Translation.Z);
+        }
+
+        explicit Transform4(const float* const components[10])
+        {
+            QX = SIMD::LoadUnaligned(components[0]);
+            QY = SIMD::LoadUnaligned(components[1]);
+            QZ = SIMD::LoadUnaligned(components[2]);
+            QW = SIMD::LoadUnaligned(components[3]);
+            SX = SIMD::LoadUnaligned(components[4]);
+            SY = SIMD::LoadUnaligned(components[5]);
+            SZ = SIMD::LoadUnaligned(components[6]);
+            TX = SIMD::LoadUnaligned(components[7]);
+            TY = SIMD::LoadUnaligned(components[8]);
+            TZ = SIMD::LoadUnaligned(components[9]);
+        }
+
+        void Store(float* const components[10]) const
+        {
+            SIMD::StoreUnaligned(components[0], QX);
+            SIMD::StoreUnaligned(components[1], QY);
+            SIMD::StoreUnaligned(components[2], QZ);
+            SIMD::StoreUnaligned(components[3], QW);
+            SIMD::StoreUnaligned(components[4], SX);
+            SIMD::StoreUnaligned(components[5], SY);
+            SIMD::StoreUnaligned(components[6], SZ);
+            SIMD::StoreUnaligned(components[7], TX);
+            SIMD::StoreUnaligned(components[8], TY);
+            SIMD::StoreUnaligned(components[9], TZ);
+        }
+
+        void Store(Transform* t) const
+        {
+            float data[10][4];
+            SIMD::StoreUnaligned(data[0], QX);
+            SIMD::StoreUnaligned(data[1], QY);
+            SIMD::StoreUnaligned(data[2], QZ);
+            SIMD::StoreUnaligned(data[3], QW);
+            SIMD::StoreUnaligned(data[4], SX);
+            SIMD::StoreUnaligned(data[5], SY);
+            SIMD::StoreUnaligned(data[6], SZ);
+            SIMD::StoreUnaligned(data[7], TX);
+            SIMD::StoreUnaligned(data[8], TY);
+            SIMD::StoreUnaligned(data[9], TZ);
+            for (int32 i = 0; i < 4; i++)
+            {
+                t[i].Orientation = Quaternion(data[0][i], data[1][i], data[2][i], data[3][i]);
+                t[i].Scale = Float3(data[4][i], data[5][i], data[6][i]);
+                t[i].Translation = Vector3(data[7][i], data[8][i], data[9][i]);
+            }
+        }
+    };
+
+    // Calculates the normalized product of the quaternions (matches Quaternion::Multiply followed by Normalize)
+    FORCE_INLINE void MultiplyOrientation(const Transform4& p, const Transform4& l, Transform4& result)
+    {
+        const SimdVector4 a = SIMD::Sub(SIMD::Mul(p.QY, l.QZ), SIMD::Mul(p.QZ, l.QY));
+        const SimdVector4 b = SIMD::Sub(SIMD::Mul(p.QZ, l.QX), SIMD::Mul(p.QX, l.QZ));
+        const SimdVector4 c = SIMD::Sub(SIMD::Mul(p.QX, l.QY), SIMD::Mul(p.QY, l.QX));
+        const SimdVector4 d = SIMD::Add(SIMD::Add(SIMD::Mul(p.QX, l.QX), SIMD::Mul(p.QY, l.QY)), SIMD::Mul(p.QZ, l.QZ));
+        const SimdVector4 qx = SIMD::Add(SIMD::Add(SIMD::Mul(p.QX, l.QW), SIMD::Mul(l.QX, p.QW)), a);
+        const SimdVector4 qy = SIMD::Add(SIMD::Add(SIMD::Mul(p.QY, l.QW), SIMD::Mul(l.QY, p.QW)), b);
+        const SimdVector4 qz = SIMD::Add(SIMD::Add(SIMD::Mul(p.QZ, l.QW), SIMD::Mul(l.QZ, p.QW)), c);
+        const SimdVector4 qw = SIMD::Sub(SIMD::Mul(p.QW, l.QW), d);
+        const SimdVector4 lengthSq = SIMD::Add(SIMD::Add(SIMD::Mul(qx, qx), SIMD::Mul(qy, qy)), SIMD::Add(SIMD::Mul(qz, qz), SIMD::Mul(qw, qw)));
+        const SimdVector4 invLength = SIMD::Div(SIMD::Splat(1.0f), SIMD::Max(SIMD::Sqrt(lengthSq), SIMD::Splat(ZeroTolerance)));
+        result.QX = SIMD::Mul(qx, invLength);
+        result.QY = SIMD::Mul(qy, invLength);
+        result.QZ = SIMD::Mul(qz, invLength);
+        result.QW = SIMD::Mul(qw, invLength);
+    }
+
+    // Rotates the vectors by the quaternion (matches Vector3::Transform)
+    FORCE_INLINE void Rotate(const Transform4& q, SimdVector4& vx, SimdVector4& vy, SimdVector4& vz)
+    {
+        const SimdVector4 x = SIMD::Add(q.QX, q.QX);
+        const SimdVector4 y = SIMD::Add(q.QY, q.QY);
+        const SimdVector4 z = SIMD::Add(q.QZ, q.QZ);
+        const SimdVector4 wx = SIMD::Mul(q.QW, x);
+        const SimdVector4 wy = SIMD::Mul(q.QW, y);
+        const SimdVector4 wz = SIMD::Mul(q.QW, z);
+        const SimdVector4 xx = SIMD::Mul(q.QX, x);
+        const SimdVector4 xy = SIMD::Mul(q.QX, y);
+        const SimdVector4 xz = SIMD::Mul(q.QX, z);
+        const SimdVector4 yy = SIMD::Mul(q.QY, y);
+        const SimdVector4 yz = SIMD::Mul(q.QY, z);
+        const SimdVector4 zz = SIMD::Mul(q.QZ, z);
+        const SimdVector4 one = SIMD::Splat(1.0f);
+        const SimdVector4 rx = SIMD::Add(SIMD::Add(SIMD::Mul(vx, SIMD::Sub(SIMD::Sub(one, yy), zz)), SIMD::Mul(vy, SIMD::Sub(xy, wz))), SIMD::Mul(vz, SIMD::Add(xz, wy)));
+        const SimdVector4 ry = SIMD::Add(SIMD::Add(SIMD::Mul(vx, SIMD::Add(xy, wz)), SIMD::Mul(vy, SIMD::Sub(SIMD::Sub(one, xx), zz))), SIMD::Mul(vz, SIMD::Sub(yz, wx)));
+        const SimdVector4 rz = SIMD::Add(SIMD::Add(SIMD::Mul(vx, SIMD::Sub(xz, wy)), SIMD::Mul(vy, SIMD::Add(yz, wx))), SIMD::Mul(vz, SIMD::Sub(SIMD::Sub(one, xx), yy)));
+        vx = rx;
+        vy = ry;
+        vz = rz;
+    }
+
+    // Combines the transformations (parent * local), matches Transform::LocalToWorld
+    FORCE_INLINE void Combine(const Transform4& p, const Transform4& l, Transform4& w)
+    {
+        MultiplyOrientation(p, l, w);
+        w.SX = SIMD::Mul(p.SX, l.SX);
+        w.SY = SIMD::Mul(p.SY, l.SY);
+        w.SZ = SIMD::Mul(p.SZ, l.SZ);
+        w.TX = SIMD::Mul(l.TX, p.SX);
+        w.TY = SIMD::Mul(l.TY, p.SY);
+        w.TZ = SIMD::Mul(l.TZ, p.SZ);
+        Rotate(p, w.TX, w.TY, w.TZ);
+        w.TX = SIMD::Add(w.TX, p.TX);
+        w.TY = SIMD::Add(w.TY, p.TY);
+        w.TZ = SIMD::Add(w.TZ, p.TZ);
+    }
+}
+
+#endif
+
 Transform::Transform(const Vector3& position, const Matrix3x3& rotationScale)
     : Translation(position)
 {
@@ -79,16 +234,7 @@ Transform Transform::Subtract(const Transform& other) const
 
 void Transform::LocalToWorld(const Transform& other, Transform& result) const
 {
-    //Quaternion::Multiply(Orientation, other.Orientation, result.Orientation);
-    const float a = Orientation.Y * other.Orientation.Z - Orientation.Z * other.Orientation.Y;
-    const float b = Orientation.Z * other.Orientation.X - Orientation.X * other.Orientation.Z;
-    const float c = Orientation.X * other.Orientation.Y - Orientation.Y * other.Orientation.X;
-    const float d = Orientation.X * other.Orientation.X + Orientation.Y * other.Orientation.Y + Orientation.Z * other.Orientation.Z;
-    result.Orientation.X = Orientation.X * other.Orientation.W + other.Orientation.X * Orientation.W + a;
-    result.Orientation.Y = Orientation.Y * other.Orientation.W + other.Orientation.Y * Orientation.W + b;
-    result.Orientation.Z = Orientation.Z * other.Orientation.W + other.Orientation.Z * Orientation.W + c;
-    result.Orientation.W = Orientation.W * other.Orientation.W - d;
-
+    Quaternion::Multiply(Orientation, other.Orientation, result.Orientation);
     //result.Orientation.Normalize();
     const float length = result.Orientation.Length();
     if (length > ZeroTolerance)
@@ -128,6 +274,40 @@ void Transform::LocalToWorld(const Transform& other, Transform& result) const
     result.Translation = Vector3(tmp.X + Translation.X, tmp.Y + Translation.Y, tmp.Z + Translation.Z);
 }
 
+void Transform::LocalToWorld(const Transform& parent, const Span<Transform>& local, Span<Transform> result)
+{
+    ASSERT(result.Length() >= local.Length());
+    const Transform* src = local.Get();
+    Transform* dst = result.Get();
+    const int32 count = local.Length();
+    int32 i = 0;
+#if !USE_LARGE_WORLDS
+    const Transform4 p(parent);
+    for (; i + 4 <= count; i += 4)
+    {
+        const Transform4 l(src + i);
+        Transform4 w;
+        Combine(p, l, w);
+        w.Store(dst + i);
+    }
+#endif
+    for (; i < count; i++)
+        parent.LocalToWorld(src[i], dst[i]);
+}
+
+#if !USE_LARGE_WORLDS
+
+void Transform::LocalToWorld4(const float* const parent[10], const float* const local[10], float* const result[10])
+{
+    const Transform4 p(parent);
+    const Transform4 l(local);
+    Transform4 w;
+    Combine(p, l, w);
+    w.Store(result);
+}
+
+#endif
+
 void Transform::LocalToWorldVector(const Vector3& vector, Vector3& result) const
 {
     Vector3 tmp = vector * Scale;
@@ -159,6 +339,44 @@ void Transform::WorldToLocal(const Transform& other, Transform& result) const
     Vector3::Multiply(result.Translation, invScale, result.Translation);
 }
 
+void Transform::WorldToLocal(const Transform& parent, const Span<Transform>& world, Span<Transform> result)
+{
+    ASSERT(result.Length() >= world.Length());
+    const Transform* src = world.Get();
+    Transform* dst = result.Get();
+    const int32 count = world.Length();
+    int32 i = 0;
+#if !USE_LARGE_WORLDS
+    Float3 invScale = parent.Scale;
+    if (invScale.X != 0.0f)
+        invScale.X = 1.0f / invScale.X;
+    if (invScale.Y != 0.0f)
+        invScale.Y = 1.0f / invScale.Y;
+    if (invScale.Z != 0.0f)
+        invScale.Z = 1.0f / invScale.Z;
+    const Transform4 p(Transform(parent.Translation, parent.Orientation.Conjugated(), invScale));
+    for (; i + 4 <= count; i += 4)
+    {
+        const Transform4 w(src + i);
+        Transform4 l;
+        MultiplyOrientation(p, w, l);
+        l.SX = SIMD::Mul(w.SX, p.SX);
+        l.SY = SIMD::Mul(w.SY, p.SY);
+        l.SZ = SIMD::Mul(w.SZ, p.SZ);
+        l.TX = SIMD::Sub(w.TX, p.TX);
+        l.TY = SIMD::Sub(w.TY, p.TY);
+        l.TZ = SIMD::Sub(w.TZ, p.TZ);
+        Rotate(p, l.TX, l.TY, l.TZ);
+        l.TX = SIMD::Mul(l.TX, p.SX);
+        l.TY = SIMD::Mul(l.TY, p.SY);
+        l.TZ = SIMD::Mul(l.TZ, p.SZ);
+        l.Store(dst + i);
+    }
+#endif
+    for (; i < count; i++)
+        parent.WorldToLocal(src[i], dst[i]);
+}
+
 void Transform::WorldToLocal(const Vector3& point, Vector3& result) const
 {
     Vector3 invScale = Scale;
@@ -180,6 +180,24 @@ API_STRUCT() struct FLAXENGINE_API Transform
     /// <param name="result">The world space transformation.</param>
     void LocalToWorld(const Transform& other, Transform& result) const;
 
+    /// <summary>
+    /// Performs transformation of the given transforms in local space to the world space of the parent transform (the same as parent.LocalToWorld for each transform).
+    /// </summary>
+    /// <param name="parent">The parent transformation.</param>
+    /// <param name="local">The local space transformations.</param>
+    /// <param name="result">The world space transformations. Has to be at least the size of local, can point to the same memory.</param>
+    static void LocalToWorld(const Transform& parent, const Span<Transform>& local, Span<Transform> result);
+
+#if !USE_LARGE_WORLDS
+    /// <summary>
+    /// Performs transformation of 4 transforms in local space to the world space of their parents at once (the same as parent.LocalToWorld for each transform). Uses SoA layout: each component (orientation XYZW, scale XYZ and translation XYZ) points to 4 floats.
+    /// </summary>
+    /// <param name="parent">The parent transformations components.</param>
+    /// <param name="local">The local space transformations components.</param>
+    /// <param name="result">The world space transformations components. Can point to the same memory as local.</param>
+    static void LocalToWorld4(const float* const parent[10], const float* const local[10], float* const result[10]);
+#endif
+
     /// <summary>
     /// Performs transformation of the given point in local space to the world space of this transform.
     /// </summary>
@@ -237,6 +255,14 @@ API_STRUCT() struct FLAXENGINE_API Transform
     /// <param name="result">The local space transformation.</param>
     void WorldToLocal(const Transform& other, Transform& result) const;
 
+    /// <summary>
+    /// Performs transformation of the given transforms in world space to the local space of the parent transform (the same as parent.WorldToLocal for each transform).
+    /// </summary>
+    /// <param name="parent">The parent transformation.</param>
+    /// <param name="world">The world space transformations.</param>
+    /// <param name="result">The local space transformations. Has to be at least the size of world, can point to the same memory.</param>
+    static void WorldToLocal(const Transform& parent, const Span<Transform>& world, Span<Transform> result);
+
     /// <summary>
     /// Performs transformation of the given point in world space to the local space of this transform.
     /// </summary>
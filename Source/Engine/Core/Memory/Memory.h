@@ -6,8 +6,18 @@
 #include "Engine/Platform/Platform.h"
 #include <new>
 
+// Enable/disable the thread-caching small objects allocator as the default Allocator (can be disabled at startup with -crtalloc command line)
+#ifndef USE_SMALL_OBJECT_ALLOCATOR
+#define USE_SMALL_OBJECT_ALLOCATOR (PLATFORM_DESKTOP && PLATFORM_64BITS)
+#endif
+
+#if USE_SMALL_OBJECT_ALLOCATOR
+#include "SmallObjectAllocator.h"
+typedef SmallObjectAllocator Allocator;
+#else
 #include "CrtAllocator.h"
 typedef CrtAllocator Allocator;
+#endif
 
 namespace AllocatorExt
 {
@@ -0,0 +1,578 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#include "Memory.h"
+
+#if USE_SMALL_OBJECT_ALLOCATOR
+
+#include "SmallObjectAllocator.h"
+#include "Engine/Core/Math/Math.h"
+
+static_assert(PLATFORM_64BITS, "Small objects allocator requires 64-bit address space.");
+
+// Size of the memory chunk (aligned to its size so the span descriptor can be found from the object address)
+#define CHUNK_SIZE_BITS 21
+#define CHUNK_SIZE (1ull << CHUNK_SIZE_BITS)
+
+// Size of the memory span that holds the objects of a single size class (the first span of the chunk holds the spans descriptors)
+#define SPAN_SIZE_BITS 16
+#define SPAN_SIZE (1ull << SPAN_SIZE_BITS)
+#define SPANS_PER_CHUNK (int32)(CHUNK_SIZE / SPAN_SIZE)
+
+// Amount of the chunks allocated at once from the system
+#define ARENA_CHUNKS 16
+
+// Amount of the objects size classes (up to SMALL_OBJECT_MAX_SIZE)
+#define SIZE_CLASSES 20
+
+// Maximum amount of the objects carved from the unused span memory at once (memory is touched lazily)
+#define SPAN_CARVE_COUNT 32
+
+// Maximum amount of the spans checked for the free objects before taking the new span
+#define SPAN_SEARCH_LIMIT 4
+
+// Chunks map covers the 48-bit address space with the bitmaps of the chunks
+#define CHUNKS_MAP_LEAF_BITS 14
+#define CHUNKS_MAP_LEAF_SIZE (1 << CHUNKS_MAP_LEAF_BITS)
+#define CHUNKS_MAP_ROOT_SIZE (1 << (48 - CHUNK_SIZE_BITS - CHUNKS_MAP_LEAF_BITS))
+
+bool SmallObjectAllocator::Enabled = true;
+
+namespace
+{
+    struct Heap;
+
+    struct FreeObject
+    {
+        FreeObject* Next;
+    };
+
+    struct MemorySpan
+    {
+        // Objects freed by the owner thread
+        FreeObject* FreeList;
+        // Objects freed by the other threads (lock-free stack, collected by the owner thread)
+        int64 volatile RemoteFreeList;
+        // The owning thread heap (null if span is free or abandoned)
+        Heap* volatile Owner;
+        MemorySpan* Prev;
+        MemorySpan* Next;
+        byte* Data;
+        int32 Used;
+        int32 Carved;
+        int32 Capacity;
+        int32 SizeClass;
+        uint32 ObjectSize;
+    };
+
+    struct ChunkHeader
+    {
+        MemorySpan Spans[SPANS_PER_CHUNK];
+    };
+
+    static_assert(sizeof(ChunkHeader) <= SPAN_SIZE, "Chunk header has to fit into a single span.");
+
+    struct Heap
+    {
+        // The spans lists per size class (the first span is used for allocations)
+        MemorySpan* Spans[SIZE_CLASSES];
+        Heap* Next;
+        Heap* NextFree;
+
+        // Stats (updated only by the owner thread)
+        uint64 Allocations;
+        uint64 Frees;
+        uint64 RemoteFrees;
+        uint64 SystemAllocations;
+        int64 UsedMemory;
+    };
+
+    struct GlobalData
+    {
+        int32 volatile Lock;
+        MemorySpan* FreeSpans;
+        MemorySpan* AbandonedSpans[SIZE_CLASSES];
+        Heap* Heaps;
+        Heap* FreeHeaps;
+        uint64 ReservedMemory;
+        int32 SpansCount;
+        int32 FreeSpansCount;
+        int32 AbandonedSpansCount;
+        int32 HeapsCount;
+
+        // Stats of the frees from the threads that have been already exited
+        int64 volatile ExitedThreadsFrees;
+        int64 volatile ExitedThreadsUsedMemory;
+    };
+
+    const uint32 SizeClassSizes[SIZE_CLASSES] =
+    {
+        16, 32, 48, 64, 80, 96, 112, 128,
+        160, 192, 224, 256,
+        320, 384, 448, 512,
+        640, 768, 896, 1024,
+    };
+
+    // Maps the (size - 1) / 16 to the size class
+    const byte SizeClassLookup[SMALL_OBJECT_MAX_SIZE / 16] =
+    {
+        0, 1, 2, 3, 4, 5, 6, 7,
+        8, 8, 9, 9, 10, 10, 11, 11,
+        12, 12, 12, 12, 13, 13, 13, 13, 14, 14, 14, 14, 15, 15, 15, 15,
+        16, 16, 16, 16, 16, 16, 16, 16, 17, 17, 17, 17, 17, 17, 17, 17,
+        18, 18, 18, 18, 18, 18, 18, 18, 19, 19, 19, 19, 19, 19, 19, 19,
+    };
+
+    // Note: global data is zero-initialized so allocator can be used before static constructors are called
+    GlobalData Global;
+    uint64* ChunksMap[CHUNKS_MAP_ROOT_SIZE];
+    THREADLOCAL Heap* ThreadHeap = nullptr;
+    THREADLOCAL bool ThreadExited = false;
+
+    struct GlobalLock
+    {
+        GlobalLock()
+        {
+            for (int32 spin = 0; Platform::InterlockedCompareExchange(&Global.Lock, 1, 0) != 0; spin++)
+            {
+                if (spin > 64)
+                    Platform::Sleep(0);
+            }
+        }
+
+        ~GlobalLock()
+        {
+            Platform::AtomicStore(&Global.Lock, 0);
+        }
+    };
+
+    FORCE_INLINE MemorySpan* GetSpan(const void* ptr)
+    {
+        const uint64 address = (uint64)ptr;
+        auto chunk = (ChunkHeader*)(address & ~(CHUNK_SIZE - 1));
+        return &chunk->Spans[(address & (CHUNK_SIZE - 1)) >> SPAN_SIZE_BITS];
+    }
+
+    void AddArena()
+    {
+        // Allocate one chunk more to align the chunks
+        const uint64 size = (ARENA_CHUNKS + 1) * CHUNK_SIZE;
+        byte* memory = (byte*)Platform::AllocatePages(size / SPAN_SIZE, SPAN_SIZE);
+        if (!memory)
+            return;
+        Global.ReservedMemory += size;
+        byte* chunks = (byte*)(((uint64)memory + CHUNK_SIZE - 1) & ~(CHUNK_SIZE - 1));
+        for (int32 chunkIndex = 0; chunkIndex < ARENA_CHUNKS; chunkIndex++)
+        {
+            byte* chunk = chunks + chunkIndex * CHUNK_SIZE;
+
+            // Register chunk
+            const uint64 address = (uint64)chunk;
+            uint64*& leaf = ChunksMap[address >> (CHUNK_SIZE_BITS + CHUNKS_MAP_LEAF_BITS)];
+            if (!leaf)
+            {
+                auto newLeaf = (uint64*)Platform::Allocate(CHUNKS_MAP_LEAF_SIZE / 8, 16);
+                Platform::MemoryClear(newLeaf, CHUNKS_MAP_LEAF_SIZE / 8);
+                Platform::MemoryBarrier();
+                leaf = newLeaf;
+            }
+            const uint32 index = (uint32)(address >> CHUNK_SIZE_BITS) & (CHUNKS_MAP_LEAF_SIZE - 1);
+            leaf[index >> 6] |= 1ull << (index & 63);
+
+            // Add spans to the free list
+            auto header = (ChunkHeader*)chunk;
+            for (int32 i = SPANS_PER_CHUNK - 1; i > 0; i--)
+            {
+                MemorySpan& span = header->Spans[i];
+                Platform::MemoryClear(&span, sizeof(MemorySpan));
+                span.Data = chunk + i * SPAN_SIZE;
+                span.SizeClass = -1;
+                span.Next = Global.FreeSpans;
+                Global.FreeSpans = &span;
+            }
+            Global.SpansCount += SPANS_PER_CHUNK - 1;
+            Global.FreeSpansCount += SPANS_PER_CHUNK - 1;
+        }
+    }
+
+    void CollectRemoteFrees(MemorySpan* span)
+    {
+        auto list = (FreeObject*)Platform::InterlockedExchange(&span->RemoteFreeList, 0);
+        if (!list)
+            return;
+        int32 count = 1;
+        FreeObject* last = list;
+        while (last->Next)
+        {
+            last = last->Next;
+            count++;
+        }
+        last->Next = span->FreeList;
+        span->FreeList = list;
+        span->Used -= count;
+    }
+
+    void CarveObjects(MemorySpan* span)
+    {
+        const int32 count = Math::Min(span->Capacity - span->Carved, SPAN_CARVE_COUNT);
+        byte* data = span->Data + (uint64)span->Carved * span->ObjectSize;
+        for (int32 i = count - 1; i >= 0; i--)
+        {
+            auto obj = (FreeObject*)(data + (uint64)i * span->ObjectSize);
+            obj->Next = span->FreeList;
+            span->FreeList = obj;
+        }
+        span->Carved += count;
+    }
+
+    void LinkSpan(Heap* heap, MemorySpan* span)
+    {
+        MemorySpan*& head = heap->Spans[span->SizeClass];
+        span->Prev = nullptr;
+        span->Next = head;
+        if (head)
+            head->Prev = span;
+        head = span;
+    }
+
+    void UnlinkSpan(Heap* heap, MemorySpan* span)
+    {
+        if (span->Prev)
+            span->Prev->Next = span->Next;
+        else
+            heap->Spans[span->SizeClass] = span->Next;
+        if (span->Next)
+            span->Next->Prev = span->Prev;
+        span->Prev = span->Next = nullptr;
+    }
+
+    void ReleaseSpan(MemorySpan* span)
+    {
+        span->Owner = nullptr;
+        span->FreeList = nullptr;
+        span->Used = 0;
+        span->Carved = 0;
+        span->SizeClass = -1;
+        GlobalLock lock;
+        span->Next = Global.FreeSpans;
+        Global.FreeSpans = span;
+        Global.FreeSpansCount++;
+    }
+
+    // Moves the abandoned spans with all objects freed by the other threads to the free spans list (called within global lock)
+    void ReclaimAbandonedSpans()
+    {
+        for (int32 sizeClass = 0; sizeClass < SIZE_CLASSES; sizeClass++)
+        {
+            MemorySpan** prev = &Global.AbandonedSpans[sizeClass];
+            while (MemorySpan* span = *prev)
+            {
+                CollectRemoteFrees(span);
+                if (span->Used != 0)
+                {
+                    prev = &span->Next;
+                    continue;
+                }
+                *prev = span->Next;
+                Global.AbandonedSpansCount--;
+                span->FreeList = nullptr;
+                span->Carved = 0;
+                span->SizeClass = -1;
+                span->Next = Global.FreeSpans;
+                Global.FreeSpans = span;
+                Global.FreeSpansCount++;
+            }
+        }
+    }
+
+    MemorySpan* AcquireSpan(Heap* heap, int32 sizeClass)
+    {
+        MemorySpan* span;
+        {
+            GlobalLock lock;
+
+            // Adopt span left by the exited thread
+            span = Global.AbandonedSpans[sizeClass];
+            if (span)
+            {
+                Global.AbandonedSpans[sizeClass] = span->Next;
+                Global.AbandonedSpansCount--;
+            }
+            else
+            {
+                if (!Global.FreeSpans)
+                    ReclaimAbandonedSpans();
+                if (!Global.FreeSpans)
+                    AddArena();
+                span = Global.FreeSpans;
+                if (!span)
+                    return nullptr;
+                Global.FreeSpans = span->Next;
+                Global.FreeSpansCount--;
+                span->SizeClass = sizeClass;
+                span->ObjectSize = SizeClassSizes[sizeClass];
+                span->Capacity = (int32)(SPAN_SIZE / span->ObjectSize);
+                span->Used = 0;
+                span->Carved = 0;
+                span->FreeList = nullptr;
+            }
+        }
+        span->Owner = heap;
+        CollectRemoteFrees(span);
+        LinkSpan(heap, span);
+        return span;
+    }
+
+    FreeObject* AllocateSlow(Heap* heap, int32 sizeClass)
+    {
+        // Find span with free objects (move the full spans to the end of the list so the other ones are checked on the next search)
+        MemorySpan* span = heap->Spans[sizeClass];
+        for (int32 i = 0; span && i < SPAN_SEARCH_LIMIT; i++)
+        {
+            if (!span->FreeList)
+                CollectRemoteFrees(span);
+            if (!span->FreeList && span->Carved < span->Capacity)
+                CarveObjects(span);
+            if (span->FreeList)
+                break;
+            MemorySpan* next = span->Next;
+            if (next)
+            {
+                UnlinkSpan(heap, span);
+                MemorySpan* last = next;
+                while (last->Next)
+                    last = last->Next;
+                last->Next = span;
+                span->Prev = last;
+            }
+            span = next;
+        }
+        if (!span || !span->FreeList)
+        {
+            // Note: adopted span can be still full (it stays in the heap and gets the objects back via remote frees)
+            do
+            {
+                span = AcquireSpan(heap, sizeClass);
+                if (!span)
+                    return nullptr;
+                if (!span->FreeList && span->Carved < span->Capacity)
+                    CarveObjects(span);
+            } while (!span->FreeList);
+        }
+        else if (span != heap->Spans[sizeClass])
+        {
+            UnlinkSpan(heap, span);
+            LinkSpan(heap, span);
+        }
+
+        FreeObject* obj = span->FreeList;
+        span->FreeList = obj->Next;
+        span->Used++;
+        return obj;
+    }
+
+    void ReleaseHeap()
+    {
+        Heap* heap = ThreadHeap;
+        ThreadHeap = nullptr;
+        ThreadExited = true;
+        if (!heap)
+            return;
+
+        // Free the empty spans and leave the used ones for the other threads
+        for (int32 sizeClass = 0; sizeClass < SIZE_CLASSES; sizeClass++)
+        {
+            MemorySpan* span = heap->Spans[sizeClass];
+            heap->Spans[sizeClass] = nullptr;
+            while (span)
+            {
+                MemorySpan* next = span->Next;
+                CollectRemoteFrees(span);
+                if (span->Used == 0)
+                {
+                    ReleaseSpan(span);
+                }
+                else
+                {
+                    span->Owner = nullptr;
+                    span->Prev = nullptr;
+                    GlobalLock lock;
+                    span->Next = Global.AbandonedSpans[sizeClass];
+                    Global.AbandonedSpans[sizeClass] = span;
+                    Global.AbandonedSpansCount++;
+                }
+                span = next;
+            }
+        }
+
+        GlobalLock lock;
+        heap->NextFree = Global.FreeHeaps;
+        Global.FreeHeaps = heap;
+        Global.HeapsCount--;
+    }
+
+    struct ThreadHeapGuard
+    {
+        ~ThreadHeapGuard()
+        {
+            ReleaseHeap();
+        }
+    };
+
+    Heap* InitHeap()
+    {
+        if (ThreadExited)
+            return nullptr;
+
+        // Release heap on thread exit
+        static thread_local ThreadHeapGuard guard;
+
+        Heap* heap;
+        {
+            GlobalLock lock;
+            heap = Global.FreeHeaps;
+            if (heap)
+                Global.FreeHeaps = heap->NextFree;
+            Global.HeapsCount++;
+        }
+        if (!heap)
+        {
+            heap = (Heap*)Platform::Allocate(sizeof(Heap), 16);
+            Platform::MemoryClear(heap, sizeof(Heap));
+            GlobalLock lock;
+            heap->Next = Global.Heaps;
+            Global.Heaps = heap;
+        }
+        ThreadHeap = heap;
+        return heap;
+    }
+}
+
+void* SmallObjectAllocator::Allocate(uint64 size, uint64 alignment)
+{
+    Heap* heap = ThreadHeap;
+    if (size - 1 < SMALL_OBJECT_MAX_SIZE && alignment <= SMALL_OBJECT_ALIGNMENT && Enabled)
+    {
+        if (!heap)
+            heap = InitHeap();
+        if (heap)
+        {
+            const int32 sizeClass = SizeClassLookup[(size - 1) >> 4];
+            MemorySpan* span = heap->Spans[sizeClass];
+            FreeObject* obj;
+            if (span && span->FreeList)
+            {
+                obj = span->FreeList;
+                span->FreeList = obj->Next;
+                span->Used++;
+            }
+            else
+            {
+                obj = AllocateSlow(heap, sizeClass);
+            }
+            if (obj)
+            {
+                heap->Allocations++;
+                heap->UsedMemory += SizeClassSizes[sizeClass];
+#if COMPILE_WITH_PROFILER
+                Platform::OnMemoryAlloc(obj, size);
+#endif
+                return obj;
+            }
+        }
+    }
+    if (heap)
+        heap->SystemAllocations++;
+    return Platform::Allocate(size, alignment);
+}
+
+void SmallObjectAllocator::Free(void* ptr)
+{
+    if (!IsSmallObject(ptr))
+    {
+        Platform::Free(ptr);
+        return;
+    }
+#if COMPILE_WITH_PROFILER
+    Platform::OnMemoryFree(ptr);
+#endif
+    MemorySpan* span = GetSpan(ptr);
+    auto obj = (FreeObject*)ptr;
+    Heap* heap = ThreadHeap;
+    if (!heap)
+        heap = InitHeap();
+    if (heap && span->Owner == heap)
+    {
+        obj->Next = span->FreeList;
+        span->FreeList = obj;
+        heap->Frees++;
+        heap->UsedMemory -= span->ObjectSize;
+
+        // Return the unused span (except the one used for allocations)
+        if (--span->Used == 0 && heap->Spans[span->SizeClass] != span)
+        {
+            UnlinkSpan(heap, span);
+            ReleaseSpan(span);
+        }
+        return;
+    }
+
+    // Return the object to the span owner
+    const uint32 objectSize = span->ObjectSize;
+    int64 head;
+    do
+    {
+        head = Platform::AtomicRead(&span->RemoteFreeList);
+        obj->Next = (FreeObject*)head;
+    } while (Platform::InterlockedCompareExchange(&span->RemoteFreeList, (int64)obj, head) != head);
+    if (heap)
+    {
+        heap->Frees++;
+        heap->RemoteFrees++;
+        heap->UsedMemory -= objectSize;
+    }
+    else
+    {
+        Platform::InterlockedIncrement(&Global.ExitedThreadsFrees);
+        Platform::InterlockedAdd(&Global.ExitedThreadsUsedMemory, -(int64)objectSize);
+    }
+}
+
+bool SmallObjectAllocator::IsSmallObject(const void* ptr)
+{
+    const uint64 address = (uint64)ptr;
+    const uint64 rootIndex = address >> (CHUNK_SIZE_BITS + CHUNKS_MAP_LEAF_BITS);
+    if (rootIndex >= CHUNKS_MAP_ROOT_SIZE)
+        return false;
+    const uint64* leaf = ChunksMap[rootIndex];
+    if (!leaf)
+        return false;
+    const uint32 index = (uint32)(address >> CHUNK_SIZE_BITS) & (CHUNKS_MAP_LEAF_SIZE - 1);
+    return ((leaf[index >> 6] >> (index & 63)) & 1) != 0;
+}
+
+void SmallObjectAllocator::GetStats(SmallObjectAllocatorStats& result)
+{
+    Platform::MemoryClear(&result, sizeof(result));
+    GlobalLock lock;
+    result.ReservedMemory = Global.ReservedMemory;
+    result.UsedSpans = Global.SpansCount - Global.FreeSpansCount - Global.AbandonedSpansCount;
+    result.FreeSpans = Global.FreeSpansCount;
+    result.AbandonedSpans = Global.AbandonedSpansCount;
+    result.Threads = Global.HeapsCount;
+
+    // Note: counters of the other threads are read without synchronization
+    int64 usedMemory = Global.ExitedThreadsUsedMemory;
+    result.Frees = Global.ExitedThreadsFrees;
+    result.RemoteFrees = Global.ExitedThreadsFrees;
+    for (const Heap* heap = Global.Heaps; heap; heap = heap->Next)
+    {
+        result.Allocations += heap->Allocations;
+        result.Frees += heap->Frees;
+        result.RemoteFrees += heap->RemoteFrees;
+        result.SystemAllocations += heap->SystemAllocations;
+        usedMemory += heap->UsedMemory;
+    }
+    result.UsedMemory = (uint64)Math::Max<int64>(usedMemory, 0);
+}
+
+#endif
@@ -0,0 +1,117 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#include "Engine/Core/Types/BaseTypes.h"
+#include "Engine/Platform/Platform.h"
+
+// The maximum size of the allocation served by the small objects allocator (in bytes)
+#define SMALL_OBJECT_MAX_SIZE 1024
+
+// The maximum alignment of the allocation served by the small objects allocator (in bytes)
+#define SMALL_OBJECT_ALIGNMENT 16
+
+/// <summary>
+/// The small objects allocator statistics.
+/// </summary>
+struct SmallObjectAllocatorStats
+{
+    /// <summary>
+    /// The size of the memory reserved for the allocator arenas (in bytes).
+    /// </summary>
+    uint64 ReservedMemory;
+
+    /// <summary>
+    /// The size of the memory used by the allocated small objects (in bytes, includes the size class rounding).
+    /// </summary>
+    uint64 UsedMemory;
+
+    /// <summary>
+    /// The total amount of the small objects allocations.
+    /// </summary>
+    uint64 Allocations;
+
+    /// <summary>
+    /// The total amount of the small objects frees.
+    /// </summary>
+    uint64 Frees;
+
+    /// <summary>
+    /// The total amount of the small objects freed by the other thread than the one that allocated them.
+    /// </summary>
+    uint64 RemoteFrees;
+
+    /// <summary>
+    /// The total amount of the allocations passed to the system allocator (too big, over-aligned or when allocator is disabled).
+    /// </summary>
+    uint64 SystemAllocations;
+
+    /// <summary>
+    /// The amount of the memory spans used by the threads caches.
+    /// </summary>
+    int32 UsedSpans;
+
+    /// <summary>
+    /// The amount of the free memory spans.
+    /// </summary>
+    int32 FreeSpans;
+
+    /// <summary>
+    /// The amount of the memory spans left by the exited threads (reused by the other threads).
+    /// </summary>
+    int32 AbandonedSpans;
+
+    /// <summary>
+    /// The amount of the threads using the allocator.
+    /// </summary>
+    int32 Threads;
+};
+
+/// <summary>
+/// The thread-caching memory allocator optimized for the small objects. Allocations up to SMALL_OBJECT_MAX_SIZE bytes are rounded to the size classes and served from the per-thread memory spans (no locking). Objects freed by the other thread are returned to the span owner via lock-free list. Spans are carved from the large arenas (backed by the huge pages if supported). Other allocations use the system allocator.
+/// </summary>
+class FLAXENGINE_API SmallObjectAllocator
+{
+public:
+    /// <summary>
+    /// True if use the small objects allocator for the new allocations, otherwise all the new allocations use the system allocator. Memory can be freed regardless of this value so it's safe to change it at any time (eg. at startup via -crtalloc command line).
+    /// </summary>
+    static bool Enabled;
+
+public:
+    /// <summary>
+    /// Allocates memory on a specified alignment boundary.
+    /// </summary>
+    /// <param name="size">The size of the allocation (in bytes).</param>
+    /// <param name="alignment">The memory alignment (in bytes). Must be an integer power of 2.</param>
+    /// <returns>The pointer to the allocated chunk of the memory. The pointer is a multiple of alignment.</returns>
+    static void* Allocate(uint64 size, uint64 alignment = 16);
+
+    /// <summary>
+    /// Frees a block of allocated memory.
+    /// </summary>
+    /// <param name="ptr">A pointer to the memory block to deallocate.</param>
+    static void Free(void* ptr);
+
+    /// <summary>
+    /// Checks if the given memory has been allocated by the small objects allocator (rather than the system allocator).
+    /// </summary>
+    /// <param name="ptr">A pointer to the memory block.</param>
+    /// <returns>True if memory is owned by the small objects allocator, otherwise false.</returns>
+    static bool IsSmallObject(const void* ptr);
+
+    /// <summary>
+    /// Gets the allocator statistics.
+    /// </summary>
+    /// <param name="result">The result statistics.</param>
+    static void GetStats(SmallObjectAllocatorStats& result);
+
+    /// <summary>
+    /// Gets the name of the allocator.
+    /// </summary>
+    /// <returns>The name.</returns>
+    static const Char* Name()
+    {
+        return TEXT("SmallObject");
+    }
+};
@@ -4,15 +4,18 @@
 
 #include "Engine/Platform/Platform.h"
 #if PLATFORM_SIMD_SSE2
-#ifdef _WIN32
 #include <xmmintrin.h>
-#endif
+#elif PLATFORM_SIMD_NEON && (defined(__aarch64__) || defined(_M_ARM64))
+#include <arm_neon.h>
 #else
 #include <math.h>
 #endif
 
 #if PLATFORM_SIMD_SSE2
 
+// True if SIMD functions use the vector registers, otherwise false (scalar fallback).
+#define USE_SIMD 1
+
 // Vector of four floating point values stored in vector register.
 typedef __m128 SimdVector4;
 
@@ -33,6 +36,11 @@ namespace SIMD
         return _mm_load_ps((const float*)(src));
     }
 
+    FORCE_INLINE SimdVector4 LoadUnaligned(const void* src)
+    {
+        return _mm_loadu_ps((const float*)(src));
+    }
+
     FORCE_INLINE SimdVector4 Splat(float value)
     {
         return _mm_set_ps1(value);
@@ -43,6 +51,23 @@ namespace SIMD
         _mm_store_ps((float*)dst, src);
     }
 
+    FORCE_INLINE void StoreUnaligned(void* dst, SimdVector4 src)
+    {
+        _mm_storeu_ps((float*)dst, src);
+    }
+
+    FORCE_INLINE float GetX(SimdVector4 a)
+    {
+        return _mm_cvtss_f32(a);
+    }
+
+    // Picks the X and Y components from the first vector and the Z and W components from the second vector (by index).
+    template<int X, int Y, int Z, int W>
+    FORCE_INLINE SimdVector4 Shuffle(SimdVector4 a, SimdVector4 b)
+    {
+        return _mm_shuffle_ps(a, b, _MM_SHUFFLE(W, Z, Y, X));
+    }
+
     FORCE_INLINE int MoveMask(SimdVector4 a)
     {
         return _mm_movemask_ps(a);
@@ -94,8 +119,124 @@ namespace SIMD
     }
 }
 
+#elif PLATFORM_SIMD_NEON && (defined(__aarch64__) || defined(_M_ARM64))
+
+#define USE_SIMD 1
+
+// Vector of four floating point values stored in vector register.
+typedef float32x4_t SimdVector4;
+
+namespace SIMD
+{
+    FORCE_INLINE SimdVector4 Load(float xyzw)
+    {
+        return vdupq_n_f32(xyzw);
+    }
+
+    FORCE_INLINE SimdVector4 Load(float x, float y, float z, float w)
+    {
+        const float data[4] = { x, y, z, w };
+        return vld1q_f32(data);
+    }
+
+    FORCE_INLINE SimdVector4 Load(const void* src)
+    {
+        return vld1q_f32((const float*)src);
+    }
+
+    FORCE_INLINE SimdVector4 LoadUnaligned(const void* src)
+    {
+        return vld1q_f32((const float*)src);
+    }
+
+    FORCE_INLINE SimdVector4 Splat(float value)
+    {
+        return vdupq_n_f32(value);
+    }
+
+    FORCE_INLINE void Store(void* dst, SimdVector4 src)
+    {
+        vst1q_f32((float*)dst, src);
+    }
+
+    FORCE_INLINE void StoreUnaligned(void* dst, SimdVector4 src)
+    {
+        vst1q_f32((float*)dst, src);
+    }
+
+    FORCE_INLINE float GetX(SimdVector4 a)
+    {
+        return vgetq_lane_f32(a, 0);
+    }
+
+    // Picks the X and Y components from the first vector and the Z and W components from the second vector (by index).
+    template<int X, int Y, int Z, int W>
+    FORCE_INLINE SimdVector4 Shuffle(SimdVector4 a, SimdVector4 b)
+    {
+        SimdVector4 result = vdupq_n_f32(vgetq_lane_f32(a, X));
+        result = vsetq_lane_f32(vgetq_lane_f32(a, Y), result, 1);
+        result = vsetq_lane_f32(vgetq_lane_f32(b, Z), result, 2);
+        result = vsetq_lane_f32(vgetq_lane_f32(b, W), result, 3);
+        return result;
+    }
+
+    FORCE_INLINE int MoveMask(SimdVector4 a)
+    {
+        static const int32 shifts[4] = { 0, 1, 2, 3 };
+        const uint32x4_t signs = vshrq_n_u32(vreinterpretq_u32_f32(a), 31);
+        return (int)vaddvq_u32(vshlq_u32(signs, vld1q_s32(shifts)));
+    }
+
+    FORCE_INLINE SimdVector4 Add(SimdVector4 a, SimdVector4 b)
+    {
+        return vaddq_f32(a, b);
+    }
+
+    FORCE_INLINE SimdVector4 Sub(SimdVector4 a, SimdVector4 b)
+    {
+        return vsubq_f32(a, b);
+    }
+
+    FORCE_INLINE SimdVector4 Mul(SimdVector4 a, SimdVector4 b)
+    {
+        return vmulq_f32(a, b);
+    }
+
+    FORCE_INLINE SimdVector4 Div(SimdVector4 a, SimdVector4 b)
+    {
+        return vdivq_f32(a, b);
+    }
+
+    FORCE_INLINE SimdVector4 Rcp(SimdVector4 a)
+    {
+        return vrecpeq_f32(a);
+    }
+
+    FORCE_INLINE SimdVector4 Sqrt(SimdVector4 a)
+    {
+        return vsqrtq_f32(a);
+    }
+
+    FORCE_INLINE SimdVector4 Rsqrt(SimdVector4 a)
+    {
+        return vrsqrteq_f32(a);
+    }
+
+    FORCE_INLINE SimdVector4 Min(SimdVector4 a, SimdVector4 b)
+    {
+        return vminq_f32(a, b);
+    }
+
+    FORCE_INLINE SimdVector4 Max(SimdVector4 a, SimdVector4 b)
+    {
+        return vmaxq_f32(a, b);
+    }
+}
+
 #else
 
+#define USE_SIMD 0
+
 struct SimdVector4
 {
 	float X, Y, Z, W;
@@ -118,6 +259,11 @@ namespace SIMD
 		return *(const SimdVector4*)src;
 	}
 
+	FORCE_INLINE SimdVector4 LoadUnaligned(const void* src)
+	{
+		return *(const SimdVector4*)src;
+	}
+
 	FORCE_INLINE SimdVector4 Splat(float value)
 	{
 		return { value, value, value, value };
@@ -128,6 +274,23 @@ namespace SIMD
 		(*(SimdVector4*)dst) = src;
 	}
 
+	FORCE_INLINE void StoreUnaligned(void* dst, SimdVector4 src)
+	{
+		(*(SimdVector4*)dst) = src;
+	}
+
+	FORCE_INLINE float GetX(SimdVector4 a)
+	{
+		return a.X;
+	}
+
+	// Picks the X and Y components from the first vector and the Z and W components from the second vector (by index).
+	template<int X, int Y, int Z, int W>
+	FORCE_INLINE SimdVector4 Shuffle(SimdVector4 a, SimdVector4 b)
+	{
+		return { (&a.X)[X], (&a.X)[Y], (&b.X)[Z], (&b.X)[W] };
+	}
+
 	FORCE_INLINE int MoveMask(SimdVector4 a)
 	{
 		return (a.W < 0 ? (1 << 3) : 0) |
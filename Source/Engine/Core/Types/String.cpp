@@ -17,7 +17,7 @@ String::String(const StringView& str)
     if (_length != 0)
     {
         ASSERT(_length > 0);
-        _data = (Char*)Platform::Allocate((_length + 1) * sizeof(Char), 16);
+        _data = (Char*)Allocator::Allocate((_length + 1) * sizeof(Char));
         _data[_length] = 0;
         Platform::MemoryCopy(_data, str.Get(), _length * sizeof(Char));
     }
@@ -46,11 +46,11 @@ void String::Set(const Char* chars, int32 length)
         Char* data = nullptr;
         if (length != 0)
         {
-            data = (Char*)Platform::Allocate((length + 1) * sizeof(Char), 16);
+            data = (Char*)Allocator::Allocate((length + 1) * sizeof(Char));
             Platform::MemoryCopy(data, chars, length * sizeof(Char));
             data[length] = 0;
         }
-        Platform::Free(_data);
+        Allocator::Free(_data);
         _data = data;
         _length = length;
     }
@@ -60,10 +60,10 @@ void String::Set(const char* chars, int32 length)
 {
     if (length != _length)
     {
-        Platform::Free(_data);
+        Allocator::Free(_data);
         if (length != 0)
         {
-            _data = (Char*)Platform::Allocate((length + 1) * sizeof(Char), 16);
+            _data = (Char*)Allocator::Allocate((length + 1) * sizeof(Char));
             _data[length] = 0;
         }
         else
@@ -78,7 +78,7 @@ void String::Set(const char* chars, int32 length)
 
 void String::SetUTF8(const char* chars, int32 length)
 {
-    Platform::Free(_data);
+    Allocator::Free(_data);
     _data = StringUtils::ConvertUTF82UTF16(chars, length, _length);
 }
 
@@ -91,13 +91,13 @@ void String::Append(const Char* chars, int32 count)
     const auto oldLength = _length;
 
     _length = oldLength + count;
-    _data = (Char*)Platform::Allocate((_length + 1) * sizeof(Char), 16);
+    _data = (Char*)Allocator::Allocate((_length + 1) * sizeof(Char));
 
     Platform::MemoryCopy(_data, oldData, oldLength * sizeof(Char));
     Platform::MemoryCopy(_data + oldLength, chars, count * sizeof(Char));
     _data[_length] = 0;
 
-    Platform::Free(oldData);
+    Allocator::Free(oldData);
 }
 
 void String::Append(const char* chars, int32 count)
@@ -109,14 +109,14 @@ void String::Append(const char* chars, int32 count)
     const auto oldLength = _length;
 
     _length = oldLength + count;
-    _data = (Char*)Platform::Allocate((_length + 1) * sizeof(Char), 16);
+    _data = (Char*)Allocator::Allocate((_length + 1) * sizeof(Char));
 
     Platform::MemoryCopy(_data, oldData, oldLength * sizeof(Char));
     StringUtils::ConvertANSI2UTF16(chars, _data + oldLength, count, _length);
     _length += oldLength;
     _data[_length] = 0;
 
-    Platform::Free(oldData);
+    Allocator::Free(oldData);
 }
 
 String& String::operator+=(const StringView& str)
@@ -151,14 +151,14 @@ void String::Insert(int32 startIndex, const String& other)
     const auto oldLength = _length;
 
     _length = oldLength + otherLength;
-    _data = (Char*)Platform::Allocate((_length + 1) * sizeof(Char), 16);
+    _data = (Char*)Allocator::Allocate((_length + 1) * sizeof(Char));
 
     Platform::MemoryCopy(_data, oldData, startIndex * sizeof(Char));
     Platform::MemoryCopy(_data + startIndex, other.Get(), otherLength * sizeof(Char));
     Platform::MemoryCopy(_data + startIndex + otherLength, oldData + startIndex, (oldLength - startIndex) * sizeof(Char));
     _data[_length] = 0;
 
-    Platform::Free(oldData);
+    Allocator::Free(oldData);
 }
 
 void String::Remove(int32 startIndex, int32 length)
@@ -174,13 +174,13 @@ void String::Remove(int32 startIndex, int32 length)
     }
 
     _length = oldLength - length;
-    _data = (Char*)Platform::Allocate((_length + 1) * sizeof(Char), 16);
+    _data = (Char*)Allocator::Allocate((_length + 1) * sizeof(Char));
 
     Platform::MemoryCopy(_data, oldData, startIndex * sizeof(Char));
     Platform::MemoryCopy(_data + startIndex, oldData + startIndex + length, (_length - startIndex) * sizeof(Char));
     _data[_length] = 0;
 
-    Platform::Free(oldData);
+    Allocator::Free(oldData);
 }
 
 void String::Split(Char c, Array<String>& results) const
@@ -378,11 +378,11 @@ void StringAnsi::Set(const char* chars, int32 length)
         char* data = nullptr;
         if (length != 0)
         {
-            data = (char*)Platform::Allocate((length + 1) * sizeof(char), 16);
+            data = (char*)Allocator::Allocate((length + 1) * sizeof(char));
             Platform::MemoryCopy(data, chars, length * sizeof(char));
             data[length] = 0;
         }
-        Platform::Free(_data);
+        Allocator::Free(_data);
         _data = data;
         _length = length;
     }
@@ -392,10 +392,10 @@ void StringAnsi::Set(const Char* chars, int32 length)
 {
     if (length != _length)
     {
-        Platform::Free(_data);
+        Allocator::Free(_data);
         if (length != 0)
         {
-            _data = (char*)Platform::Allocate((length + 1) * sizeof(char), 16);
+            _data = (char*)Allocator::Allocate((length + 1) * sizeof(char));
             _data[length] = 0;
         }
         else
@@ -418,13 +418,13 @@ void StringAnsi::Append(const char* chars, int32 count)
     const auto oldLength = _length;
 
     _length = oldLength + count;
-    _data = (char*)Platform::Allocate((_length + 1) * sizeof(char), 16);
+    _data = (char*)Allocator::Allocate((_length + 1) * sizeof(char));
 
     Platform::MemoryCopy(_data, oldData, oldLength * sizeof(char));
     Platform::MemoryCopy(_data + oldLength, chars, count * sizeof(char));
     _data[_length] = 0;
 
-    Platform::Free(oldData);
+    Allocator::Free(oldData);
 }
 
 void StringAnsi::Append(const Char* chars, int32 count)
@@ -436,13 +436,13 @@ void StringAnsi::Append(const Char* chars, int32 count)
     const auto oldLength = _length;
 
     _length = oldLength + count;
-    _data = (char*)Platform::Allocate((_length + 1) * sizeof(char), 16);
+    _data = (char*)Allocator::Allocate((_length + 1) * sizeof(char));
 
     Platform::MemoryCopy(_data, oldData, oldLength * sizeof(char));
     StringUtils::ConvertUTF162ANSI(chars, _data + oldLength, count * sizeof(char));
     _data[_length] = 0;
 
-    Platform::Free(oldData);
+    Allocator::Free(oldData);
 }
 
 StringAnsi& StringAnsi::operator+=(const StringAnsiView& str)
@@ -511,14 +511,14 @@ void StringAnsi::Insert(int32 startIndex, const StringAnsi& other)
     const auto oldLength = _length;
 
     _length = oldLength + otherLength;
-    _data = (char*)Platform::Allocate((_length + 1) * sizeof(char), 16);
+    _data = (char*)Allocator::Allocate((_length + 1) * sizeof(char));
 
     Platform::MemoryCopy(_data, oldData, startIndex * sizeof(char));
     Platform::MemoryCopy(_data + startIndex, other.Get(), otherLength * sizeof(char));
     Platform::MemoryCopy(_data + startIndex + otherLength, oldData + startIndex, (oldLength - startIndex) * sizeof(char));
     _data[_length] = 0;
 
-    Platform::Free(oldData);
+    Allocator::Free(oldData);
 }
 
 void StringAnsi::Remove(int32 startIndex, int32 length)
@@ -534,13 +534,13 @@ void StringAnsi::Remove(int32 startIndex, int32 length)
     }
 
     _length = oldLength - length;
-    _data = (char*)Platform::Allocate((_length + 1) * sizeof(char), 16);
+    _data = (char*)Allocator::Allocate((_length + 1) * sizeof(char));
 
     Platform::MemoryCopy(_data, oldData, startIndex * sizeof(char));
     Platform::MemoryCopy(_data + startIndex, oldData + startIndex + length, length * sizeof(char));
     _data[_length] = 0;
 
-    Platform::Free(oldData);
+    Allocator::Free(oldData);
 }
 
 void StringAnsi::Split(char c, Array<StringAnsi>& results) const
@@ -3,6 +3,7 @@
 #pragma once
 
 #include "Engine/Platform/Platform.h"
+#include "Engine/Core/Memory/Memory.h"
 #include "Engine/Platform/StringUtils.h"
 #include "Engine/Core/Formatting.h"
 
@@ -24,7 +25,7 @@ class StringBase
     /// </summary>
     ~StringBase()
     {
-        Platform::Free(_data);
+        Allocator::Free(_data);
     }
 
 public:
@@ -33,7 +34,7 @@ class StringBase
     /// </summary>
     void Clear()
     {
-        Platform::Free(_data);
+        Allocator::Free(_data);
         _data = nullptr;
         _length = 0;
     }
@@ -334,10 +335,10 @@ class StringBase
         ASSERT(length >= 0);
         if (length == _length)
             return;
-        Platform::Free(_data);
+        Allocator::Free(_data);
         if (length != 0)
         {
-            _data = (T*)Platform::Allocate((length + 1) * sizeof(T), 16);
+            _data = (T*)Allocator::Allocate((length + 1) * sizeof(T));
             _data[length] = 0;
         }
         else
@@ -474,7 +475,7 @@ class StringBase
             const auto oldLength = _length;
             const auto oldData = _data;
             _length += replacedCount * (replacementTextLength - searchTextLength);
-            _data = (T*)Platform::Allocate((_length + 1) * sizeof(T), 16);
+            _data = (T*)Allocator::Allocate((_length + 1) * sizeof(T));
 
             T* writePosition = _data;
             readPosition = oldData;
@@ -497,7 +498,7 @@ class StringBase
             Platform::MemoryCopy(writePosition, readPosition, writeOffset * sizeof(T));
 
             _data[_length] = 0;
-            Platform::Free(oldData);
+            Allocator::Free(oldData);
         }
 
         return replacedCount;
@@ -531,10 +532,10 @@ class StringBase
             const auto oldData = _data;
             const auto minLength = _length < length ? _length : length;
             _length = length;
-            _data = (T*)Platform::Allocate((length + 1) * sizeof(T), 16);
+            _data = (T*)Allocator::Allocate((length + 1) * sizeof(T));
             Platform::MemoryCopy(_data, oldData, minLength * sizeof(T));
             _data[length] = 0;
-            Platform::Free(oldData);
+            Allocator::Free(oldData);
         }
     }
 };
@@ -758,7 +759,7 @@ API_CLASS(InBuild) class FLAXENGINE_API String : public StringBase<Char>
     {
         String result;
         result._length = a.Length() + 1;
-        result._data = (Char*)Platform::Allocate((result._length + 1) * sizeof(Char), 16);
+        result._data = (Char*)Allocator::Allocate((result._length + 1) * sizeof(Char));
         Platform::MemoryCopy(result._data, a.Get(), a.Length() * sizeof(Char));
         result._data[a.Length()] = b;
         result._data[result._length] = 0;
@@ -775,7 +776,7 @@ API_CLASS(InBuild) class FLAXENGINE_API String : public StringBase<Char>
     {
         if (this != &s)
         {
-            Platform::Free(_data);
+            Allocator::Free(_data);
             _data = s._data;
             _length = s._length;
             s._data = nullptr;
@@ -1455,7 +1456,7 @@ API_CLASS(InBuild) class FLAXENGINE_API StringAnsi : public StringBase<char>
     {
         StringAnsi result;
         result._length = a.Length() + 1;
-        result._data = (char*)Platform::Allocate((result._length + 1) * sizeof(char), 16);
+        result._data = (char*)Allocator::Allocate((result._length + 1) * sizeof(char));
         Platform::MemoryCopy(result._data, a.Get(), a.Length() * sizeof(char));
         result._data[a.Length()] = b;
         result._data[result._length] = 0;
@@ -1472,7 +1473,7 @@ API_CLASS(InBuild) class FLAXENGINE_API StringAnsi : public StringBase<char>
     {
         if (this != &s)
         {
-            Platform::Free(_data);
+            Allocator::Free(_data);
             _data = s._data;
             _length = s._length;
             s._data = nullptr;
@@ -126,12 +126,14 @@ bool CommandLine::Parse(const Char* cmdLine)
     PARSE_BOOL_SWITCH("-novsync ", NoVSync);
     PARSE_BOOL_SWITCH("-nolog ", NoLog);
     PARSE_BOOL_SWITCH("-std ", Std);
+    PARSE_BOOL_SWITCH("-crtalloc ", CrtAlloc);
 #if !BUILD_RELEASE
     PARSE_ARG_SWITCH("-debug ", DebuggerAddress);
     PARSE_BOOL_SWITCH("-debugwait ", WaitForDebugger);
 #endif
 #if PLATFORM_HAS_HEADLESS_MODE
     PARSE_BOOL_SWITCH("-headless ", Headless);
+    PARSE_BOOL_SWITCH("-server ", Server);
 #endif
     PARSE_BOOL_SWITCH("-d3d12 ", D3D12);
     PARSE_BOOL_SWITCH("-d3d11 ", D3D11);
@@ -49,6 +49,11 @@ class CommandLine
         /// </summary>
         Nullable<bool> Std;
 
+        /// <summary>
+        /// -crtalloc (use the system memory allocator instead of the small objects allocator)
+        /// </summary>
+        Nullable<bool> CrtAlloc;
+
 #if !BUILD_RELEASE
 
         /// <summary>
@@ -70,6 +75,11 @@ class CommandLine
         /// </summary>
         Nullable<bool> Headless;
 
+        /// <summary>
+        /// -server (Run as a dedicated server: headless, without rendering and audio)
+        /// </summary>
+        Nullable<bool> Server;
+
 #endif
 
         /// <summary>
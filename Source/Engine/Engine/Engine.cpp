@@ -57,6 +57,7 @@ namespace EngineImpl
     void InitLog();
     void InitPaths();
     void InitMainWindow();
+    void OnFrame();
 }
 
 DateTime Engine::StartupTime;
@@ -85,6 +86,10 @@ int32 Engine::Main(const Char* cmdLine)
         Platform::Fatal(TEXT("Invalid command line."));
         return -1;
     }
+#if USE_SMALL_OBJECT_ALLOCATOR
+    if (CommandLine::Options.CrtAlloc.IsTrue())
+        SmallObjectAllocator::Enabled = false;
+#endif
 
 #if FLAX_TESTS
     // Configure engine for test running environment
@@ -93,6 +98,15 @@ int32 Engine::Main(const Char* cmdLine)
     CommandLine::Options.Mute = true;
     CommandLine::Options.Std = true;
 #endif
+#if PLATFORM_HAS_HEADLESS_MODE
+    if (CommandLine::Options.Server.IsTrue())
+    {
+        // Dedicated server runs without a window, rendering and audio
+        CommandLine::Options.Headless = true;
+        CommandLine::Options.Null = true;
+        CommandLine::Options.Mute = true;
+    }
+#endif
 
     if (Platform::Init())
     {
@@ -157,21 +171,13 @@ int32 Engine::Main(const Char* cmdLine)
     EngineImpl::IsReady = true;
 
     // Main engine loop
-    const bool useSleep = true; // TODO: this should probably be a platform setting
+    const bool isServer = IsServer();
     while (!ShouldExit())
     {
         // Reduce CPU usage by introducing idle time if the engine is running very fast and has enough time to spend
-        if ((useSleep && Time::UpdateFPS > ZeroTolerance) || !Platform::GetHasFocus())
+        if (Time::UpdateFPS > ZeroTolerance || !Platform::GetHasFocus())
         {
-            double nextTick = Time::GetNextTick();
-            double timeToTick = nextTick - Platform::GetTimeSeconds();
-
-            // Sleep less than needed, some platforms may sleep slightly more than requested
-            if (timeToTick > 0.002)
-            {
-                PROFILE_CPU_NAMED("Idle");
-                Platform::Sleep(1);
-            }
+            Time::WaitForNextTick();
         }
 
         // App paused logic
@@ -191,6 +197,8 @@ int32 Engine::Main(const Char* cmdLine)
         // Update game logic
         if (Time::OnBeginUpdate())
         {
+            if (isServer)
+                EngineImpl::OnFrame(); // Dedicated server doesn't draw so count frames with the updates
             OnUpdate();
             OnLateUpdate();
             Time::OnEndUpdate();
@@ -205,8 +213,11 @@ int32 Engine::Main(const Char* cmdLine)
         }
 
         // Draw frame
-        if (Time::OnBeginDraw())
+        if (!isServer && Time::OnBeginDraw())
         {
+            // Collect physics simulation results before drawing when interpolating between the fixed timestep states
+            if (Time::PhysicsFixedTimestep)
+                Physics::CollectResults();
             OnDraw();
             Time::OnEndDraw();
             FrameMark;
@@ -349,8 +360,7 @@ void Engine::OnDraw()
     PROFILE_CPU_NAMED("Draw");
 
     // Begin frame rendering
-    FrameCount++;
-    const double time = Platform::GetTimeSeconds();
+    EngineImpl::OnFrame();
     auto device = GPUDevice::Instance;
     device->Locker.Lock();
 #if COMPILE_WITH_PROFILER
@@ -364,23 +374,6 @@ void Engine::OnDraw()
     ProfilerGPU::EndFrame();
 #endif
     device->Locker.Unlock();
-
-    // Calculate FPS
-    EngineImpl::FpsAccumulatedFrames++;
-    if (time - EngineImpl::FpsAccumulated >= 1.0)
-    {
-        EngineImpl::Fps = EngineImpl::FpsAccumulatedFrames;
-        EngineImpl::FpsAccumulatedFrames = 0;
-        EngineImpl::FpsAccumulated = time;
-    }
-
-#if !LOG_ENABLE_AUTO_FLUSH
-    // Flush log file every fourth frame
-    if (FrameCount % 4 == 0)
-    {
-        LOG_FLUSH();
-    }
-#endif
 }
 
 bool Engine::IsHeadless()
@@ -392,6 +385,15 @@ bool Engine::IsHeadless()
 #endif
 }
 
+bool Engine::IsServer()
+{
+#if PLATFORM_HAS_HEADLESS_MODE
+    return CommandLine::Options.Server.IsTrue();
+#else
+    return false;
+#endif
+}
+
 bool Engine::IsReady()
 {
     return EngineImpl::IsReady;
@@ -626,6 +628,29 @@ void EngineImpl::InitPaths()
     Platform::SetWorkingDirectory(Globals::ProjectFolder);
 }
 
+void EngineImpl::OnFrame()
+{
+    Engine::FrameCount++;
+
+    // Calculate FPS
+    const double time = Platform::GetTimeSeconds();
+    FpsAccumulatedFrames++;
+    if (time - FpsAccumulated >= 1.0)
+    {
+        Fps = FpsAccumulatedFrames;
+        FpsAccumulatedFrames = 0;
+        FpsAccumulated = time;
+    }
+
+#if !LOG_ENABLE_AUTO_FLUSH
+    // Flush log file every fourth frame
+    if (Engine::FrameCount % 4 == 0)
+    {
+        LOG_FLUSH();
+    }
+#endif
+}
+
 void EngineImpl::InitMainWindow()
 {
 #if PLATFORM_HAS_HEADLESS_MODE
@@ -132,6 +132,9 @@ DECLARE_SCRIPTING_TYPE_NO_SPAWN(Engine);
     // Returns true if engine is running without main window (aka headless mode).
     API_PROPERTY() static bool IsHeadless();
 
+    // Returns true if engine is running as a dedicated server (headless mode without rendering). Draw-only services are not initialized and the draw tick is skipped.
+    API_PROPERTY() static bool IsServer();
+
     // True if Engine is ready to work (init and not disposing)
     static bool IsReady();
 
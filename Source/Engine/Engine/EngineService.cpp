@@ -1,6 +1,7 @@
 // Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
 
 #include "EngineService.h"
+#include "Engine.h"
 #include "Engine/Core/Log.h"
 #include "Engine/Core/Collections/Array.h"
 #include "Engine/Core/Collections/Sorting.h"
@@ -49,10 +50,11 @@ void EngineService::Sort()
     Sorting::QuickSort(services.Get(), services.Count(), &CompareEngineServices);
 }
 
-EngineService::EngineService(const Char* name, int32 order)
+EngineService::EngineService(const Char* name, int32 order, bool drawOnly)
 {
     Name = name;
     Order = order;
+    DrawOnly = drawOnly;
 
     auto& services = GetServices();
     services.Add(this);
@@ -72,6 +74,18 @@ void EngineService::OnInit()
 
     // Init services from front to back
     auto& services = GetServices();
+    if (Engine::IsServer())
+    {
+        // Unregister services not used without rendering
+        for (int32 i = services.Count() - 1; i >= 0; i--)
+        {
+            if (services[i]->DrawOnly)
+            {
+                LOG(Info, "Skip {0} (dedicated server)", services[i]->Name);
+                services.RemoveAtKeepOrder(i);
+            }
+        }
+    }
 #if TRACY_ENABLE
     Char nameBuffer[100];
 #endif
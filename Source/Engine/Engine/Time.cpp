@@ -1,17 +1,25 @@
 // Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
 
 #include "Time.h"
+#include "Engine.h"
 #include "EngineService.h"
+#include "Engine/Core/Log.h"
 #include "Engine/Core/Math/Math.h"
 #include "Engine/Platform/Platform.h"
 #include "Engine/Core/Config/TimeSettings.h"
 #include "Engine/Serialization/Serialization.h"
+#include "Engine/Profiler/ProfilerCPU.h"
 
 namespace
 {
     bool FixedDeltaTimeEnable;
     float FixedDeltaTimeValue;
     float MaxUpdateDeltaTime = 0.1f;
+
+    // Average time the sleep overshoots the requested wake up time (used to adapt the spinning time)
+    double PacingOversleep = 0.001;
+    double PacingErrorSum = 0.0;
+    FramePacingStats PacingStats;
 }
 
 bool Time::_gamePaused = false;
@@ -21,6 +29,9 @@ float Time::UpdateFPS = 60.0f;
 float Time::PhysicsFPS = 60.0f;
 float Time::DrawFPS = 60.0f;
 float Time::TimeScale = 1.0f;
+FramePacingMode Time::FramePacing = FramePacingMode::LowLatency;
+bool Time::PhysicsFixedTimestep = false;
+int32 Time::PhysicsMaxSteps = 4;
 Time::TickData Time::Update;
 Time::FixedStepTickData Time::Physics;
 Time::TickData Time::Draw;
@@ -41,6 +52,14 @@ class TimeService : public EngineService
         Time::_gamePaused = true;
 #endif
     }
+
+    void Dispose() override
+    {
+        if (PacingStats.Count != 0)
+        {
+            LOG(Info, "Frame pacing: {0} waits, average error: {1} ms, max error: {2} ms, late: {3}", PacingStats.Count, PacingStats.AverageError, PacingStats.MaxError, PacingStats.LateCount);
+        }
+    }
 };
 
 TimeService TimeServiceInstance;
@@ -51,6 +70,9 @@ void TimeSettings::Apply()
     Time::PhysicsFPS = PhysicsFPS;
     Time::DrawFPS = DrawFPS;
     Time::TimeScale = TimeScale;
+    Time::FramePacing = FramePacing;
+    Time::PhysicsFixedTimestep = PhysicsFixedTimestep;
+    Time::PhysicsMaxSteps = PhysicsMaxSteps;
     ::MaxUpdateDeltaTime = MaxUpdateDeltaTime;
 }
 
@@ -61,6 +83,9 @@ void TimeSettings::Deserialize(DeserializeStream& stream, ISerializeModifier* mo
     DESERIALIZE(DrawFPS);
     DESERIALIZE(TimeScale);
     DESERIALIZE(MaxUpdateDeltaTime);
+    DESERIALIZE(FramePacing);
+    DESERIALIZE(PhysicsFixedTimestep);
+    DESERIALIZE(PhysicsMaxSteps);
 }
 
 void Time::TickData::OnBeforeRun(float targetFps, double currentTime)
@@ -135,10 +160,52 @@ void Time::TickData::Advance(double time, double deltaTime)
     TicksCount++;
 }
 
+void Time::FixedStepTickData::OnBeforeRun(float targetFps, double currentTime)
+{
+    TickData::OnBeforeRun(targetFps, currentTime);
+    Accumulator = 0.0;
+    AccumulatorTime = currentTime;
+}
+
+void Time::FixedStepTickData::OnReset(float targetFps, double currentTime)
+{
+    TickData::OnReset(targetFps, currentTime);
+    Accumulator = 0.0;
+    AccumulatorTime = currentTime;
+}
+
+bool Time::FixedStepTickData::OnFixedStep(double time, float targetFps, int32 maxSteps)
+{
+    // Accumulate the frame time and consume it in the fixed steps
+    const double step = 1.0 / targetFps;
+    const double epsilon = step * 0.0001; // Prevent losing the whole step due to the rounding errors
+    Accumulator += Math::Max(time - AccumulatorTime, 0.0);
+    AccumulatorTime = time;
+    Accumulator = Math::Min(Accumulator, step * Math::Max(maxSteps, 1));
+    if (Accumulator < step - epsilon)
+    {
+        NextBegin = time + (step - Accumulator);
+        return false;
+    }
+    Accumulator = Math::Max(Accumulator - step, 0.0);
+    NextBegin = Accumulator < step - epsilon ? time + (step - Accumulator) : time;
+    Samples.Add(step);
+    Advance(time, step);
+    return true;
+}
+
+float Time::FixedStepTickData::GetInterpolationAlpha(double time, float targetFps) const
+{
+    const double accumulator = Accumulator + Math::Max(time - AccumulatorTime, 0.0);
+    return Math::Saturate((float)(accumulator * targetFps));
+}
+
 bool Time::FixedStepTickData::OnTickBegin(float targetFps, float maxDeltaTime)
 {
     // Check if can perform a tick
     double time = Platform::GetTimeSeconds();
+    if (PhysicsFixedTimestep && targetFps > ZeroTolerance && !FixedDeltaTimeEnable)
+        return OnFixedStep(time, targetFps, PhysicsMaxSteps);
     double deltaTime, minDeltaTime;
     if (FixedDeltaTimeEnable)
     {
@@ -193,7 +260,7 @@ double Time::GetNextTick()
         nextTick = nextUpdate;
     if (PhysicsFPS > ZeroTolerance && nextPhysics < nextTick)
         nextTick = nextPhysics;
-    if (DrawFPS > ZeroTolerance && nextDraw < nextTick)
+    if (DrawFPS > ZeroTolerance && nextDraw < nextTick && !Engine::IsServer())
         nextTick = nextDraw;
 
     if (nextTick == MAX_double)
@@ -249,6 +316,24 @@ void Time::SetFixedDeltaTime(bool enable, float value)
     FixedDeltaTimeValue = value;
 }
 
+float Time::GetPhysicsInterpolationAlpha()
+{
+    if (!PhysicsFixedTimestep || PhysicsFPS <= ZeroTolerance)
+        return 1.0f;
+    return Physics.GetInterpolationAlpha(Platform::GetTimeSeconds(), PhysicsFPS);
+}
+
+FramePacingStats Time::GetFramePacingStats()
+{
+    return PacingStats;
+}
+
+void Time::ResetFramePacingStats()
+{
+    PacingStats = FramePacingStats();
+    PacingErrorSum = 0.0;
+}
+
 void Time::OnBeforeRun()
 {
     // Initialize tick data (based on a time settings)
@@ -258,6 +343,58 @@ void Time::OnBeforeRun()
     Draw.OnBeforeRun(DrawFPS, time);
 }
 
+void Time::WaitForNextTick()
+{
+    const double nextTick = GetNextTick();
+    double now = Platform::GetTimeSeconds();
+    if (nextTick <= now)
+        return;
+    PROFILE_CPU_NAMED("Idle");
+
+    // Wake up a bit before the tick and spin the remaining time (sleep can overshoot the requested time depending on the system scheduler)
+    double spinTime;
+    switch (FramePacing)
+    {
+    case FramePacingMode::LowLatency:
+        spinTime = Math::Min(PacingOversleep * 2.0 + 0.0005, 0.002);
+        break;
+    case FramePacingMode::FixedTick:
+        spinTime = Math::Min(PacingOversleep + 0.0001, 0.001);
+        break;
+    default:
+        spinTime = 0.0;
+        break;
+    }
+    const double wakeTime = nextTick - spinTime;
+    if (wakeTime > now)
+    {
+        Platform::SleepUntil(wakeTime);
+        now = Platform::GetTimeSeconds();
+        PacingOversleep += (Math::Max(now - wakeTime, 0.0) - PacingOversleep) * 0.1;
+    }
+    if (spinTime > 0.0)
+    {
+        while (now < nextTick)
+        {
+            if (FramePacing == FramePacingMode::FixedTick)
+                Platform::Sleep(0);
+            now = Platform::GetTimeSeconds();
+        }
+    }
+
+    if (now < nextTick)
+        return; // Woke up too early (main loop will wait again)
+
+    // Update statistics
+    const double error = now - nextTick;
+    PacingStats.Count++;
+    PacingErrorSum += error;
+    PacingStats.AverageError = (float)(PacingErrorSum / (double)PacingStats.Count * 1000.0);
+    PacingStats.MaxError = Math::Max(PacingStats.MaxError, (float)(error * 1000.0));
+    if (error > 0.001)
+        PacingStats.LateCount++;
+}
+
 bool Time::OnBeginUpdate()
 {
     if (Update.OnTickBegin(UpdateFPS, MaxUpdateDeltaTime))
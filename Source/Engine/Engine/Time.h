@@ -7,6 +7,47 @@
 #include "Engine/Scripting/ScriptingType.h"
 #include "Engine/Core/Collections/SamplesBuffer.h"
 
+/// <summary>
+/// The policies of waiting for the next tick in the engine main loop (frame pacing).
+/// </summary>
+API_ENUM() enum class FramePacingMode
+{
+    /// <summary>Sleeps until shortly before the next tick and spins the remaining time to wake up as close to the tick as possible. Uses a bit more CPU time for the lowest frame time jitter.</summary>
+    LowLatency = 0,
+    /// <summary>Sleeps until the next tick without spinning. Uses the least CPU time but the wake up can be late by the system scheduler latency.</summary>
+    PowerSaving = 1,
+    /// <summary>Sleeps until shortly before the next tick and yields the CPU to other threads for the remaining time. Keeps a stable tick rate without burning a core (eg. for dedicated servers).</summary>
+    FixedTick = 2,
+};
+
+/// <summary>
+/// The frame pacing statistics (how precisely the engine main loop wakes up for the next tick).
+/// </summary>
+API_STRUCT(NoDefault) struct FLAXENGINE_API FramePacingStats
+{
+    DECLARE_SCRIPTING_TYPE_MINIMAL(FramePacingStats);
+
+    /// <summary>
+    /// The amount of the waits for the next tick.
+    /// </summary>
+    API_FIELD() int64 Count = 0;
+
+    /// <summary>
+    /// The average delay of the wake up after the tick time (in milliseconds).
+    /// </summary>
+    API_FIELD() float AverageError = 0.0f;
+
+    /// <summary>
+    /// The maximum delay of the wake up after the tick time (in milliseconds).
+    /// </summary>
+    API_FIELD() float MaxError = 0.0f;
+
+    /// <summary>
+    /// The amount of the wake ups delayed by more than a millisecond after the tick time.
+    /// </summary>
+    API_FIELD() int64 LateCount = 0;
+};
+
 /// <summary>
 /// Game ticking and timing system.
 /// </summary>
@@ -98,9 +139,38 @@ DECLARE_SCRIPTING_TYPE_NO_SPAWN(Time);
         /// </summary>
         SamplesBuffer<double, 4> Samples;
 
+        /// <summary>
+        /// The accumulated time not simulated yet (used by the fixed timestep mode).
+        /// </summary>
+        double Accumulator = 0.0;
+
+        /// <summary>
+        /// The time of the last accumulation (used by the fixed timestep mode).
+        /// </summary>
+        double AccumulatorTime = 0.0;
+
     public:
 
+        /// <summary>
+        /// Performs the fixed timestep tick. Accumulates the time since the last call and consumes it in the constant steps.
+        /// </summary>
+        /// <param name="time">The current time (in seconds).</param>
+        /// <param name="targetFps">The simulation rate (step is 1/targetFps).</param>
+        /// <param name="maxSteps">The maximum amount of steps to accumulate (the excess time is dropped).</param>
+        /// <returns>True if the tick can be performed, otherwise false.</returns>
+        bool OnFixedStep(double time, float targetFps, int32 maxSteps);
+
+        /// <summary>
+        /// Gets the interpolation factor (normalized) between the last two fixed steps at the given time.
+        /// </summary>
+        /// <param name="time">The current time (in seconds).</param>
+        /// <param name="targetFps">The simulation rate (step is 1/targetFps).</param>
+        /// <returns>The interpolation factor.</returns>
+        float GetInterpolationAlpha(double time, float targetFps) const;
+
         // [TickData]
+        void OnBeforeRun(float targetFps, double currentTime) override;
+        void OnReset(float targetFps, double currentTime) override;
         bool OnTickBegin(float targetFps, float maxDeltaTime) override;
     };
 
@@ -139,6 +209,21 @@ DECLARE_SCRIPTING_TYPE_NO_SPAWN(Time);
     /// </summary>
     API_FIELD() static float TimeScale;
 
+    /// <summary>
+    /// The policy of waiting for the next tick in the engine main loop.
+    /// </summary>
+    API_FIELD() static FramePacingMode FramePacing;
+
+    /// <summary>
+    /// Enables the fixed timestep for the physics simulation. Physics is stepped always by 1/PhysicsFPS using the accumulated frame time (deterministic and independent from the frame rate) and rigid bodies can interpolate their transformation between the steps when drawing.
+    /// </summary>
+    API_FIELD() static bool PhysicsFixedTimestep;
+
+    /// <summary>
+    /// The maximum amount of physics steps to catch up with the frame time when using the fixed timestep. Prevents the spiral of death when simulation takes longer than the step (the remaining time is dropped so the game slows down).
+    /// </summary>
+    API_FIELD() static int32 PhysicsMaxSteps;
+
 public:
 
     /// <summary>
@@ -225,11 +310,27 @@ DECLARE_SCRIPTING_TYPE_NO_SPAWN(Time);
     /// <param name="value">The fixed draw/update rate for the time.</param>
     API_FUNCTION() static void SetFixedDeltaTime(bool enable, float value);
 
+    /// <summary>
+    /// Gets the interpolation factor (normalized) between the last two physics simulation steps for the current time. Returns 1 if not using the fixed timestep.
+    /// </summary>
+    API_PROPERTY() static float GetPhysicsInterpolationAlpha();
+
+    /// <summary>
+    /// Gets the frame pacing statistics (precision of waiting for the next tick in the engine main loop).
+    /// </summary>
+    API_PROPERTY() static FramePacingStats GetFramePacingStats();
+
+    /// <summary>
+    /// Resets the frame pacing statistics.
+    /// </summary>
+    API_FUNCTION() static void ResetFramePacingStats();
+
 private:
 
     // Methods used by the Engine class
 
     static void OnBeforeRun();
+    static void WaitForNextTick();
 
     static bool OnBeginUpdate();
     static bool OnBeginPhysics();
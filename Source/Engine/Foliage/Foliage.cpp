@@ -5,19 +5,21 @@
 #include "FoliageCluster.h"
 #include "Engine/Core/Log.h"
 #include "Engine/Core/Random.h"
+#include "Engine/Core/Math/CollisionsHelper.h"
+#include "Engine/Core/Types/Span.h"
 #include "Engine/Engine/Engine.h"
 #include "Engine/Graphics/RenderTask.h"
+#include "Engine/Graphics/RenderTools.h"
 #if !FOLIAGE_USE_SINGLE_QUAD_TREE
 #include "Engine/Threading/JobSystem.h"
 #if FOLIAGE_USE_DRAW_CALLS_BATCHING
-#include "Engine/Graphics/RenderTools.h"
 #include "Engine/Graphics/GPUDevice.h"
-#include "Engine/Renderer/RenderList.h"
 #endif
 #endif
 #include "Engine/Level/SceneQuery.h"
 #include "Engine/Profiler/ProfilerCPU.h"
 #include "Engine/Renderer/GlobalSignDistanceFieldPass.h"
+#include "Engine/Renderer/RenderList.h"
 #include "Engine/Renderer/GI/GlobalSurfaceAtlasPass.h"
 #include "Engine/Serialization/Serialization.h"
 #include "Engine/Utilities/Encryption.h"
@@ -94,6 +96,21 @@ void Foliage::AddToCluster(ChunkedArray<FoliageCluster, FOLIAGE_CLUSTER_CHUNKS_S
     }
 }
 
+namespace
+{
+    // Culls all the cluster instances with the view frustum at once (outputs the instances bounds relative to the view origin)
+    void CullClusterInstances(const RenderContext& renderContext, const FoliageCluster* cluster, BoundingSphere* spheres, bool* visible)
+    {
+        const int32 count = cluster->Instances.Count();
+        for (int32 i = 0; i < count; i++)
+        {
+            spheres[i] = cluster->Instances.Get()[i]->Bounds;
+            spheres[i].Center -= renderContext.View.Origin;
+        }
+        CollisionsHelper::FrustumIntersectsSpheres(renderContext.View.CullingFrustum, ToSpan(spheres, count), ToSpan(visible, count));
+    }
+}
+
 #if !FOLIAGE_USE_SINGLE_QUAD_TREE && FOLIAGE_USE_DRAW_CALLS_BATCHING
 
 void Foliage::DrawInstance(RenderContext& renderContext, FoliageInstance& instance, const FoliageType& type, Model* model, int32 lod, float lodDitherFactor, DrawCallsList* drawCallsLists, BatchedDrawCalls& result) const
@@ -154,7 +171,7 @@ void Foliage::DrawCluster(RenderContext& renderContext, FoliageCluster* cluster,
         box = cluster->Children[idx]->TotalBounds; \
         box.Minimum -= viewOrigin; \
         box.Maximum -= viewOrigin; \
-		if (renderContext.View.CullingFrustum.Intersects(box)) \
+		if (renderContext.View.CullingFrustum.Intersects(box) && !renderContext.List->Occlusion.IsOccluded(box)) \
 			DrawCluster(renderContext, cluster->Children[idx], type, drawCallsLists, result)
         DRAW_CLUSTER(0);
         DRAW_CLUSTER(1);
@@ -167,16 +184,26 @@ void Foliage::DrawCluster(RenderContext& renderContext, FoliageCluster* cluster,
         // Draw visible instances
         const auto frame = Engine::FrameCount;
         const auto model = type.Model.Get();
+        BoundingSphere spheres[FOLIAGE_CLUSTER_CAPACITY];
+        bool visible[FOLIAGE_CLUSTER_CAPACITY];
+        CullClusterInstances(renderContext, cluster, spheres, visible);
         for (int32 i = 0; i < cluster->Instances.Count(); i++)
         {
             auto& instance = *cluster->Instances.Get()[i];
-            BoundingSphere sphere = instance.Bounds;
-            sphere.Center -= viewOrigin;
-            if (Float3::Distance(renderContext.View.Position, sphere.Center) - (float)sphere.Radius < instance.CullDistance &&
-                renderContext.View.CullingFrustum.Intersects(sphere))
+            const BoundingSphere& sphere = spheres[i];
+            if (visible[i] &&
+                Float3::Distance(renderContext.View.Position, sphere.Center) - (float)sphere.Radius < instance.CullDistance)
             {
                 const auto modelFrame = instance.DrawState.PrevFrame + 1;
 
+                // Replace the distant instance with the impostor
+                const float impostorFade = type.Impostor.IsEnabled() ? type.Impostor.Draw(renderContext, model, _transform.LocalToWorld(instance.Transform)) : 0.0f;
+                if (impostorFade >= 1.0f)
+                {
+                    instance.DrawState.PrevFrame = frame;
+                    continue;
+                }
+
                 // Select a proper LOD index (model may be culled)
                 int32 lodIndex = RenderTools::ComputeModelLOD(model, sphere.Center, (float)sphere.Radius, renderContext);
                 if (lodIndex == -1)
@@ -236,7 +263,12 @@ void Foliage::DrawCluster(RenderContext& renderContext, FoliageCluster* cluster,
                 }
 
                 // Draw
-                if (instance.DrawState.PrevLOD == lodIndex)
+                if (impostorFade > 0.0f)
+                {
+                    // Dither-out the instance during the cross-fade with the impostor
+                    DrawInstance(renderContext, instance, type, model, lodIndex, impostorFade, drawCallsLists, result);
+                }
+                else if (instance.DrawState.PrevLOD == lodIndex)
                 {
                     DrawInstance(renderContext, instance, type, model, lodIndex, 0.0f, drawCallsLists, result);
                 }
@@ -283,7 +315,7 @@ void Foliage::DrawCluster(RenderContext& renderContext, FoliageCluster* cluster,
         box = cluster->Children[idx]->TotalBounds; \
         box.Minimum -= viewOrigin; \
         box.Maximum -= viewOrigin; \
-		if (renderContext.View.CullingFrustum.Intersects(box)) \
+		if (renderContext.View.CullingFrustum.Intersects(box) && !renderContext.List->Occlusion.IsOccluded(box)) \
 			DrawCluster(renderContext, cluster->Children[idx], draw)
         DRAW_CLUSTER(0);
         DRAW_CLUSTER(1);
@@ -295,20 +327,30 @@ void Foliage::DrawCluster(RenderContext& renderContext, FoliageCluster* cluster,
     {
         // Draw visible instances
         const auto frame = Engine::FrameCount;
+        BoundingSphere spheres[FOLIAGE_CLUSTER_CAPACITY];
+        bool visible[FOLIAGE_CLUSTER_CAPACITY];
+        CullClusterInstances(renderContext, cluster, spheres, visible);
         for (int32 i = 0; i < cluster->Instances.Count(); i++)
         {
             auto& instance = *cluster->Instances[i];
             auto& type = FoliageTypes[instance.Type];
-            BoundingSphere sphere = instance.Bounds;
-            sphere.Center -= viewOrigin;
+            const BoundingSphere& sphere = spheres[i];
 
             // Check if can draw this instance
             if (type._canDraw &&
-                Float3::Distance(renderContext.View.Position, sphere.Center) - (float)sphere.Radius < instance.CullDistance &&
-                renderContext.View.CullingFrustum.Intersects(sphere))
+                visible[i] &&
+                Float3::Distance(renderContext.View.Position, sphere.Center) - (float)sphere.Radius < instance.CullDistance)
             {
-                Matrix world;
+                // Replace the distant instance with the impostor
                 const Transform transform = _transform.LocalToWorld(instance.Transform);
+                const float impostorFade = type.Impostor.IsEnabled() ? type.Impostor.Draw(renderContext, type.Model, transform) : 0.0f;
+                if (impostorFade >= 1.0f)
+                {
+                    instance.DrawState.PrevFrame = frame;
+                    continue;
+                }
+
+                Matrix world;
                 const Float3 translation = transform.Translation - renderContext.View.Origin;
                 Matrix::Transformation(transform.Scale, transform.Orientation, translation, world);
 
@@ -324,7 +366,17 @@ void Foliage::DrawCluster(RenderContext& renderContext, FoliageCluster* cluster,
                 draw.Bounds = sphere;
                 draw.PerInstanceRandom = instance.Random;
                 draw.DrawModes = type._drawModes;
-                type.Model->Draw(renderContext, draw);
+                if (impostorFade > 0.0f)
+                {
+                    // Dither-out the instance during the cross-fade with the impostor
+                    const int32 lodIndex = RenderTools::ComputeModelLOD(type.Model, sphere.Center, (float)sphere.Radius, renderContext);
+                    if (lodIndex != -1)
+                        type.Model->LODs[type.Model->ClampLODIndex(lodIndex + renderContext.View.ModelLODBias)].Draw(renderContext, draw, impostorFade);
+                }
+                else
+                {
+                    type.Model->Draw(renderContext, draw);
+                }
 
                 //DebugDraw::DrawSphere(instance.Bounds, Color::YellowGreen);
 
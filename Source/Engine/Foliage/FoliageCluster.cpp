@@ -3,6 +3,36 @@
 #include "FoliageCluster.h"
 #include "FoliageInstance.h"
 #include "Foliage.h"
+#include "Engine/Core/Math/CollisionsHelper.h"
+#include "Engine/Core/Collections/Sorting.h"
+#include "Engine/Core/Types/Span.h"
+
+namespace
+{
+    struct RayHit
+    {
+        float Distance;
+        int32 Index;
+
+        bool operator<(const RayHit& other) const
+        {
+            return Distance < other.Distance;
+        }
+    };
+
+    // Gets the items hit by the ray sorted by the distance to their bounds
+    int32 SortRayHits(const float* distances, int32 count, RayHit* hits)
+    {
+        int32 hitsCount = 0;
+        for (int32 i = 0; i < count; i++)
+        {
+            if (distances[i] < MAX_float)
+                hits[hitsCount++] = { distances[i], i };
+        }
+        Sorting::QuickSort(hits, hitsCount);
+        return hitsCount;
+    }
+}
 
 void FoliageCluster::Init(const BoundingBox& bounds)
 {
@@ -95,31 +125,41 @@ bool FoliageCluster::Intersects(Foliage* foliage, const Ray& ray, Real& distance
     Vector3 minDistanceNormal = Vector3::Up;
     FoliageInstance* minInstance = nullptr;
 
+    // Test bounds of all children (or instances) at once and visit them from the closest one until the found hit is closer than the next bounds
+    float distances[FOLIAGE_CLUSTER_CAPACITY];
+    RayHit hits[FOLIAGE_CLUSTER_CAPACITY];
     if (Children[0])
     {
-#define CHECK_CHILD(idx) \
-		if (Children[idx]->TotalBounds.Intersects(ray) && Children[idx]->Intersects(foliage, ray, distance, normal, instance) && minDistance > distance) \
-		{ \
-			minDistanceNormal = normal; \
-			minDistance = distance; \
-			minInstance = instance; \
-			result = true; \
-		}
-        CHECK_CHILD(0);
-        CHECK_CHILD(1);
-        CHECK_CHILD(2);
-        CHECK_CHILD(3);
-#undef CHECK_CHILD
+        const BoundingBox bounds[4] = { Children[0]->TotalBounds, Children[1]->TotalBounds, Children[2]->TotalBounds, Children[3]->TotalBounds };
+        CollisionsHelper::RayIntersectsBoxes(ray, ToSpan(bounds, 4), ToSpan(distances, 4));
+        const int32 hitsCount = SortRayHits(distances, 4, hits);
+        for (int32 i = 0; i < hitsCount && hits[i].Distance < minDistance; i++)
+        {
+            if (Children[hits[i].Index]->Intersects(foliage, ray, distance, normal, instance) && minDistance > distance)
+            {
+                minDistanceNormal = normal;
+                minDistance = distance;
+                minInstance = instance;
+                result = true;
+            }
+        }
     }
     else
     {
-        Mesh* mesh;
+        BoundingSphere bounds[FOLIAGE_CLUSTER_CAPACITY];
         for (int32 i = 0; i < Instances.Count(); i++)
+            bounds[i] = Instances[i]->Bounds;
+        CollisionsHelper::RayIntersectsSpheres(ray, ToSpan(bounds, Instances.Count()), ToSpan(distances, Instances.Count()));
+        const int32 hitsCount = SortRayHits(distances, Instances.Count(), hits);
+        Mesh* mesh;
+        for (int32 i = 0; i < hitsCount && hits[i].Distance < minDistance; i++)
         {
-            auto& ii = *Instances[i];
+            auto& ii = *Instances[hits[i].Index];
             auto& type = foliage->FoliageTypes[ii.Type];
+            if (!type.IsReady())
+                continue;
             const Transform transform = foliage->GetTransform().LocalToWorld(ii.Transform);
-            if (type.IsReady() && ii.Bounds.Intersects(ray) && type.Model->Intersects(ray, transform, distance, normal, &mesh) && minDistance > distance)
+            if (type.Model->Intersects(ray, transform, distance, normal, &mesh) && minDistance > distance)
             {
                 minDistanceNormal = normal;
                 minDistance = distance;
@@ -5,6 +5,9 @@
 #include "Engine/Core/Random.h"
 #include "Engine/Serialization/Serialization.h"
 #include "Foliage.h"
+#if USE_EDITOR
+#include "Engine/Renderer/ImpostorsRenderer.h"
+#endif
 
 FoliageType::FoliageType()
     : ScriptingObject(SpawnParams(Guid::New(), TypeInitializer))
@@ -33,6 +36,7 @@ FoliageType& FoliageType::operator=(const FoliageType& other)
     ScaleInLightmap = other.ScaleInLightmap;
     DrawModes = other.DrawModes;
     ShadowsMode = other.ShadowsMode;
+    Impostor = other.Impostor;
     PaintDensity = other.PaintDensity;
     PaintRadius = other.PaintRadius;
     PaintGroundSlopeAngleMin = other.PaintGroundSlopeAngleMin;
@@ -67,6 +71,16 @@ void FoliageType::SetMaterials(const Array<MaterialBase*>& value)
         Entries[i].Material = value[i];
 }
 
+#if USE_EDITOR
+
+void FoliageType::BakeImpostor(int32 frames, int32 resolution)
+{
+    if (Foliage)
+        ImpostorsRenderer::Bake(Foliage, Index, frames, resolution);
+}
+
+#endif
+
 Float3 FoliageType::GetRandomScale() const
 {
     Float3 result;
@@ -148,6 +162,7 @@ void FoliageType::Serialize(SerializeStream& stream, const void* otherObj)
     SERIALIZE(ScaleInLightmap);
     SERIALIZE(DrawModes);
     SERIALIZE(ShadowsMode);
+    SERIALIZE(Impostor);
     SERIALIZE_BIT(ReceiveDecals);
     SERIALIZE_BIT(UseDensityScaling);
     SERIALIZE(DensityScalingScale);
@@ -188,6 +203,7 @@ void FoliageType::Deserialize(DeserializeStream& stream, ISerializeModifier* mod
     DESERIALIZE(ScaleInLightmap);
     DESERIALIZE(DrawModes);
     DESERIALIZE(ShadowsMode);
+    DESERIALIZE(Impostor);
     DESERIALIZE_BIT(ReceiveDecals);
     DESERIALIZE_BIT(UseDensityScaling);
     DESERIALIZE(DensityScalingScale);
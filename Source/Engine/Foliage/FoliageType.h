@@ -5,6 +5,7 @@
 #include "Config.h"
 #include "Engine/Core/Collections/ChunkedArray.h"
 #include "Engine/Content/Assets/Model.h"
+#include "Engine/Graphics/Models/ModelImpostor.h"
 #include "Engine/Core/ISerializable.h"
 
 /// <summary>
@@ -106,6 +107,15 @@ API_CLASS(Sealed, NoSpawn) class FLAXENGINE_API FoliageType : public ScriptingOb
     /// </summary>
     API_PROPERTY() void SetMaterials(const Array<MaterialBase*>& value);
 
+#if USE_EDITOR
+    /// <summary>
+    /// Bakes the impostor atlases for the foliage type model (captured from multiple directions). Atlases are saved next to the model asset and assigned to the impostor once ready.
+    /// </summary>
+    /// <param name="frames">The amount of captured frames in each atlas row and column.</param>
+    /// <param name="resolution">The resolution of the single frame (in pixels).</param>
+    API_FUNCTION() void BakeImpostor(int32 frames = 8, int32 resolution = 128);
+#endif
+
 public:
     /// <summary>
     /// The per-instance cull distance.
@@ -132,6 +142,11 @@ API_CLASS(Sealed, NoSpawn) class FLAXENGINE_API FoliageType : public ScriptingOb
     /// </summary>
     API_FIELD() ShadowsCastingMode ShadowsMode = ShadowsCastingMode::All;
 
+    /// <summary>
+    /// The impostor used to replace the distant instances (before they get culled by the CullDistance).
+    /// </summary>
+    API_FIELD() ModelImpostor Impostor;
+
     /// <summary>
     /// The foliage instances density defined in instances count per 1000x1000 units area.
     /// </summary>
@@ -30,10 +30,24 @@ void DefaultGPUTasksExecutor::FrameEnd()
     ASSERT(_context != nullptr);
 
     // Default implementation performs async operations on end of the frame which is synchronized with a rendering thread
+    const auto manager = GPUDevice::Instance->GetTasksManager();
+    const double startTime = Platform::GetTimeSeconds();
+    uint64 uploadSize = 0;
     GPUTask* buffer[32];
-    const int32 count = GPUDevice::Instance->GetTasksManager()->RequestWork(buffer, 32);
+    const int32 count = manager->RequestWork(buffer, 32);
     for (int32 i = 0; i < count; i++)
     {
+        // Keep the remaining tasks for the next frame when exceeding the frame budget (eg. during texture streaming bursts)
+        const uint64 taskUploadSize = buffer[i]->GetUploadSize();
+        const bool overUploadBudget = manager->FrameUploadBudget != 0 && uploadSize + taskUploadSize > manager->FrameUploadBudget;
+        const bool overTimeBudget = manager->FrameTimeBudget > 0.0f && (float)((Platform::GetTimeSeconds() - startTime) * 1000.0) > manager->FrameTimeBudget;
+        if (i != 0 && (overUploadBudget || overTimeBudget))
+        {
+            manager->ReturnWork(buffer + i, count - i);
+            break;
+        }
+        uploadSize += taskUploadSize;
+
         _context->Run(buffer[i]);
     }
 
@@ -83,6 +83,14 @@ class GPUTask : public Task
         return IsRunning() && _syncPoint != 0;
     }
 
+    /// <summary>
+    /// Gets the estimated amount of bytes uploaded to the GPU by this task. Used to limit the amount of uploads per frame.
+    /// </summary>
+    virtual uint64 GetUploadSize() const
+    {
+        return 0;
+    }
+
 public:
     /// <summary>
     /// Executes this task.
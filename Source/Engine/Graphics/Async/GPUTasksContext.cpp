@@ -5,6 +5,7 @@
 #include "Engine/Core/Log.h"
 #include "Engine/Graphics/GPUDevice.h"
 #include "Engine/Threading/Threading.h"
+#include "Engine/Core/Utilities.h"
 
 #define GPU_TASKS_USE_DEDICATED_CONTEXT 0
 
@@ -27,6 +28,7 @@ GPUTasksContext::GPUTasksContext(GPUDevice* device)
 GPUTasksContext::~GPUTasksContext()
 {
     ASSERT(IsInMainThread());
+    LOG(Info, "GPU tasks done: {0}, uploaded: {1}", _totalTasksDoneCount, Utilities::BytesToText(_totalUploadSize));
 
     // Cancel jobs to sync
     auto tasks = _tasksDone;
@@ -48,6 +50,10 @@ void GPUTasksContext::Run(GPUTask* task)
     ASSERT(task != nullptr);
 
     _tasksDone.Add(task);
+    const uint64 uploadSize = task->GetUploadSize();
+    _frameTasksCount++;
+    _frameUploadSize += uploadSize;
+    _totalUploadSize += uploadSize;
     task->Execute(this);
 }
 
@@ -68,6 +74,8 @@ void GPUTasksContext::OnFrameBegin()
 
     // Move forward one frame
     ++_currentSyncPoint;
+    _frameTasksCount = 0;
+    _frameUploadSize = 0;
 
     // Try to flush done jobs
     auto currentSyncPointGPU = _currentSyncPoint - GPU_ASYNC_LATENCY;
@@ -75,8 +83,6 @@ void GPUTasksContext::OnFrameBegin()
     {
         if (_tasksDone[i]->GetSyncPoint() <= currentSyncPointGPU)
         {
-            // TODO: add stats counter and count performed jobs, print to log on exit.
-
             auto job = _tasksDone[i];
             job->Sync();
 
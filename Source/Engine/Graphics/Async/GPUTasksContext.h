@@ -19,6 +19,9 @@ class GPUTasksContext
     GPUSyncPoint _currentSyncPoint;
     Array<GPUTask*> _tasksDone;
     int32 _totalTasksDoneCount;
+    int32 _frameTasksCount = 0;
+    uint64 _frameUploadSize = 0;
+    uint64 _totalUploadSize = 0;
 
 public:
     /// <summary>
@@ -66,6 +69,30 @@ class GPUTasksContext
         return _totalTasksDoneCount;
     }
 
+    /// <summary>
+    /// Gets the amount of tasks executed by this context during the current frame.
+    /// </summary>
+    FORCE_INLINE int32 GetFrameTasksCount() const
+    {
+        return _frameTasksCount;
+    }
+
+    /// <summary>
+    /// Gets the estimated amount of bytes uploaded to the GPU by the tasks executed during the current frame.
+    /// </summary>
+    FORCE_INLINE uint64 GetFrameUploadSize() const
+    {
+        return _frameUploadSize;
+    }
+
+    /// <summary>
+    /// Gets the estimated total amount of bytes uploaded to the GPU by the tasks executed by this context.
+    /// </summary>
+    FORCE_INLINE uint64 GetTotalUploadSize() const
+    {
+        return _totalUploadSize;
+    }
+
     /// <summary>
     /// Perform given task
     /// </summary>
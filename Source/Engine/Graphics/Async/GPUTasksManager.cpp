@@ -136,6 +136,14 @@ int32 GPUTasksManager::RequestWork(GPUTask** buffer, int32 maxCount)
     return count;
 }
 
+void GPUTasksManager::ReturnWork(GPUTask** buffer, int32 count)
+{
+    // Insert tasks at the beginning of the buffer used by the next RequestWork to keep the order
+    auto& b = _buffers[(_bufferIndex + 1) % 2];
+    for (int32 i = count - 1; i >= 0; i--)
+        b.Insert(0, buffer[i]);
+}
+
 String GPUTasksManager::ToString() const
 {
     return TEXT("GPU Tasks Manager");
@@ -30,6 +30,17 @@ class GPUTasksManager : public Object, public NonCopyable
 public:
     GPUTasksManager();
 
+public:
+    /// <summary>
+    /// The maximum amount of bytes uploaded to the GPU by the tasks within a single frame (0 to disable the limit). At least one task is executed every frame.
+    /// </summary>
+    uint64 FrameUploadBudget = 32 * 1024 * 1024;
+
+    /// <summary>
+    /// The maximum time (in milliseconds) spent on executing tasks within a single frame (0 to disable the limit). At least one task is executed every frame.
+    /// </summary>
+    float FrameTimeBudget = 2.0f;
+
     /// <summary>
     /// Gets the GPU tasks executor.
     /// </summary>
@@ -78,6 +89,13 @@ class GPUTasksManager : public Object, public NonCopyable
     /// <returns>The amount of tasks added to the buffer.</returns>
     int32 RequestWork(GPUTask** buffer, int32 maxCount);
 
+    /// <summary>
+    /// Returns the requested work that has not been executed (eg. due to the frame budget) so it will be requested again (before the other tasks). Should be used only by GPUTasksExecutor.
+    /// </summary>
+    /// <param name="buffer">The tasks buffer.</param>
+    /// <param name="count">The amount of tasks in the buffer.</param>
+    void ReturnWork(GPUTask** buffer, int32 count);
+
 public:
     // [Object]
     String ToString() const override;
@@ -52,6 +52,11 @@ class GPUUploadBufferTask : public GPUTask
         return _buffer == resource;
     }
 
+    uint64 GetUploadSize() const override
+    {
+        return _data.Length();
+    }
+
 protected:
     // [GPUTask]
     Result run(GPUTasksContext* context) override
@@ -56,6 +56,20 @@ class GPUUploadTextureMipTask : public GPUTask
         return _texture == resource;
     }
 
+    uint64 GetUploadSize() const override
+    {
+        if (_data.IsValid())
+            return _data.Length();
+
+        // Data is provided during execution (eg. streaming)
+        const auto texture = _texture.Get();
+        if (texture == nullptr)
+            return 0;
+        uint32 rowPitch, slicePitch;
+        texture->ComputePitch(_mipIndex, rowPitch, slicePitch);
+        return (uint64)slicePitch * texture->ArraySize();
+    }
+
 protected:
     // [GPUTask]
     Result run(GPUTasksContext* context) override
@@ -7,6 +7,7 @@
 #include "PixelFormatExtensions.h"
 #include "Async/Tasks/GPUCopyResourceTask.h"
 #include "Engine/Core/Utilities.h"
+#include "Engine/Core/Delegate.h"
 #include "Engine/Core/Types/String.h"
 #include "Engine/Core/Types/DataContainer.h"
 #include "Engine/Debug/Exceptions/InvalidOperationException.h"
@@ -243,11 +244,10 @@ bool GPUBuffer::DownloadData(BytesContainer& result)
         return GetData(result);
     }
 
-    // Ensure not running on main thread
+    // Ensure not running on main thread (GPU tasks are executed by the main thread so waiting for them would block forever)
     if (IsInMainThread())
     {
-        // TODO: support mesh data download from GPU on a main thread during rendering
-        LOG(Warning, "Cannot download GPU buffer data on a main thread. Use staging readback buffer or invoke this function from another thread.");
+        LOG(Warning, "Cannot download GPU buffer data on a main thread. Use staging readback buffer, DownloadDataAsync or invoke this function from another thread.");
         return true;
     }
 
@@ -275,13 +275,29 @@ class BufferDownloadDataTask : public ThreadPoolTask
 private:
     BufferReference _buffer;
     GPUBuffer* _staging;
-    BytesContainer& _data;
+    BytesContainer* _data = nullptr;
+    Span<byte> _output;
+    Function<void(Span<byte>)> _callback;
 
 public:
     BufferDownloadDataTask(GPUBuffer* buffer, GPUBuffer* staging, BytesContainer& data)
         : _buffer(buffer)
         , _staging(staging)
-        , _data(data)
+        , _data(&data)
+    {
+    }
+
+    BufferDownloadDataTask(GPUBuffer* buffer, GPUBuffer* staging, Span<byte> output)
+        : _buffer(buffer)
+        , _staging(staging)
+        , _output(output)
+    {
+    }
+
+    BufferDownloadDataTask(GPUBuffer* buffer, GPUBuffer* staging, const Function<void(Span<byte>)>& callback)
+        : _buffer(buffer)
+        , _staging(staging)
+        , _callback(callback)
     {
     }
 
@@ -309,14 +325,35 @@ class BufferDownloadDataTask : public ThreadPoolTask
             return true;
         }
 
-        // Gather data
-        if (_staging->GetData(_data))
+        // Gather data (copy directly from the mapped staging memory)
+        const void* mapped = _staging->Map(GPUResourceMapMode::Read);
+        if (!mapped)
         {
             LOG(Warning, "Staging resource of \'{0}\' get data failed.", buffer->ToString());
             return true;
         }
+        const Span<byte> data((byte*)mapped, (int32)_staging->GetSize());
+        bool failed = false;
+        if (_data)
+        {
+            _data->Copy(data);
+        }
+        else if (_callback.IsBinded())
+        {
+            _callback(data);
+        }
+        else if (_output.Length() >= data.Length())
+        {
+            Platform::MemoryCopy(_output.Get(), data.Get(), data.Length());
+        }
+        else
+        {
+            LOG(Warning, "Output memory for \'{0}\' data is too small.", buffer->ToString());
+            failed = true;
+        }
+        _staging->Unmap();
 
-        return false;
+        return failed;
     }
 
     void OnEnd() override
@@ -328,27 +365,28 @@ class BufferDownloadDataTask : public ThreadPoolTask
     }
 };
 
-Task* GPUBuffer::DownloadDataAsync(BytesContainer& result)
+template<typename OutputType>
+Task* DownloadBufferData(GPUBuffer* buffer, OutputType& output)
 {
     // Skip for empty ones
-    if (GetSize() == 0)
+    if (buffer->GetSize() == 0)
         return nullptr;
 
     // Create the staging resource
-    const auto staging = ToStagingReadback();
+    const auto staging = buffer->ToStagingReadback();
     if (staging == nullptr)
     {
-        LOG(Warning, "Cannot create staging resource from {0}.", ToString());
+        LOG(Warning, "Cannot create staging resource from {0}.", buffer->ToString());
         return nullptr;
     }
 
-    // Create async resource copy task
-    auto copyTask = ::New<GPUCopyResourceTask>(this, staging);
-    ASSERT(copyTask->HasReference(this) && copyTask->HasReference(staging));
+    // Create async resource copy task (GPU task synchronized with the GPU frames latency)
+    auto copyTask = ::New<GPUCopyResourceTask>(buffer, staging);
+    ASSERT(copyTask->HasReference(buffer) && copyTask->HasReference(staging));
 
-    // Create task to copy downloaded data to BytesContainer
-    const auto getDataTask = ::New<BufferDownloadDataTask>(this, staging, result);
-    ASSERT(getDataTask->HasReference(this) && getDataTask->HasReference(staging));
+    // Create task to copy downloaded data to the output
+    const auto getDataTask = ::New<BufferDownloadDataTask>(buffer, staging, output);
+    ASSERT(getDataTask->HasReference(buffer) && getDataTask->HasReference(staging));
 
     // Set continuation
     copyTask->ContinueWith(getDataTask);
@@ -356,6 +394,26 @@ Task* GPUBuffer::DownloadDataAsync(BytesContainer& result)
     return copyTask;
 }
 
+Task* GPUBuffer::DownloadDataAsync(BytesContainer& result)
+{
+    return DownloadBufferData(this, result);
+}
+
+Task* GPUBuffer::DownloadDataAsync(Span<byte> result)
+{
+    if (result.Length() < (int32)GetSize())
+    {
+        Log::ArgumentOutOfRangeException(TEXT("Buffer.DownloadDataAsync"));
+        return nullptr;
+    }
+    return DownloadBufferData(this, result);
+}
+
+Task* GPUBuffer::DownloadDataAsync(const Function<void(Span<byte>)>& callback)
+{
+    return DownloadBufferData(this, callback);
+}
+
 bool GPUBuffer::GetData(BytesContainer& output)
 {
     void* mapped = Map(GPUResourceMapMode::Read);
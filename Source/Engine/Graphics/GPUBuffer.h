@@ -4,6 +4,7 @@
 
 #include "GPUBufferDescription.h"
 #include "GPUResource.h"
+#include "Engine/Core/Types/Span.h"
 
 class Task;
 template<typename T>
@@ -160,7 +161,7 @@ API_CLASS(Sealed) class FLAXENGINE_API GPUBuffer : public GPUResource
 
 public:
     /// <summary>
-    /// Stops current thread execution to gather buffer data from the GPU. Cannot be called from main thread if the buffer is not a dynamic nor staging readback.
+    /// Stops current thread execution to gather buffer data from the GPU. Cannot be called from main thread if the buffer is not a dynamic nor staging readback (use DownloadDataAsync instead).
     /// </summary>
     /// <param name="result">The result data.</param>
     /// <returns>True if cannot download data, otherwise false.</returns>
@@ -173,6 +174,20 @@ API_CLASS(Sealed) class FLAXENGINE_API GPUBuffer : public GPUResource
     /// <returns>Download data task (not started yet).</returns>
     Task* DownloadDataAsync(BytesContainer& result);
 
+    /// <summary>
+    /// Creates GPU async task that will gather buffer data from the GPU directly into the given memory (single copy from the staging buffer).
+    /// </summary>
+    /// <param name="result">The output memory. Must be at least the size of the buffer and valid until the task ends.</param>
+    /// <returns>Download data task (not started yet).</returns>
+    Task* DownloadDataAsync(Span<byte> result);
+
+    /// <summary>
+    /// Creates GPU async task that will gather buffer data from the GPU and pass it to the callback. Can be started from any thread (including the main thread during rendering) as the copy is synchronized with the GPU frames latency.
+    /// </summary>
+    /// <param name="callback">The callback invoked on a thread pool once the data is ready. The data points to the mapped staging buffer memory and is valid only during the callback (no intermediate copies are made).</param>
+    /// <returns>Download data task (not started yet).</returns>
+    Task* DownloadDataAsync(const Function<void(Span<byte>)>& callback);
+
     /// <summary>
     /// Gets the buffer data via map/memcpy/unmap sequence. Always supported for dynamic and staging readback buffers (other types support depends on graphics backend implementation).
     /// </summary>
@@ -130,6 +130,11 @@ API_CLASS(Sealed, NoSpawn) class FLAXENGINE_API GPUContext : public ScriptingObj
         return _device;
     }
 
+    /// <summary>
+    /// True if draw calls can be skipped when their pipeline state is still being created in the background (eg. on Vulkan), otherwise the pipeline is waited for. Enabled only for the scene materials drawing in the realtime views, one-shot passes (eg. probes, lightmaps or thumbnails rendering) must not lose any draws.
+    /// </summary>
+    bool AllowAsyncPipelines = false;
+
 public:
     /// <summary>
     /// Begins new frame and enters commands collecting mode.
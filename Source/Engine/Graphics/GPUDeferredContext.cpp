@@ -0,0 +1,857 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#include "GPUDeferredContext.h"
+#include "GPUBuffer.h"
+#include "Engine/Core/Math/Color.h"
+#include "Engine/Core/Math/Vector4.h"
+#include "Engine/Graphics/Textures/GPUTexture.h"
+#include "Engine/Graphics/Shaders/GPUConstantBuffer.h"
+
+namespace
+{
+    enum class CommandType : uint32
+    {
+        EventBegin,
+        EventEnd,
+        Clear,
+        ClearDepth,
+        ClearUABufferFloat,
+        ClearUABufferUint,
+        ClearUATextureUint,
+        ClearUATextureFloat,
+        UpdateBuffer,
+        CopyBuffer,
+        UpdateTexture,
+        CopyTexture,
+        ResetCounter,
+        CopyCounter,
+        CopyResource,
+        CopySubresource,
+        ResetRenderTarget,
+        SetRenderTarget,
+        SetRenderTargetDepth,
+        SetRenderTargets,
+        SetBlendFactor,
+        ResetSR,
+        ResetUA,
+        ResetCB,
+        BindSR,
+        BindUA,
+        BindCB,
+        BindVB,
+        BindIB,
+        BindSampler,
+        UpdateCB,
+        Dispatch,
+        DispatchIndirect,
+        ResolveMultisample,
+        DrawInstanced,
+        DrawIndexedInstanced,
+        DrawInstancedIndirect,
+        DrawIndexedInstancedIndirect,
+        SetViewport,
+        SetScissor,
+        SetState,
+        ClearState,
+        FlushState,
+        Flush,
+        SetResourceState,
+        ForceRebindDescriptors,
+    };
+
+    // Commands are stored one after another (header, arguments and the optional data), aligned to 8 bytes
+    struct CommandHeader
+    {
+        CommandType Type;
+        uint32 Size;
+    };
+
+    struct NoArgs
+    {
+    };
+
+    struct ResourceArgs
+    {
+        GPUResource* Resource;
+    };
+
+    struct ClearArgs
+    {
+        GPUTextureView* View;
+        Color Value;
+    };
+
+    struct ClearDepthArgs
+    {
+        GPUTextureView* View;
+        float Value;
+    };
+
+    struct ClearUAArgs
+    {
+        GPUResource* Resource;
+        uint32 Value[4];
+    };
+
+    struct UpdateBufferArgs
+    {
+        GPUBuffer* Buffer;
+        uint32 Size;
+        uint32 Offset;
+    };
+
+    struct CopyBufferArgs
+    {
+        GPUBuffer* Dst;
+        GPUBuffer* Src;
+        uint32 Size;
+        uint32 DstOffset;
+        uint32 SrcOffset;
+    };
+
+    struct UpdateTextureArgs
+    {
+        GPUTexture* Texture;
+        int32 ArrayIndex;
+        int32 MipIndex;
+        uint32 RowPitch;
+        uint32 SlicePitch;
+    };
+
+    struct CopyTextureArgs
+    {
+        GPUTexture* Dst;
+        GPUTexture* Src;
+        uint32 DstSubresource;
+        uint32 DstX, DstY, DstZ;
+        uint32 SrcSubresource;
+    };
+
+    struct CopyCounterArgs
+    {
+        GPUBuffer* Dst;
+        GPUBuffer* Src;
+        uint32 DstOffset;
+    };
+
+    struct CopyResourceArgs
+    {
+        GPUResource* Dst;
+        GPUResource* Src;
+        uint32 DstSubresource;
+        uint32 SrcSubresource;
+    };
+
+    struct SetRenderTargetsArgs
+    {
+        GPUTextureView* Depth;
+        int32 Count;
+        GPUTextureView* RTs[GPU_MAX_RT_BINDED];
+    };
+
+    struct BindArgs
+    {
+        void* Object;
+        int32 Slot;
+    };
+
+    struct BindVBArgs
+    {
+        int32 Count;
+        bool HasOffsets;
+        GPUBuffer* Buffers[GPU_MAX_VB_BINDED];
+        uint32 Offsets[GPU_MAX_VB_BINDED];
+    };
+
+    struct DispatchArgs
+    {
+        GPUShaderProgramCS* Shader;
+        GPUBuffer* Buffer;
+        uint32 X, Y, Z;
+    };
+
+    struct ResolveMultisampleArgs
+    {
+        GPUTexture* Src;
+        GPUTexture* Dst;
+        int32 SrcSubresource;
+        int32 DstSubresource;
+        PixelFormat Format;
+    };
+
+    struct DrawArgs
+    {
+        GPUBuffer* Buffer;
+        uint32 Count;
+        uint32 InstanceCount;
+        int32 StartInstance;
+        int32 StartVertex;
+        int32 StartIndex;
+    };
+
+    struct SetResourceStateArgs
+    {
+        GPUResource* Resource;
+        uint64 State;
+        int32 Subresource;
+    };
+
+    template<typename T>
+    FORCE_INLINE T* Record(Array<byte>& commands, CommandType type, uint32 dataSize = 0)
+    {
+        const uint32 size = Math::AlignUp<uint32>(sizeof(CommandHeader) + sizeof(T) + dataSize, 8);
+        const int32 position = commands.Count();
+        commands.AddUninitialized((int32)size);
+        auto header = (CommandHeader*)(commands.Get() + position);
+        header->Type = type;
+        header->Size = size;
+        return (T*)(header + 1);
+    }
+
+    FORCE_INLINE void Record(Array<byte>& commands, CommandType type)
+    {
+        Record<NoArgs>(commands, type);
+    }
+}
+
+GPUDeferredContext::GPUDeferredContext(GPUDevice* device)
+    : GPUContext(device)
+{
+}
+
+void GPUDeferredContext::Begin(GPUContext* context)
+{
+    _commands.Clear();
+    _state = context->GetState();
+    _depthBufferBinded = context->IsDepthBufferBinded();
+}
+
+void GPUDeferredContext::Execute(GPUContext* context) const
+{
+    const byte* ptr = _commands.Get();
+    const byte* end = ptr + _commands.Count();
+    while (ptr < end)
+    {
+        const auto header = (const CommandHeader*)ptr;
+        const void* args = header + 1;
+#define ARGS(type) const type& a = *(const type*)args
+#define DATA(type) ((const byte*)args + sizeof(type))
+        switch (header->Type)
+        {
+#if GPU_ALLOW_PROFILE_EVENTS
+        case CommandType::EventBegin:
+            context->EventBegin((const Char*)DATA(NoArgs));
+            break;
+        case CommandType::EventEnd:
+            context->EventEnd();
+            break;
+#endif
+        case CommandType::Clear:
+        {
+            ARGS(ClearArgs);
+            context->Clear(a.View, a.Value);
+            break;
+        }
+        case CommandType::ClearDepth:
+        {
+            ARGS(ClearDepthArgs);
+            context->ClearDepth(a.View, a.Value);
+            break;
+        }
+        case CommandType::ClearUABufferFloat:
+        {
+            ARGS(ClearUAArgs);
+            context->ClearUA((GPUBuffer*)a.Resource, *(const Float4*)a.Value);
+            break;
+        }
+        case CommandType::ClearUABufferUint:
+        {
+            ARGS(ClearUAArgs);
+            context->ClearUA((GPUBuffer*)a.Resource, a.Value);
+            break;
+        }
+        case CommandType::ClearUATextureUint:
+        {
+            ARGS(ClearUAArgs);
+            context->ClearUA((GPUTexture*)a.Resource, a.Value);
+            break;
+        }
+        case CommandType::ClearUATextureFloat:
+        {
+            ARGS(ClearUAArgs);
+            context->ClearUA((GPUTexture*)a.Resource, *(const Float4*)a.Value);
+            break;
+        }
+        case CommandType::UpdateBuffer:
+        {
+            ARGS(UpdateBufferArgs);
+            context->UpdateBuffer(a.Buffer, DATA(UpdateBufferArgs), a.Size, a.Offset);
+            break;
+        }
+        case CommandType::CopyBuffer:
+        {
+            ARGS(CopyBufferArgs);
+            context->CopyBuffer(a.Dst, a.Src, a.Size, a.DstOffset, a.SrcOffset);
+            break;
+        }
+        case CommandType::UpdateTexture:
+        {
+            ARGS(UpdateTextureArgs);
+            context->UpdateTexture(a.Texture, a.ArrayIndex, a.MipIndex, DATA(UpdateTextureArgs), a.RowPitch, a.SlicePitch);
+            break;
+        }
+        case CommandType::CopyTexture:
+        {
+            ARGS(CopyTextureArgs);
+            context->CopyTexture(a.Dst, a.DstSubresource, a.DstX, a.DstY, a.DstZ, a.Src, a.SrcSubresource);
+            break;
+        }
+        case CommandType::ResetCounter:
+        {
+            ARGS(ResourceArgs);
+            context->ResetCounter((GPUBuffer*)a.Resource);
+            break;
+        }
+        case CommandType::CopyCounter:
+        {
+            ARGS(CopyCounterArgs);
+            context->CopyCounter(a.Dst, a.DstOffset, a.Src);
+            break;
+        }
+        case CommandType::CopyResource:
+        {
+            ARGS(CopyResourceArgs);
+            context->CopyResource(a.Dst, a.Src);
+            break;
+        }
+        case CommandType::CopySubresource:
+        {
+            ARGS(CopyResourceArgs);
+            context->CopySubresource(a.Dst, a.DstSubresource, a.Src, a.SrcSubresource);
+            break;
+        }
+        case CommandType::ResetRenderTarget:
+            context->ResetRenderTarget();
+            break;
+        case CommandType::SetRenderTarget:
+        {
+            ARGS(SetRenderTargetsArgs);
+            context->SetRenderTarget(a.RTs[0]);
+            break;
+        }
+        case CommandType::SetRenderTargetDepth:
+        {
+            ARGS(SetRenderTargetsArgs);
+            context->SetRenderTarget(a.Depth, a.RTs[0]);
+            break;
+        }
+        case CommandType::SetRenderTargets:
+        {
+            ARGS(SetRenderTargetsArgs);
+            context->SetRenderTarget(a.Depth, Span<GPUTextureView*>((GPUTextureView**)a.RTs, a.Count));
+            break;
+        }
+        case CommandType::SetBlendFactor:
+        {
+            ARGS(Float4);
+            context->SetBlendFactor(a);
+            break;
+        }
+        case CommandType::ResetSR:
+            context->ResetSR();
+            break;
+        case CommandType::ResetUA:
+            context->ResetUA();
+            break;
+        case CommandType::ResetCB:
+            context->ResetCB();
+            break;
+        case CommandType::BindSR:
+        {
+            ARGS(BindArgs);
+            context->BindSR(a.Slot, (GPUResourceView*)a.Object);
+            break;
+        }
+        case CommandType::BindUA:
+        {
+            ARGS(BindArgs);
+            context->BindUA(a.Slot, (GPUResourceView*)a.Object);
+            break;
+        }
+        case CommandType::BindCB:
+        {
+            ARGS(BindArgs);
+            context->BindCB(a.Slot, (GPUConstantBuffer*)a.Object);
+            break;
+        }
+        case CommandType::BindVB:
+        {
+            ARGS(BindVBArgs);
+            context->BindVB(Span<GPUBuffer*>((GPUBuffer**)a.Buffers, a.Count), a.HasOffsets ? a.Offsets : nullptr);
+            break;
+        }
+        case CommandType::BindIB:
+        {
+            ARGS(ResourceArgs);
+            context->BindIB((GPUBuffer*)a.Resource);
+            break;
+        }
+        case CommandType::BindSampler:
+        {
+            ARGS(BindArgs);
+            context->BindSampler(a.Slot, (GPUSampler*)a.Object);
+            break;
+        }
+        case CommandType::UpdateCB:
+        {
+            ARGS(BindArgs);
+            context->UpdateCB((GPUConstantBuffer*)a.Object, DATA(BindArgs));
+            break;
+        }
+        case CommandType::Dispatch:
+        {
+            ARGS(DispatchArgs);
+            context->Dispatch(a.Shader, a.X, a.Y, a.Z);
+            break;
+        }
+        case CommandType::DispatchIndirect:
+        {
+            ARGS(DispatchArgs);
+            context->DispatchIndirect(a.Shader, a.Buffer, a.X);
+            break;
+        }
+        case CommandType::ResolveMultisample:
+        {
+            ARGS(ResolveMultisampleArgs);
+            context->ResolveMultisample(a.Src, a.Dst, a.SrcSubresource, a.DstSubresource, a.Format);
+            break;
+        }
+        case CommandType::DrawInstanced:
+        {
+            ARGS(DrawArgs);
+            context->DrawInstanced(a.Count, a.InstanceCount, a.StartInstance, a.StartVertex);
+            break;
+        }
+        case CommandType::DrawIndexedInstanced:
+        {
+            ARGS(DrawArgs);
+            context->DrawIndexedInstanced(a.Count, a.InstanceCount, a.StartInstance, a.StartVertex, a.StartIndex);
+            break;
+        }
+        case CommandType::DrawInstancedIndirect:
+        {
+            ARGS(DrawArgs);
+            context->DrawInstancedIndirect(a.Buffer, a.Count);
+            break;
+        }
+        case CommandType::DrawIndexedInstancedIndirect:
+        {
+            ARGS(DrawArgs);
+            context->DrawIndexedInstancedIndirect(a.Buffer, a.Count);
+            break;
+        }
+        case CommandType::SetViewport:
+        {
+            ARGS(Viewport);
+            context->SetViewport(a);
+            break;
+        }
+        case CommandType::SetScissor:
+        {
+            ARGS(Rectangle);
+            context->SetScissor(a);
+            break;
+        }
+        case CommandType::SetState:
+        {
+            ARGS(BindArgs);
+            context->SetState((GPUPipelineState*)a.Object);
+            break;
+        }
+        case CommandType::ClearState:
+            context->ClearState();
+            break;
+        case CommandType::FlushState:
+            context->FlushState();
+            break;
+        case CommandType::Flush:
+            context->Flush();
+            break;
+        case CommandType::SetResourceState:
+        {
+            ARGS(SetResourceStateArgs);
+            context->SetResourceState(a.Resource, a.State, a.Subresource);
+            break;
+        }
+        case CommandType::ForceRebindDescriptors:
+            context->ForceRebindDescriptors();
+            break;
+        default: ;
+        }
+#undef ARGS
+#undef DATA
+        ptr += header->Size;
+    }
+}
+
+#if GPU_ALLOW_PROFILE_EVENTS
+
+void GPUDeferredContext::EventBegin(const Char* name)
+{
+    const int32 length = StringUtils::Length(name);
+    const uint32 size = (length + 1) * sizeof(Char);
+    auto args = Record<NoArgs>(_commands, CommandType::EventBegin, size);
+    Platform::MemoryCopy(args + 1, name, size);
+}
+
+void GPUDeferredContext::EventEnd()
+{
+    Record(_commands, CommandType::EventEnd);
+}
+
+#endif
+
+void* GPUDeferredContext::GetNativePtr() const
+{
+    return nullptr;
+}
+
+bool GPUDeferredContext::IsDepthBufferBinded()
+{
+    return _depthBufferBinded;
+}
+
+void GPUDeferredContext::Clear(GPUTextureView* rt, const Color& color)
+{
+    auto args = Record<ClearArgs>(_commands, CommandType::Clear);
+    args->View = rt;
+    args->Value = color;
+}
+
+void GPUDeferredContext::ClearDepth(GPUTextureView* depthBuffer, float depthValue)
+{
+    auto args = Record<ClearDepthArgs>(_commands, CommandType::ClearDepth);
+    args->View = depthBuffer;
+    args->Value = depthValue;
+}
+
+void GPUDeferredContext::ClearUA(GPUBuffer* buf, const Float4& value)
+{
+    auto args = Record<ClearUAArgs>(_commands, CommandType::ClearUABufferFloat);
+    args->Resource = buf;
+    Platform::MemoryCopy(args->Value, &value, sizeof(args->Value));
+}
+
+void GPUDeferredContext::ClearUA(GPUBuffer* buf, const uint32 value[4])
+{
+    auto args = Record<ClearUAArgs>(_commands, CommandType::ClearUABufferUint);
+    args->Resource = buf;
+    Platform::MemoryCopy(args->Value, value, sizeof(args->Value));
+}
+
+void GPUDeferredContext::ClearUA(GPUTexture* texture, const uint32 value[4])
+{
+    auto args = Record<ClearUAArgs>(_commands, CommandType::ClearUATextureUint);
+    args->Resource = texture;
+    Platform::MemoryCopy(args->Value, value, sizeof(args->Value));
+}
+
+void GPUDeferredContext::ClearUA(GPUTexture* texture, const Float4& value)
+{
+    auto args = Record<ClearUAArgs>(_commands, CommandType::ClearUATextureFloat);
+    args->Resource = texture;
+    Platform::MemoryCopy(args->Value, &value, sizeof(args->Value));
+}
+
+void GPUDeferredContext::UpdateBuffer(GPUBuffer* buffer, const void* data, uint32 size, uint32 offset)
+{
+    auto args = Record<UpdateBufferArgs>(_commands, CommandType::UpdateBuffer, size);
+    args->Buffer = buffer;
+    args->Size = size;
+    args->Offset = offset;
+    Platform::MemoryCopy(args + 1, data, size);
+}
+
+void GPUDeferredContext::CopyBuffer(GPUBuffer* dstBuffer, GPUBuffer* srcBuffer, uint32 size, uint32 dstOffset, uint32 srcOffset)
+{
+    auto args = Record<CopyBufferArgs>(_commands, CommandType::CopyBuffer);
+    args->Dst = dstBuffer;
+    args->Src = srcBuffer;
+    args->Size = size;
+    args->DstOffset = dstOffset;
+    args->SrcOffset = srcOffset;
+}
+
+void GPUDeferredContext::UpdateTexture(GPUTexture* texture, int32 arrayIndex, int32 mipIndex, const void* data, uint32 rowPitch, uint32 slicePitch)
+{
+    const uint32 size = slicePitch * (texture->IsVolume() ? Math::Max(texture->Depth() >> mipIndex, 1) : 1);
+    auto args = Record<UpdateTextureArgs>(_commands, CommandType::UpdateTexture, size);
+    args->Texture = texture;
+    args->ArrayIndex = arrayIndex;
+    args->MipIndex = mipIndex;
+    args->RowPitch = rowPitch;
+    args->SlicePitch = slicePitch;
+    Platform::MemoryCopy(args + 1, data, size);
+}
+
+void GPUDeferredContext::CopyTexture(GPUTexture* dstResource, uint32 dstSubresource, uint32 dstX, uint32 dstY, uint32 dstZ, GPUTexture* srcResource, uint32 srcSubresource)
+{
+    auto args = Record<CopyTextureArgs>(_commands, CommandType::CopyTexture);
+    args->Dst = dstResource;
+    args->Src = srcResource;
+    args->DstSubresource = dstSubresource;
+    args->DstX = dstX;
+    args->DstY = dstY;
+    args->DstZ = dstZ;
+    args->SrcSubresource = srcSubresource;
+}
+
+void GPUDeferredContext::ResetCounter(GPUBuffer* buffer)
+{
+    Record<ResourceArgs>(_commands, CommandType::ResetCounter)->Resource = buffer;
+}
+
+void GPUDeferredContext::CopyCounter(GPUBuffer* dstBuffer, uint32 dstOffset, GPUBuffer* srcBuffer)
+{
+    auto args = Record<CopyCounterArgs>(_commands, CommandType::CopyCounter);
+    args->Dst = dstBuffer;
+    args->Src = srcBuffer;
+    args->DstOffset = dstOffset;
+}
+
+void GPUDeferredContext::CopyResource(GPUResource* dstResource, GPUResource* srcResource)
+{
+    auto args = Record<CopyResourceArgs>(_commands, CommandType::CopyResource);
+    args->Dst = dstResource;
+    args->Src = srcResource;
+}
+
+void GPUDeferredContext::CopySubresource(GPUResource* dstResource, uint32 dstSubresource, GPUResource* srcResource, uint32 srcSubresource)
+{
+    auto args = Record<CopyResourceArgs>(_commands, CommandType::CopySubresource);
+    args->Dst = dstResource;
+    args->Src = srcResource;
+    args->DstSubresource = dstSubresource;
+    args->SrcSubresource = srcSubresource;
+}
+
+void GPUDeferredContext::ResetRenderTarget()
+{
+    _depthBufferBinded = false;
+    Record(_commands, CommandType::ResetRenderTarget);
+}
+
+void GPUDeferredContext::SetRenderTarget(GPUTextureView* rt)
+{
+    _depthBufferBinded = false;
+    auto args = Record<SetRenderTargetsArgs>(_commands, CommandType::SetRenderTarget);
+    args->Depth = nullptr;
+    args->Count = 1;
+    args->RTs[0] = rt;
+}
+
+void GPUDeferredContext::SetRenderTarget(GPUTextureView* depthBuffer, GPUTextureView* rt)
+{
+    _depthBufferBinded = depthBuffer != nullptr;
+    auto args = Record<SetRenderTargetsArgs>(_commands, CommandType::SetRenderTargetDepth);
+    args->Depth = depthBuffer;
+    args->Count = 1;
+    args->RTs[0] = rt;
+}
+
+void GPUDeferredContext::SetRenderTarget(GPUTextureView* depthBuffer, const Span<GPUTextureView*>& rts)
+{
+    ASSERT(rts.Length() <= GPU_MAX_RT_BINDED);
+    _depthBufferBinded = depthBuffer != nullptr;
+    auto args = Record<SetRenderTargetsArgs>(_commands, CommandType::SetRenderTargets);
+    args->Depth = depthBuffer;
+    args->Count = rts.Length();
+    Platform::MemoryCopy(args->RTs, rts.Get(), rts.Length() * sizeof(GPUTextureView*));
+}
+
+void GPUDeferredContext::SetBlendFactor(const Float4& value)
+{
+    *Record<Float4>(_commands, CommandType::SetBlendFactor) = value;
+}
+
+void GPUDeferredContext::ResetSR()
+{
+    Record(_commands, CommandType::ResetSR);
+}
+
+void GPUDeferredContext::ResetUA()
+{
+    Record(_commands, CommandType::ResetUA);
+}
+
+void GPUDeferredContext::ResetCB()
+{
+    Record(_commands, CommandType::ResetCB);
+}
+
+void GPUDeferredContext::BindSR(int32 slot, GPUResourceView* view)
+{
+    auto args = Record<BindArgs>(_commands, CommandType::BindSR);
+    args->Object = view;
+    args->Slot = slot;
+}
+
+void GPUDeferredContext::BindUA(int32 slot, GPUResourceView* view)
+{
+    auto args = Record<BindArgs>(_commands, CommandType::BindUA);
+    args->Object = view;
+    args->Slot = slot;
+}
+
+void GPUDeferredContext::BindCB(int32 slot, GPUConstantBuffer* cb)
+{
+    auto args = Record<BindArgs>(_commands, CommandType::BindCB);
+    args->Object = cb;
+    args->Slot = slot;
+}
+
+void GPUDeferredContext::BindVB(const Span<GPUBuffer*>& vertexBuffers, const uint32* vertexBuffersOffsets)
+{
+    ASSERT(vertexBuffers.Length() <= GPU_MAX_VB_BINDED);
+    auto args = Record<BindVBArgs>(_commands, CommandType::BindVB);
+    args->Count = vertexBuffers.Length();
+    args->HasOffsets = vertexBuffersOffsets != nullptr;
+    Platform::MemoryCopy(args->Buffers, vertexBuffers.Get(), vertexBuffers.Length() * sizeof(GPUBuffer*));
+    if (vertexBuffersOffsets)
+        Platform::MemoryCopy(args->Offsets, vertexBuffersOffsets, vertexBuffers.Length() * sizeof(uint32));
+}
+
+void GPUDeferredContext::BindIB(GPUBuffer* indexBuffer)
+{
+    Record<ResourceArgs>(_commands, CommandType::BindIB)->Resource = indexBuffer;
+}
+
+void GPUDeferredContext::BindSampler(int32 slot, GPUSampler* sampler)
+{
+    auto args = Record<BindArgs>(_commands, CommandType::BindSampler);
+    args->Object = sampler;
+    args->Slot = slot;
+}
+
+void GPUDeferredContext::UpdateCB(GPUConstantBuffer* cb, const void* data)
+{
+    const uint32 size = cb->GetSize();
+    auto args = Record<BindArgs>(_commands, CommandType::UpdateCB, size);
+    args->Object = cb;
+    args->Slot = 0;
+    Platform::MemoryCopy(args + 1, data, size);
+}
+
+void GPUDeferredContext::Dispatch(GPUShaderProgramCS* shader, uint32 threadGroupCountX, uint32 threadGroupCountY, uint32 threadGroupCountZ)
+{
+    auto args = Record<DispatchArgs>(_commands, CommandType::Dispatch);
+    args->Shader = shader;
+    args->Buffer = nullptr;
+    args->X = threadGroupCountX;
+    args->Y = threadGroupCountY;
+    args->Z = threadGroupCountZ;
+}
+
+void GPUDeferredContext::DispatchIndirect(GPUShaderProgramCS* shader, GPUBuffer* bufferForArgs, uint32 offsetForArgs)
+{
+    auto args = Record<DispatchArgs>(_commands, CommandType::DispatchIndirect);
+    args->Shader = shader;
+    args->Buffer = bufferForArgs;
+    args->X = offsetForArgs;
+}
+
+void GPUDeferredContext::ResolveMultisample(GPUTexture* sourceMultisampleTexture, GPUTexture* destTexture, int32 sourceSubResource, int32 destSubResource, PixelFormat format)
+{
+    auto args = Record<ResolveMultisampleArgs>(_commands, CommandType::ResolveMultisample);
+    args->Src = sourceMultisampleTexture;
+    args->Dst = destTexture;
+    args->SrcSubresource = sourceSubResource;
+    args->DstSubresource = destSubResource;
+    args->Format = format;
+}
+
+void GPUDeferredContext::DrawInstanced(uint32 verticesCount, uint32 instanceCount, int32 startInstance, int32 startVertex)
+{
+    auto args = Record<DrawArgs>(_commands, CommandType::DrawInstanced);
+    args->Count = verticesCount;
+    args->InstanceCount = instanceCount;
+    args->StartInstance = startInstance;
+    args->StartVertex = startVertex;
+}
+
+void GPUDeferredContext::DrawIndexedInstanced(uint32 indicesCount, uint32 instanceCount, int32 startInstance, int32 startVertex, int32 startIndex)
+{
+    auto args = Record<DrawArgs>(_commands, CommandType::DrawIndexedInstanced);
+    args->Count = indicesCount;
+    args->InstanceCount = instanceCount;
+    args->StartInstance = startInstance;
+    args->StartVertex = startVertex;
+    args->StartIndex = startIndex;
+}
+
+void GPUDeferredContext::DrawInstancedIndirect(GPUBuffer* bufferForArgs, uint32 offsetForArgs)
+{
+    auto args = Record<DrawArgs>(_commands, CommandType::DrawInstancedIndirect);
+    args->Buffer = bufferForArgs;
+    args->Count = offsetForArgs;
+}
+
+void GPUDeferredContext::DrawIndexedInstancedIndirect(GPUBuffer* bufferForArgs, uint32 offsetForArgs)
+{
+    auto args = Record<DrawArgs>(_commands, CommandType::DrawIndexedInstancedIndirect);
+    args->Buffer = bufferForArgs;
+    args->Count = offsetForArgs;
+}
+
+void GPUDeferredContext::SetViewport(const Viewport& viewport)
+{
+    *Record<Viewport>(_commands, CommandType::SetViewport) = viewport;
+}
+
+void GPUDeferredContext::SetScissor(const Rectangle& scissorRect)
+{
+    *Record<Rectangle>(_commands, CommandType::SetScissor) = scissorRect;
+}
+
+GPUPipelineState* GPUDeferredContext::GetState() const
+{
+    return _state;
+}
+
+void GPUDeferredContext::SetState(GPUPipelineState* state)
+{
+    _state = state;
+    auto args = Record<BindArgs>(_commands, CommandType::SetState);
+    args->Object = state;
+    args->Slot = 0;
+}
+
+void GPUDeferredContext::ClearState()
+{
+    _state = nullptr;
+    _depthBufferBinded = false;
+    Record(_commands, CommandType::ClearState);
+}
+
+void GPUDeferredContext::FlushState()
+{
+    Record(_commands, CommandType::FlushState);
+}
+
+void GPUDeferredContext::Flush()
+{
+    Record(_commands, CommandType::Flush);
+}
+
+void GPUDeferredContext::SetResourceState(GPUResource* resource, uint64 state, int32 subresource)
+{
+    auto args = Record<SetResourceStateArgs>(_commands, CommandType::SetResourceState);
+    args->Resource = resource;
+    args->State = state;
+    args->Subresource = subresource;
+}
+
+void GPUDeferredContext::ForceRebindDescriptors()
+{
+    Record(_commands, CommandType::ForceRebindDescriptors);
+}
@@ -0,0 +1,99 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#include "GPUContext.h"
+#include "Engine/Core/Collections/Array.h"
+
+/// <summary>
+/// GPU context that records the commands to execute them later on the other context (in the same order). Allows to record commands on a worker thread (eg. to draw large lists of draw calls in parallel). Resources used by the recorded commands need to be valid until execution.
+/// </summary>
+class FLAXENGINE_API GPUDeferredContext : public GPUContext
+{
+private:
+    Array<byte> _commands;
+    GPUPipelineState* _state = nullptr;
+    bool _depthBufferBinded = false;
+
+public:
+    /// <summary>
+    /// Initializes a new instance of the <see cref="GPUDeferredContext"/> class.
+    /// </summary>
+    /// <param name="device">The graphics device.</param>
+    GPUDeferredContext(GPUDevice* device);
+
+public:
+    /// <summary>
+    /// Returns true if context has no recorded commands.
+    /// </summary>
+    FORCE_INLINE bool IsEmpty() const
+    {
+        return _commands.IsEmpty();
+    }
+
+    /// <summary>
+    /// Begins the commands recording. Clears the previously recorded commands.
+    /// </summary>
+    /// <param name="context">The context that will execute the commands. Used to initialize the recording state (eg. pipeline state or depth buffer binding queries).</param>
+    void Begin(GPUContext* context);
+
+    /// <summary>
+    /// Executes the recorded commands on the given context (in the order of recording).
+    /// </summary>
+    /// <param name="context">The context to execute commands on.</param>
+    void Execute(GPUContext* context) const;
+
+public:
+    // [GPUContext]
+#if GPU_ALLOW_PROFILE_EVENTS
+    void EventBegin(const Char* name) override;
+    void EventEnd() override;
+#endif
+    void* GetNativePtr() const override;
+    bool IsDepthBufferBinded() override;
+    void Clear(GPUTextureView* rt, const Color& color) override;
+    void ClearDepth(GPUTextureView* depthBuffer, float depthValue) override;
+    void ClearUA(GPUBuffer* buf, const Float4& value) override;
+    void ClearUA(GPUBuffer* buf, const uint32 value[4]) override;
+    void ClearUA(GPUTexture* texture, const uint32 value[4]) override;
+    void ClearUA(GPUTexture* texture, const Float4& value) override;
+    void UpdateBuffer(GPUBuffer* buffer, const void* data, uint32 size, uint32 offset) override;
+    void CopyBuffer(GPUBuffer* dstBuffer, GPUBuffer* srcBuffer, uint32 size, uint32 dstOffset, uint32 srcOffset) override;
+    void UpdateTexture(GPUTexture* texture, int32 arrayIndex, int32 mipIndex, const void* data, uint32 rowPitch, uint32 slicePitch) override;
+    void CopyTexture(GPUTexture* dstResource, uint32 dstSubresource, uint32 dstX, uint32 dstY, uint32 dstZ, GPUTexture* srcResource, uint32 srcSubresource) override;
+    void ResetCounter(GPUBuffer* buffer) override;
+    void CopyCounter(GPUBuffer* dstBuffer, uint32 dstOffset, GPUBuffer* srcBuffer) override;
+    void CopyResource(GPUResource* dstResource, GPUResource* srcResource) override;
+    void CopySubresource(GPUResource* dstResource, uint32 dstSubresource, GPUResource* srcResource, uint32 srcSubresource) override;
+    void ResetRenderTarget() override;
+    void SetRenderTarget(GPUTextureView* rt) override;
+    void SetRenderTarget(GPUTextureView* depthBuffer, GPUTextureView* rt) override;
+    void SetRenderTarget(GPUTextureView* depthBuffer, const Span<GPUTextureView*>& rts) override;
+    void SetBlendFactor(const Float4& value) override;
+    void ResetSR() override;
+    void ResetUA() override;
+    void ResetCB() override;
+    void BindSR(int32 slot, GPUResourceView* view) override;
+    void BindUA(int32 slot, GPUResourceView* view) override;
+    void BindCB(int32 slot, GPUConstantBuffer* cb) override;
+    void BindVB(const Span<GPUBuffer*>& vertexBuffers, const uint32* vertexBuffersOffsets = nullptr) override;
+    void BindIB(GPUBuffer* indexBuffer) override;
+    void BindSampler(int32 slot, GPUSampler* sampler) override;
+    void UpdateCB(GPUConstantBuffer* cb, const void* data) override;
+    void Dispatch(GPUShaderProgramCS* shader, uint32 threadGroupCountX, uint32 threadGroupCountY, uint32 threadGroupCountZ) override;
+    void DispatchIndirect(GPUShaderProgramCS* shader, GPUBuffer* bufferForArgs, uint32 offsetForArgs) override;
+    void ResolveMultisample(GPUTexture* sourceMultisampleTexture, GPUTexture* destTexture, int32 sourceSubResource, int32 destSubResource, PixelFormat format) override;
+    void DrawInstanced(uint32 verticesCount, uint32 instanceCount, int32 startInstance, int32 startVertex) override;
+    void DrawIndexedInstanced(uint32 indicesCount, uint32 instanceCount, int32 startInstance, int32 startVertex, int32 startIndex) override;
+    void DrawInstancedIndirect(GPUBuffer* bufferForArgs, uint32 offsetForArgs) override;
+    void DrawIndexedInstancedIndirect(GPUBuffer* bufferForArgs, uint32 offsetForArgs) override;
+    void SetViewport(const Viewport& viewport) override;
+    void SetScissor(const Rectangle& scissorRect) override;
+    GPUPipelineState* GetState() const override;
+    void SetState(GPUPipelineState* state) override;
+    void ClearState() override;
+    void FlushState() override;
+    void Flush() override;
+    void SetResourceState(GPUResource* resource, uint64 state, int32 subresource) override;
+    void ForceRebindDescriptors() override;
+};
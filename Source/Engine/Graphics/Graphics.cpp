@@ -17,6 +17,8 @@ Quality Graphics::VolumetricFogQuality = Quality::High;
 Quality Graphics::ShadowsQuality = Quality::Medium;
 Quality Graphics::ShadowMapsQuality = Quality::Medium;
 bool Graphics::AllowCSMBlending = false;
+bool Graphics::ParallelDrawCalls = true;
+bool Graphics::OcclusionCulling = true;
 Quality Graphics::GlobalSDFQuality = Quality::High;
 Quality Graphics::GIQuality = Quality::High;
 PostProcessSettings Graphics::PostProcessSettings;
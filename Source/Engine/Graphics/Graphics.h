@@ -53,6 +53,16 @@ API_CLASS(Static) class FLAXENGINE_API Graphics
     /// </summary>
     API_FIELD() static bool AllowCSMBlending;
 
+    /// <summary>
+    /// Enables recording of the large draw calls lists (eg. GBuffer or depth pass) on multiple threads using deferred GPU contexts.
+    /// </summary>
+    API_FIELD() static bool ParallelDrawCalls;
+
+    /// <summary>
+    /// Enables the CPU occlusion culling that rasterizes the largest occluders (eg. static models marked as occluders) into the low-resolution depth buffer and culls objects hidden behind them before emitting draw calls.
+    /// </summary>
+    API_FIELD() static bool OcclusionCulling;
+
     /// <summary>
     /// The Global SDF quality. Controls the volume texture resolution and amount of cascades to use.
     /// </summary>
@@ -30,7 +30,7 @@ void DecalMaterialShader::Bind(BindParameters& params)
     auto context = params.GPUContext;
     auto& view = params.RenderContext.View;
     auto& drawCall = *params.FirstDrawCall;
-    Span<byte> cb(_cbData.Get(), _cbData.Count());
+    Span<byte> cb = GetConstants();
     ASSERT_LOW_LAYER(cb.Length() >= sizeof(DecalMaterialShaderData));
     auto materialData = reinterpret_cast<DecalMaterialShaderData*>(cb.Get());
     cb = Span<byte>(cb.Get() + sizeof(DecalMaterialShaderData), cb.Length() - sizeof(DecalMaterialShaderData));
@@ -72,7 +72,7 @@ void DecalMaterialShader::Bind(BindParameters& params)
     // Bind constants
     if (_cb)
     {
-        context->UpdateCB(_cb, _cbData.Get());
+        context->UpdateCB(_cb, materialData);
         context->BindCB(0, _cb);
     }
 
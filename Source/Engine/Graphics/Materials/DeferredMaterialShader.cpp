@@ -49,7 +49,7 @@ void DeferredMaterialShader::Bind(BindParameters& params)
     auto context = params.GPUContext;
     auto& view = params.RenderContext.View;
     auto& drawCall = *params.FirstDrawCall;
-    Span<byte> cb(_cbData.Get(), _cbData.Count());
+    Span<byte> cb = GetConstants();
     ASSERT_LOW_LAYER(cb.Length() >= sizeof(DeferredMaterialShaderData));
     auto materialData = reinterpret_cast<DeferredMaterialShaderData*>(cb.Get());
     cb = Span<byte>(cb.Get() + sizeof(DeferredMaterialShaderData), cb.Length() - sizeof(DeferredMaterialShaderData));
@@ -96,7 +96,7 @@ void DeferredMaterialShader::Bind(BindParameters& params)
     // Bind constants
     if (_cb)
     {
-        context->UpdateCB(_cb, _cbData.Get());
+        context->UpdateCB(_cb, materialData);
         context->BindCB(0, _cb);
     }
 
@@ -116,7 +116,7 @@ void DeferredMaterialShader::Bind(BindParameters& params)
             cullMode = CullMode::Normal;
     }
     ASSERT_LOW_LAYER(!(useSkinning && params.DrawCallsCount > 1)); // No support for instancing skinned meshes
-    const auto cache = params.DrawCallsCount == 1 ? &_cache : &_cacheInstanced;
+    const auto cache = params.DrawCallsCount == 1 && !params.Instanced ? &_cache : &_cacheInstanced;
     PipelineStateCache* psCache = cache->GetPS(view.Pass, useLightmap, useSkinning, perBoneMotionBlur);
     ASSERT(psCache);
     GPUPipelineState* state = psCache->GetPS(cullMode, wireframe);
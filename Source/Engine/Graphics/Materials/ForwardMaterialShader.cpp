@@ -44,7 +44,7 @@ void ForwardMaterialShader::Bind(BindParameters& params)
     auto context = params.GPUContext;
     auto& view = params.RenderContext.View;
     auto& drawCall = *params.FirstDrawCall;
-    Span<byte> cb(_cbData.Get(), _cbData.Count());
+    Span<byte> cb = GetConstants();
     ASSERT_LOW_LAYER(cb.Length() >= sizeof(ForwardMaterialShaderData));
     auto materialData = reinterpret_cast<ForwardMaterialShaderData*>(cb.Get());
     cb = Span<byte>(cb.Get() + sizeof(ForwardMaterialShaderData), cb.Length() - sizeof(ForwardMaterialShaderData));
@@ -87,7 +87,7 @@ void ForwardMaterialShader::Bind(BindParameters& params)
     // Bind constants
     if (_cb)
     {
-        context->UpdateCB(_cb, _cbData.Get());
+        context->UpdateCB(_cb, materialData);
         context->BindCB(0, _cb);
     }
 
@@ -107,7 +107,7 @@ void ForwardMaterialShader::Bind(BindParameters& params)
             cullMode = CullMode::Normal;
     }
     ASSERT_LOW_LAYER(!(useSkinning && params.DrawCallsCount > 1)); // No support for instancing skinned meshes
-    const auto cacheObj = params.DrawCallsCount == 1 ? &_cache : &_cacheInstanced;
+    const auto cacheObj = params.DrawCallsCount == 1 && !params.Instanced ? &_cache : &_cacheInstanced;
     PipelineStateCache* psCache = cacheObj->GetPS(view.Pass, useSkinning);
     ASSERT(psCache);
     GPUPipelineState* state = psCache->GetPS(cullMode, wireframe);
@@ -29,7 +29,7 @@ void GUIMaterialShader::Bind(BindParameters& params)
 {
     // Prepare
     auto context = params.GPUContext;
-    Span<byte> cb(_cbData.Get(), _cbData.Count());
+    Span<byte> cb = GetConstants();
     ASSERT_LOW_LAYER(cb.Length() >= sizeof(GUIMaterialShaderData));
     auto materialData = reinterpret_cast<GUIMaterialShaderData*>(cb.Get());
     cb = Span<byte>(cb.Get() + sizeof(GUIMaterialShaderData), cb.Length() - sizeof(GUIMaterialShaderData));
@@ -65,7 +65,7 @@ void GUIMaterialShader::Bind(BindParameters& params)
     // Bind constants
     if (_cb)
     {
-        context->UpdateCB(_cb, _cbData.Get());
+        context->UpdateCB(_cb, materialData);
         context->BindCB(0, _cb);
     }
 
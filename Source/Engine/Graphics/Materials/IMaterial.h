@@ -155,6 +155,11 @@ class FLAXENGINE_API IMaterial
         /// </summary>
         GPUTextureView* Input = nullptr;
 
+        /// <summary>
+        /// True if per-object data (transformation, etc.) is provided via instance buffer so instanced pipeline is used even for a single draw call (see RenderList::Objects).
+        /// </summary>
+        bool Instanced = false;
+
         BindParameters(::GPUContext* context, const ::RenderContext& renderContext);
         BindParameters(::GPUContext* context, const ::RenderContext& renderContext, const DrawCall& drawCall);
         BindParameters(::GPUContext* context, const ::RenderContext& renderContext, const DrawCall* firstDrawCall, int32 drawCallsCount);
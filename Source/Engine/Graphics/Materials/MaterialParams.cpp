@@ -14,6 +14,8 @@
 #include "Engine/Renderer/GlobalSignDistanceFieldPass.h"
 #include "Engine/Scripting/Enums.h"
 #include "Engine/Streaming/Streaming.h"
+#include "Engine/Threading/FastLock.h"
+#include "Engine/Profiler/ProfilerCPU.h"
 
 bool MaterialInfo8::operator==(const MaterialInfo8& other) const
 {
@@ -166,8 +168,53 @@ Variant MaterialParameter::GetValue() const
     }
 }
 
+void MaterialParameter::SetIsOverride(bool value)
+{
+    if (_override != value)
+    {
+        _override = value;
+        InvalidateBindCache();
+    }
+}
+
+void MaterialParameter::InvalidateBindCache() const
+{
+    if (_owner)
+        _owner->InvalidateBindCache();
+}
+
+int32 MaterialParameter::GetConstantSize() const
+{
+    // Size of the value written by Bind into the constant buffer (0 for parameters that are not just constants)
+    switch (_type)
+    {
+    case MaterialParameterType::Bool:
+    case MaterialParameterType::Integer:
+    case MaterialParameterType::Float:
+        return sizeof(int32);
+    case MaterialParameterType::Vector2:
+        return sizeof(Float2);
+    case MaterialParameterType::Vector3:
+        return sizeof(Float3);
+    case MaterialParameterType::Vector4:
+    case MaterialParameterType::Color:
+    case MaterialParameterType::ChannelMask:
+        return sizeof(Float4);
+    case MaterialParameterType::Matrix:
+        return sizeof(Matrix);
+    default:
+        return 0;
+    }
+}
+
 void MaterialParameter::SetValue(const Variant& value)
 {
+    // Skip cache invalidation if the value is the same (eg. particles set parameters every frame)
+    byte prevData[sizeof(AsData)];
+    const bool isConstant = GetConstantSize() != 0;
+    if (isConstant)
+        Platform::MemoryCopy(prevData, AsData, sizeof(AsData));
+
     bool invalidType = false;
     switch (_type)
     {
@@ -275,6 +322,10 @@ void MaterialParameter::SetValue(const Variant& value)
     {
         LOG(Error, "Invalid material parameter value type {0} to set (param type: {1})", value.Type, ScriptingEnum::ToString(_type));
     }
+    if (isConstant && Platform::MemoryCompare(prevData, AsData, sizeof(AsData)) != 0)
+    {
+        InvalidateBindCache();
+    }
 }
 
 void MaterialParameter::Bind(BindMeta& meta) const
@@ -521,6 +572,7 @@ void MaterialParameter::clone(const MaterialParameter* param)
     }
     _asAsset = param->_asAsset;
     _asGPUTexture = param->_asGPUTexture;
+    InvalidateBindCache();
 }
 
 bool MaterialParameter::operator==(const MaterialParameter& other) const
@@ -597,16 +649,105 @@ int32 MaterialParams::GetVersionHash() const
 void MaterialParams::Bind(MaterialParamsLink* link, MaterialParameter::BindMeta& meta)
 {
     ASSERT(link && link->This);
-    for (int32 i = 0; i < link->This->Count(); i++)
+    MaterialParams* params = link->This;
+
+    // Identify the parameters overrides chain (eg. material instance with other base material) and its state (versions only increase so the sum changes whenever any of the collections gets modified)
+    uint64 links = 0;
+    int64 version = 0;
+    for (MaterialParamsLink* l = link; l; l = l->Down)
+    {
+        links = links * 31 + (uint64)(uintptr)l->This;
+        version += Platform::AtomicRead(&l->This->_bindVersion);
+    }
+
+    // Use cache if none of the parameters in the chain were modified since the last bind
+    {
+        ScopeReadLock lock(params->_bindCacheLocker);
+        if (params->_bindCacheVersion == version && params->_bindCacheLinks == links)
+        {
+            params->BindCached(meta);
+            return;
+        }
+    }
+
+    // Rebuild cache (readers are blocked so the cached data is not modified while in use)
+    ScopeWriteLock lock(params->_bindCacheLocker);
+    if (params->_bindCacheVersion != version || params->_bindCacheLinks != links)
+    {
+        params->UpdateBindCache(link, links);
+        params->_bindCacheVersion = version;
+    }
+    params->BindCached(meta);
+}
+
+void MaterialParams::BindCached(MaterialParameter::BindMeta& meta) const
+{
+    // Copy constants at once and bind only the parameters that cannot be cached (textures, scene textures, gameplay globals, etc.)
+    if (_bindCacheConstants.HasItems())
+    {
+        ASSERT_LOW_LAYER(meta.Constants.Get() && meta.Constants.Length() >= _bindCacheOffset + _bindCacheConstants.Count());
+        Platform::MemoryCopy(meta.Constants.Get() + _bindCacheOffset, _bindCacheConstants.Get(), _bindCacheConstants.Count());
+    }
+    for (const MaterialParameter* param : _bindCacheDynamic)
+    {
+        param->Bind(meta);
+    }
+}
+
+void MaterialParams::UpdateBindCache(MaterialParamsLink* link, uint64 links)
+{
+    PROFILE_CPU();
+    _bindCacheLinks = links;
+    _bindCacheConstants.Clear();
+    _bindCacheDynamic.Clear();
+
+    // Resolve the overriden parameters
+    Array<const MaterialParameter*, InlinedAllocation<64>> constants;
+    int32 start = MAX_int32, end = 0;
+    for (int32 i = 0; i < Count(); i++)
     {
         MaterialParamsLink* l = link;
         while (l->Down && !l->This->At(i).IsOverride())
         {
             l = l->Down;
         }
+        const MaterialParameter& param = l->This->At(i);
+        const int32 size = param.GetConstantSize();
+        if (size != 0)
+        {
+            constants.Add(&param);
+            start = Math::Min(start, (int32)param.GetBindOffset());
+            end = Math::Max(end, (int32)param.GetBindOffset() + size);
+        }
+        else
+        {
+            _bindCacheDynamic.Add(&param);
+        }
+    }
+    if (constants.IsEmpty())
+        return;
 
-        l->This->At(i).Bind(meta);
+    // Pack constants the same way as they are placed in the constant buffer
+    Array<byte, InlinedAllocation<1024>> data;
+    data.Resize(end);
+    Platform::MemoryClear(data.Get(), end);
+    MaterialParameter::BindMeta meta;
+    meta.Context = nullptr;
+    meta.Constants = ToSpan(data);
+    meta.Input = nullptr;
+    meta.Buffers = nullptr;
+    meta.CanSampleDepth = meta.CanSampleGBuffer = false;
+    for (const MaterialParameter* param : constants)
+    {
+        param->Bind(meta);
     }
+    _bindCacheOffset = start;
+    _bindCacheConstants.Set(data.Get() + start, end - start);
+}
+
+void MaterialParams::InvalidateBindCache()
+{
+    Platform::InterlockedIncrement(&_bindVersion);
 }
 
 void MaterialParams::Clone(MaterialParams& result)
@@ -617,6 +758,7 @@ void MaterialParams::Clone(MaterialParams& result)
     result.Resize(Count(), false);
     for (int32 i = 0; i < Count(); i++)
     {
+        result.At(i)._owner = &result;
         result.At(i).clone(&At(i));
     }
 
@@ -627,6 +769,13 @@ void MaterialParams::Dispose()
 {
     Resize(0);
     _versionHash = 0;
+    {
+        ScopeWriteLock lock(_bindCacheLocker);
+        _bindCacheVersion = -1;
+        _bindCacheConstants.Resize(0);
+        _bindCacheDynamic.Resize(0);
+    }
+    InvalidateBindCache();
 }
 
 bool MaterialParams::Load(ReadStream* stream)
@@ -876,6 +1025,9 @@ bool MaterialParams::Load(ReadStream* stream)
     }
 
     UpdateHash();
+    for (int32 i = 0; i < Count(); i++)
+        At(i)._owner = this;
+    InvalidateBindCache();
 
     return result;
 }
@@ -10,6 +10,7 @@
 #include "Engine/Scripting/ScriptingObjectReference.h"
 #include "Engine/Content/Assets/Texture.h"
 #include "Engine/Content/AssetReference.h"
+#include "Engine/Threading/FastLock.h"
 
 class MaterialInstance;
 class MaterialParams;
@@ -197,6 +198,7 @@ API_CLASS(NoSpawn) class FLAXENGINE_API MaterialParameter : public ScriptingObje
     AssetReference<Asset> _asAsset;
     ScriptingObjectReference<GPUTexture> _asGPUTexture;
     String _name;
+    MaterialParams* _owner = nullptr;
 
 public:
     MaterialParameter(const MaterialParameter& other)
@@ -259,10 +261,7 @@ API_CLASS(NoSpawn) class FLAXENGINE_API MaterialParameter : public ScriptingObje
     /// <summary>
     /// Sets the value override mode.
     /// </summary>
-    API_PROPERTY() void SetIsOverride(bool value)
-    {
-        _override = value;
-    }
+    API_PROPERTY() void SetIsOverride(bool value);
 
     /// <summary>
     /// Gets the parameter resource graphics pipeline binding register index.
@@ -340,6 +339,8 @@ API_CLASS(NoSpawn) class FLAXENGINE_API MaterialParameter : public ScriptingObje
 
 private:
     void clone(const MaterialParameter* param);
+    int32 GetConstantSize() const;
+    void InvalidateBindCache() const;
 
 public:
     bool operator==(const MaterialParameter& other) const;
@@ -354,9 +355,21 @@ API_CLASS(NoSpawn) class FLAXENGINE_API MaterialParameter : public ScriptingObje
 class FLAXENGINE_API MaterialParams : public Array<MaterialParameter>
 {
     friend MaterialInstance;
+    friend MaterialParameter;
 private:
     int32 _versionHash = 0;
 
+    // Incremented every time the parameters get modified (invalidates the cached parameters bindings of this collection and the ones that override it)
+    volatile int64 _bindVersion = 0;
+
+    // Cached parameters binding (constants packed into the buffer layout and the parameters that need to be bound every time, eg. textures), rebuilt when any parameters in the overrides chain get modified
+    ReadWriteLock _bindCacheLocker;
+    int64 _bindCacheVersion = -1;
+    uint64 _bindCacheLinks = 0;
+    int32 _bindCacheOffset = 0;
+    Array<byte> _bindCacheConstants;
+    Array<const MaterialParameter*> _bindCacheDynamic;
+
 public:
     MaterialParameter* Get(const Guid& id);
     MaterialParameter* Get(const StringView& name);
@@ -430,4 +443,7 @@ class FLAXENGINE_API MaterialParams : public Array<MaterialParameter>
 
 private:
     void UpdateHash();
+    void UpdateBindCache(MaterialParamsLink* link, uint64 links);
+    void BindCached(MaterialParameter::BindMeta& meta) const;
+    void InvalidateBindCache();
 };
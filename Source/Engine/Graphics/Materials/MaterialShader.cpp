@@ -10,6 +10,8 @@
 #include "Engine/Graphics/Shaders/GPUConstantBuffer.h"
 #include "Engine/Graphics/Shaders/GPUShader.h"
 #include "Engine/Engine/Time.h"
+#include "Engine/Threading/Threading.h"
+#include "Engine/Threading/ThreadLocal.h"
 #include "DecalMaterialShader.h"
 #include "PostFxMaterialShader.h"
 #include "ForwardMaterialShader.h"
@@ -35,6 +37,12 @@ PACK_STRUCT(struct MaterialShaderDataPerView {
     Float4 TemporalAAJitter;
     });
 
+namespace
+{
+    ThreadLocal<Array<byte>> ConstantsData;
+    CriticalSection PipelineStatesLocker;
+}
+
 IMaterial::BindParameters::BindParameters(::GPUContext* context, const ::RenderContext& renderContext)
     : GPUContext(context)
     , RenderContext(renderContext)
@@ -93,18 +101,25 @@ void IMaterial::BindParameters::BindViewData()
     GPUContext->BindCB(1, PerViewConstants);
 }
 
-GPUPipelineState* MaterialShader::PipelineStateCache::InitPS(CullMode mode, bool wireframe)
+GPUPipelineState* MaterialShader::PipelineStateCache::InitPS(int32 index, CullMode mode, bool wireframe)
 {
+    ScopeLock lock(PipelineStatesLocker);
+    auto ps = PS[index];
+    if (ps)
+        return ps; // Created by other thread
     Desc.CullMode = mode;
     Desc.Wireframe = wireframe;
-    auto ps = GPUDevice::Instance->CreatePipelineState();
+    ps = GPUDevice::Instance->CreatePipelineState();
     ps->Init(Desc);
+    Platform::AtomicStore((intptr volatile*)&PS[index], (intptr)ps); // Publish initialized state to the threads that read it without a lock (eg. parallel draw calls recording)
     return ps;
 }
 
 MaterialShader::MaterialShader(const StringView& name)
     : _isLoaded(false)
     , _shader(nullptr)
+    , _cb(nullptr)
+    , _cbSize(0)
 {
     ASSERT(GPUDevice::Instance);
     _shader = GPUDevice::Instance->CreateShader(name);
@@ -116,6 +131,18 @@ MaterialShader::~MaterialShader()
     SAFE_DELETE_GPU_RESOURCE(_shader);
 }
 
+Span<byte> MaterialShader::GetConstants() const
+{
+    auto& data = ConstantsData.Get();
+    if (data.Count() < _cbSize)
+    {
+        const int32 count = data.Count();
+        data.Resize(_cbSize);
+        Platform::MemoryClear(data.Get() + count, _cbSize - count);
+    }
+    return Span<byte>(data.Get(), _cbSize);
+}
+
 MaterialShader* MaterialShader::Create(const StringView& name, MemoryReadStream& shaderCacheStream, const MaterialInfo& info)
 {
     MaterialShader* material;
@@ -230,8 +257,7 @@ bool MaterialShader::Load(MemoryReadStream& shaderCacheStream, const MaterialInf
             cbSize = 1024;
             _cb = nullptr;
         }
-        _cbData.Resize(cbSize, false);
-        Platform::MemoryClear(_cbData.Get(), cbSize);
+        _cbSize = cbSize;
     }
 
     // Initialize the material based on type (create pipeline states and setup)
@@ -248,6 +274,6 @@ void MaterialShader::Unload()
 {
     _isLoaded = false;
     _cb = nullptr;
-    _cbData.Resize(0, false);
+    _cbSize = 0;
     _shader->ReleaseGPU();
 }
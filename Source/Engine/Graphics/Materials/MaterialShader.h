@@ -4,6 +4,7 @@
 
 #include "IMaterial.h"
 #include "Engine/Core/Collections/Array.h"
+#include "Engine/Core/Types/Span.h"
 #include "Engine/Graphics/GPUPipelineState.h"
 #include "Engine/Renderer/Config.h"
 
@@ -41,13 +42,13 @@ class MaterialShader : public IMaterial
         GPUPipelineState* GetPS(CullMode mode, bool wireframe)
         {
             const int32 index = static_cast<int32>(mode) + (wireframe ? 3 : 0);
-            auto ps = PS[index];
+            auto ps = (GPUPipelineState*)Platform::AtomicRead((intptr volatile*)&PS[index]);
             if (!ps)
-                PS[index] = ps = InitPS(mode, wireframe);
+                ps = InitPS(index, mode, wireframe);
             return ps;
         }
 
-        GPUPipelineState* InitPS(CullMode mode, bool wireframe);
+        GPUPipelineState* InitPS(int32 index, CullMode mode, bool wireframe);
 
         void Release()
         {
@@ -59,7 +60,7 @@ class MaterialShader : public IMaterial
     bool _isLoaded;
     GPUShader* _shader;
     GPUConstantBuffer* _cb;
-    Array<byte> _cbData;
+    int32 _cbSize;
     MaterialInfo _info;
 
 protected:
@@ -102,6 +103,9 @@ class MaterialShader : public IMaterial
     bool Load(MemoryReadStream& shaderCacheStream, const MaterialInfo& info);
     virtual bool Load() = 0;
 
+    // Gets the memory for the material constants to write during binding. Uses per-thread memory as materials can be bound from the multiple threads (eg. when recording draw calls in parallel).
+    Span<byte> GetConstants() const;
+
 public:
     // [IMaterial]
     const MaterialInfo& GetInfo() const override;
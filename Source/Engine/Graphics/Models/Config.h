@@ -21,3 +21,19 @@
 
 // Defines the maximum allowed amount of skeleton bones to be used with skinned model
 #define MAX_BONES_PER_MODEL 256
+
+// Maximum amount of vertices and triangles in a single mesh cluster (meshlet) generated during model import
+#define MESH_CLUSTER_MAX_VERTICES 64
+#define MESH_CLUSTER_MAX_TRIANGLES 124
+
+// Minimum amount of clusters in the mesh to use the clusters culling for the depth-only passes (small meshes are culled as a whole)
+#define MESH_CLUSTER_CULLING_MIN_CLUSTERS 16
+
+// Maximum amount of the index buffer ranges drawn for the mesh after clusters culling (more fragmented visibility draws the whole mesh)
+#define MESH_CLUSTER_CULLING_MAX_RANGES 8
+
+// Flag set in the vertices count of the mesh data stored in the model LOD chunk to indicate the compressed data layout (meshoptimizer vertex/index codecs)
+#define MESH_DATA_COMPRESSED_FLAG 0x80000000u
+
+// Minimum amount of the compressed meshes in the model LOD to decode them in parallel on load
+#define MESH_DATA_PARALLEL_DECODE_MIN_MESHES 2
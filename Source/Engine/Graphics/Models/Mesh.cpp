@@ -1,6 +1,7 @@
 // Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
 
 #include "Mesh.h"
+#include "MeshChunkData.h"
 #include "ModelInstanceEntry.h"
 #include "Engine/Content/Assets/Material.h"
 #include "Engine/Content/Assets/Model.h"
@@ -9,6 +10,7 @@
 #include "Engine/Graphics/GPUContext.h"
 #include "Engine/Graphics/GPUDevice.h"
 #include "Engine/Graphics/RenderTask.h"
+#include "Engine/Graphics/RenderTools.h"
 #include "Engine/Profiler/ProfilerCPU.h"
 #include "Engine/Renderer/RenderList.h"
 #include "Engine/Scripting/ManagedCLR/MCore.h"
@@ -21,6 +23,14 @@
 
 namespace
 {
+    FORCE_INLINE Span<MeshCluster> GetCullingClusters(const Array<MeshCluster>& clusters, uint32 triangles)
+    {
+        // Use clusters only if they match the loaded index buffer
+        if (clusters.Count() >= MESH_CLUSTER_CULLING_MIN_CLUSTERS && clusters.Last().FirstIndex + clusters.Last().IndicesCount == triangles * 3)
+            return ToSpan(clusters);
+        return Span<MeshCluster>();
+    }
+
     template<typename IndexType>
     bool UpdateMesh(Mesh* mesh, uint32 vertexCount, uint32 triangleCount, Float3* vertices, IndexType* triangles, Float3* normals, Float3* tangents, Float2* uvs, Color32* colors)
     {
@@ -154,6 +164,7 @@ bool Mesh::UpdateMesh(uint32 vertexCount, uint32 triangleCount, VB0ElementType*
     auto model = (Model*)_model;
 
     Unload();
+    _clusters.Clear();
 
     // Setup GPU resources
     model->LODs[_lodIndex]._verticesCount -= _vertices;
@@ -205,10 +216,16 @@ bool Mesh::UpdateTriangles(uint32 triangleCount, void* ib, bool use16BitIndices)
     _indexBuffer = indexBuffer;
     _triangles = triangleCount;
     _use16BitIndexBuffer = use16BitIndices;
+    _clusters.Clear();
 
     return false;
 }
 
+void Mesh::SetClusters(const Span<MeshCluster>& clusters)
+{
+    _clusters.Set(clusters.Get(), clusters.Length());
+}
+
 void Mesh::Init(Model* model, int32 lodIndex, int32 index, int32 materialSlotIndex, const BoundingBox& box, const BoundingSphere& sphere, bool hasLightmapUVs)
 {
     _model = model;
@@ -225,6 +242,7 @@ void Mesh::Init(Model* model, int32 lodIndex, int32 index, int32 materialSlotInd
     _vertexBuffers[1] = nullptr;
     _vertexBuffers[2] = nullptr;
     _indexBuffer = nullptr;
+    _clusters.Clear();
 }
 
 Mesh::~Mesh()
@@ -511,6 +529,19 @@ void Mesh::Draw(const RenderContext& renderContext, const DrawInfo& info, float
         GBufferPass::AddIndexBufferToModelLOD(_indexBuffer, &((Model*)_model)->LODs[_lodIndex]);
 #endif
 
+    // Draw only the visible clusters of the large meshes in depth-only passes (eg. shadow map projection)
+    Array<Int2, InlinedAllocation<MESH_CLUSTER_CULLING_MAX_RANGES>> ranges;
+    if (drawModes == DrawPass::Depth && RenderTools::CullMeshClusters(GetCullingClusters(_clusters, _triangles), renderContext.View, drawCall.World, material->GetInfo().CullMode, ranges))
+    {
+        for (const Int2& range : ranges)
+        {
+            drawCall.Draw.StartIndex = range.X;
+            drawCall.Draw.IndicesCount = range.Y;
+            renderContext.List->AddDrawCall(renderContext, drawModes, info.Flags, drawCall, entry.ReceiveDecals, info.SortOrder);
+        }
+        return;
+    }
+
     // Push draw call to the render list
     renderContext.List->AddDrawCall(renderContext, drawModes, info.Flags, drawCall, entry.ReceiveDecals, info.SortOrder);
 }
@@ -576,48 +607,35 @@ void Mesh::Draw(const RenderContextBatch& renderContextBatch, const DrawInfo& in
     const auto shadowsMode = entry.ShadowsMode & slot.ShadowsMode;
     const auto drawModes = info.DrawModes & material->GetDrawModes();
     if (drawModes != DrawPass::None)
-        renderContextBatch.GetMainContext().List->AddDrawCall(renderContextBatch, drawModes, info.Flags, shadowsMode, info.Bounds, drawCall, entry.ReceiveDecals, info.SortOrder);
+        renderContextBatch.GetMainContext().List->AddDrawCall(renderContextBatch, drawModes, info.Flags, shadowsMode, info.Bounds, drawCall, entry.ReceiveDecals, info.SortOrder, GetCullingClusters(_clusters, _triangles));
 }
 
-bool Mesh::DownloadDataGPU(MeshBufferType type, BytesContainer& result) const
+GPUBuffer* Mesh::GetGPUBuffer(MeshBufferType type) const
 {
-    GPUBuffer* buffer = nullptr;
     switch (type)
     {
     case MeshBufferType::Index:
-        buffer = _indexBuffer;
-        break;
+        return _indexBuffer;
     case MeshBufferType::Vertex0:
-        buffer = _vertexBuffers[0];
-        break;
+        return _vertexBuffers[0];
     case MeshBufferType::Vertex1:
-        buffer = _vertexBuffers[1];
-        break;
+        return _vertexBuffers[1];
     case MeshBufferType::Vertex2:
-        buffer = _vertexBuffers[2];
-        break;
+        return _vertexBuffers[2];
+    default:
+        return nullptr;
     }
+}
+
+bool Mesh::DownloadDataGPU(MeshBufferType type, BytesContainer& result) const
+{
+    GPUBuffer* buffer = GetGPUBuffer(type);
     return buffer && buffer->DownloadData(result);
 }
 
 Task* Mesh::DownloadDataGPUAsync(MeshBufferType type, BytesContainer& result) const
 {
-    GPUBuffer* buffer = nullptr;
-    switch (type)
-    {
-    case MeshBufferType::Index:
-        buffer = _indexBuffer;
-        break;
-    case MeshBufferType::Vertex0:
-        buffer = _vertexBuffers[0];
-        break;
-    case MeshBufferType::Vertex1:
-        buffer = _vertexBuffers[1];
-        break;
-    case MeshBufferType::Vertex2:
-        buffer = _vertexBuffers[2];
-        break;
-    }
+    GPUBuffer* buffer = GetGPUBuffer(type);
     return buffer ? buffer->DownloadDataAsync(result) : nullptr;
 }
 
@@ -648,43 +666,26 @@ bool Mesh::DownloadDataCPU(MeshBufferType type, BytesContainer& result, int32& c
         MemoryReadStream stream(chunk->Get(), chunk->Size());
 
         // Seek to find mesh location
+        MeshChunkData data;
         for (int32 i = 0; i <= _index; i++)
         {
-            // #MODEL_DATA_FORMAT_USAGE
-            uint32 vertices;
-            stream.ReadUint32(&vertices);
-            uint32 triangles;
-            stream.ReadUint32(&triangles);
-            uint32 indicesCount = triangles * 3;
-            bool use16BitIndexBuffer = indicesCount <= MAX_uint16;
-            uint32 ibStride = use16BitIndexBuffer ? sizeof(uint16) : sizeof(uint32);
-            if (vertices == 0 || triangles == 0)
+            if (data.Read(stream))
             {
                 LOG(Error, "Invalid mesh data.");
                 return true;
             }
-            auto vb0 = stream.Move<VB0ElementType>(vertices);
-            auto vb1 = stream.Move<VB1ElementType>(vertices);
-            bool hasColors = stream.ReadBool();
-            VB2ElementType18* vb2 = nullptr;
-            if (hasColors)
-            {
-                vb2 = stream.Move<VB2ElementType18>(vertices);
-            }
-            auto ib = stream.Move<byte>(indicesCount * ibStride);
-
-            if (i != _index)
-                continue;
-
-            // Cache mesh data
-            _cachedIndexBufferCount = indicesCount;
-            _cachedIndexBuffer.Set(ib, indicesCount * ibStride);
-            _cachedVertexBuffer[0].Set((const byte*)vb0, vertices * sizeof(VB0ElementType));
-            _cachedVertexBuffer[1].Set((const byte*)vb1, vertices * sizeof(VB1ElementType));
-            if (hasColors)
-                _cachedVertexBuffer[2].Set((const byte*)vb2, vertices * sizeof(VB2ElementType));
-            break;
         }
+        if (data.Decode())
+            return true;
+
+        // Cache mesh data
+        const uint32 indicesCount = data.GetIndicesCount();
+        _cachedIndexBufferCount = indicesCount;
+        _cachedIndexBuffer.Set((const byte*)data.IB, indicesCount * data.GetIndexBufferStride());
+        _cachedVertexBuffer[0].Set((const byte*)data.VB0, data.Vertices * sizeof(VB0ElementType));
+        _cachedVertexBuffer[1].Set((const byte*)data.VB1, data.Vertices * sizeof(VB1ElementType));
+        if (data.VB2)
+            _cachedVertexBuffer[2].Set((const byte*)data.VB2, data.Vertices * sizeof(VB2ElementType));
     }
 
     switch (type)
@@ -747,6 +748,35 @@ enum class InternalBufferType
     IB32 = 4,
 };
 
+bool MeshBase::DownloadBufferGPU(MeshBufferType type, int32 elementSize, MTypeObject* resultType, MArray*& result) const
+{
+    result = nullptr;
+    GPUBuffer* buffer = GetGPUBuffer(type);
+    if (!buffer || elementSize != (int32)buffer->GetStride() || buffer->GetSize() % elementSize != 0)
+        return true;
+    const int32 dataCount = (int32)(buffer->GetSize() / elementSize);
+    MArray* array = MCore::Array::New(MCore::Type::GetClass(INTERNAL_TYPE_OBJECT_GET(resultType)), dataCount);
+    const MGCHandle handle = MCore::GCHandle::New((MObject*)array, true);
+    auto task = buffer->DownloadDataAsync(Span<byte>((byte*)MCore::Array::GetAddress(array), dataCount * elementSize));
+    if (task == nullptr)
+    {
+        MCore::GCHandle::Free(handle);
+        return false;
+    }
+    task->Start();
+    _model->Locker.Unlock();
+    const bool failed = task->Wait();
+    _model->Locker.Lock();
+    MCore::GCHandle::Free(handle);
+    if (failed)
+    {
+        LOG(Error, "Task failed.");
+        return false;
+    }
+    result = array;
+    return false;
+}
+
 MArray* Mesh::DownloadBuffer(bool forceGpu, MTypeObject* resultType, int32 typeI)
 {
     auto mesh = this;
@@ -764,30 +794,44 @@ MArray* Mesh::DownloadBuffer(bool forceGpu, MTypeObject* resultType, int32 typeI
     }
 
     MeshBufferType bufferType;
+    int32 managedElementSize;
     switch (type)
     {
     case InternalBufferType::VB0:
         bufferType = MeshBufferType::Vertex0;
+        managedElementSize = sizeof(VB0ElementType);
         break;
     case InternalBufferType::VB1:
         bufferType = MeshBufferType::Vertex1;
+        managedElementSize = sizeof(VB1ElementType);
         break;
     case InternalBufferType::VB2:
         bufferType = MeshBufferType::Vertex2;
+        managedElementSize = sizeof(VB2ElementType);
         break;
     case InternalBufferType::IB16:
+        bufferType = MeshBufferType::Index;
+        managedElementSize = sizeof(uint16);
+        break;
     case InternalBufferType::IB32:
         bufferType = MeshBufferType::Index;
+        managedElementSize = sizeof(uint32);
         break;
     default:
         return nullptr;
     }
+    if (forceGpu)
+    {
+        // Download data from GPU directly into the managed array memory if no conversion is needed
+        MArray* result;
+        if (!DownloadBufferGPU(bufferType, managedElementSize, resultType, result))
+            return result;
+    }
     BytesContainer data;
     int32 dataCount;
     if (forceGpu)
     {
         // Get data from GPU
-        // TODO: support reusing the input memory buffer to perform a single copy from staging buffer to the input CPU buffer
         auto task = mesh->DownloadDataGPUAsync(bufferType, data);
         if (task == nullptr)
             return nullptr;
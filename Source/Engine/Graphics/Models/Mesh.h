@@ -28,6 +28,7 @@ API_CLASS(NoSpawn) class FLAXENGINE_API Mesh : public MeshBase
     mutable Array<byte> _cachedVertexBuffer[3];
     mutable Array<byte> _cachedIndexBuffer;
     mutable int32 _cachedIndexBufferCount;
+    Array<MeshCluster> _clusters;
 
 public:
     Mesh(const Mesh& other)
@@ -91,6 +92,20 @@ API_CLASS(NoSpawn) class FLAXENGINE_API Mesh : public MeshBase
         return _hasLightmapUVs;
     }
 
+    /// <summary>
+    /// Gets the mesh clusters (meshlets) used for the fine-grained culling of the mesh triangles. Empty if mesh has no clusters data.
+    /// </summary>
+    FORCE_INLINE const Array<MeshCluster>& GetClusters() const
+    {
+        return _clusters;
+    }
+
+    /// <summary>
+    /// Sets the mesh clusters (meshlets) used for the fine-grained culling of the mesh triangles. Clusters have to cover the whole mesh index buffer.
+    /// </summary>
+    /// <param name="clusters">The clusters data.</param>
+    void SetClusters(const Span<MeshCluster>& clusters);
+
 #if USE_PRECISE_MESH_INTERSECTS
     /// <summary>
     /// Gets the collision proxy used by the mesh.
@@ -307,6 +322,7 @@ API_CLASS(NoSpawn) class FLAXENGINE_API Mesh : public MeshBase
 
 public:
     // [MeshBase]
+    GPUBuffer* GetGPUBuffer(MeshBufferType type) const override;
     bool DownloadDataGPU(MeshBufferType type, BytesContainer& result) const override;
     Task* DownloadDataGPUAsync(MeshBufferType type, BytesContainer& result) const override;
     bool DownloadDataCPU(MeshBufferType type, BytesContainer& result, int32& count) const override;
@@ -127,6 +127,13 @@ API_CLASS(Abstract, NoSpawn) class FLAXENGINE_API MeshBase : public ScriptingObj
     void SetBounds(const BoundingBox& box);
 
 public:
+    /// <summary>
+    /// Gets the GPU buffer used by the mesh.
+    /// </summary>
+    /// <param name="type">Buffer type</param>
+    /// <returns>The buffer or null if not used (or mesh is not initialized).</returns>
+    virtual GPUBuffer* GetGPUBuffer(MeshBufferType type) const = 0;
+
     /// <summary>
     /// Extract mesh buffer data from GPU. Cannot be called from the main thread.
     /// </summary>
@@ -152,6 +159,12 @@ API_CLASS(Abstract, NoSpawn) class FLAXENGINE_API MeshBase : public ScriptingObj
     /// <returns>True if failed, otherwise false</returns>
     virtual bool DownloadDataCPU(MeshBufferType type, BytesContainer& result, int32& count) const = 0;
 
+protected:
+#if !COMPILE_WITHOUT_CSHARP
+    // Downloads the buffer from the GPU directly into the new managed array memory (single copy from the staging buffer). Returns true if the managed elements don't match the buffer layout and data needs conversion, otherwise false (result is null if download failed).
+    bool DownloadBufferGPU(MeshBufferType type, int32 elementSize, MTypeObject* resultType, MArray*& result) const;
+#endif
+
 public:
     /// <summary>
     /// Model instance drawing packed data.
@@ -0,0 +1,202 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#include "MeshChunkData.h"
+#include "Engine/Core/Log.h"
+#include "Engine/Core/Collections/Array.h"
+#include "Engine/Core/Math/Math.h"
+#include "Engine/Serialization/MemoryReadStream.h"
+#include "Engine/Serialization/WriteStream.h"
+#include <ThirdParty/meshoptimizer/meshoptimizer.h>
+
+// Vertex positions quantized to 16-bit unorm relative to the mesh bounds (padded to 4-byte stride required by the vertex codec)
+PACK_STRUCT(struct VB0QuantizedElementType
+    {
+    uint16 Position[4];
+    });
+
+namespace
+{
+    bool WriteEncoded(WriteStream* stream, Array<byte>& buffer, size_t size)
+    {
+        if (size == 0)
+        {
+            LOG(Error, "Failed to encode mesh data.");
+            return true;
+        }
+        stream->WriteUint32((uint32)size);
+        stream->WriteBytes(buffer.Get(), (uint32)size);
+        return false;
+    }
+
+    bool WriteEncodedVertices(WriteStream* stream, Array<byte>& buffer, const void* data, uint32 vertices, uint32 stride)
+    {
+        buffer.Resize((int32)meshopt_encodeVertexBufferBound(vertices, stride), false);
+        const size_t size = meshopt_encodeVertexBuffer(buffer.Get(), buffer.Count(), data, vertices, stride);
+        return WriteEncoded(stream, buffer, size);
+    }
+}
+
+bool MeshChunkData::Read(MemoryReadStream& stream)
+{
+    // #MODEL_DATA_FORMAT_USAGE
+    stream.ReadUint32(&Vertices);
+    stream.ReadUint32(&Triangles);
+    Compressed = (Vertices & MESH_DATA_COMPRESSED_FLAG) != 0;
+    Vertices &= ~MESH_DATA_COMPRESSED_FLAG;
+    Use16BitIndexBuffer = GetIndicesCount() <= MAX_uint16;
+    _decoded.Release();
+    if (Vertices == 0 || Triangles == 0)
+        return true;
+    if (!Compressed)
+    {
+        VB0 = stream.Move<VB0ElementType>(Vertices);
+        VB1 = stream.Move<VB1ElementType>(Vertices);
+        const bool hasColors = stream.ReadBool();
+        VB2 = hasColors ? stream.Move<VB2ElementType>(Vertices) : nullptr;
+        IB = stream.Move<byte>(GetIndicesCount() * GetIndexBufferStride());
+        return false;
+    }
+
+    // Compressed data is decoded later (link the encoded streams)
+    stream.ReadByte(&_flags);
+    if (_flags & QuantizedPositions)
+    {
+        stream.Read(_boundsMin);
+        stream.Read(_boundsSize);
+    }
+    for (int32 i = 0; i < ARRAY_COUNT(_encoded); i++)
+    {
+        if (i == 2 && (_flags & HasColors) == 0)
+        {
+            _encoded[i] = Span<byte>();
+            continue;
+        }
+        uint32 size;
+        stream.ReadUint32(&size);
+        if (stream.GetPosition() + size > stream.GetLength())
+            return true;
+        _encoded[i] = Span<byte>(stream.Move<byte>(size), size);
+    }
+    VB0 = nullptr;
+    VB1 = nullptr;
+    VB2 = nullptr;
+    IB = nullptr;
+    return false;
+}
+
+bool MeshChunkData::Decode()
+{
+    if (!Compressed || _decoded.IsValid())
+        return false;
+
+    // Allocate memory for all buffers
+    const uint32 vb0Size = Vertices * sizeof(VB0ElementType);
+    const uint32 vb1Size = Vertices * sizeof(VB1ElementType);
+    const uint32 vb2Size = _flags & HasColors ? Vertices * sizeof(VB2ElementType) : 0;
+    const uint32 ibSize = GetIndicesCount() * GetIndexBufferStride();
+    _decoded.Allocate(vb0Size + vb1Size + vb2Size + ibSize);
+    byte* data = _decoded.Get();
+    VB0 = (VB0ElementType*)data;
+    VB1 = (VB1ElementType*)(data + vb0Size);
+    VB2 = vb2Size ? (VB2ElementType*)(data + vb0Size + vb1Size) : nullptr;
+    IB = data + vb0Size + vb1Size + vb2Size;
+
+    // Decode streams
+    bool failed;
+    if (_flags & QuantizedPositions)
+    {
+        Array<VB0QuantizedElementType> quantized;
+        quantized.Resize(Vertices, false);
+        failed = meshopt_decodeVertexBuffer(quantized.Get(), Vertices, sizeof(VB0QuantizedElementType), _encoded[0].Get(), _encoded[0].Length()) != 0;
+        if (!failed)
+        {
+            const Float3 scale = _boundsSize / (float)MAX_uint16;
+            for (uint32 i = 0; i < Vertices; i++)
+            {
+                const uint16* q = quantized[i].Position;
+                VB0[i].Position = _boundsMin + Float3(q[0], q[1], q[2]) * scale;
+            }
+        }
+    }
+    else
+    {
+        failed = meshopt_decodeVertexBuffer(VB0, Vertices, sizeof(VB0ElementType), _encoded[0].Get(), _encoded[0].Length()) != 0;
+    }
+    failed |= meshopt_decodeVertexBuffer(VB1, Vertices, sizeof(VB1ElementType), _encoded[1].Get(), _encoded[1].Length()) != 0;
+    if (VB2)
+        failed |= meshopt_decodeVertexBuffer(VB2, Vertices, sizeof(VB2ElementType), _encoded[2].Get(), _encoded[2].Length()) != 0;
+    failed |= meshopt_decodeIndexBuffer(IB, GetIndicesCount(), GetIndexBufferStride(), _encoded[3].Get(), _encoded[3].Length()) != 0;
+    if (failed)
+    {
+        LOG(Error, "Failed to decode mesh data. Vertices: {0}, triangles: {1}", Vertices, Triangles);
+        _decoded.Release();
+        return true;
+    }
+    return false;
+}
+
+bool MeshChunkData::WriteCompressed(WriteStream* stream, uint32 vertices, uint32 triangles, const Float3* positions, const VB1ElementType* vb1, const VB2ElementType* vb2, const uint32* indices, bool quantizePositions)
+{
+    if ((vertices & MESH_DATA_COMPRESSED_FLAG) != 0)
+    {
+        LOG(Error, "Too many vertices to compress mesh data.");
+        return true;
+    }
+
+    // #MODEL_DATA_FORMAT_USAGE
+    stream->WriteUint32(vertices | MESH_DATA_COMPRESSED_FLAG);
+    stream->WriteUint32(triangles);
+    byte flags = None;
+    if (quantizePositions)
+        flags |= QuantizedPositions;
+    if (vb2)
+        flags |= HasColors;
+    stream->WriteByte(flags);
+    Array<byte> buffer;
+
+    // Vertex Buffer 0
+    if (quantizePositions)
+    {
+        Float3 min = Float3::Maximum, max = Float3::Minimum;
+        for (uint32 i = 0; i < vertices; i++)
+        {
+            min = Float3::Min(min, positions[i]);
+            max = Float3::Max(max, positions[i]);
+        }
+        const Float3 size = max - min;
+        stream->Write(min);
+        stream->Write(size);
+        const Float3 scale(size.X > ZeroTolerance ? (float)MAX_uint16 / size.X : 0.0f, size.Y > ZeroTolerance ? (float)MAX_uint16 / size.Y : 0.0f, size.Z > ZeroTolerance ? (float)MAX_uint16 / size.Z : 0.0f);
+        Array<VB0QuantizedElementType> quantized;
+        quantized.Resize(vertices, false);
+        for (uint32 i = 0; i < vertices; i++)
+        {
+            const Float3 q = (positions[i] - min) * scale;
+            uint16* p = quantized[i].Position;
+            p[0] = (uint16)Math::Clamp<int32>(Math::RoundToInt(q.X), 0, MAX_uint16);
+            p[1] = (uint16)Math::Clamp<int32>(Math::RoundToInt(q.Y), 0, MAX_uint16);
+            p[2] = (uint16)Math::Clamp<int32>(Math::RoundToInt(q.Z), 0, MAX_uint16);
+            p[3] = 0;
+        }
+        if (WriteEncodedVertices(stream, buffer, quantized.Get(), vertices, sizeof(VB0QuantizedElementType)))
+            return true;
+    }
+    else if (WriteEncodedVertices(stream, buffer, positions, vertices, sizeof(VB0ElementType)))
+    {
+        return true;
+    }
+
+    // Vertex Buffer 1
+    if (WriteEncodedVertices(stream, buffer, vb1, vertices, sizeof(VB1ElementType)))
+        return true;
+
+    // Vertex Buffer 2
+    if (vb2 && WriteEncodedVertices(stream, buffer, vb2, vertices, sizeof(VB2ElementType)))
+        return true;
+
+    // Index Buffer
+    const uint32 indicesCount = triangles * 3;
+    buffer.Resize((int32)meshopt_encodeIndexBufferBound(indicesCount, vertices), false);
+    const size_t size = meshopt_encodeIndexBuffer(buffer.Get(), buffer.Count(), indices, indicesCount);
+    return WriteEncoded(stream, buffer, size);
+}
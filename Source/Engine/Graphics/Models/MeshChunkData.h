@@ -0,0 +1,115 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#include "Types.h"
+#include "Config.h"
+#include "Engine/Core/Types/DataContainer.h"
+
+class MemoryReadStream;
+class WriteStream;
+
+/// <summary>
+/// The mesh geometry data stored in the model LOD data chunk. Links the chunk memory for the raw data layout or decodes the compressed data layout (quantized positions, meshoptimizer vertex and index codecs) into the own buffer.
+/// </summary>
+struct FLAXENGINE_API MeshChunkData
+{
+private:
+    enum Flags : byte
+    {
+        None = 0,
+        QuantizedPositions = 1,
+        HasColors = 2,
+    };
+
+    byte _flags = None;
+    Float3 _boundsMin = Float3::Zero;
+    Float3 _boundsSize = Float3::Zero;
+    Span<byte> _encoded[4];
+    BytesContainer _decoded;
+
+public:
+    /// <summary>
+    /// The amount of vertices.
+    /// </summary>
+    uint32 Vertices = 0;
+
+    /// <summary>
+    /// The amount of triangles.
+    /// </summary>
+    uint32 Triangles = 0;
+
+    /// <summary>
+    /// True if index buffer uses 16-bit indices, otherwise 32-bit ones.
+    /// </summary>
+    bool Use16BitIndexBuffer = false;
+
+    /// <summary>
+    /// True if mesh data is stored in the compressed layout (needs to be decoded after reading).
+    /// </summary>
+    bool Compressed = false;
+
+    /// <summary>
+    /// The vertex buffer 0 data (valid after reading for the raw data or after decoding for the compressed data).
+    /// </summary>
+    VB0ElementType* VB0 = nullptr;
+
+    /// <summary>
+    /// The vertex buffer 1 data (valid after reading for the raw data or after decoding for the compressed data).
+    /// </summary>
+    VB1ElementType* VB1 = nullptr;
+
+    /// <summary>
+    /// The vertex buffer 2 data (optional, null if mesh has no vertex colors).
+    /// </summary>
+    VB2ElementType* VB2 = nullptr;
+
+    /// <summary>
+    /// The index buffer data (valid after reading for the raw data or after decoding for the compressed data).
+    /// </summary>
+    void* IB = nullptr;
+
+public:
+    /// <summary>
+    /// Gets the amount of indices.
+    /// </summary>
+    FORCE_INLINE uint32 GetIndicesCount() const
+    {
+        return Triangles * 3;
+    }
+
+    /// <summary>
+    /// Gets the size of the index buffer element (in bytes).
+    /// </summary>
+    FORCE_INLINE uint32 GetIndexBufferStride() const
+    {
+        return Use16BitIndexBuffer ? sizeof(uint16) : sizeof(uint32);
+    }
+
+    /// <summary>
+    /// Reads the mesh data from the model LOD data chunk (moves the stream to the next mesh). Compressed data links the stream memory and needs to be decoded before using the buffers.
+    /// </summary>
+    /// <param name="stream">The input stream.</param>
+    /// <returns>True if failed, otherwise false.</returns>
+    bool Read(MemoryReadStream& stream);
+
+    /// <summary>
+    /// Decodes the compressed mesh data (does nothing for the raw data). Safe to call from any thread as it uses only the own memory and the linked stream data.
+    /// </summary>
+    /// <returns>True if failed, otherwise false.</returns>
+    bool Decode();
+
+    /// <summary>
+    /// Writes the mesh data to the model LOD data chunk in the compressed layout.
+    /// </summary>
+    /// <param name="stream">The output stream.</param>
+    /// <param name="vertices">The amount of vertices.</param>
+    /// <param name="triangles">The amount of triangles.</param>
+    /// <param name="positions">The vertex positions.</param>
+    /// <param name="vb1">The vertex buffer 1 data.</param>
+    /// <param name="vb2">The vertex buffer 2 data (optional).</param>
+    /// <param name="indices">The triangle indices.</param>
+    /// <param name="quantizePositions">True if quantize vertex positions to 16-bit per component (relative to the mesh bounds), otherwise store them at full precision.</param>
+    /// <returns>True if failed, otherwise false.</returns>
+    static bool WriteCompressed(WriteStream* stream, uint32 vertices, uint32 triangles, const Float3* positions, const VB1ElementType* vb1, const VB2ElementType* vb2, const uint32* indices, bool quantizePositions);
+};
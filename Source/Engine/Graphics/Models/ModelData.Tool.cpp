@@ -13,6 +13,7 @@
 #include "Engine/Platform/Platform.h"
 #define USE_MIKKTSPACE 1
 #include "ThirdParty/MikkTSpace/mikktspace.h"
+#include "ThirdParty/meshoptimizer/meshoptimizer.h"
 #if USE_ASSIMP
 #define USE_SPARIAL_SORT 1
 #define ASSIMP_BUILD_NO_EXPORT
@@ -869,6 +870,94 @@ void MeshData::ImproveCacheLocality()
     LOG(Info, "Cache relevant optimize for {0} vertices and {1} indices. Average output ACMR is {2}. Time: {3}s", vertexCount, indexCount, (float)iCacheMisses / indexCount / 3, Utilities::RoundTo2DecimalPlaces(endTime - startTime));
 }
 
+void MeshData::GenerateClusters()
+{
+    Clusters.Clear();
+    const int32 indexCount = Indices.Count();
+    const int32 vertexCount = Positions.Count();
+    if (indexCount == 0 || vertexCount == 0)
+        return;
+
+    // Split triangles into meshlets (index buffer should be already optimized for vertex cache to get spatially coherent clusters)
+    Array<meshopt_Meshlet> meshlets;
+    meshlets.Resize((int32)meshopt_buildMeshletsBound(indexCount, MESH_CLUSTER_MAX_VERTICES, MESH_CLUSTER_MAX_TRIANGLES));
+    const int32 meshletsCount = (int32)meshopt_buildMeshlets(meshlets.Get(), Indices.Get(), indexCount, vertexCount, MESH_CLUSTER_MAX_VERTICES, MESH_CLUSTER_MAX_TRIANGLES);
+
+    // Write clusters triangles continuously into the index buffer and compute their bounds
+    Array<uint32> indices;
+    indices.Resize(indexCount);
+    Clusters.Resize(meshletsCount);
+    uint32 indexOffset = 0;
+    for (int32 i = 0; i < meshletsCount; i++)
+    {
+        const meshopt_Meshlet& meshlet = meshlets[i];
+        uint32* clusterIndices = indices.Get() + indexOffset;
+        for (int32 triangle = 0; triangle < meshlet.triangle_count; triangle++)
+        {
+            clusterIndices[triangle * 3 + 0] = meshlet.vertices[meshlet.indices[triangle][0]];
+            clusterIndices[triangle * 3 + 1] = meshlet.vertices[meshlet.indices[triangle][1]];
+            clusterIndices[triangle * 3 + 2] = meshlet.vertices[meshlet.indices[triangle][2]];
+        }
+        const uint32 clusterIndexCount = meshlet.triangle_count * 3;
+        const meshopt_Bounds bounds = meshopt_computeClusterBounds(clusterIndices, clusterIndexCount, (const float*)Positions.Get(), vertexCount, sizeof(Float3));
+
+        auto& cluster = Clusters[i];
+        cluster.Center = Float3(bounds.center[0], bounds.center[1], bounds.center[2]);
+        cluster.Radius = bounds.radius;
+        cluster.ConeAxis = Float3(bounds.cone_axis[0], bounds.cone_axis[1], bounds.cone_axis[2]);
+        cluster.ConeCutoff = bounds.cone_cutoff;
+        cluster.FirstIndex = indexOffset;
+        cluster.IndicesCount = clusterIndexCount;
+        indexOffset += clusterIndexCount;
+    }
+    ASSERT(indexOffset == (uint32)indexCount);
+    Indices.Swap(indices);
+}
+
+void MeshData::Simplify(float triangleReduction, float targetError)
+{
+    const int32 srcIndexCount = Indices.Count();
+    const int32 srcVertexCount = Positions.Count();
+    const int32 dstIndexCountTarget = int32(srcIndexCount * Math::Saturate(triangleReduction)) / 3 * 3;
+    if (srcIndexCount == 0 || dstIndexCountTarget >= srcIndexCount)
+        return;
+
+    // Simplify index buffer
+    Array<uint32> indices;
+    indices.Resize(srcIndexCount);
+    const int32 dstIndexCount = (int32)meshopt_simplify(indices.Get(), Indices.Get(), srcIndexCount, (const float*)Positions.Get(), srcVertexCount, sizeof(Float3), dstIndexCountTarget, targetError);
+    indices.Resize(dstIndexCount);
+
+    // Generate simplified vertex buffer remapping table (use only vertices from the simplified index buffer)
+    Array<uint32> remap;
+    remap.Resize(srcVertexCount);
+    const int32 dstVertexCount = (int32)meshopt_optimizeVertexFetchRemap(remap.Get(), indices.Get(), dstIndexCount, srcVertexCount);
+    Indices.Resize(dstIndexCount);
+    meshopt_remapIndexBuffer(Indices.Get(), indices.Get(), dstIndexCount, remap.Get());
+
+    // Remap vertex buffers
+#define REMAP_VERTEX_BUFFER(name, type) \
+    if (name.Count() == srcVertexCount) \
+    { \
+        Array<type> buffer; \
+        buffer.Resize(dstVertexCount); \
+        meshopt_remapVertexBuffer(buffer.Get(), name.Get(), srcVertexCount, sizeof(type), remap.Get()); \
+        name.Swap(buffer); \
+    }
+    REMAP_VERTEX_BUFFER(Positions, Float3);
+    REMAP_VERTEX_BUFFER(UVs, Float2);
+    REMAP_VERTEX_BUFFER(Normals, Float3);
+    REMAP_VERTEX_BUFFER(Tangents, Float3);
+    REMAP_VERTEX_BUFFER(BitangentSigns, float);
+    REMAP_VERTEX_BUFFER(LightmapUVs, Float2);
+    REMAP_VERTEX_BUFFER(Colors, Color);
+    REMAP_VERTEX_BUFFER(BlendIndices, Int4);
+    REMAP_VERTEX_BUFFER(BlendWeights, Float4);
+#undef REMAP_VERTEX_BUFFER
+    BlendShapes.Clear();
+    Clusters.Clear();
+}
+
 float MeshData::CalculateTrianglesArea() const
 {
     float sum = 0;
@@ -1,7 +1,9 @@
 // Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
 
 #include "ModelData.h"
+#include "MeshChunkData.h"
 #include "Engine/Core/Log.h"
+#include "Engine/Core/SIMD.h"
 #include "Engine/Animations/CurveSerialization.h"
 #include "Engine/Serialization/WriteStream.h"
 #include "Engine/Debug/Exceptions/ArgumentNullException.h"
@@ -23,6 +25,7 @@ void MeshData::Clear()
     BlendIndices.Clear();
     BlendWeights.Clear();
     BlendShapes.Clear();
+    Clusters.Clear();
 }
 
 void MeshData::EnsureCapacity(int32 vertices, int32 indices, bool preserveContents, bool withColors, bool withSkin)
@@ -51,6 +54,7 @@ void MeshData::SwapBuffers(MeshData& other)
     BlendIndices.Swap(other.BlendIndices);
     BlendWeights.Swap(other.BlendWeights);
     BlendShapes.Swap(other.BlendShapes);
+    Clusters.Swap(other.Clusters);
 }
 
 void MeshData::Release()
@@ -67,6 +71,7 @@ void MeshData::Release()
     BlendIndices.Resize(0);
     BlendWeights.Resize(0);
     BlendShapes.Resize(0);
+    Clusters.Resize(0);
 }
 
 void MeshData::InitFromModelVertices(ModelVertex19* vertices, uint32 verticesCount)
@@ -253,7 +258,7 @@ void MeshData::SetIndexBuffer(void* data, uint32 indicesCount)
     }
 }
 
-bool MeshData::Pack2Model(WriteStream* stream) const
+bool MeshData::Pack2Model(WriteStream* stream, bool compress, bool quantizePositions) const
 {
     // Validate input
     if (stream == nullptr)
@@ -311,6 +316,33 @@ bool MeshData::Pack2Model(WriteStream* stream) const
         return true;
     }
 
+    if (compress)
+    {
+        // Compressed layout encodes the whole streams at once
+        Array<VB1ElementType> vb1;
+        vb1.Resize(verticiecCount, false);
+        for (uint32 i = 0; i < verticiecCount; i++)
+        {
+            Float2 uv = hasUVs ? UVs[i] : Float2::Zero;
+            Float3 normal = hasNormals ? Normals[i] : Float3::UnitZ;
+            Float3 tangent = hasTangents ? Tangents[i] : Float3::UnitX;
+            Float2 lightmapUV = hasLightmapUVs ? LightmapUVs[i] : Float2::Zero;
+            Float3 bitangentSign = hasBitangentSigns ? BitangentSigns[i] : Float3::Dot(Float3::Cross(Float3::Normalize(Float3::Cross(normal, tangent)), normal), tangent);
+            vb1[i].TexCoord = Half2(uv);
+            vb1[i].Normal = Float1010102(normal * 0.5f + 0.5f, 0);
+            vb1[i].Tangent = Float1010102(tangent * 0.5f + 0.5f, static_cast<byte>(bitangentSign < 0 ? 1 : 0));
+            vb1[i].LightmapUVs = Half2(lightmapUV);
+        }
+        Array<VB2ElementType> vb2;
+        if (hasVertexColors)
+        {
+            vb2.Resize(verticiecCount, false);
+            for (uint32 i = 0; i < verticiecCount; i++)
+                vb2[i].Color = Color32(Colors[i]);
+        }
+        return MeshChunkData::WriteCompressed(stream, verticiecCount, trianglesCount, Positions.Get(), vb1.Get(), hasVertexColors ? vb2.Get() : nullptr, Indices.Get(), quantizePositions);
+    }
+
     // Vertices
     stream->WriteUint32(verticiecCount);
 
@@ -499,6 +531,78 @@ void MeshData::CalculateSphere(BoundingSphere& result) const
         BoundingSphere::FromPoints(Positions.Get(), Positions.Count(), result);
 }
 
+void MeshData::CalculateBounds(BoundingBox& box, BoundingSphere& sphere) const
+{
+    const int32 count = Positions.Count();
+    if (count == 0)
+        return;
+    const Float3* points = Positions.Get();
+
+    // Process 4 points at once (SoA layout in registers) to find min, max and sum of positions
+    SimdVector4 minX = SIMD::Splat(MAX_float), minY = minX, minZ = minX;
+    SimdVector4 maxX = SIMD::Splat(MIN_float), maxY = maxX, maxZ = maxX;
+    SimdVector4 sumX = SIMD::Splat(0.0f), sumY = sumX, sumZ = sumX;
+    const int32 count4 = count & ~3;
+    for (int32 i = 0; i < count4; i += 4)
+    {
+        const Float3* p = points + i;
+        const SimdVector4 x = SIMD::Load(p[0].X, p[1].X, p[2].X, p[3].X);
+        const SimdVector4 y = SIMD::Load(p[0].Y, p[1].Y, p[2].Y, p[3].Y);
+        const SimdVector4 z = SIMD::Load(p[0].Z, p[1].Z, p[2].Z, p[3].Z);
+        minX = SIMD::Min(minX, x);
+        minY = SIMD::Min(minY, y);
+        minZ = SIMD::Min(minZ, z);
+        maxX = SIMD::Max(maxX, x);
+        maxY = SIMD::Max(maxY, y);
+        maxZ = SIMD::Max(maxZ, z);
+        sumX = SIMD::Add(sumX, x);
+        sumY = SIMD::Add(sumY, y);
+        sumZ = SIMD::Add(sumZ, z);
+    }
+    ALIGN_BEGIN(16) float lanes[9][4] ALIGN_END(16);
+    SIMD::Store(lanes[0], minX);
+    SIMD::Store(lanes[1], minY);
+    SIMD::Store(lanes[2], minZ);
+    SIMD::Store(lanes[3], maxX);
+    SIMD::Store(lanes[4], maxY);
+    SIMD::Store(lanes[5], maxZ);
+    SIMD::Store(lanes[6], sumX);
+    SIMD::Store(lanes[7], sumY);
+    SIMD::Store(lanes[8], sumZ);
+    Float3 min(MAX_float), max(MIN_float), sum(0.0f);
+    for (int32 lane = 0; lane < 4; lane++)
+    {
+        min = Float3::Min(min, Float3(lanes[0][lane], lanes[1][lane], lanes[2][lane]));
+        max = Float3::Max(max, Float3(lanes[3][lane], lanes[4][lane], lanes[5][lane]));
+        sum += Float3(lanes[6][lane], lanes[7][lane], lanes[8][lane]);
+    }
+    for (int32 i = count4; i < count; i++)
+    {
+        min = Float3::Min(min, points[i]);
+        max = Float3::Max(max, points[i]);
+        sum += points[i];
+    }
+    box = BoundingBox(min, max);
+
+    // Find the radius of the sphere around the points center
+    const Float3 center = sum / (float)count;
+    const SimdVector4 centerX = SIMD::Splat(center.X), centerY = SIMD::Splat(center.Y), centerZ = SIMD::Splat(center.Z);
+    SimdVector4 radiusSq = SIMD::Splat(0.0f);
+    for (int32 i = 0; i < count4; i += 4)
+    {
+        const Float3* p = points + i;
+        const SimdVector4 x = SIMD::Sub(SIMD::Load(p[0].X, p[1].X, p[2].X, p[3].X), centerX);
+        const SimdVector4 y = SIMD::Sub(SIMD::Load(p[0].Y, p[1].Y, p[2].Y, p[3].Y), centerY);
+        const SimdVector4 z = SIMD::Sub(SIMD::Load(p[0].Z, p[1].Z, p[2].Z, p[3].Z), centerZ);
+        radiusSq = SIMD::Max(radiusSq, SIMD::Add(SIMD::Add(SIMD::Mul(x, x), SIMD::Mul(y, y)), SIMD::Mul(z, z)));
+    }
+    SIMD::Store(lanes[0], radiusSq);
+    float radius = Math::Max(Math::Max(lanes[0][0], lanes[0][1]), Math::Max(lanes[0][2], lanes[0][3]));
+    for (int32 i = count4; i < count; i++)
+        radius = Math::Max(radius, Float3::DistanceSquared(center, points[i]));
+    sphere = BoundingSphere(center, Math::Sqrt(radius));
+}
+
 void MeshData::TransformBuffer(const Matrix& matrix)
 {
     // Compute matrix inverse transpose
@@ -541,6 +645,9 @@ void MeshData::TransformBuffer(const Matrix& matrix)
             v.NormalDelta.Normalize();
         }
     }
+
+    // Clusters bounds are no longer valid
+    Clusters.Clear();
 }
 
 void MeshData::NormalizeBlendWeights()
@@ -556,6 +663,9 @@ void MeshData::NormalizeBlendWeights()
 
 void MeshData::Merge(MeshData& other)
 {
+    // Clusters need to be regenerated for the merged index buffer
+    Clusters.Clear();
+
     // Merge index buffer (and remap indices)
     const uint32 vertexIndexOffset = Positions.Count();
     const int32 indicesStart = Indices.Count();
@@ -737,18 +847,13 @@ bool ModelData::Pack2ModelHeader(WriteStream* stream) const
             // Material Slot
             stream->WriteInt32(mesh.MaterialSlotIndex);
 
-            // Box
+            // Box and Sphere
             BoundingBox box;
-            mesh.CalculateBox(box);
-            stream->WriteBoundingBox(box);
-
-            // Sphere
             BoundingSphere sphere;
-            mesh.CalculateSphere(sphere);
+            mesh.CalculateBounds(box, sphere);
+            stream->WriteBoundingBox(box);
             stream->WriteBoundingSphere(sphere);
 
-            // TODO: calculate Sphere and Box at once - make it faster using SSE
-
             // Has Lightmap UVs
             stream->WriteBool(mesh.LightmapUVs.HasItems());
         }
@@ -757,6 +862,47 @@ bool ModelData::Pack2ModelHeader(WriteStream* stream) const
     return false;
 }
 
+bool ModelData::Pack2ModelClusters(WriteStream* stream) const
+{
+    // Validate input
+    if (stream == nullptr)
+    {
+        Log::ArgumentNullException();
+        return true;
+    }
+    const int32 lodCount = GetLODsCount();
+    if (lodCount == 0 || lodCount > MODEL_MAX_LODS)
+    {
+        Log::ArgumentOutOfRangeException();
+        return true;
+    }
+
+    // Version
+    stream->WriteInt32(1);
+
+    // Amount of LODs
+    stream->WriteByte(lodCount);
+
+    // For each LOD
+    for (int32 lodIndex = 0; lodIndex < lodCount; lodIndex++)
+    {
+        auto& lod = LODs[lodIndex];
+
+        // Amount of meshes
+        stream->WriteUint16(lod.Meshes.Count());
+
+        // For each mesh
+        for (int32 meshIndex = 0; meshIndex < lod.Meshes.Count(); meshIndex++)
+        {
+            auto& clusters = lod.Meshes[meshIndex]->Clusters;
+            stream->WriteInt32(clusters.Count());
+            stream->WriteBytes(clusters.Get(), clusters.Count() * sizeof(MeshCluster));
+        }
+    }
+
+    return false;
+}
+
 bool ModelData::Pack2SkinnedModelHeader(WriteStream* stream) const
 {
     // Validate input
@@ -818,18 +964,13 @@ bool ModelData::Pack2SkinnedModelHeader(WriteStream* stream) const
             // Material Slot
             stream->WriteInt32(mesh.MaterialSlotIndex);
 
-            // Box
+            // Box and Sphere
             BoundingBox box;
-            mesh.CalculateBox(box);
-            stream->WriteBoundingBox(box);
-
-            // Sphere
             BoundingSphere sphere;
-            mesh.CalculateSphere(sphere);
+            mesh.CalculateBounds(box, sphere);
+            stream->WriteBoundingBox(box);
             stream->WriteBoundingSphere(sphere);
 
-            // TODO: calculate Sphere and Box at once - make it faster using SSE
-
             // Blend Shapes
             const int32 blendShapes = mesh.BlendShapes.Count();
             stream->WriteUint16(blendShapes);
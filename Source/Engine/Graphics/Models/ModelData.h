@@ -90,6 +90,11 @@ class FLAXENGINE_API MeshData
     /// </summary>
     Array<BlendShape> BlendShapes;
 
+    /// <summary>
+    /// Mesh clusters (meshlets) used for the fine-grained culling. Optional, valid only for the current index buffer (cleared when mesh geometry gets modified).
+    /// </summary>
+    Array<MeshCluster> Clusters;
+
 public:
     /// <summary>
     /// Determines whether this instance has any mesh data.
@@ -185,8 +190,10 @@ class FLAXENGINE_API MeshData
     /// Pack mesh data to the stream
     /// </summary>
     /// <param name="stream">Output stream</param>
+    /// <param name="compress">True if compress the vertex and index buffers (see MeshChunkData), otherwise store the raw data.</param>
+    /// <param name="quantizePositions">True if quantize the vertex positions to 16-bit (relative to the mesh bounds) when compressing the data.</param>
     /// <returns>True if cannot save data, otherwise false</returns>
-    bool Pack2Model(WriteStream* stream) const;
+    bool Pack2Model(WriteStream* stream, bool compress = false, bool quantizePositions = false) const;
 
     /// <summary>
     /// Pack skinned mesh data to the stream
@@ -207,6 +214,13 @@ class FLAXENGINE_API MeshData
     /// <param name="result">Output sphere</param>
     void CalculateSphere(BoundingSphere& result) const;
 
+    /// <summary>
+    /// Calculates bounding box and bounding sphere for the mesh at once (faster than separate CalculateBox and CalculateSphere).
+    /// </summary>
+    /// <param name="box">Output box.</param>
+    /// <param name="sphere">Output sphere.</param>
+    void CalculateBounds(BoundingBox& box, BoundingSphere& sphere) const;
+
 public:
 #if COMPILE_WITH_MODEL_TOOL
 
@@ -248,6 +262,18 @@ class FLAXENGINE_API MeshData
     /// </summary>
     void ImproveCacheLocality();
 
+    /// <summary>
+    /// Splits the mesh into clusters (meshlets) with bounding spheres and normal cones. Reorders the index buffer so each cluster triangles are stored continuously.
+    /// </summary>
+    void GenerateClusters();
+
+    /// <summary>
+    /// Simplifies the mesh geometry by reducing the triangles count (uses meshoptimizer). Unused vertices are removed from the vertex buffers. Clears the blend shapes and clusters.
+    /// </summary>
+    /// <param name="triangleReduction">The target amount of triangles to keep (normalized to 0-1 range).</param>
+    /// <param name="targetError">The maximum error of the simplification (relative to the mesh size).</param>
+    void Simplify(float triangleReduction, float targetError = 0.05f);
+
     /// <summary>
     /// Sums the area of all triangles in the mesh.
     /// </summary>
@@ -472,6 +498,13 @@ class FLAXENGINE_API ModelData
     /// <returns>True if cannot save data, otherwise false</returns>
     bool Pack2ModelHeader(WriteStream* stream) const;
 
+    /// <summary>
+    /// Pack meshes clusters data to the stream (optional model data chunk).
+    /// </summary>
+    /// <param name="stream">Output stream</param>
+    /// <returns>True if cannot save data, otherwise false</returns>
+    bool Pack2ModelClusters(WriteStream* stream) const;
+
     /// <summary>
     /// Pack skinned mesh data to the header stream
     /// </summary>
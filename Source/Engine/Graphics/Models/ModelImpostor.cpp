@@ -0,0 +1,38 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#include "ModelImpostor.h"
+#include "Engine/Content/Assets/Model.h"
+#include "Engine/Graphics/RenderTask.h"
+#include "Engine/Graphics/Textures/GPUTexture.h"
+#include "Engine/Renderer/RenderList.h"
+
+float ModelImpostor::Draw(const RenderContext& renderContext, const Model* model, const Transform& transform) const
+{
+    // Impostors are used only by the main view (shadows and offline passes use the model geometry)
+    if (EnumHasNoneFlags(renderContext.View.Pass, DrawPass::GBuffer) || renderContext.View.IsOfflinePass)
+        return 0.0f;
+    if (!Albedo->IsLoaded() || !Normal->IsLoaded() || Albedo->GetResidentMipLevels() == 0 || Normal->GetResidentMipLevels() == 0)
+        return 0.0f;
+
+    // Calculate fade-in based on the distance to the model bounds (the same bounds are used for baking)
+    BoundingSphere localSphere;
+    BoundingSphere::FromBox(model->GetBox(), localSphere);
+    const Float3 position = transform.LocalToWorld(localSphere.Center) - renderContext.View.Origin;
+    const float radius = (float)localSphere.Radius * transform.Scale.MaxValue();
+    const float distance = Float3::Distance(renderContext.View.Position, position) - radius;
+    if (distance <= Distance)
+        return 0.0f;
+    const float fade = FadeDistance > ZeroTolerance ? Math::Saturate((distance - Distance) / FadeDistance) : 1.0f;
+
+    RendererImpostorData data;
+    data.Albedo = Albedo->GetTexture();
+    data.Normal = Normal->GetTexture();
+    data.Position = position;
+    data.Radius = radius;
+    data.Orientation = transform.Orientation;
+    data.Fade = fade;
+    data.Frames = Math::Clamp(Frames, 2, 32);
+    renderContext.List->Impostors.Add(data);
+
+    return fade;
+}
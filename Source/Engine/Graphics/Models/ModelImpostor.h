@@ -0,0 +1,63 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#include "Engine/Core/ISerializable.h"
+#include "Engine/Core/Math/Transform.h"
+#include "Engine/Content/AssetReference.h"
+#include "Engine/Content/Assets/Texture.h"
+
+class Model;
+struct RenderContext;
+
+/// <summary>
+/// The model impostor settings. Impostor is a camera-facing quad that uses the atlas of the model images captured from multiple directions (octahedral layout) to replace the distant model geometry.
+/// </summary>
+API_STRUCT() struct FLAXENGINE_API ModelImpostor : ISerializable
+{
+    API_AUTO_SERIALIZATION();
+    DECLARE_SCRIPTING_TYPE_MINIMAL(ModelImpostor);
+
+    /// <summary>
+    /// The baked impostor albedo atlas (RGB: base color, A: opacity).
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(0)") AssetReference<Texture> Albedo;
+
+    /// <summary>
+    /// The baked impostor normals atlas (RGB: model-space normal vector, A: normalized depth within the model bounds).
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(10)") AssetReference<Texture> Normal;
+
+    /// <summary>
+    /// The amount of captured frames in each atlas row and column.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(20), Limit(2, 32)") int32 Frames = 8;
+
+    /// <summary>
+    /// The distance from the view (to the model bounds) at which the impostor starts to replace the model. Use 0 to disable impostor.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(30), Limit(0)") float Distance = 5000.0f;
+
+    /// <summary>
+    /// The length of the cross-fade between the model and the impostor (in world units, starting at Distance).
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(40), Limit(0)") float FadeDistance = 500.0f;
+
+public:
+    /// <summary>
+    /// Determines whether the impostor is enabled and has the atlases assigned.
+    /// </summary>
+    FORCE_INLINE bool IsEnabled() const
+    {
+        return Distance > 0.0f && Albedo && Normal;
+    }
+
+    /// <summary>
+    /// Draws the impostor if the model is far enough from the view.
+    /// </summary>
+    /// <param name="renderContext">The rendering context.</param>
+    /// <param name="model">The model used to bake the impostor.</param>
+    /// <param name="transform">The model world transformation.</param>
+    /// <returns>The impostor fade-in progress (normalized to 0-1 range). 0 if impostor is not used, 1 if it fully replaces the model geometry, otherwise the model should be dithered-out with the returned factor.</returns>
+    float Draw(const RenderContext& renderContext, const Model* model, const Transform& transform) const;
+};
@@ -1,42 +1,60 @@
 // Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
 
 #include "ModelLOD.h"
+#include "MeshChunkData.h"
 #include "Engine/Core/Log.h"
 #include "Engine/Core/Math/Transform.h"
 #include "Engine/Graphics/GPUDevice.h"
+#include "Engine/Profiler/ProfilerCPU.h"
 #include "Engine/Serialization/MemoryReadStream.h"
+#include "Engine/Threading/JobSystem.h"
 
 bool ModelLOD::Load(MemoryReadStream& stream)
 {
-    // Load LOD for each mesh
+    // Read LOD data for each mesh
+    Array<MeshChunkData> meshesData;
+    meshesData.Resize(Meshes.Count());
+    int32 compressedCount = 0;
     _verticesCount = 0;
     for (int32 i = 0; i < Meshes.Count(); i++)
     {
-        // #MODEL_DATA_FORMAT_USAGE
-        uint32 vertices;
-        stream.ReadUint32(&vertices);
-        _verticesCount += vertices;
-        uint32 triangles;
-        stream.ReadUint32(&triangles);
-        uint32 indicesCount = triangles * 3;
-        bool use16BitIndexBuffer = indicesCount <= MAX_uint16;
-        uint32 ibStride = use16BitIndexBuffer ? sizeof(uint16) : sizeof(uint32);
-        if (vertices == 0 || triangles == 0)
+        auto& data = meshesData[i];
+        if (data.Read(stream))
             return true;
-        auto vb0 = stream.Move<VB0ElementType>(vertices);
-        auto vb1 = stream.Move<VB1ElementType>(vertices);
-        bool hasColors = stream.ReadBool();
-        VB2ElementType18* vb2 = nullptr;
-        if (hasColors)
+        _verticesCount += data.Vertices;
+        compressedCount += data.Compressed ? 1 : 0;
+    }
+
+    // Decode compressed meshes (in parallel for multiple meshes)
+    if (compressedCount >= MESH_DATA_PARALLEL_DECODE_MIN_MESHES)
+    {
+        PROFILE_CPU_NAMED("Decode Meshes");
+        volatile int64 failed = 0;
+        Function<void(int32)> job = [&meshesData, &failed](int32 i)
+        {
+            if (meshesData[i].Decode())
+                Platform::InterlockedExchange(&failed, 1);
+        };
+        JobSystem::Execute(job, meshesData.Count());
+        if (failed)
+            return true;
+    }
+    else if (compressedCount != 0)
+    {
+        for (auto& data : meshesData)
         {
-            vb2 = stream.Move<VB2ElementType18>(vertices);
+            if (data.Decode())
+                return true;
         }
-        auto ib = stream.Move<byte>(indicesCount * ibStride);
+    }
 
-        // Setup GPU resources
-        if (Meshes[i].Load(vertices, triangles, vb0, vb1, vb2, ib, use16BitIndexBuffer))
+    // Setup GPU resources
+    for (int32 i = 0; i < Meshes.Count(); i++)
+    {
+        auto& data = meshesData[i];
+        if (Meshes[i].Load(data.Vertices, data.Triangles, data.VB0, data.VB1, data.VB2, data.IB, data.Use16BitIndexBuffer))
         {
-            LOG(Warning, "Cannot initialize mesh {0}. Vertices: {1}, triangles: {2}", i, vertices, triangles);
+            LOG(Warning, "Cannot initialize mesh {0}. Vertices: {1}, triangles: {2}", i, data.Vertices, data.Triangles);
             return true;
         }
     }
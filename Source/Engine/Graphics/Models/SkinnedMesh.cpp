@@ -276,33 +276,28 @@ void SkinnedMesh::Draw(const RenderContextBatch& renderContextBatch, const DrawI
         renderContextBatch.GetMainContext().List->AddDrawCall(renderContextBatch, drawModes, StaticFlags::None, shadowsMode, info.Bounds, drawCall, entry.ReceiveDecals, info.SortOrder);
 }
 
-bool SkinnedMesh::DownloadDataGPU(MeshBufferType type, BytesContainer& result) const
+GPUBuffer* SkinnedMesh::GetGPUBuffer(MeshBufferType type) const
 {
-    GPUBuffer* buffer = nullptr;
     switch (type)
     {
     case MeshBufferType::Index:
-        buffer = _indexBuffer;
-        break;
+        return _indexBuffer;
     case MeshBufferType::Vertex0:
-        buffer = _vertexBuffer;
-        break;
+        return _vertexBuffer;
+    default:
+        return nullptr;
     }
+}
+
+bool SkinnedMesh::DownloadDataGPU(MeshBufferType type, BytesContainer& result) const
+{
+    GPUBuffer* buffer = GetGPUBuffer(type);
     return buffer && buffer->DownloadData(result);
 }
 
 Task* SkinnedMesh::DownloadDataGPUAsync(MeshBufferType type, BytesContainer& result) const
 {
-    GPUBuffer* buffer = nullptr;
-    switch (type)
-    {
-    case MeshBufferType::Index:
-        buffer = _indexBuffer;
-        break;
-    case MeshBufferType::Vertex0:
-        buffer = _vertexBuffer;
-        break;
-    }
+    GPUBuffer* buffer = GetGPUBuffer(type);
     return buffer ? buffer->DownloadDataAsync(result) : nullptr;
 }
 
@@ -534,24 +529,36 @@ MArray* SkinnedMesh::DownloadBuffer(bool forceGpu, MTypeObject* resultType, int3
     }
 
     MeshBufferType bufferType;
+    int32 managedElementSize;
     switch (type)
     {
     case InternalBufferType::VB0:
         bufferType = MeshBufferType::Vertex0;
+        managedElementSize = sizeof(VB0SkinnedElementType);
         break;
     case InternalBufferType::IB16:
+        bufferType = MeshBufferType::Index;
+        managedElementSize = sizeof(uint16);
+        break;
     case InternalBufferType::IB32:
         bufferType = MeshBufferType::Index;
+        managedElementSize = sizeof(uint32);
         break;
     default:
         return nullptr;
     }
+    if (forceGpu)
+    {
+        // Download data from GPU directly into the managed array memory if no conversion is needed
+        MArray* result;
+        if (!DownloadBufferGPU(bufferType, managedElementSize, resultType, result))
+            return result;
+    }
     BytesContainer data;
     int32 dataCount;
     if (forceGpu)
     {
         // Get data from GPU
-        // TODO: support reusing the input memory buffer to perform a single copy from staging buffer to the input CPU buffer
         auto task = mesh->DownloadDataGPUAsync(bufferType, data);
         if (task == nullptr)
             return nullptr;
@@ -64,6 +64,26 @@ enum class MeshBufferType
     Vertex2 = 3,
 };
 
+/// <summary>
+/// The mesh cluster (meshlet) data used for the fine-grained culling of the mesh triangles. Cluster triangles are stored continuously in the mesh index buffer.
+/// </summary>
+/// <remarks>The layout is kept tightly packed so the same data can be uploaded to the GPU structured buffer for the GPU-driven culling.</remarks>
+struct MeshCluster
+{
+    // The bounding sphere center (in mesh local-space).
+    Float3 Center;
+    // The bounding sphere radius.
+    float Radius;
+    // The normal cone axis (in mesh local-space). Cluster is back-facing if dot(viewDirection, ConeAxis) >= ConeCutoff.
+    Float3 ConeAxis;
+    // The normal cone cutoff (cosine of the half of the cone angle).
+    float ConeCutoff;
+    // The first index of the cluster triangles in the mesh index buffer.
+    uint32 FirstIndex;
+    // The amount of indices of the cluster triangles.
+    uint32 IndicesCount;
+};
+
 // Vertex structure for all models (versioned)
 PACK_STRUCT(struct ModelVertex15
     {
@@ -449,6 +449,65 @@ int32 RenderTools::ComputeSkinnedModelLOD(const SkinnedModel* model, const Float
     return 0;
 }
 
+bool RenderTools::CullMeshClusters(const Span<MeshCluster>& clusters, const RenderView& view, const Matrix& world, CullMode cullMode, Array<Int2, InlinedAllocation<MESH_CLUSTER_CULLING_MAX_RANGES>>& ranges)
+{
+    ranges.Clear();
+    if (clusters.Length() < MESH_CLUSTER_CULLING_MIN_CLUSTERS)
+        return false;
+
+    // Normal cones are valid only for the uniform scale (and get flipped by the inverted culling, mirrored instances are handled by the materials via WorldDeterminantSign)
+    const Float3 scale = world.GetScaleVector().GetAbsolute();
+    const float maxScale = scale.MaxValue();
+    const bool useCones = cullMode != CullMode::TwoSided && maxScale - scale.MinValue() <= maxScale * 0.01f;
+    const float coneSign = cullMode == CullMode::Inverted ? -1.0f : 1.0f;
+    const bool isOrthographic = view.IsOrthographicProjection();
+    const Float3 viewDirection = view.Direction;
+    const Float3 viewPosition = view.Position;
+
+    uint32 visibleIndices = 0;
+    for (int32 i = 0; i < clusters.Length(); i++)
+    {
+        const MeshCluster& cluster = clusters[i];
+
+        // Frustum culling
+        Float3 center;
+        Float3::Transform(cluster.Center, world, center);
+        const float radius = cluster.Radius * maxScale;
+        if (!view.CullingFrustum.Intersects(BoundingSphere(center, radius)))
+            continue;
+
+        // Back-face culling
+        if (useCones)
+        {
+            Float3 coneAxis;
+            Float3::TransformNormal(cluster.ConeAxis, world, coneAxis);
+            coneAxis *= coneSign / maxScale;
+            if (isOrthographic)
+            {
+                if (Float3::Dot(viewDirection, coneAxis) >= cluster.ConeCutoff)
+                    continue;
+            }
+            else
+            {
+                const Float3 toCenter = center - viewPosition;
+                if (Float3::Dot(toCenter, coneAxis) >= cluster.ConeCutoff * toCenter.Length() + radius)
+                    continue;
+            }
+        }
+
+        // Add to the draw ranges (merge with the previous range if adjacent or if run out of ranges)
+        visibleIndices += cluster.IndicesCount;
+        if (ranges.HasItems() && (ranges.Last().X + ranges.Last().Y == (int32)cluster.FirstIndex || ranges.Count() == MESH_CLUSTER_CULLING_MAX_RANGES))
+            ranges.Last().Y = (int32)(cluster.FirstIndex + cluster.IndicesCount) - ranges.Last().X;
+        else
+            ranges.Add(Int2((int32)cluster.FirstIndex, (int32)cluster.IndicesCount));
+    }
+
+    // Draw the whole mesh if all clusters are visible
+    const MeshCluster& lastCluster = clusters[clusters.Length() - 1];
+    return visibleIndices != lastCluster.FirstIndex + lastCluster.IndicesCount;
+}
+
 void RenderTools::ComputeCascadeUpdateFrequency(int32 cascadeIndex, int32 cascadeCount, int32& updateFrequency, int32& updatePhrase, int32 updateMaxCountPerFrame)
 {
     switch (updateMaxCountPerFrame)
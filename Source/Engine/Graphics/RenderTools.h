@@ -4,6 +4,10 @@
 
 #include "PixelFormat.h"
 #include "RenderView.h"
+#include "Engine/Core/Collections/Array.h"
+#include "Engine/Core/Types/Span.h"
+#include "Engine/Graphics/Models/Config.h"
+#include "Engine/Graphics/Models/Types.h"
 #include "Engine/Scripting/ScriptingType.h"
 
 class Model;
@@ -109,6 +113,17 @@ API_CLASS(Static) class FLAXENGINE_API RenderTools
         return ((uint32)(-(int32)(distanceI >> 31)) | 0x80000000) ^ distanceI;
     }
 
+    /// <summary>
+    /// Culls the mesh clusters (meshlets) for the depth-only view (eg. shadow map projection) using the clusters bounding spheres and normal cones (back-facing clusters are culled only for single-sided materials).
+    /// </summary>
+    /// <param name="clusters">The mesh clusters.</param>
+    /// <param name="view">The rendering view.</param>
+    /// <param name="world">The mesh world transformation.</param>
+    /// <param name="cullMode">The material triangles culling mode.</param>
+    /// <param name="ranges">The output ranges of the index buffer to draw (start index and indices count). Adjacent visible clusters are merged into a single range.</param>
+    /// <returns>True if mesh is partially visible and only output ranges should be drawn (none if whole mesh got culled), otherwise false if whole mesh should be drawn.</returns>
+    static bool CullMeshClusters(const Span<MeshCluster>& clusters, const RenderView& view, const Matrix& world, CullMode cullMode, Array<Int2, InlinedAllocation<MESH_CLUSTER_CULLING_MAX_RANGES>>& ranges);
+
     // Calculates the update frequency and phrase for the given cached data (eg. cascaded shadow map or global sdf cascade contents). Lower data indices are updated first and more frequent.
     static void ComputeCascadeUpdateFrequency(int32 cascadeIndex, int32 cascadeCount, int32& updateFrequency, int32& updatePhrase, int32 updateMaxCountPerFrame = 1);
 
@@ -30,6 +30,21 @@
 #define VULKAN_HASH_POOLS_WITH_TYPES_USAGE_ID 1
 #define VULKAN_USE_DEBUG_LAYER GPU_ENABLE_DIAGNOSTICS
 
+// Enables creating graphics pipelines on the worker threads (draw calls that use the pipeline that is still being created are skipped to prevent stalls, only when GPUContext::AllowAsyncPipelines is set)
+#ifndef VULKAN_USE_ASYNC_PIPELINES
+#define VULKAN_USE_ASYNC_PIPELINES 1
+#endif
+
+// Enables reusing descriptor sets with the same layout and descriptors within the descriptor pools set lifetime (skips sets allocation and update)
+#ifndef VULKAN_USE_DESCRIPTOR_SET_CACHE
+#define VULKAN_USE_DESCRIPTOR_SET_CACHE 1
+#endif
+
+// Size of the shared staging buffer pages used to sub-allocate the small uploads (eg. texture mips streaming) instead of creating a staging buffer per upload
+#ifndef VULKAN_STAGING_UPLOAD_PAGE_SIZE
+#define VULKAN_STAGING_UPLOAD_PAGE_SIZE (4 * 1024 * 1024)
+#endif
+
 #ifndef VULKAN_USE_QUERIES
 #define VULKAN_USE_QUERIES 1
 #endif
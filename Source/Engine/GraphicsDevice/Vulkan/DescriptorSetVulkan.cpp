@@ -11,6 +11,7 @@
 #include "CmdBufferVulkan.h"
 #include "Engine/Threading/Threading.h"
 #include "Engine/Engine/Engine.h"
+#include "Engine/Profiler/RenderStats.h"
 
 void DescriptorSetLayoutInfoVulkan::CacheTypesUsageID()
 {
@@ -222,11 +223,68 @@ bool TypedDescriptorPoolSetVulkan::AllocateDescriptorSets(const DescriptorSetLay
         {
             pool = GetFreePool(true);
         }
+        RENDER_STAT_DESCRIPTOR_SET_ALLOCATION(layoutHandles.Count());
         return true;
     }
     return true;
 }
 
+#if VULKAN_USE_DESCRIPTOR_SET_CACHE
+
+bool TypedDescriptorPoolSetVulkan::FindCachedDescriptorSets(const DescriptorSetLayoutVulkan& layout, const DescriptorSetWriteContainerVulkan& writes, VkDescriptorSet* outSets)
+{
+    // Build the key from the layout and the descriptors data (arrays are zero-initialized so structures padding is deterministic)
+    const auto& layoutHandles = layout.GetHandles();
+    const int32 handlesSize = layoutHandles.Count() * sizeof(VkDescriptorSetLayout);
+    const int32 imagesSize = writes.DescriptorImageInfo.Count() * sizeof(VkDescriptorImageInfo);
+    const int32 buffersSize = writes.DescriptorBufferInfo.Count() * sizeof(VkDescriptorBufferInfo);
+    const int32 texelBuffersSize = writes.DescriptorTexelBufferView.Count() * sizeof(VkBufferView);
+    _key.Resize(handlesSize + imagesSize + buffersSize + texelBuffersSize, false);
+    byte* key = _key.Get();
+    Platform::MemoryCopy(key, layoutHandles.Get(), handlesSize);
+    key += handlesSize;
+    Platform::MemoryCopy(key, writes.DescriptorImageInfo.Get(), imagesSize);
+    key += imagesSize;
+    Platform::MemoryCopy(key, writes.DescriptorBufferInfo.Get(), buffersSize);
+    key += buffersSize;
+    Platform::MemoryCopy(key, writes.DescriptorTexelBufferView.Get(), texelBuffersSize);
+    _keyHash = Crc::MemCrc32(_key.Get(), _key.Count());
+
+    // Find the sets with the same key
+    int32 index;
+    if (_cache.TryGet(_keyHash, index))
+    {
+        do
+        {
+            const CachedSets& e = _cacheEntries[index];
+            if (e.KeySize == _key.Count() && Platform::MemoryCompare(_cacheKeys.Get() + e.KeyStart, _key.Get(), e.KeySize) == 0)
+            {
+                Platform::MemoryCopy(outSets, _cacheSets.Get() + e.SetsStart, layoutHandles.Count() * sizeof(VkDescriptorSet));
+                return true;
+            }
+            index = e.Next;
+        } while (index != -1);
+    }
+    return false;
+}
+
+void TypedDescriptorPoolSetVulkan::AddCachedDescriptorSets(const DescriptorSetLayoutVulkan& layout, const VkDescriptorSet* sets)
+{
+    CachedSets& e = _cacheEntries.AddOne();
+    e.KeyStart = _cacheKeys.Count();
+    e.KeySize = _key.Count();
+    e.SetsStart = _cacheSets.Count();
+    _cacheKeys.Add(_key);
+    _cacheSets.Add(sets, layout.GetHandles().Count());
+
+    // Link with the other sets with the same key hash
+    int32* first = _cache.TryGet(_keyHash);
+    e.Next = first ? *first : -1;
+    _cache[_keyHash] = _cacheEntries.Count() - 1;
+}
+
+#endif
+
 DescriptorPoolVulkan* TypedDescriptorPoolSetVulkan::GetFreePool(bool forceNewPool)
 {
     if (!forceNewPool)
@@ -263,6 +321,12 @@ void TypedDescriptorPoolSetVulkan::Reset()
         pool->Element->Reset();
     }
     _poolListCurrent = _poolListHead;
+#if VULKAN_USE_DESCRIPTOR_SET_CACHE
+    _cache.Clear();
+    _cacheEntries.Clear();
+    _cacheKeys.Clear();
+    _cacheSets.Clear();
+#endif
 }
 
 DescriptorPoolSetContainerVulkan::DescriptorPoolSetContainerVulkan(GPUDeviceVulkan* device)
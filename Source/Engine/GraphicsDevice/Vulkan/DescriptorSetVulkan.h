@@ -19,6 +19,7 @@
 class GPUDeviceVulkan;
 class CmdBufferVulkan;
 class GPUContextVulkan;
+struct DescriptorSetWriteContainerVulkan;
 
 namespace DescriptorSet
 {
@@ -276,6 +277,24 @@ class TypedDescriptorPoolSetVulkan
     PoolList* _poolListHead = nullptr;
     PoolList* _poolListCurrent = nullptr;
 
+#if VULKAN_USE_DESCRIPTOR_SET_CACHE
+    struct CachedSets
+    {
+        int32 KeyStart;
+        int32 KeySize;
+        int32 SetsStart;
+        int32 Next;
+    };
+
+    // Descriptor sets allocated from this pool set (valid until pools reset), searched by the layout and descriptors data hash
+    Dictionary<uint32, int32> _cache;
+    Array<CachedSets> _cacheEntries;
+    Array<byte> _cacheKeys;
+    Array<VkDescriptorSet> _cacheSets;
+    Array<byte> _key;
+    uint32 _keyHash = 0;
+#endif
+
 public:
 
     TypedDescriptorPoolSetVulkan(GPUDeviceVulkan* device, const DescriptorPoolSetContainerVulkan* owner, const DescriptorSetLayoutVulkan& layout)
@@ -290,6 +309,24 @@ class TypedDescriptorPoolSetVulkan
 
     bool AllocateDescriptorSets(const DescriptorSetLayoutVulkan& layout, VkDescriptorSet* outSets);
 
+#if VULKAN_USE_DESCRIPTOR_SET_CACHE
+    /// <summary>
+    /// Finds the descriptor sets allocated and written before (from this pool set) for the same layout and descriptors.
+    /// </summary>
+    /// <param name="layout">The descriptor sets layout.</param>
+    /// <param name="writes">The descriptors to write.</param>
+    /// <param name="outSets">The output descriptor sets (one per layout handle).</param>
+    /// <returns>True if found cached sets, otherwise false (use AddCachedDescriptorSets after writing the new sets).</returns>
+    bool FindCachedDescriptorSets(const DescriptorSetLayoutVulkan& layout, const DescriptorSetWriteContainerVulkan& writes, VkDescriptorSet* outSets);
+
+    /// <summary>
+    /// Adds the written descriptor sets to the cache. Uses the key from the last FindCachedDescriptorSets call.
+    /// </summary>
+    /// <param name="layout">The descriptor sets layout.</param>
+    /// <param name="sets">The descriptor sets (one per layout handle).</param>
+    void AddCachedDescriptorSets(const DescriptorSetLayoutVulkan& layout, const VkDescriptorSet* sets);
+#endif
+
     const DescriptorPoolSetContainerVulkan* GetOwner() const
     {
         return _owner;
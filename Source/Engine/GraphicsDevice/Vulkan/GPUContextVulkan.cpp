@@ -382,6 +382,7 @@ void GPUContextVulkan::BeginRenderPass()
     FramebufferVulkan::Key framebufferKey;
     framebufferKey.AttachmentCount = _rtCount;
     RenderTargetLayoutVulkan layout;
+    Platform::MemoryClear(&layout, sizeof(layout)); // Clear padding to compare and save layouts memory
     layout.RTsCount = _rtCount;
     layout.BlendEnable = _currentState && _currentState->BlendEnable;
     layout.DepthFormat = _rtDepth ? _rtDepth->GetFormat() : PixelFormat::Unknown;
@@ -589,6 +590,12 @@ void GPUContextVulkan::UpdateDescriptorSets(GPUPipelineStateVulkan* pipelineStat
         remainingHasDescriptorsPerStageMask >>= 1;
     }
 
+#if VULKAN_USE_DESCRIPTOR_SET_CACHE
+    // Reuse sets with the same descriptors if they were already written (eg. the same material used by the other draw call)
+    if (pipelineState->CurrentTypedDescriptorPoolSet->FindCachedDescriptorSets(*pipelineState->DescriptorSetsLayout, pipelineState->DSWriteContainer, pipelineState->DescriptorSetHandles.Get()))
+        return;
+#endif
+
     // Allocate sets if need to
     //if (needsWrite) // TODO: write on change only?
     {
@@ -611,6 +618,10 @@ void GPUContextVulkan::UpdateDescriptorSets(GPUPipelineStateVulkan* pipelineStat
         }
 
         vkUpdateDescriptorSets(_device->Device, pipelineState->DSWriteContainer.DescriptorWrites.Count(), pipelineState->DSWriteContainer.DescriptorWrites.Get(), 0, nullptr);
+        RENDER_STAT_DESCRIPTOR_SET_UPDATE(pipelineState->DescriptorSetHandles.Count());
+#if VULKAN_USE_DESCRIPTOR_SET_CACHE
+        pipelineState->CurrentTypedDescriptorPoolSet->AddCachedDescriptorSets(*pipelineState->DescriptorSetsLayout, pipelineState->DescriptorSetHandles.Get());
+#endif
     }
 }
 
@@ -629,6 +640,12 @@ void GPUContextVulkan::UpdateDescriptorSets(ComputePipelineStateVulkan* pipeline
     // Update descriptors
     UpdateDescriptorSets(*pipelineState->DescriptorInfo, pipelineState->DSWriter, needsWrite);
 
+#if VULKAN_USE_DESCRIPTOR_SET_CACHE
+    // Reuse sets with the same descriptors if they were already written
+    if (pipelineState->CurrentTypedDescriptorPoolSet->FindCachedDescriptorSets(*pipelineState->DescriptorSetsLayout, pipelineState->DSWriteContainer, pipelineState->DescriptorSetHandles.Get()))
+        return;
+#endif
+
     // Allocate sets if need to
     //if (needsWrite) // TODO: write on change only?f
     {
@@ -640,26 +657,35 @@ void GPUContextVulkan::UpdateDescriptorSets(ComputePipelineStateVulkan* pipeline
         pipelineState->DSWriter.SetDescriptorSet(descriptorSet);
 
         vkUpdateDescriptorSets(_device->Device, pipelineState->DSWriteContainer.DescriptorWrites.Count(), pipelineState->DSWriteContainer.DescriptorWrites.Get(), 0, nullptr);
+        RENDER_STAT_DESCRIPTOR_SET_UPDATE(pipelineState->DescriptorSetHandles.Count());
+#if VULKAN_USE_DESCRIPTOR_SET_CACHE
+        pipelineState->CurrentTypedDescriptorPoolSet->AddCachedDescriptorSets(*pipelineState->DescriptorSetsLayout, pipelineState->DescriptorSetHandles.Get());
+#endif
     }
 }
 
-void GPUContextVulkan::BindPipeline()
+bool GPUContextVulkan::BindPipeline()
 {
     if (_psDirtyFlag && _currentState && (_rtDepth || _rtCount))
     {
+        // Skip if pipeline is not ready yet (eg. being created on a worker thread)
+        const auto pipeline = _currentState->GetState(_renderPass, AllowAsyncPipelines);
+        if (pipeline == VK_NULL_HANDLE)
+            return true;
+
         // Clear flag
         _psDirtyFlag = false;
 
         // Change state
         const auto cmdBuffer = _cmdBufferManager->GetCmdBuffer();
-        const auto pipeline = _currentState->GetState(_renderPass);
         vkCmdBindPipeline(cmdBuffer->GetHandle(), VK_PIPELINE_BIND_POINT_GRAPHICS, pipeline);
 
         RENDER_STAT_PS_STATE_CHANGE();
     }
+    return false;
 }
 
-void GPUContextVulkan::OnDrawCall()
+bool GPUContextVulkan::OnDrawCall()
 {
     GPUPipelineStateVulkan* pipelineState = _currentState;
     ASSERT(pipelineState && pipelineState->IsValid());
@@ -698,7 +724,11 @@ void GPUContextVulkan::OnDrawCall()
         BeginRenderPass();
     }
 
-    BindPipeline();
+    if (BindPipeline())
+    {
+        _rtDirtyFlag = false;
+        return true;
+    }
 
     //UpdateDynamicStates();
 
@@ -714,6 +744,7 @@ void GPUContextVulkan::OnDrawCall()
 #if VK_ENABLE_BARRIERS_DEBUG
     LOG(Warning, "Draw");
 #endif
+    return false;
 }
 
 void GPUContextVulkan::FrameBegin()
@@ -721,6 +752,9 @@ void GPUContextVulkan::FrameBegin()
     // Base
     GPUContext::FrameBegin();
 
+    // Start creating the pipelines recorded in the previous runs
+    _device->PipelineWarmup.Update();
+
     // Setup
     _psDirtyFlag = 0;
     _rtDirtyFlag = 0;
@@ -1206,7 +1240,8 @@ void GPUContextVulkan::ResolveMultisample(GPUTexture* sourceMultisampleTexture,
 void GPUContextVulkan::DrawInstanced(uint32 verticesCount, uint32 instanceCount, int32 startInstance, int32 startVertex)
 {
     const auto cmdBuffer = _cmdBufferManager->GetCmdBuffer();
-    OnDrawCall();
+    if (OnDrawCall())
+        return;
     vkCmdDraw(cmdBuffer->GetHandle(), verticesCount, instanceCount, startVertex, startInstance);
     RENDER_STAT_DRAW_CALL(verticesCount * instanceCount, verticesCount * instanceCount / 3);
 }
@@ -1214,7 +1249,8 @@ void GPUContextVulkan::DrawInstanced(uint32 verticesCount, uint32 instanceCount,
 void GPUContextVulkan::DrawIndexedInstanced(uint32 indicesCount, uint32 instanceCount, int32 startInstance, int32 startVertex, int32 startIndex)
 {
     const auto cmdBuffer = _cmdBufferManager->GetCmdBuffer();
-    OnDrawCall();
+    if (OnDrawCall())
+        return;
     vkCmdDrawIndexed(cmdBuffer->GetHandle(), indicesCount, instanceCount, startIndex, startVertex, startInstance);
     RENDER_STAT_DRAW_CALL(0, indicesCount / 3 * instanceCount);
 }
@@ -1225,7 +1261,8 @@ void GPUContextVulkan::DrawInstancedIndirect(GPUBuffer* bufferForArgs, uint32 of
 
     auto bufferForArgsVK = (GPUBufferVulkan*)bufferForArgs;
     const auto cmdBuffer = _cmdBufferManager->GetCmdBuffer();
-    OnDrawCall();
+    if (OnDrawCall())
+        return;
     vkCmdDrawIndirect(cmdBuffer->GetHandle(), bufferForArgsVK->GetHandle(), (VkDeviceSize)offsetForArgs, 1, sizeof(VkDrawIndirectCommand));
     RENDER_STAT_DRAW_CALL(0, 0);
 }
@@ -1236,7 +1273,8 @@ void GPUContextVulkan::DrawIndexedInstancedIndirect(GPUBuffer* bufferForArgs, ui
 
     auto bufferForArgsVK = (GPUBufferVulkan*)bufferForArgs;
     const auto cmdBuffer = _cmdBufferManager->GetCmdBuffer();
-    OnDrawCall();
+    if (OnDrawCall())
+        return;
     vkCmdDrawIndexedIndirect(cmdBuffer->GetHandle(), bufferForArgsVK->GetHandle(), (VkDeviceSize)offsetForArgs, 1, sizeof(VkDrawIndexedIndirectCommand));
     RENDER_STAT_DRAW_CALL(0, 0);
 }
@@ -1331,16 +1369,24 @@ void GPUContextVulkan::UpdateBuffer(GPUBuffer* buffer, const void* data, uint32
     }
     else
     {
-        auto staging = _device->StagingManager.AcquireBuffer(size, GPUResourceUsage::StagingUpload);
-        staging->SetData(data, size);
+        // Use shared staging memory for smaller uploads
+        uint32 stagingOffset = 0;
+        auto staging = _device->StagingManager.AllocateUpload(cmdBuffer, data, size, stagingOffset);
+        const bool ownStaging = staging == nullptr;
+        if (ownStaging)
+        {
+            staging = _device->StagingManager.AcquireBuffer(size, GPUResourceUsage::StagingUpload);
+            staging->SetData(data, size);
+        }
 
         VkBufferCopy region;
         region.size = size;
-        region.srcOffset = 0;
+        region.srcOffset = stagingOffset;
         region.dstOffset = offset;
         vkCmdCopyBuffer(cmdBuffer->GetHandle(), ((GPUBufferVulkan*)staging)->GetHandle(), ((GPUBufferVulkan*)buffer)->GetHandle(), 1, &region);
 
-        _device->StagingManager.ReleaseBuffer(cmdBuffer, staging);
+        if (ownStaging)
+            _device->StagingManager.ReleaseBuffer(cmdBuffer, staging);
     }
 
     // Memory transfer barrier
@@ -1386,14 +1432,22 @@ void GPUContextVulkan::UpdateTexture(GPUTexture* texture, int32 arrayIndex, int3
     AddImageBarrier(textureVulkan, mipIndex, arrayIndex, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
     FlushBarriers();
 
-    auto buffer = _device->StagingManager.AcquireBuffer(slicePitch, GPUResourceUsage::StagingUpload);
-    buffer->SetData(data, slicePitch);
+    // Use shared staging memory for smaller uploads
+    uint32 stagingOffset = 0;
+    auto buffer = _device->StagingManager.AllocateUpload(cmdBuffer, data, slicePitch, stagingOffset);
+    const bool ownStaging = buffer == nullptr;
+    if (ownStaging)
+    {
+        buffer = _device->StagingManager.AcquireBuffer(slicePitch, GPUResourceUsage::StagingUpload);
+        buffer->SetData(data, slicePitch);
+    }
 
     // Setup buffer copy region
     int32 mipWidth, mipHeight, mipDepth;
     texture->GetMipSize(mipIndex, mipWidth, mipHeight, mipDepth);
     VkBufferImageCopy bufferCopyRegion;
     Platform::MemoryClear(&bufferCopyRegion, sizeof(bufferCopyRegion));
+    bufferCopyRegion.bufferOffset = stagingOffset;
     bufferCopyRegion.imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
     bufferCopyRegion.imageSubresource.mipLevel = mipIndex;
     bufferCopyRegion.imageSubresource.baseArrayLayer = arrayIndex;
@@ -1405,7 +1459,8 @@ void GPUContextVulkan::UpdateTexture(GPUTexture* texture, int32 arrayIndex, int3
     // Copy mip level from staging buffer
     vkCmdCopyBufferToImage(cmdBuffer->GetHandle(), ((GPUBufferVulkan*)buffer)->GetHandle(), textureVulkan->GetHandle(), VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &bufferCopyRegion);
 
-    _device->StagingManager.ReleaseBuffer(cmdBuffer, buffer);
+    if (ownStaging)
+        _device->StagingManager.ReleaseBuffer(cmdBuffer, buffer);
 }
 
 void GPUContextVulkan::CopyTexture(GPUTexture* dstResource, uint32 dstSubresource, uint32 dstX, uint32 dstY, uint32 dstZ, GPUTexture* srcResource, uint32 srcSubresource)
@@ -160,8 +160,8 @@ class GPUContextVulkan : public GPUContext
     void UpdateDescriptorSets(const struct SpirvShaderDescriptorInfo& descriptorInfo, class DescriptorSetWriterVulkan& dsWriter, bool& needsWrite);
     void UpdateDescriptorSets(GPUPipelineStateVulkan* pipelineState);
     void UpdateDescriptorSets(ComputePipelineStateVulkan* pipelineState);
-    void BindPipeline();
-    void OnDrawCall();
+    bool BindPipeline();
+    bool OnDrawCall();
 
 public:
 
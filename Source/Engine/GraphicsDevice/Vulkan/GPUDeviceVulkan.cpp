@@ -33,6 +33,8 @@
 #include "Engine/Engine/CommandLine.h"
 #include "Engine/Utilities/StringConverter.h"
 #include "Engine/Profiler/ProfilerCPU.h"
+#include "Engine/Serialization/MemoryReadStream.h"
+#include "Engine/Serialization/MemoryWriteStream.h"
 #include "Engine/Threading/Threading.h"
 #include "Engine/Scripting/Enums.h"
 
@@ -970,6 +972,38 @@ void StagingManagerVulkan::ReleaseBuffer(CmdBufferVulkan* cmdBuffer, GPUBuffer*&
     buffer = nullptr;
 }
 
+GPUBuffer* StagingManagerVulkan::AllocateUpload(CmdBufferVulkan* cmdBuffer, const void* data, uint32 size, uint32& offset)
+{
+    // Multiple of every texel block size (including 12-byte formats) and 4 (required by buffer copies)
+    const uint32 alignment = 48;
+    if (size > VULKAN_STAGING_UPLOAD_PAGE_SIZE / 4)
+        return nullptr;
+    ScopeLock lock(_locker);
+
+    // Use a new page if the current one is full or has been used by the other command buffer (page is released after GPU executes all commands that use it)
+    offset = (_uploadPageOffset + alignment - 1) / alignment * alignment;
+    if (_uploadPage && (offset + size > VULKAN_STAGING_UPLOAD_PAGE_SIZE || _uploadPageCmdBuffer != cmdBuffer))
+        ReleaseBuffer(_uploadPageCmdBuffer, _uploadPage);
+    if (!_uploadPage)
+    {
+        GPUBuffer* page = AcquireBuffer(VULKAN_STAGING_UPLOAD_PAGE_SIZE, GPUResourceUsage::StagingUpload);
+        if (!page)
+            return nullptr;
+        _uploadPage = page;
+        _uploadPageCmdBuffer = cmdBuffer;
+        offset = 0;
+    }
+    _uploadPageOffset = offset + size;
+
+    // Copy data
+    byte* mapped = (byte*)_uploadPage->Map(GPUResourceMapMode::Write);
+    if (!mapped)
+        return nullptr;
+    Platform::MemoryCopy(mapped + offset, data, size);
+    _uploadPage->Unmap();
+    return _uploadPage;
+}
+
 void StagingManagerVulkan::ProcessPendingFree()
 {
     ScopeLock lock(_locker);
@@ -1021,6 +1055,9 @@ void StagingManagerVulkan::Dispose()
 #endif
 
     // Release buffers and clear memory
+    _uploadPage = nullptr;
+    _uploadPageCmdBuffer = nullptr;
+    _uploadPageOffset = 0;
     for (auto buffer : _allBuffers)
     {
         buffer->ReleaseGPU();
@@ -1039,6 +1076,7 @@ GPUDeviceVulkan::GPUDeviceVulkan(ShaderProfile shaderProfile, GPUAdapterVulkan*
     , DeferredDeletionQueue(this)
     , StagingManager(this)
     , HelperResources(this)
+    , PipelineWarmup(this)
 {
 }
 
@@ -1437,6 +1475,128 @@ bool GPUDeviceVulkan::SavePipelineCache()
     return File::WriteAllBytes(path, data);
 }
 
+// Version of the pipelines warmup cache file format (increment on RenderTargetLayoutVulkan or the hashing changes)
+#define PIPELINE_WARMUP_VERSION 1
+
+void GetPipelineWarmupPath(String& path)
+{
+#if USE_EDITOR
+    path = Globals::ProjectCacheFolder / TEXT("VulkanPipelines.cache");
+#else
+    path = Globals::ProductLocalFolder / TEXT("VulkanPipelines.cache");
+#endif
+}
+
+PipelineWarmupVulkan::PipelineWarmupVulkan(GPUDeviceVulkan* device)
+    : _device(device)
+{
+}
+
+void PipelineWarmupVulkan::Load()
+{
+    String path;
+    GetPipelineWarmupPath(path);
+    if (!FileSystem::FileExists(path))
+        return;
+    Array<byte> data;
+    if (File::ReadAllBytes(path, data))
+        return;
+    MemoryReadStream stream(data);
+    if (data.Count() < 3 * (int32)sizeof(int32))
+        return;
+    int32 version, layoutSize, count;
+    stream.ReadInt32(&version);
+    stream.ReadInt32(&layoutSize);
+    stream.ReadInt32(&count);
+    if (version != PIPELINE_WARMUP_VERSION || layoutSize != sizeof(RenderTargetLayoutVulkan))
+        return;
+    ScopeLock lock(_locker);
+    for (int32 i = 0; i < count; i++)
+    {
+        if (stream.GetLength() - stream.GetPosition() < 2 * sizeof(int32))
+            break;
+        uint32 hash;
+        int32 layoutsCount;
+        stream.ReadUint32(&hash);
+        stream.ReadInt32(&layoutsCount);
+        if (layoutsCount < 0 || stream.GetLength() - stream.GetPosition() < layoutsCount * sizeof(RenderTargetLayoutVulkan))
+            break;
+        auto& layouts = _pipelines[hash];
+        layouts.Resize(layoutsCount);
+        stream.ReadBytes(layouts.Get(), layoutsCount * sizeof(RenderTargetLayoutVulkan));
+    }
+    LOG(Info, "Loaded {0} Vulkan pipeline states to warmup", _pipelines.Count());
+}
+
+bool PipelineWarmupVulkan::Save()
+{
+    ScopeLock lock(_locker);
+    if (!_isDirty)
+        return false;
+    MemoryWriteStream stream(4096);
+    stream.WriteInt32(PIPELINE_WARMUP_VERSION);
+    stream.WriteInt32(sizeof(RenderTargetLayoutVulkan));
+    stream.WriteInt32(_pipelines.Count());
+    for (auto& e : _pipelines)
+    {
+        stream.WriteUint32(e.Key);
+        stream.WriteInt32(e.Value.Count());
+        stream.WriteBytes(e.Value.Get(), e.Value.Count() * sizeof(RenderTargetLayoutVulkan));
+    }
+    _isDirty = false;
+    String path;
+    GetPipelineWarmupPath(path);
+    return File::WriteAllBytes(path, stream.GetHandle(), stream.GetPosition());
+}
+
+void PipelineWarmupVulkan::OnCreated(GPUPipelineStateVulkan* state)
+{
+    ScopeLock lock(_locker);
+    if (_pipelines.ContainsKey(state->GetStateHash()))
+        _queue.Add(state);
+}
+
+void PipelineWarmupVulkan::OnReleased(GPUPipelineStateVulkan* state)
+{
+    ScopeLock lock(_locker);
+    _queue.Remove(state);
+}
+
+void PipelineWarmupVulkan::OnUsed(uint32 stateHash, const RenderTargetLayoutVulkan& layout)
+{
+    ScopeLock lock(_locker);
+    auto& layouts = _pipelines[stateHash];
+    if (!layouts.Contains(layout))
+    {
+        layouts.Add(layout);
+        _isDirty = true;
+    }
+}
+
+void PipelineWarmupVulkan::Update()
+{
+    ScopeLock lock(_locker);
+    if (_queue.IsEmpty())
+        return;
+    PROFILE_CPU();
+    Array<RenderTargetLayoutVulkan> layouts;
+    for (GPUPipelineStateVulkan* state : _queue)
+    {
+        if (!state->IsValid() || !_pipelines.TryGet(state->GetStateHash(), layouts))
+            continue;
+        for (RenderTargetLayoutVulkan& layout : layouts)
+            state->CreateStateAsync(_device->GetOrCreateRenderPass(layout));
+    }
+    _queue.Clear();
+}
+
+void PipelineWarmupVulkan::Dispose()
+{
+    ScopeLock lock(_locker);
+    _pipelines.Clear();
+    _queue.Clear();
+}
+
 #if VK_EXT_validation_cache
 
 void GetValidationCachePath(String& path)
@@ -1894,6 +2054,7 @@ bool GPUDeviceVulkan::Init()
         const VkResult result = vkCreatePipelineCache(Device, &pipelineCacheCreateInfo, nullptr, &PipelineCache);
         LOG_VULKAN_RESULT(result);
     }
+    PipelineWarmup.Load();
 #if VK_EXT_validation_cache
     if (OptionalDeviceExtensions.HasEXTValidationCache && vkCreateValidationCacheEXT && vkDestroyValidationCacheEXT)
     {
@@ -1990,6 +2151,9 @@ void GPUDeviceVulkan::Dispose()
     DeferredDeletionQueue.ReleaseResources(true);
     vmaDestroyAllocator(Allocator);
     Allocator = VK_NULL_HANDLE;
+    if (PipelineWarmup.Save())
+        LOG(Warning, "Failed to save Vulkan pipelines warmup cache");
+    PipelineWarmup.Dispose();
     if (PipelineCache != VK_NULL_HANDLE)
     {
         if (SavePipelineCache())
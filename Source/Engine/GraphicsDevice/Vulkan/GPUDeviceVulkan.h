@@ -27,6 +27,7 @@ class FenceManagerVulkan;
 class GPUDeviceVulkan;
 class UniformBufferUploaderVulkan;
 class DescriptorPoolsManagerVulkan;
+class GPUPipelineStateVulkan;
 
 class SemaphoreVulkan
 {
@@ -431,6 +432,9 @@ class StagingManagerVulkan
     Array<GPUBuffer*> _allBuffers;
     Array<FreeEntry> _freeBuffers;
     Array<PendingEntry> _pendingBuffers;
+    GPUBuffer* _uploadPage = nullptr;
+    CmdBufferVulkan* _uploadPageCmdBuffer = nullptr;
+    uint32 _uploadPageOffset = 0;
 #if !BUILD_RELEASE
     uint64 _allBuffersTotalSize = 0;
     uint64 _allBuffersPeekSize = 0;
@@ -443,10 +447,51 @@ class StagingManagerVulkan
     StagingManagerVulkan(GPUDeviceVulkan* device);
     GPUBuffer* AcquireBuffer(uint32 size, GPUResourceUsage usage);
     void ReleaseBuffer(CmdBufferVulkan* cmdBuffer, GPUBuffer*& buffer);
+
+    // Allocates the staging memory for the small upload from the shared staging page and copies the data to it. Returns null if upload is too big (use AcquireBuffer instead).
+    GPUBuffer* AllocateUpload(CmdBufferVulkan* cmdBuffer, const void* data, uint32 size, uint32& offset);
     void ProcessPendingFree();
     void Dispose();
 };
 
+/// <summary>
+/// Vulkan graphics pipelines warmup. Records the used pipelines (pipeline state and render targets layout pairs) and creates them on the worker threads once the pipeline state gets created again (eg. during the next game run) to reduce hitches on the first pipeline use.
+/// </summary>
+class PipelineWarmupVulkan
+{
+private:
+
+    GPUDeviceVulkan* _device;
+    CriticalSection _locker;
+    Dictionary<uint32, Array<RenderTargetLayoutVulkan>> _pipelines;
+    Array<GPUPipelineStateVulkan*> _queue;
+    bool _isDirty = false;
+
+public:
+
+    PipelineWarmupVulkan(GPUDeviceVulkan* device);
+
+    // Loads the recorded pipelines from the cache file.
+    void Load();
+
+    // Saves the recorded pipelines to the cache file.
+    bool Save();
+
+    // Called when pipeline state gets created (from any thread) to enqueue its recorded pipelines for creation.
+    void OnCreated(GPUPipelineStateVulkan* state);
+
+    // Called when pipeline state gets released (from any thread).
+    void OnReleased(GPUPipelineStateVulkan* state);
+
+    // Called when pipeline gets used for the first time to record it.
+    void OnUsed(uint32 stateHash, const RenderTargetLayoutVulkan& layout);
+
+    // Starts creating the enqueued pipelines (called on frame start by the main context).
+    void Update();
+
+    void Dispose();
+};
+
 /// <summary>
 /// Implementation of Graphics Device for Vulkan backend.
 /// </summary>
@@ -559,6 +604,11 @@ class GPUDeviceVulkan : public GPUDevice
     /// </summary>
     HelperResourcesVulkan HelperResources;
 
+    /// <summary>
+    /// The graphics pipelines warmup.
+    /// </summary>
+    PipelineWarmupVulkan PipelineWarmup;
+
     /// <summary>
     /// The graphics queue.
     /// </summary>
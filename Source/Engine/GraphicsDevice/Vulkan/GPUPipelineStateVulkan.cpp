@@ -7,7 +7,9 @@
 #include "DescriptorSetVulkan.h"
 #include "GPUShaderProgramVulkan.h"
 #include "Engine/Core/Log.h"
+#include "Engine/Core/Collections/HashFunctions.h"
 #include "Engine/Profiler/ProfilerCPU.h"
+#include "Engine/Threading/ThreadPoolTask.h"
 
 GPUShaderProgramCSVulkan::~GPUShaderProgramCSVulkan()
 {
@@ -129,38 +131,30 @@ PipelineLayoutVulkan* GPUPipelineStateVulkan::GetLayout()
     return _layout;
 }
 
-VkPipeline GPUPipelineStateVulkan::GetState(RenderPassVulkan* renderPass)
+void GPUPipelineStateVulkan::SetupDesc(RenderPassVulkan* renderPass, VkGraphicsPipelineCreateInfo& desc, VkPipelineColorBlendStateCreateInfo& descColorBlend, VkPipelineMultisampleStateCreateInfo& descMultisample)
 {
-    ASSERT(renderPass);
-
-    // Try reuse cached version
-    VkPipeline pipeline = VK_NULL_HANDLE;
-    if (_pipelines.TryGet(renderPass, pipeline))
-    {
-#if BUILD_DEBUG
-        // Verify
-        RenderPassVulkan* refKey = nullptr;
-        _pipelines.KeyOf(pipeline, &refKey);
-        ASSERT(refKey == renderPass);
-#endif
-        return pipeline;
-    }
-
-    PROFILE_CPU_NAMED("Create Pipeline");
-
-    // Update description to match the pipeline
-    _descColorBlend.attachmentCount = renderPass->Layout.RTsCount;
-    _descMultisample.rasterizationSamples = (VkSampleCountFlagBits)renderPass->Layout.MSAA;
-    _desc.renderPass = renderPass->GetHandle();
-
     // Check if has missing layout
     if (_desc.layout == VK_NULL_HANDLE)
     {
         _desc.layout = GetLayout()->GetHandle();
     }
 
-    // Create object
-    const VkResult result = vkCreateGraphicsPipelines(_device->Device, _device->PipelineCache, 1, &_desc, nullptr, &pipeline);
+    // Update description to match the pipeline
+    desc = _desc;
+    descColorBlend = _descColorBlend;
+    descMultisample = _descMultisample;
+    descColorBlend.attachmentCount = renderPass->Layout.RTsCount;
+    descMultisample.rasterizationSamples = (VkSampleCountFlagBits)renderPass->Layout.MSAA;
+    desc.renderPass = renderPass->GetHandle();
+    desc.pColorBlendState = &descColorBlend;
+    desc.pMultisampleState = &descMultisample;
+}
+
+VkPipeline GPUPipelineStateVulkan::CreatePipeline(const VkGraphicsPipelineCreateInfo& desc) const
+{
+    PROFILE_CPU_NAMED("Create Pipeline");
+    VkPipeline pipeline = VK_NULL_HANDLE;
+    const VkResult result = vkCreateGraphicsPipelines(_device->Device, _device->PipelineCache, 1, &desc, nullptr, &pipeline);
     LOG_VULKAN_RESULT(result);
     if (result != VK_SUCCESS)
     {
@@ -171,15 +165,170 @@ VkPipeline GPUPipelineStateVulkan::GetState(RenderPassVulkan* renderPass)
 #endif
         return VK_NULL_HANDLE;
     }
+    return pipeline;
+}
+
+class CreatePipelineTaskVulkan : public ThreadPoolTask
+{
+private:
+    GPUPipelineStateVulkan* _state;
+    GPUPipelineStateVulkan::PendingPipeline* _pending;
+
+public:
+    CreatePipelineTaskVulkan(GPUPipelineStateVulkan* state, GPUPipelineStateVulkan::PendingPipeline* pending)
+        : _state(state)
+        , _pending(pending)
+    {
+    }
+
+    ~CreatePipelineTaskVulkan()
+    {
+        _pending->Release();
+    }
+
+protected:
+    // [ThreadPoolTask]
+    bool Run() override
+    {
+        // Skip if pipeline got created on the render thread or the state got released before the job started
+        if (Platform::InterlockedCompareExchange(&_pending->State, 1, 0) == 0)
+        {
+            _pending->Pipeline = _state->CreatePipeline(_pending->Desc);
+            Platform::AtomicStore(&_pending->State, 2);
+        }
+        return false;
+    }
+};
 
-    // Cache it
+void GPUPipelineStateVulkan::PendingPipeline::Release()
+{
+    if (Platform::InterlockedDecrement(&RefCount) == 0)
+        Delete(this);
+}
+
+VkPipeline GPUPipelineStateVulkan::GetState(RenderPassVulkan* renderPass, bool allowAsync)
+{
+    ASSERT(renderPass);
+#if !VULKAN_USE_ASYNC_PIPELINES
+    allowAsync = false;
+#endif
+
+    // Try reuse cached version
+    VkPipeline pipeline = VK_NULL_HANDLE;
+    if (_pipelines.TryGet(renderPass, pipeline))
+    {
+#if BUILD_DEBUG
+        // Verify
+        if (pipeline != VK_NULL_HANDLE)
+        {
+            RenderPassVulkan* refKey = nullptr;
+            _pipelines.KeyOf(pipeline, &refKey);
+            ASSERT(refKey == renderPass);
+        }
+#endif
+        return pipeline;
+    }
+
+    // Check if pipeline is being created on a worker thread
+    PendingPipeline* pending = nullptr;
+    for (PendingPipeline* e : _pendingPipelines)
+    {
+        if (e->RenderPass == renderPass)
+        {
+            pending = e;
+            break;
+        }
+    }
+    if (pending == nullptr)
+    {
+        if (allowAsync)
+        {
+            // Skip drawing with this pipeline until it's ready to prevent hitches
+            CreateStateAsync(renderPass);
+            return VK_NULL_HANDLE;
+        }
+
+        VkGraphicsPipelineCreateInfo desc;
+        VkPipelineColorBlendStateCreateInfo descColorBlend;
+        VkPipelineMultisampleStateCreateInfo descMultisample;
+        SetupDesc(renderPass, desc, descColorBlend, descMultisample);
+        pipeline = CreatePipeline(desc);
+        if (pipeline == VK_NULL_HANDLE)
+            return VK_NULL_HANDLE;
+        _pipelines.Add(renderPass, pipeline);
+        _device->PipelineWarmup.OnUsed(_stateHash, renderPass->Layout);
+        return pipeline;
+    }
+    if (Platform::AtomicRead(&pending->State) != 2)
+    {
+        if (allowAsync)
+            return VK_NULL_HANDLE;
+
+        // Create pipeline now if the job has not started yet, otherwise wait for it
+        if (Platform::InterlockedCompareExchange(&pending->State, 1, 0) == 0)
+        {
+            pending->Pipeline = CreatePipeline(pending->Desc);
+            Platform::AtomicStore(&pending->State, 2);
+        }
+        else
+        {
+            PROFILE_CPU_NAMED("Wait For Pipeline");
+            while (Platform::AtomicRead(&pending->State) != 2)
+                Platform::Sleep(0);
+        }
+    }
+
+    // Cache it (failed pipeline too, to not try creating it again every draw)
+    pipeline = pending->Pipeline;
+    _pendingPipelines.Remove(pending);
+    pending->Release();
     _pipelines.Add(renderPass, pipeline);
+    if (pipeline != VK_NULL_HANDLE)
+        _device->PipelineWarmup.OnUsed(_stateHash, renderPass->Layout);
 
     return pipeline;
 }
 
+void GPUPipelineStateVulkan::CreateStateAsync(RenderPassVulkan* renderPass)
+{
+    if (_pipelines.ContainsKey(renderPass))
+        return;
+    for (PendingPipeline* e : _pendingPipelines)
+    {
+        if (e->RenderPass == renderPass)
+            return;
+    }
+
+    // Copy the description so worker thread doesn't access the state that can be modified
+    auto pending = New<PendingPipeline>();
+    pending->RenderPass = renderPass;
+    SetupDesc(renderPass, pending->Desc, pending->DescColorBlend, pending->DescMultisample);
+    _pendingPipelines.Add(pending);
+    pending->Job = New<CreatePipelineTaskVulkan>(this, pending);
+    Task::StartNew(pending->Job);
+}
+
 void GPUPipelineStateVulkan::OnReleaseGPU()
 {
+    _device->PipelineWarmup.OnReleased(this);
+    for (PendingPipeline* pending : _pendingPipelines)
+    {
+        if (Platform::InterlockedCompareExchange(&pending->State, 3, 0) == 0)
+        {
+            // Cancel the job if not yet started (task gets deleted so the pending pipeline is freed even if the job never runs)
+            pending->Job->Cancel();
+        }
+        else
+        {
+            // Wait for the job to end
+            while (Platform::AtomicRead(&pending->State) != 2)
+                Platform::Sleep(1);
+            if (pending->Pipeline != VK_NULL_HANDLE)
+                _device->DeferredDeletionQueue.EnqueueResource(DeferredDeletionQueueVulkan::Type::Pipeline, pending->Pipeline);
+        }
+        pending->Release();
+    }
+    _pendingPipelines.Clear();
     DSWriteContainer.Release();
     CurrentTypedDescriptorPoolSet = nullptr;
     DescriptorSetsLayout = nullptr;
@@ -187,7 +336,8 @@ void GPUPipelineStateVulkan::OnReleaseGPU()
     DynamicOffsets.Resize(0);
     for (auto i = _pipelines.Begin(); i.IsNotEnd(); ++i)
     {
-        _device->DeferredDeletionQueue.EnqueueResource(DeferredDeletionQueueVulkan::Type::Pipeline, i->Value);
+        if (i->Value != VK_NULL_HANDLE)
+            _device->DeferredDeletionQueue.EnqueueResource(DeferredDeletionQueueVulkan::Type::Pipeline, i->Value);
     }
     _layout = nullptr;
     _pipelines.Clear();
@@ -383,10 +533,28 @@ bool GPUPipelineStateVulkan::Init(const Description& desc)
         DSWriter[stage].DynamicOffsets = dynamicOffsetsStart[stage] + DynamicOffsets.Get();
     }
 
+    // Hash the state to identify the same pipelines between the runs (for warmup)
+    _stateHash = 0;
+#define HASH_SHADER_STAGE(type) CombineHash(_stateHash, desc.type ? ((GPUShaderProgram##type##Vulkan*)desc.type)->CodeHash : 0)
+    HASH_SHADER_STAGE(VS);
+    HASH_SHADER_STAGE(HS);
+    HASH_SHADER_STAGE(DS);
+    HASH_SHADER_STAGE(GS);
+    HASH_SHADER_STAGE(PS);
+#undef HASH_SHADER_STAGE
+    CombineHash(_stateHash, (uint32)desc.DepthEnable | (uint32)desc.DepthWriteEnable << 1 | (uint32)desc.DepthClipEnable << 2 | (uint32)desc.Wireframe << 3);
+    CombineHash(_stateHash, (uint32)desc.DepthFunc | (uint32)desc.PrimitiveTopologyType << 8 | (uint32)desc.CullMode << 16);
+    CombineHash(_stateHash, (uint32)desc.BlendMode.AlphaToCoverageEnable | (uint32)desc.BlendMode.BlendEnable << 1 | (uint32)desc.BlendMode.RenderTargetWriteMask << 8);
+    CombineHash(_stateHash, (uint32)desc.BlendMode.SrcBlend | (uint32)desc.BlendMode.DestBlend << 8 | (uint32)desc.BlendMode.BlendOp << 16);
+    CombineHash(_stateHash, (uint32)desc.BlendMode.SrcBlendAlpha | (uint32)desc.BlendMode.DestBlendAlpha << 8 | (uint32)desc.BlendMode.BlendOpAlpha << 16);
+
     // Set non-zero memory usage
     _memoryUsage = sizeof(VkGraphicsPipelineCreateInfo);
 
-    return GPUPipelineState::Init(desc);
+    if (GPUPipelineState::Init(desc))
+        return true;
+    _device->PipelineWarmup.OnCreated(this);
+    return false;
 }
 
 #endif
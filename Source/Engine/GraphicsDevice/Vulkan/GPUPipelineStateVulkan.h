@@ -10,6 +10,7 @@
 #if GRAPHICS_API_VULKAN
 
 class PipelineLayoutVulkan;
+class Task;
 
 class ComputePipelineStateVulkan
 {
@@ -103,9 +104,29 @@ class ComputePipelineStateVulkan
 /// </summary>
 class GPUPipelineStateVulkan : public GPUResourceVulkan<GPUPipelineState>
 {
+    friend class CreatePipelineTaskVulkan;
+
 private:
 
+    // Pipeline that is being created on a worker thread (referenced by the state and the job, freed by the last one)
+    struct PendingPipeline
+    {
+        RenderPassVulkan* RenderPass;
+        VkGraphicsPipelineCreateInfo Desc;
+        VkPipelineColorBlendStateCreateInfo DescColorBlend;
+        VkPipelineMultisampleStateCreateInfo DescMultisample;
+        VkPipeline Pipeline = VK_NULL_HANDLE;
+        Task* Job = nullptr;
+        // 0 - queued, 1 - creating, 2 - done, 3 - canceled
+        volatile int32 State = 0;
+        volatile int64 RefCount = 2;
+
+        void Release();
+    };
+
     Dictionary<RenderPassVulkan*, VkPipeline> _pipelines;
+    Array<PendingPipeline*> _pendingPipelines;
+    uint32 _stateHash = 0;
     VkGraphicsPipelineCreateInfo _desc;
     VkPipelineShaderStageCreateInfo _shaderStages[ShaderStage_Count - 1];
     VkPipelineInputAssemblyStateCreateInfo _descInputAssembly;
@@ -211,8 +232,28 @@ class GPUPipelineStateVulkan : public GPUResourceVulkan<GPUPipelineState>
     /// Gets the Vulkan graphics pipeline object for the given rendering state. Uses depth buffer and render targets formats and multi-sample levels to setup a proper PSO. Uses caching.
     /// </summary>
     /// <param name="renderPass">The render pass.</param>
-    /// <returns>Vulkan graphics pipeline object.</returns>
-    VkPipeline GetState(RenderPassVulkan* renderPass);
+    /// <param name="allowAsync">True if can create the pipeline on a worker thread and return null until it's ready, otherwise pipeline is created (or waited for) on the calling thread.</param>
+    /// <returns>Vulkan graphics pipeline object or null if it's still being created on a worker thread (draw call should be skipped).</returns>
+    VkPipeline GetState(RenderPassVulkan* renderPass, bool allowAsync);
+
+    /// <summary>
+    /// Starts creating the Vulkan graphics pipeline object for the given render pass on a worker thread. Does nothing if it's already created or pending.
+    /// </summary>
+    /// <param name="renderPass">The render pass.</param>
+    void CreateStateAsync(RenderPassVulkan* renderPass);
+
+    /// <summary>
+    /// Gets the hash of the pipeline state description (stable between the runs).
+    /// </summary>
+    FORCE_INLINE uint32 GetStateHash() const
+    {
+        return _stateHash;
+    }
+
+private:
+
+    void SetupDesc(RenderPassVulkan* renderPass, VkGraphicsPipelineCreateInfo& desc, VkPipelineColorBlendStateCreateInfo& descColorBlend, VkPipelineMultisampleStateCreateInfo& descMultisample);
+    VkPipeline CreatePipeline(const VkGraphicsPipelineCreateInfo& desc) const;
 
 public:
 
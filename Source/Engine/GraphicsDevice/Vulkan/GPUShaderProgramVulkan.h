@@ -61,6 +61,11 @@ class GPUShaderProgramVulkan : public BaseType
     /// </summary>
     SpirvShaderDescriptorInfo DescriptorInfo;
 
+    /// <summary>
+    /// The hash of the shader bytecode (stable between the runs, used to identify the pipelines for warmup).
+    /// </summary>
+    uint32 CodeHash = 0;
+
 public:
 
     // [BaseType]
@@ -10,6 +10,7 @@
 #include "Types.h"
 #include "Engine/Core/Log.h"
 #include "Engine/Core/Types/DataContainer.h"
+#include "Engine/Utilities/Crc.h"
 #include "Engine/Serialization/MemoryReadStream.h"
 #include "Engine/Graphics/PixelFormatExtensions.h"
 
@@ -134,6 +135,7 @@ GPUShaderProgram* GPUShaderVulkan::CreateGPUShaderProgram(ShaderStage type, cons
     LOG(Info, "VK_OBJECT_TYPE_SHADER_MODULE=0x{0:x}, {1}", (uintptr)shaderModule, String(initializer.Name.GetText()));
 #endif
 
+    const uint32 codeHash = Crc::MemCrc32(spirv.Get(), spirv.Length());
     GPUShaderProgram* shader = nullptr;
     switch (type)
     {
@@ -141,6 +143,7 @@ GPUShaderProgram* GPUShaderVulkan::CreateGPUShaderProgram(ShaderStage type, cons
     {
         // Create object
         auto vsShader = New<GPUShaderProgramVSVulkan>(_device, initializer, header->DescriptorInfo, shaderModule);
+        vsShader->CodeHash = codeHash;
         shader = vsShader;
         VkPipelineVertexInputStateCreateInfo& inputState = vsShader->VertexInputState;
         VkVertexInputBindingDescription* vertexBindingDescriptions = vsShader->VertexBindingDescriptions;
@@ -208,22 +211,30 @@ GPUShaderProgram* GPUShaderVulkan::CreateGPUShaderProgram(ShaderStage type, cons
     {
         int32 controlPointsCount;
         stream.ReadInt32(&controlPointsCount);
-        shader = New<GPUShaderProgramHSVulkan>(_device, initializer, header->DescriptorInfo, shaderModule, controlPointsCount);
+        auto hsShader = New<GPUShaderProgramHSVulkan>(_device, initializer, header->DescriptorInfo, shaderModule, controlPointsCount);
+        hsShader->CodeHash = codeHash;
+        shader = hsShader;
         break;
     }
     case ShaderStage::Domain:
     {
-        shader = New<GPUShaderProgramDSVulkan>(_device, initializer, header->DescriptorInfo, shaderModule);
+        auto dsShader = New<GPUShaderProgramDSVulkan>(_device, initializer, header->DescriptorInfo, shaderModule);
+        dsShader->CodeHash = codeHash;
+        shader = dsShader;
         break;
     }
     case ShaderStage::Geometry:
     {
-        shader = New<GPUShaderProgramGSVulkan>(_device, initializer, header->DescriptorInfo, shaderModule);
+        auto gsShader = New<GPUShaderProgramGSVulkan>(_device, initializer, header->DescriptorInfo, shaderModule);
+        gsShader->CodeHash = codeHash;
+        shader = gsShader;
         break;
     }
     case ShaderStage::Pixel:
     {
-        shader = New<GPUShaderProgramPSVulkan>(_device, initializer, header->DescriptorInfo, shaderModule);
+        auto psShader = New<GPUShaderProgramPSVulkan>(_device, initializer, header->DescriptorInfo, shaderModule);
+        psShader->CodeHash = codeHash;
+        shader = psShader;
         break;
     }
     case ShaderStage::Compute:
@@ -84,6 +84,9 @@ Actor::Actor(const SpawnParams& params)
 {
     _drawNoCulling = 0;
     _drawCategory = 0;
+    _isTransformDirty = 0;
+    _isTransformQueued = 0;
+    _isTransformResolved = 0;
 }
 
 SceneRendering* Actor::GetSceneRendering() const
@@ -471,47 +474,68 @@ void Actor::SetLayerNameRecursive(const StringView& value)
 
 bool Actor::HasTag() const
 {
-    return Tags.Count() != 0;
+    return _tags.Count() != 0;
 }
 
 bool Actor::HasTag(const Tag& tag) const
 {
-    return Tags.Contains(tag);
+    return _tags.Contains(tag);
 }
 
 bool Actor::HasTag(const StringView& tag) const
 {
-    return Tags.Contains(tag);
+    return _tags.Contains(tag);
 }
 
 void Actor::AddTag(const Tag& tag)
 {
-    Tags.AddUnique(tag);
+    if (IsDuringPlay())
+        Level::removeActorFromIndex(this);
+    _tags.AddUnique(tag);
+    if (IsDuringPlay())
+        Level::addActorToIndex(this);
 }
 
 void Actor::AddTagRecursive(const Tag& tag)
 {
     for (const auto& child : Children)
         child->AddTagRecursive(tag);
-    Tags.AddUnique(tag);
+    AddTag(tag);
 }
 
 void Actor::RemoveTag(const Tag& tag)
 {
-    Tags.Remove(tag);
+    if (IsDuringPlay())
+        Level::removeActorFromIndex(this);
+    _tags.Remove(tag);
+    if (IsDuringPlay())
+        Level::addActorToIndex(this);
+}
+
+void Actor::SetTags(const Array<Tag>& value)
+{
+    if (IsDuringPlay())
+        Level::removeActorFromIndex(this);
+    _tags = value;
+    if (IsDuringPlay())
+        Level::addActorToIndex(this);
 }
 
 PRAGMA_DISABLE_DEPRECATION_WARNINGS
 
 const String& Actor::GetTag() const
 {
-    return Tags.Count() != 0 ? Tags[0].ToString() : String::Empty;
+    return _tags.Count() != 0 ? _tags[0].ToString() : String::Empty;
 }
 
 void Actor::SetTag(const StringView& value)
 {
     const Tag tag = Tags::Get(value);
-    Tags.Set(&tag, 1);
+    if (IsDuringPlay())
+        Level::removeActorFromIndex(this);
+    _tags.Set(&tag, 1);
+    if (IsDuringPlay())
+        Level::addActorToIndex(this);
 }
 
 PRAGMA_ENABLE_DEPRECATION_WARNINGS
@@ -540,7 +564,11 @@ void Actor::SetName(const StringView& value)
 {
     if (_name == value)
         return;
+    if (IsDuringPlay())
+        Level::removeActorFromIndex(this);
     _name = value;
+    if (IsDuringPlay())
+        Level::addActorToIndex(this);
     if (GetScene())
         Level::callActorEvent(Level::ActorEventType::OnActorNameChanged, this, nullptr);
 }
@@ -608,32 +636,35 @@ void Actor::SetStaticFlags(StaticFlags value)
 void Actor::SetTransform(const Transform& value)
 {
     CHECK(!value.IsNanOrInfinity());
+    ResolveParentTransform();
     if (!(Vector3::NearEqual(_transform.Translation, value.Translation) && Quaternion::NearEqual(_transform.Orientation, value.Orientation, ACTOR_ORIENTATION_EPSILON) && Float3::NearEqual(_transform.Scale, value.Scale)))
     {
         if (_parent)
             _parent->GetTransform().WorldToLocal(value, _localTransform);
         else
             _localTransform = value;
-        OnTransformChanged();
+        UpdateTransform();
     }
 }
 
 void Actor::SetPosition(const Vector3& value)
 {
     CHECK(!value.IsNanOrInfinity());
+    ResolveParentTransform();
     if (!Vector3::NearEqual(_transform.Translation, value))
     {
         if (_parent)
             _localTransform.Translation = _parent->GetTransform().WorldToLocal(value);
         else
             _localTransform.Translation = value;
-        OnTransformChanged();
+        UpdateTransform();
     }
 }
 
 void Actor::SetOrientation(const Quaternion& value)
 {
     CHECK(!value.IsNanOrInfinity());
+    ResolveParentTransform();
     if (!Quaternion::NearEqual(_transform.Orientation, value, ACTOR_ORIENTATION_EPSILON))
     {
         if (_parent)
@@ -647,20 +678,21 @@ void Actor::SetOrientation(const Quaternion& value)
         {
             _localTransform.Orientation = value;
         }
-        OnTransformChanged();
+        UpdateTransform();
     }
 }
 
 void Actor::SetScale(const Float3& value)
 {
     CHECK(!value.IsNanOrInfinity());
+    ResolveParentTransform();
     if (!Float3::NearEqual(_transform.Scale, value))
     {
         if (_parent)
             Float3::Divide(value, _parent->GetScale(), _localTransform.Scale);
         else
             _localTransform.Scale = value;
-        OnTransformChanged();
+        UpdateTransform();
     }
 }
 
@@ -706,7 +738,7 @@ void Actor::SetLocalTransform(const Transform& value)
     if (!(Vector3::NearEqual(_localTransform.Translation, value.Translation) && Quaternion::NearEqual(_localTransform.Orientation, value.Orientation, ACTOR_ORIENTATION_EPSILON) && Float3::NearEqual(_localTransform.Scale, value.Scale)))
     {
         _localTransform = value;
-        OnTransformChanged();
+        UpdateTransform();
     }
 }
 
@@ -716,7 +748,7 @@ void Actor::SetLocalPosition(const Vector3& value)
     if (!Vector3::NearEqual(_localTransform.Translation, value))
     {
         _localTransform.Translation = value;
-        OnTransformChanged();
+        UpdateTransform();
     }
 }
 
@@ -728,7 +760,7 @@ void Actor::SetLocalOrientation(const Quaternion& value)
     if (!Quaternion::NearEqual(_localTransform.Orientation, v, ACTOR_ORIENTATION_EPSILON))
     {
         _localTransform.Orientation = v;
-        OnTransformChanged();
+        UpdateTransform();
     }
 }
 
@@ -738,7 +770,7 @@ void Actor::SetLocalScale(const Float3& value)
     if (!Float3::NearEqual(_localTransform.Scale, value))
     {
         _localTransform.Scale = value;
-        OnTransformChanged();
+        UpdateTransform();
     }
 }
 
@@ -846,6 +878,7 @@ void Actor::BeginPlay(SceneBeginData* data)
 
     // Set flag
     Flags |= ObjectFlags::IsDuringPlay;
+    Level::addActorToIndex(this);
 
     OnBeginPlay();
 
@@ -887,6 +920,13 @@ void Actor::EndPlay()
 
     // Clear flag
     Flags &= ~ObjectFlags::IsDuringPlay;
+    Level::removeActorFromIndex(this);
+    if (_isTransformQueued)
+    {
+        _isTransformQueued = 0;
+        _isTransformDirty = 0;
+        Level::removeTransformUpdate(this);
+    }
 
     // Call event deeper
     for (int32 i = 0; i < Children.Count(); i++)
@@ -931,18 +971,18 @@ void Actor::Serialize(SerializeStream& stream, const void* otherObj)
     SERIALIZE_MEMBER(StaticFlags, _staticFlags);
     SERIALIZE(HideFlags);
     SERIALIZE_MEMBER(Layer, _layer);
-    if (!other || Tags != other->Tags)
+    if (!other || _tags != other->_tags)
     {
-        if (Tags.Count() == 1)
+        if (_tags.Count() == 1)
         {
             stream.JKEY("Tag");
-            stream.String(Tags.Get()->ToString());
+            stream.String(_tags.Get()->ToString());
         }
         else
         {
             stream.JKEY("Tags");
             stream.StartArray();
-            for (auto& tag : Tags)
+            for (auto& tag : _tags)
                 stream.String(tag.ToString());
             stream.EndArray();
         }
@@ -997,6 +1037,11 @@ void Actor::Deserialize(DeserializeStream& stream, ISerializeModifier* modifier)
     // Base
     SceneObject::Deserialize(stream, modifier);
 
+    // Name and tags are indexed for the level queries
+    const bool isIndexed = IsDuringPlay();
+    if (isIndexed)
+        Level::removeActorFromIndex(this);
+
     DESERIALIZE_BIT_MEMBER(IsActive, _isActive);
     DESERIALIZE_MEMBER(StaticFlags, _staticFlags);
     DESERIALIZE(HideFlags);
@@ -1046,8 +1091,8 @@ void Actor::Deserialize(DeserializeStream& stream, ISerializeModifier* modifier)
     {
         if (tag->value.IsString() && tag->value.GetStringLength())
         {
-            Tags.Clear();
-            Tags.Add(Tags::Get(tag->value.GetText()));
+            _tags.Clear();
+            _tags.Add(Tags::Get(tag->value.GetText()));
         }
     }
     else
@@ -1055,12 +1100,12 @@ void Actor::Deserialize(DeserializeStream& stream, ISerializeModifier* modifier)
         const auto tags = stream.FindMember("Tags");
         if (tags != stream.MemberEnd() && tags->value.IsArray())
         {
-            Tags.Clear();
+            _tags.Clear();
             for (rapidjson::SizeType i = 0; i < tags->value.Size(); i++)
             {
                 auto& e = tags->value[i];
                 if (e.IsString() && e.GetStringLength())
-                    Tags.Add(Tags::Get(e.GetText()));
+                    _tags.Add(Tags::Get(e.GetText()));
             }
         }
     }
@@ -1097,6 +1142,9 @@ void Actor::Deserialize(DeserializeStream& stream, ISerializeModifier* modifier)
             }
         }
     }
+
+    if (isIndexed)
+        Level::addActorToIndex(this);
 }
 
 void Actor::OnEnable()
@@ -1140,9 +1188,54 @@ void Actor::OnParentChanged()
 {
 }
 
+void Actor::ResolveParentTransform()
+{
+    // Ensure that parent world-space transformation is valid if any of the ancestors has the deferred update pending
+    if (!Level::HasTransformUpdates())
+        return;
+    Actor* dirty = nullptr;
+    for (Actor* a = _parent; a; a = a->_parent)
+    {
+        if (a->_isTransformDirty)
+            dirty = a;
+    }
+    if (dirty)
+        dirty->OnTransformChanged();
+}
+
+void Actor::UpdateTransform()
+{
+    if (Level::DeferTransformUpdates && IsDuringPlay() && IsInMainThread())
+    {
+        // Update only own transformation and defer the hierarchy update
+        if (_parent)
+            _parent->_transform.LocalToWorld(_localTransform, _transform);
+        else
+            _transform = _localTransform;
+        _isTransformDirty = 1;
+        if (!_isTransformQueued)
+        {
+            _isTransformQueued = 1;
+            Level::addTransformUpdate(this);
+        }
+    }
+    else
+    {
+        ResolveParentTransform();
+        OnTransformChanged();
+    }
+}
+
 void Actor::OnTransformChanged()
 {
     ASSERT_LOW_LAYER(!_localTransform.IsNanOrInfinity());
+    if (_isTransformResolved)
+    {
+        // Hierarchy transformation has been already resolved by the deferred update (see Level::FlushTransformUpdates)
+        // Keep the dirty flag as actor could be moved again by other notifications in the batch (and needs to be updated in the next flush iteration)
+        return;
+    }
+    _isTransformDirty = 0;
 
     if (_parent)
     {
@@ -39,6 +39,9 @@ API_CLASS(Abstract) class FLAXENGINE_API Actor : public SceneObject
     int16 _isEnabled : 1;
     int16 _drawNoCulling : 1;
     int16 _drawCategory : 4;
+    int16 _isTransformDirty : 1;
+    int16 _isTransformQueued : 1;
+    int16 _isTransformResolved : 1;
     byte _layer;
     StaticFlags _staticFlags;
     Transform _localTransform;
@@ -46,6 +49,7 @@ API_CLASS(Abstract) class FLAXENGINE_API Actor : public SceneObject
     BoundingSphere _sphere;
     BoundingBox _box;
     String _name;
+    Array<Tag> _tags;
     Scene* _scene;
     PhysicsScene* _physicsScene;
 
@@ -73,10 +77,6 @@ API_CLASS(Abstract) class FLAXENGINE_API Actor : public SceneObject
     API_FIELD(Attributes="HideInEditor, NoSerialize")
     HideFlags HideFlags;
 
-    /// <summary>
-    /// Actor tags collection.
-    /// </summary>
-    API_FIELD(Attributes="NoAnimate, EditorDisplay(\"General\"), EditorOrder(-68)") Array<Tag> Tags;
 
 public:
     /// <summary>
@@ -124,6 +124,20 @@ API_CLASS(Abstract) class FLAXENGINE_API Actor : public SceneObject
     /// </summary>
     API_FUNCTION() void SetLayerNameRecursive(const StringView& value);
 
+    /// <summary>
+    /// Gets the actor tags collection.
+    /// </summary>
+    API_PROPERTY(Attributes="NoAnimate, EditorDisplay(\"General\"), EditorOrder(-68)")
+    FORCE_INLINE const Array<Tag>& GetTags() const
+    {
+        return _tags;
+    }
+
+    /// <summary>
+    /// Sets the actor tags collection. Updates the level actors index used by tag queries.
+    /// </summary>
+    API_PROPERTY() void SetTags(const Array<Tag>& value);
+
     /// <summary>
     /// Determines whether this actor has any tag assigned.
     /// </summary>
@@ -1051,6 +1065,8 @@ API_CLASS(Abstract) class FLAXENGINE_API Actor : public SceneObject
     void SetSceneInHierarchy(Scene* scene);
     void OnEnableInHierarchy();
     void OnDisableInHierarchy();
+    void ResolveParentTransform();
+    void UpdateTransform();
 
     // Helper methods used by templates GetChildren/GetScripts to prevent including MClass/Script here
     static bool IsSubClassOf(const Actor* object, const MClass* klass);
@@ -70,7 +70,7 @@ void AnimatedModel::SetupSkinningData()
     const int32 targetBonesCount = SkinnedModel->Skeleton.Bones.Count();
     const int32 currentBonesCount = _skinningData.BonesCount;
 
-    if (targetBonesCount != currentBonesCount)
+    if (targetBonesCount != currentBonesCount && !Engine::IsServer())
     {
         _skinningData.Setup(targetBonesCount);
     }
@@ -103,15 +103,18 @@ void AnimatedModel::PreInitSkinningData()
     GraphInstance.Invalidate();
     GraphInstance.RootTransform = skeleton.Nodes[0].LocalTransform;
 
-    // Setup bones transformations including bone offset matrix
-    Array<Matrix> identityMatrices; // TODO: use shared memory?
-    identityMatrices.Resize(bonesCount, false);
-    for (int32 boneIndex = 0; boneIndex < bonesCount; boneIndex++)
+    // Setup bones transformations including bone offset matrix (skinning is not used on dedicated server)
+    if (_skinningData.BonesCount != 0)
     {
-        auto& bone = skeleton.Bones[boneIndex];
-        identityMatrices[boneIndex] = bone.OffsetMatrix * GraphInstance.NodesPose[bone.NodeIndex];
+        Array<Matrix> identityMatrices; // TODO: use shared memory?
+        identityMatrices.Resize(bonesCount, false);
+        for (int32 boneIndex = 0; boneIndex < bonesCount; boneIndex++)
+        {
+            auto& bone = skeleton.Bones[boneIndex];
+            identityMatrices[boneIndex] = bone.OffsetMatrix * GraphInstance.NodesPose[bone.NodeIndex];
+        }
+        _skinningData.SetData(identityMatrices.Get(), true);
     }
-    _skinningData.SetData(identityMatrices.Get(), true);
 
     UpdateBounds();
     UpdateSockets();
@@ -577,7 +580,8 @@ void AnimatedModel::OnAnimationUpdated_Async()
         GraphInstance.RootMotion = masterInstance.RootMotion;
     }
 
-    // Calculate the final bones transformations and update skinning
+    // Calculate the final bones transformations and update skinning (skinning is not used on dedicated server)
+    if (_skinningData.BonesCount != 0)
     {
         ANIM_GRAPH_PROFILE_EVENT("Final Pose");
         const int32 bonesCount = skeleton.Bones.Count();
@@ -595,7 +599,8 @@ void AnimatedModel::OnAnimationUpdated_Async()
     }
 
     UpdateBounds();
-    _blendShapes.Update(SkinnedModel.Get());
+    if (!Engine::IsServer())
+        _blendShapes.Update(SkinnedModel.Get());
 }
 
 void AnimatedModel::OnAnimationUpdated_Sync()
@@ -7,14 +7,17 @@
 #include "Engine/Graphics/GPUContext.h"
 #include "Engine/Graphics/GPUDevice.h"
 #include "Engine/Graphics/RenderTask.h"
+#include "Engine/Graphics/RenderTools.h"
 #include "Engine/Serialization/Serialization.h"
 #include "Engine/Level/Prefabs/PrefabManager.h"
 #include "Engine/Level/Scene/Scene.h"
 #include "Engine/Renderer/GlobalSignDistanceFieldPass.h"
+#include "Engine/Renderer/OcclusionBuffer.h"
 #include "Engine/Renderer/GI/GlobalSurfaceAtlasPass.h"
 #include "Engine/Utilities/Encryption.h"
 #if USE_EDITOR
 #include "Editor/Editor.h"
+#include "Engine/Renderer/ImpostorsRenderer.h"
 #endif
 
 StaticModel::StaticModel(const SpawnParams& params)
@@ -26,6 +29,7 @@ StaticModel::StaticModel(const SpawnParams& params)
     , _vertexColorsDirty(false)
     , _vertexColorsCount(0)
     , _sortOrder(0)
+    , _occluder(false)
 {
     _drawCategory = SceneRendering::SceneDrawAsync;
     Model.Changed.Bind<StaticModel, &StaticModel::OnModelChanged>(this);
@@ -92,6 +96,25 @@ void StaticModel::SetSortOrder(int32 value)
     _sortOrder = (int16)Math::Clamp<int32>(value, MIN_int16, MAX_int16);
 }
 
+bool StaticModel::GetOccluder() const
+{
+    return _occluder;
+}
+
+void StaticModel::SetOccluder(bool value)
+{
+    if (_occluder == value)
+        return;
+    _occluder = value;
+    if (_scene && IsDuringPlay() && IsActiveInHierarchy())
+    {
+        if (value)
+            GetSceneRendering()->AddOccluder(this);
+        else
+            GetSceneRendering()->RemoveOccluder(this);
+    }
+}
+
 bool StaticModel::HasLightmap() const
 {
     return Lightmap.TextureIndex != INVALID_INDEX;
@@ -219,6 +242,15 @@ void StaticModel::RemoveVertexColors()
     _vertexColorsDirty = false;
 }
 
+#if USE_EDITOR
+
+void StaticModel::BakeImpostor(int32 frames, int32 resolution)
+{
+    ImpostorsRenderer::Bake(this, frames, resolution);
+}
+
+#endif
+
 void StaticModel::OnModelChanged()
 {
     if (_residencyChangedModel)
@@ -361,6 +393,12 @@ void StaticModel::Draw(RenderContextBatch& renderContextBatch)
     if (!Model || !Model->IsLoaded())
         return;
     const RenderContext& renderContext = renderContextBatch.GetMainContext();
+
+    // Replace the distant model with the impostor (in the main view only)
+    const float impostorFade = Impostor.IsEnabled() ? Impostor.Draw(renderContext, Model, _transform) : 0.0f;
+    if (impostorFade >= 1.0f && renderContextBatch.Contexts.Count() == 1)
+        return;
+
     Matrix world;
     const Float3 translation = _transform.Translation - renderContext.View.Origin;
     Matrix::Transformation(_transform.Scale, _transform.Orientation, translation, world);
@@ -384,7 +422,27 @@ void StaticModel::Draw(RenderContextBatch& renderContextBatch)
     draw.SortOrder = _sortOrder;
     draw.VertexColors = _vertexColorsCount ? _vertexColorsBuffer : nullptr;
 
-    Model->Draw(renderContextBatch, draw);
+    if (impostorFade > 0.0f)
+    {
+        // Dither-out the model in the main view during the cross-fade with the impostor (shadow views still draw the whole model)
+        int32 lodIndex = _forcedLod != -1 ? _forcedLod : RenderTools::ComputeModelLOD(Model, draw.Bounds.Center, (float)draw.Bounds.Radius, renderContext);
+        if (lodIndex != -1)
+        {
+            const ModelLOD& lod = Model->LODs[Model->ClampLODIndex(lodIndex + _lodBias + renderContext.View.ModelLODBias)];
+            if (impostorFade < 1.0f)
+                lod.Draw(renderContext, draw, impostorFade);
+            for (int32 i = 1; i < renderContextBatch.Contexts.Count(); i++)
+            {
+                const RenderContext& shadowContext = renderContextBatch.Contexts[i];
+                if (shadowContext.View.CullingFrustum.Intersects(draw.Bounds))
+                    lod.Draw(shadowContext, draw, 0.0f);
+            }
+        }
+    }
+    else
+    {
+        Model->Draw(renderContextBatch, draw);
+    }
 
     GEOMETRY_DRAW_STATE_EVENT_END(_drawState, world);
 }
@@ -416,6 +474,8 @@ void StaticModel::Serialize(SerializeStream& stream, const void* otherObj)
     SERIALIZE_MEMBER(ForcedLOD, _forcedLod);
     SERIALIZE_MEMBER(SortOrder, _sortOrder);
     SERIALIZE(DrawModes);
+    SERIALIZE_MEMBER(Occluder, _occluder);
+    SERIALIZE(Impostor);
 
     if (HasLightmap()
 #if USE_EDITOR
@@ -468,6 +528,10 @@ void StaticModel::Deserialize(DeserializeStream& stream, ISerializeModifier* mod
     DESERIALIZE_MEMBER(ForcedLOD, _forcedLod);
     DESERIALIZE_MEMBER(SortOrder, _sortOrder);
     DESERIALIZE(DrawModes);
+    bool occluder = _occluder;
+    DESERIALIZE_MEMBER(Occluder, occluder);
+    SetOccluder(occluder);
+    DESERIALIZE(Impostor);
     DESERIALIZE_MEMBER(LightmapIndex, Lightmap.TextureIndex);
     DESERIALIZE_MEMBER(LightmapArea, Lightmap.UVsArea);
 
@@ -613,6 +677,22 @@ bool StaticModel::IntersectsEntry(const Ray& ray, Real& distance, Vector3& norma
     return result;
 }
 
+BoundingSphere StaticModel::GetOccluderBounds() const
+{
+    return _sphere;
+}
+
+void StaticModel::DrawOccluder(const RenderContext& renderContext, OcclusionBuffer& buffer)
+{
+    if (!Model || !Model->IsLoaded() || !Model->CanBeRendered())
+        return;
+
+    // Use the first LOD (lower LODs can be smaller than the object and cull visible objects behind it)
+    Matrix world;
+    renderContext.View.GetWorldMatrix(_transform, world);
+    buffer.AddModel(world, Model.Get(), 0);
+}
+
 void StaticModel::OnTransformChanged()
 {
     // Base
@@ -638,6 +718,9 @@ void StaticModel::OnEnable()
         }
     }
 
+    if (_scene && _occluder)
+        GetSceneRendering()->AddOccluder(this);
+
     // Skip ModelInstanceActor (add to SceneRendering manually)
     Actor::OnEnable();
 }
@@ -651,6 +734,8 @@ void StaticModel::OnDisable()
     {
         GetSceneRendering()->RemoveActor(this, _sceneRenderingKey);
     }
+    if (_scene && _occluder)
+        GetSceneRendering()->RemoveOccluder(this);
     if (_residencyChangedModel)
     {
         _residencyChangedModel->ResidencyChanged.Unbind<StaticModel, &StaticModel::OnModelResidencyChanged>(this);
@@ -3,14 +3,16 @@
 #pragma once
 
 #include "ModelInstanceActor.h"
+#include "Engine/Level/Scene/SceneRendering.h"
 #include "Engine/Content/Assets/Model.h"
+#include "Engine/Graphics/Models/ModelImpostor.h"
 #include "Engine/Renderer/DrawCall.h"
 #include "Engine/Renderer/Lightmaps.h"
 
 /// <summary>
 /// Renders model on the screen.
 /// </summary>
-API_CLASS(Attributes="ActorContextMenu(\"New/Model\")") class FLAXENGINE_API StaticModel : public ModelInstanceActor
+API_CLASS(Attributes="ActorContextMenu(\"New/Model\")") class FLAXENGINE_API StaticModel : public ModelInstanceActor, public IOccluder
 {
     DECLARE_SCENE_OBJECT(StaticModel);
 private:
@@ -22,6 +24,7 @@ API_CLASS(Attributes="ActorContextMenu(\"New/Model\")") class FLAXENGINE_API Sta
     bool _vertexColorsDirty;
     byte _vertexColorsCount;
     int16 _sortOrder;
+    bool _occluder;
     Array<Color32> _vertexColorsData[MODEL_MAX_LODS];
     GPUBuffer* _vertexColorsBuffer[MODEL_MAX_LODS];
     Model* _residencyChangedModel = nullptr;
@@ -44,6 +47,12 @@ API_CLASS(Attributes="ActorContextMenu(\"New/Model\")") class FLAXENGINE_API Sta
     API_FIELD(Attributes="EditorOrder(15), DefaultValue(DrawPass.Default), EditorDisplay(\"Model\")")
     DrawPass DrawModes = DrawPass::Default;
 
+    /// <summary>
+    /// The impostor used to replace the model when viewed from a distance.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(80), EditorDisplay(\"Impostor\", EditorDisplayAttribute.InlineStyle)")
+    ModelImpostor Impostor;
+
     /// <summary>
     /// The baked lightmap entry.
     /// </summary>
@@ -105,6 +114,17 @@ API_CLASS(Attributes="ActorContextMenu(\"New/Model\")") class FLAXENGINE_API Sta
     /// </summary>
     API_PROPERTY() void SetSortOrder(int32 value);
 
+    /// <summary>
+    /// Gets the value indicating whether this model is used as an occluder in the CPU occlusion culling (hides other objects behind it). Use it for large, solid objects such as walls or buildings (the first model LOD is used for rasterization).
+    /// </summary>
+    API_PROPERTY(Attributes="EditorOrder(70), DefaultValue(false), EditorDisplay(\"Model\")")
+    bool GetOccluder() const;
+
+    /// <summary>
+    /// Sets the value indicating whether this model is used as an occluder in the CPU occlusion culling (hides other objects behind it). Use it for large, solid objects such as walls or buildings (the first model LOD is used for rasterization).
+    /// </summary>
+    API_PROPERTY() void SetOccluder(bool value);
+
     /// <summary>
     /// Determines whether this model has valid lightmap data.
     /// </summary>
@@ -151,6 +171,15 @@ API_CLASS(Attributes="ActorContextMenu(\"New/Model\")") class FLAXENGINE_API Sta
     /// </summary>
     API_FUNCTION() void RemoveVertexColors();
 
+#if USE_EDITOR
+    /// <summary>
+    /// Bakes the impostor atlases for the model (captured from multiple directions). Atlases are saved next to the model asset and assigned to the impostor once ready.
+    /// </summary>
+    /// <param name="frames">The amount of captured frames in each atlas row and column.</param>
+    /// <param name="resolution">The resolution of the single frame (in pixels).</param>
+    API_FUNCTION() void BakeImpostor(int32 frames = 8, int32 resolution = 128);
+#endif
+
 private:
     void OnModelChanged();
     void OnModelLoaded();
@@ -171,6 +200,10 @@ API_CLASS(Attributes="ActorContextMenu(\"New/Model\")") class FLAXENGINE_API Sta
     bool IntersectsEntry(int32 entryIndex, const Ray& ray, Real& distance, Vector3& normal) override;
     bool IntersectsEntry(const Ray& ray, Real& distance, Vector3& normal, int32& entryIndex) override;
 
+    // [IOccluder]
+    BoundingSphere GetOccluderBounds() const override;
+    void DrawOccluder(const RenderContext& renderContext, OcclusionBuffer& buffer) override;
+
 protected:
     // [ModelInstanceActor]
     void OnTransformChanged() override;
@@ -0,0 +1,328 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#include "Level.h"
+#include "Actor.h"
+#include "Scene/Scene.h"
+#include "Engine/Core/Collections/Dictionary.h"
+#include "Engine/Core/Collections/HashSet.h"
+#include "Engine/Profiler/ProfilerCPU.h"
+#include "Engine/Scripting/ManagedCLR/MClass.h"
+#include "Engine/Threading/Threading.h"
+#include "Engine/Threading/FastLock.h"
+
+namespace
+{
+    typedef HashSet<Actor*> ActorsSet;
+
+    struct IndexedActor
+    {
+        uint32 NameHash;
+        Array<Tag> Tags;
+    };
+
+    struct ActorsIndexData
+    {
+        ReadWriteLock Locker;
+        Dictionary<uint32, ActorsSet> Names;
+        Dictionary<ScriptingTypeHandle, ActorsSet> Types;
+        Dictionary<Tag, ActorsSet> Tags;
+        // The keys used to register the actor (actor tags list can be modified directly so the index keeps own copy to unregister it properly)
+        Dictionary<Actor*, IndexedActor> Actors;
+    };
+
+    ActorsIndexData ActorsIndex;
+
+    template<typename KeyType>
+    void IndexAdd(Dictionary<KeyType, ActorsSet>& index, const KeyType& key, Actor* actor)
+    {
+        index[key].Add(actor);
+    }
+
+    template<typename KeyType>
+    void IndexRemove(Dictionary<KeyType, ActorsSet>& index, const KeyType& key, Actor* actor)
+    {
+        ActorsSet* actors = index.TryGet(key);
+        if (actors && actors->Remove(actor) && actors->IsEmpty())
+            index.Remove(key);
+    }
+
+    FORCE_INLINE uint32 GetNameHash(const StringView& name)
+    {
+        return GetHash(name);
+    }
+
+    FORCE_INLINE bool IsSubClassOf(const ScriptingTypeHandle& type, const MClass* klass)
+    {
+        const MClass* typeClass = type.GetType().ManagedClass;
+        return typeClass && typeClass->IsSubClassOf(klass);
+    }
+
+    // Indexed actors are all actors during play, filter the ones in the loaded scenes (the same set as the scenes hierarchy walk)
+    FORCE_INLINE bool IsInLoadedScene(const Actor* actor)
+    {
+        Scene* scene = actor->GetScene();
+        return scene && Level::Scenes.Contains(scene);
+    }
+
+    Actor* FindActorRecursive(Actor* node, const Tag& tag)
+    {
+        if (node->HasTag(tag))
+            return node;
+        Actor* result = nullptr;
+        for (Actor* child : node->Children)
+        {
+            result = FindActorRecursive(child, tag);
+            if (result)
+                break;
+        }
+        return result;
+    }
+
+    Actor* FindActorRecursiveByType(Actor* node, const MClass* type, const Tag& tag)
+    {
+        if (node->HasTag(tag) && node->GetClass()->IsSubClassOf(type))
+            return node;
+        Actor* result = nullptr;
+        for (Actor* child : node->Children)
+        {
+            result = FindActorRecursiveByType(child, type, tag);
+            if (result)
+                break;
+        }
+        return result;
+    }
+
+    void FindActorsRecursive(Actor* node, const Tag& tag, const bool activeOnly, Array<Actor*>& result)
+    {
+        if (activeOnly && !node->GetIsActive())
+            return;
+        if (node->HasTag(tag))
+            result.Add(node);
+        for (Actor* child : node->Children)
+            FindActorsRecursive(child, tag, activeOnly, result);
+    }
+
+    void FindActorsRecursiveByParentTags(Actor* node, const Array<Tag>& tags, const bool activeOnly, Array<Actor*>& result)
+    {
+        if (activeOnly && !node->GetIsActive())
+            return;
+        for (Tag tag : tags)
+        {
+            if (node->HasTag(tag))
+            {
+                result.Add(node);
+                break;
+            }
+        }
+        for (Actor* child : node->Children)
+            FindActorsRecursiveByParentTags(child, tags, activeOnly, result);
+    }
+
+    Actor* FindIndexedActor(const Tag& tag, const MClass* type)
+    {
+        const ActorsSet* actors = ActorsIndex.Tags.TryGet(tag);
+        if (actors)
+        {
+            for (const auto& e : *actors)
+            {
+                Actor* actor = e.Item;
+                if (actor->HasTag(tag) && (!type || actor->GetClass()->IsSubClassOf(type)) && IsInLoadedScene(actor))
+                    return actor;
+            }
+        }
+        return nullptr;
+    }
+
+    void FindIndexedActors(const Array<Tag>& tags, const bool activeOnly, Array<Actor*>& result)
+    {
+        for (int32 i = 0; i < tags.Count(); i++)
+        {
+            const Tag tag = tags[i];
+            const ActorsSet* actors = ActorsIndex.Tags.TryGet(tag);
+            if (!actors)
+                continue;
+            result.EnsureCapacity(result.Count() + actors->Count());
+            for (const auto& e : *actors)
+            {
+                Actor* actor = e.Item;
+                if (!actor->HasTag(tag) || (activeOnly && !actor->IsActiveInHierarchy()) || !IsInLoadedScene(actor))
+                    continue;
+
+                // Skip actors already added for the one of the previous tags
+                bool added = false;
+                for (int32 j = 0; j < i && !added; j++)
+                    added = actor->HasTag(tags[j]);
+                if (!added)
+                    result.Add(actor);
+            }
+        }
+    }
+}
+
+void Level::addActorToIndex(Actor* a)
+{
+    ScopeWriteLock lock(ActorsIndex.Locker);
+    if (ActorsIndex.Actors.ContainsKey(a))
+        return;
+    IndexedActor& entry = ActorsIndex.Actors[a];
+    entry.NameHash = GetNameHash(a->GetName());
+    entry.Tags = a->GetTags();
+    IndexAdd(ActorsIndex.Names, entry.NameHash, a);
+    IndexAdd(ActorsIndex.Types, a->GetTypeHandle(), a);
+    for (const Tag& tag : entry.Tags)
+        IndexAdd(ActorsIndex.Tags, tag, a);
+}
+
+void Level::removeActorFromIndex(Actor* a)
+{
+    ScopeWriteLock lock(ActorsIndex.Locker);
+    const IndexedActor* entry = ActorsIndex.Actors.TryGet(a);
+    if (!entry)
+        return;
+    IndexRemove(ActorsIndex.Names, entry->NameHash, a);
+    IndexRemove(ActorsIndex.Types, a->GetTypeHandle(), a);
+    for (const Tag& tag : entry->Tags)
+        IndexRemove(ActorsIndex.Tags, tag, a);
+    ActorsIndex.Actors.Remove(a);
+}
+
+Actor* Level::FindActor(const StringView& name)
+{
+    ScopeLock lock(ScenesLock);
+    ScopeReadLock indexLock(ActorsIndex.Locker);
+    const ActorsSet* actors = ActorsIndex.Names.TryGet(GetNameHash(name));
+    if (actors)
+    {
+        for (const auto& e : *actors)
+        {
+            Actor* actor = e.Item;
+            if (actor->GetName() == name && IsInLoadedScene(actor))
+                return actor;
+        }
+    }
+    return nullptr;
+}
+
+Actor* Level::FindActor(const MClass* type)
+{
+    CHECK_RETURN(type, nullptr);
+    ScopeLock lock(ScenesLock);
+    ScopeReadLock indexLock(ActorsIndex.Locker);
+    for (const auto& e : ActorsIndex.Types)
+    {
+        if (!IsSubClassOf(e.Key, type))
+            continue;
+        for (const auto& actor : e.Value)
+        {
+            if (IsInLoadedScene(actor.Item))
+                return actor.Item;
+        }
+    }
+    return nullptr;
+}
+
+Actor* Level::FindActor(const MClass* type, const StringView& name)
+{
+    CHECK_RETURN(type, nullptr);
+    ScopeLock lock(ScenesLock);
+    ScopeReadLock indexLock(ActorsIndex.Locker);
+    const ActorsSet* actors = ActorsIndex.Names.TryGet(GetNameHash(name));
+    if (actors)
+    {
+        for (const auto& e : *actors)
+        {
+            Actor* actor = e.Item;
+            if (actor->GetName() == name && actor->GetClass()->IsSubClassOf(type) && IsInLoadedScene(actor))
+                return actor;
+        }
+    }
+    return nullptr;
+}
+
+Actor* Level::FindActor(const Tag& tag, Actor* root)
+{
+    PROFILE_CPU();
+    if (root)
+        return FindActorRecursive(root, tag);
+    ScopeLock lock(ScenesLock);
+    ScopeReadLock indexLock(ActorsIndex.Locker);
+    return FindIndexedActor(tag, nullptr);
+}
+
+Actor* Level::FindActor(const MClass* type, const Tag& tag, Actor* root)
+{
+    CHECK_RETURN(type, nullptr);
+    if (root)
+        return FindActorRecursiveByType(root, type, tag);
+    ScopeLock lock(ScenesLock);
+    ScopeReadLock indexLock(ActorsIndex.Locker);
+    return FindIndexedActor(tag, type);
+}
+
+Array<Actor*> Level::FindActors(const Tag& tag, const bool activeOnly, Actor* root)
+{
+    PROFILE_CPU();
+    Array<Actor*> result;
+    if (root)
+    {
+        FindActorsRecursive(root, tag, activeOnly, result);
+    }
+    else
+    {
+        ScopeLock lock(ScenesLock);
+        ScopeReadLock indexLock(ActorsIndex.Locker);
+        const Array<Tag> tags(&tag, 1);
+        FindIndexedActors(tags, activeOnly, result);
+    }
+    return result;
+}
+
+Array<Actor*> Level::FindActorsByParentTag(const Tag& parentTag, const bool activeOnly, Actor* root)
+{
+    PROFILE_CPU();
+    Array<Actor*> result;
+    const Array<Tag> subTags = Tags::GetSubTags(parentTag);
+
+    if (subTags.Count() == 0)
+    {
+        return result;
+    }
+    if (subTags.Count() == 1)
+    {
+        result = FindActors(subTags[0], activeOnly, root);
+        return result;
+    }
+
+    if (root)
+    {
+        FindActorsRecursiveByParentTags(root, subTags, activeOnly, result);
+    }
+    else
+    {
+        ScopeLock lock(ScenesLock);
+        ScopeReadLock indexLock(ActorsIndex.Locker);
+        FindIndexedActors(subTags, activeOnly, result);
+    }
+
+    return result;
+}
+
+Array<Actor*> Level::GetActors(const MClass* type)
+{
+    Array<Actor*> result;
+    CHECK_RETURN(type, result);
+    ScopeLock lock(ScenesLock);
+    ScopeReadLock indexLock(ActorsIndex.Locker);
+    for (const auto& e : ActorsIndex.Types)
+    {
+        if (!IsSubClassOf(e.Key, type))
+            continue;
+        result.EnsureCapacity(result.Count() + e.Value.Count());
+        for (const auto& actor : e.Value)
+        {
+            if (IsInLoadedScene(actor.Item))
+                result.Add(actor.Item);
+        }
+    }
+    return result;
+}
@@ -0,0 +1,269 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#include "Level.h"
+#include "Actor.h"
+#include "Scene/Scene.h"
+#include "Engine/Core/Math/Transform.h"
+#include "Engine/Profiler/ProfilerCPU.h"
+#include "Engine/Threading/JobSystem.h"
+#include "Engine/Threading/Threading.h"
+
+// Minimum amount of actors at the single hierarchy depth to update their transformations in parallel
+#define TRANSFORM_UPDATE_JOB_MIN_ACTORS 1024
+
+// Amount of actors updated by a single job (multiple of 4)
+#define TRANSFORM_UPDATE_JOB_ACTORS 256
+
+// Maximum amount of flush iterations (transformation change notifications can move other actors)
+#define TRANSFORM_UPDATE_MAX_ITERATIONS 4
+
+bool Level::DeferTransformUpdates = false;
+
+namespace
+{
+    enum TransformComponent
+    {
+        QX,
+        QY,
+        QZ,
+        QW,
+        SX,
+        SY,
+        SZ,
+        TX,
+        TY,
+        TZ,
+        MAX,
+    };
+
+    struct TransformUpdatesData
+    {
+        // Actors queued for the deferred transformation update
+        Array<Actor*> Queue;
+
+        // Actors to update (in hierarchy depth order, each depth level is padded to the multiple of 4 with null entries)
+        Array<Actor*> Actors;
+        Array<int32> Parents;
+        Array<Int2> Levels;
+
+#if !USE_LARGE_WORLDS
+        // Local and world transformations in SoA layout
+        Array<float> Local[MAX];
+        Array<float> World[MAX];
+#endif
+
+        void Add(Actor* actor, int32 parent, const Transform& local)
+        {
+            Actors.Add(actor);
+            Parents.Add(parent);
+#if !USE_LARGE_WORLDS
+            Local[QX].Add(local.Orientation.X);
+            Local[QY].Add(local.Orientation.Y);
+            Local[QZ].Add(local.Orientation.Z);
+            Local[QW].Add(local.Orientation.W);
+            Local[SX].Add(local.Scale.X);
+            Local[SY].Add(local.Scale.Y);
+            Local[SZ].Add(local.Scale.Z);
+            Local[TX].Add(local.Translation.X);
+            Local[TY].Add(local.Translation.Y);
+            Local[TZ].Add(local.Translation.Z);
+#endif
+        }
+
+        void EndLevel(int32 start)
+        {
+            const int32 end = Actors.Count();
+            while (Actors.Count() % 4 != 0)
+                Add(nullptr, Parents[start], Transform::Identity);
+            Levels.Add(Int2(start, end));
+        }
+
+        void Clear()
+        {
+            Actors.Clear();
+            Parents.Clear();
+            Levels.Clear();
+#if !USE_LARGE_WORLDS
+            for (int32 i = 0; i < MAX; i++)
+                Local[i].Clear();
+#endif
+        }
+    };
+
+    TransformUpdatesData TransformUpdates;
+
+#if !USE_LARGE_WORLDS
+    // Composes 4 transformations (parent * local) at once, matches Transform::LocalToWorld
+    void LocalToWorld4(TransformUpdatesData& data, int32 start)
+    {
+        const int32* parents = data.Parents.Get() + start;
+        float parent[MAX][4];
+        const float* p[MAX];
+        const float* l[MAX];
+        float* w[MAX];
+        for (int32 i = 0; i < MAX; i++)
+        {
+            const float* world = data.World[i].Get();
+            for (int32 j = 0; j < 4; j++)
+                parent[i][j] = world[parents[j]];
+            p[i] = parent[i];
+            l[i] = data.Local[i].Get() + start;
+            w[i] = data.World[i].Get() + start;
+        }
+        Transform::LocalToWorld4(p, l, w);
+    }
+#endif
+}
+
+bool Level::HasTransformUpdates()
+{
+    return TransformUpdates.Queue.HasItems();
+}
+
+void Level::addTransformUpdate(Actor* a)
+{
+    ASSERT_LOW_LAYER(IsInMainThread());
+    TransformUpdates.Queue.Add(a);
+}
+
+void Level::removeTransformUpdate(Actor* a)
+{
+    TransformUpdates.Queue.RemoveAllKeepOrder(a);
+}
+
+void Level::FlushTransformUpdates()
+{
+    auto& data = TransformUpdates;
+    if (data.Queue.IsEmpty())
+        return;
+    PROFILE_CPU();
+    ASSERT(IsInMainThread());
+    for (int32 iteration = 0; iteration < TRANSFORM_UPDATE_MAX_ITERATIONS && data.Queue.HasItems(); iteration++)
+    {
+        // Pick the roots of the dirty hierarchies (skip actors that are under other dirty actors as they will be updated too)
+        data.Clear();
+        Array<Scene*, InlinedAllocation<8>> scenes;
+        for (Actor* a : data.Queue)
+        {
+            a->_isTransformQueued = 0;
+            if (!a->_isTransformDirty || a->_isTransformResolved)
+                continue;
+            bool isRoot = true;
+            for (Actor* p = a->_parent; p && isRoot; p = p->_parent)
+                isRoot = !p->_isTransformDirty;
+            if (!isRoot)
+                continue;
+            a->_isTransformResolved = 1;
+            data.Add(a, -1, a->_localTransform);
+            if (a->_scene)
+                scenes.AddUnique(a->_scene);
+        }
+        data.Queue.Clear();
+        if (data.Actors.IsEmpty())
+            break;
+        data.EndLevel(0);
+
+        // Collect the hierarchies in depth order
+        for (int32 levelIndex = 0; levelIndex < data.Levels.Count(); levelIndex++)
+        {
+            const Int2 level = data.Levels[levelIndex];
+            const int32 start = data.Actors.Count();
+            for (int32 i = level.X; i < level.Y; i++)
+            {
+                for (Actor* child : data.Actors[i]->Children)
+                {
+                    child->_isTransformResolved = 1;
+                    data.Add(child, i, child->_localTransform);
+                }
+            }
+            if (data.Actors.Count() != start)
+                data.EndLevel(start);
+        }
+        const int32 count = data.Actors.Count();
+
+        // Update roots from their parents
+#if !USE_LARGE_WORLDS
+        for (int32 i = 0; i < MAX; i++)
+            data.World[i].Resize(count, false);
+#endif
+        for (int32 i = 0; i < data.Levels[0].Y; i++)
+        {
+            Actor* a = data.Actors[i];
+            if (a->_parent)
+                a->_parent->_transform.LocalToWorld(a->_localTransform, a->_transform);
+            else
+                a->_transform = a->_localTransform;
+#if !USE_LARGE_WORLDS
+            const Transform& t = a->_transform;
+            data.World[QX][i] = t.Orientation.X;
+            data.World[QY][i] = t.Orientation.Y;
+            data.World[QZ][i] = t.Orientation.Z;
+            data.World[QW][i] = t.Orientation.W;
+            data.World[SX][i] = t.Scale.X;
+            data.World[SY][i] = t.Scale.Y;
+            data.World[SZ][i] = t.Scale.Z;
+            data.World[TX][i] = t.Translation.X;
+            data.World[TY][i] = t.Translation.Y;
+            data.World[TZ][i] = t.Translation.Z;
+#endif
+        }
+
+        // Update children level by level (each level depends only on the previous ones)
+        for (int32 levelIndex = 1; levelIndex < data.Levels.Count(); levelIndex++)
+        {
+            const int32 start = data.Levels[levelIndex].X;
+            const int32 end = data.Levels[levelIndex].Y;
+            Function<void(int32)> job = [&data, start, end](int32 jobIndex)
+            {
+                const int32 jobStart = start + jobIndex * TRANSFORM_UPDATE_JOB_ACTORS;
+                const int32 jobEnd = Math::Min(jobStart + TRANSFORM_UPDATE_JOB_ACTORS, end);
+#if USE_LARGE_WORLDS
+                for (int32 i = jobStart; i < jobEnd; i++)
+                {
+                    Actor* a = data.Actors[i];
+                    a->_parent->_transform.LocalToWorld(a->_localTransform, a->_transform);
+                }
+#else
+                for (int32 i = jobStart; i < jobEnd; i += 4)
+                    LocalToWorld4(data, i);
+                for (int32 i = jobStart; i < jobEnd; i++)
+                {
+                    Transform& t = data.Actors[i]->_transform;
+                    t.Orientation = Quaternion(data.World[QX][i], data.World[QY][i], data.World[QZ][i], data.World[QW][i]);
+                    t.Scale = Float3(data.World[SX][i], data.World[SY][i], data.World[SZ][i]);
+                    t.Translation = Vector3(data.World[TX][i], data.World[TY][i], data.World[TZ][i]);
+                }
+#endif
+            };
+            const int32 jobsCount = Math::DivideAndRoundUp(end - start, TRANSFORM_UPDATE_JOB_ACTORS);
+            if (end - start >= TRANSFORM_UPDATE_JOB_MIN_ACTORS)
+                JobSystem::Execute(job, jobsCount);
+            else
+            {
+                for (int32 i = 0; i < jobsCount; i++)
+                    job(i);
+            }
+        }
+
+        // Clear dirty state before notifications (actors moved again from the callbacks get queued for the next iteration)
+        for (int32 i = 0; i < count; i++)
+        {
+            if (data.Actors[i])
+                data.Actors[i]->_isTransformDirty = 0;
+        }
+
+        // Send notifications (children first, as in the immediate update) with scene rendering locked once for the whole batch
+        for (Scene* scene : scenes)
+            scene->Rendering.Locker.Lock();
+        for (int32 i = count - 1; i >= 0; i--)
+        {
+            Actor* a = data.Actors[i];
+            if (!a)
+                continue;
+            a->OnTransformChanged();
+            a->_isTransformResolved = 0;
+        }
+        for (Scene* scene : scenes)
+            scene->Rendering.Locker.Unlock();
+    }
+}
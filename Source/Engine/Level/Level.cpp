@@ -273,12 +273,14 @@ void LevelService::Update()
 {
     TICK_LEVEL(Update, "Level::Update")
     TICK_LEVEL_EDITOR(Update)
+    Level::FlushTransformUpdates();
 }
 
 void LevelService::LateUpdate()
 {
     TICK_LEVEL(LateUpdate, "Level::LateUpdate")
     TICK_LEVEL_EDITOR(LateUpdate)
+    Level::FlushTransformUpdates();
     flushActions();
 }
 
@@ -286,12 +288,14 @@ void LevelService::FixedUpdate()
 {
     TICK_LEVEL(FixedUpdate, "Level::FixedUpdate")
     TICK_LEVEL_EDITOR(FixedUpdate)
+    Level::FlushTransformUpdates();
 }
 
 void LevelService::LateFixedUpdate()
 {
     TICK_LEVEL(LateFixedUpdate, "Level::LateFixedUpdate")
     TICK_LEVEL_EDITOR(LateFixedUpdate)
+    Level::FlushTransformUpdates();
 }
 
 #undef TICK_LEVEL
@@ -384,6 +388,19 @@ void Level::CollectPostFxVolumes(RenderContext& renderContext)
     }
 }
 
+void Level::CollectOccluders(RenderContext& renderContext)
+{
+    PROFILE_CPU();
+
+    //ScopeLock lock(ScenesLock);
+
+    for (Scene* scene : Scenes)
+    {
+        if (scene->IsActiveInHierarchy())
+            scene->Rendering.CollectOccluders(renderContext);
+    }
+}
+
 class LoadSceneAction : public SceneAction
 {
 public:
@@ -1366,172 +1383,6 @@ Actor* Level::FindActor(const Guid& id)
     return Scripting::TryFindObject<Actor>(id);
 }
 
-Actor* Level::FindActor(const StringView& name)
-{
-    Actor* result = nullptr;
-    ScopeLock lock(ScenesLock);
-    for (int32 i = 0; result == nullptr && i < Scenes.Count(); i++)
-        result = Scenes[i]->FindActor(name);
-    return result;
-}
-
-Actor* Level::FindActor(const MClass* type)
-{
-    CHECK_RETURN(type, nullptr);
-    Actor* result = nullptr;
-    ScopeLock lock(ScenesLock);
-    for (int32 i = 0; result == nullptr && i < Scenes.Count(); i++)
-        result = Scenes[i]->FindActor(type);
-    return result;
-}
-
-Actor* Level::FindActor(const MClass* type, const StringView& name)
-{
-    CHECK_RETURN(type, nullptr);
-    Actor* result = nullptr;
-    ScopeLock lock(ScenesLock);
-    for (int32 i = 0; result == nullptr && i < Scenes.Count(); i++)
-        result = Scenes[i]->FindActor(type, name);
-    return result;
-}
-
-Actor* FindActorRecursive(Actor* node, const Tag& tag)
-{
-    if (node->HasTag(tag))
-        return node;
-    Actor* result = nullptr;
-    for (Actor* child : node->Children)
-    {
-        result = FindActorRecursive(child, tag);
-        if (result)
-            break;
-    }
-    return result;
-}
-
-Actor* FindActorRecursiveByType(Actor* node, const MClass* type, const Tag& tag)
-{
-    CHECK_RETURN(type, nullptr);
-    if (node->HasTag(tag) && node->GetClass()->IsSubClassOf(type))
-        return node;
-    Actor* result = nullptr;
-    for (Actor* child : node->Children)
-    {
-        result = FindActorRecursiveByType(child, type, tag);
-        if (result)
-            break;
-    }
-    return result;
-}
-
-void FindActorsRecursive(Actor* node, const Tag& tag, const bool activeOnly, Array<Actor*>& result)
-{
-    if (activeOnly && !node->GetIsActive())
-        return;
-    if (node->HasTag(tag))
-        result.Add(node);
-    for (Actor* child : node->Children)
-        FindActorsRecursive(child, tag, activeOnly, result);
-}
-
-void FindActorsRecursiveByParentTags(Actor* node, const Array<Tag>& tags, const bool activeOnly, Array<Actor*>& result)
-{
-    if (activeOnly && !node->GetIsActive())
-        return;
-    for (Tag tag : tags)
-    {
-        if (node->HasTag(tag))
-        {
-            result.Add(node);
-            break;
-        }
-    }
-    for (Actor* child : node->Children)
-        FindActorsRecursiveByParentTags(child, tags, activeOnly, result);
-}
-
-Actor* Level::FindActor(const Tag& tag, Actor* root)
-{
-    PROFILE_CPU();
-    if (root)
-        return FindActorRecursive(root, tag);
-    Actor* result = nullptr;
-    for (Scene* scene : Scenes)
-    {
-        result = FindActorRecursive(scene, tag);
-        if (result)
-            break;
-    }
-    return result;
-}
-
-Actor* Level::FindActor(const MClass* type, const Tag& tag, Actor* root)
-{
-    CHECK_RETURN(type, nullptr);
-    if (root)
-        return FindActorRecursiveByType(root, type, tag);
-    Actor* result = nullptr;
-    ScopeLock lock(ScenesLock);
-    for (int32 i = 0; result == nullptr && i < Scenes.Count(); i++)
-        result = Scenes[i]->FindActor(type, tag);
-    return result;
-}
-
-void FindActorRecursive(Actor* node, const Tag& tag, Array<Actor*>& result)
-{
-    if (node->HasTag(tag))
-        result.Add(node);
-    for (Actor* child : node->Children)
-        FindActorRecursive(child, tag, result);
-}
-
-Array<Actor*> Level::FindActors(const Tag& tag, const bool activeOnly, Actor* root)
-{
-    PROFILE_CPU();
-    Array<Actor*> result;
-    if (root)
-    {
-        FindActorsRecursive(root, tag, activeOnly, result);
-    }
-    else
-    {
-        ScopeLock lock(ScenesLock);
-        for (Scene* scene : Scenes)
-            FindActorsRecursive(scene, tag, activeOnly,  result);
-    }
-    return result;
-}
-
-Array<Actor*> Level::FindActorsByParentTag(const Tag& parentTag, const bool activeOnly, Actor* root)
-{
-    PROFILE_CPU();
-    Array<Actor*> result;
-    const Array<Tag> subTags = Tags::GetSubTags(parentTag);
-
-    if (subTags.Count() == 0)
-    {
-        return result;
-    }
-    if (subTags.Count() == 1)
-    {
-        result = FindActors(subTags[0], activeOnly, root);
-        return result;
-    }
-
-    if (root)
-    {
-        FindActorsRecursiveByParentTags(root, subTags, activeOnly, result);
-    }
-    else
-    {
-        ScopeLock lock(ScenesLock);
-        for (Scene* scene : Scenes)
-            FindActorsRecursiveByParentTags(scene, subTags, activeOnly, result);
-    }
-
-    return result;
-}
-
 Script* Level::FindScript(const MClass* type)
 {
     CHECK_RETURN(type, nullptr);
@@ -1544,14 +1395,6 @@ Script* Level::FindScript(const MClass* type)
 
 namespace
 {
-    void GetActors(const MClass* type, Actor* actor, Array<Actor*>& result)
-    {
-        if (actor->GetClass()->IsSubClassOf(type))
-            result.Add(actor);
-        for (auto child : actor->Children)
-            GetActors(type, child, result);
-    }
-
     void GetScripts(const MClass* type, Actor* actor, Array<Script*>& result)
     {
         for (auto script : actor->Scripts)
@@ -1562,16 +1405,6 @@ namespace
     }
 }
 
-Array<Actor*> Level::GetActors(const MClass* type)
-{
-    Array<Actor*> result;
-    CHECK_RETURN(type, result);
-    ScopeLock lock(ScenesLock);
-    for (int32 i = 0; i < Scenes.Count(); i++)
-        ::GetActors(type, Scenes[i], result);
-    return result;
-}
-
 Array<Script*> Level::GetScripts(const MClass* type)
 {
     Array<Script*> result;
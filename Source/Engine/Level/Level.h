@@ -50,6 +50,12 @@ API_CLASS(Static) class FLAXENGINE_API Level
     /// </summary>
     API_FIELD() static bool TickEnabled;
 
+    /// <summary>
+    /// True if actors transformation updates should be deferred. Moving the actor updates only its own world-space transformation immediately while the hierarchy update (children transformations, bounds, rendering and physics state) is resolved once for all moved actors at the end of the current update stage (or on FlushTransformUpdates). Reduces the cost of moving deep hierarchies (eg. character rigs with sockets or vehicles with many parts) and many actors per frame.
+    /// </summary>
+    /// <remarks>World-space transformation of the moved actor children is outdated until the flush (local-space transformation is always valid).</remarks>
+    API_FIELD() static bool DeferTransformUpdates;
+
 public:
     /// <summary>
     /// Occurs when new actor gets spawned to the game.
@@ -175,6 +181,12 @@ API_CLASS(Static) class FLAXENGINE_API Level
     /// <param name="renderContext">The rendering context.</param>
     static void CollectPostFxVolumes(RenderContext& renderContext);
 
+    /// <summary>
+    /// Collects all the occluders for the CPU occlusion culling.
+    /// </summary>
+    /// <param name="renderContext">The rendering context.</param>
+    static void CollectOccluders(RenderContext& renderContext);
+
 public:
     /// <summary>
     /// Fired when scene starts saving.
@@ -341,6 +353,17 @@ API_CLASS(Static) class FLAXENGINE_API Level
 
 #endif
 
+public:
+    /// <summary>
+    /// Resolves all pending deferred actors transformation updates (see DeferTransformUpdates). Called automatically at the end of each update stage.
+    /// </summary>
+    API_FUNCTION() static void FlushTransformUpdates();
+
+    /// <summary>
+    /// Checks if any deferred actors transformation update is pending.
+    /// </summary>
+    static bool HasTransformUpdates();
+
 public:
     /// <summary>
     /// Tries to find actor with the given ID. It's very fast O(1) lookup.
@@ -350,7 +373,7 @@ API_CLASS(Static) class FLAXENGINE_API Level
     API_FUNCTION() static Actor* FindActor(const Guid& id);
 
     /// <summary>
-    /// Tries to find the actor with the given name.
+    /// Tries to find the actor with the given name. Uses the actors index (returns any matching actor).
     /// </summary>
     /// <param name="name">The name of the actor.</param>
     /// <returns>Found actor or null.</returns>
@@ -372,7 +395,7 @@ API_CLASS(Static) class FLAXENGINE_API Level
     API_FUNCTION() static Actor* FindActor(API_PARAM(Attributes="TypeReference(typeof(Actor))") const MClass* type, const StringView& name);
 
     /// <summary>
-    /// Tries to find the actor with the given tag (returns the first one found).
+    /// Tries to find the actor with the given tag (returns the first one found). Uses the actors index when searching all loaded scenes.
     /// </summary>
     /// <param name="tag">The tag of the actor to search for.</param>
     /// <param name="root">The custom root actor to start searching from (hierarchical), otherwise null to search all loaded scenes.</param>
@@ -389,7 +412,7 @@ API_CLASS(Static) class FLAXENGINE_API Level
     API_FUNCTION() static Actor* FindActor(API_PARAM(Attributes="TypeReference(typeof(Actor))") const MClass* type, const Tag& tag, Actor* root = nullptr);
 
     /// <summary>
-    /// Tries to find the actors with the given tag (returns all found).
+    /// Tries to find the actors with the given tag (returns all found). Uses the actors index when searching all loaded scenes (actors order is not defined).
     /// </summary>
     /// <param name="tag">The tag of the actor to search for.</param>
     /// <param name="activeOnly">Find only active actors.</param>
@@ -457,7 +480,7 @@ API_CLASS(Static) class FLAXENGINE_API Level
     }
 
     /// <summary>
-    /// Finds all the actors of the given type in all the loaded scenes.
+    /// Finds all the actors of the given type in all the loaded scenes. Uses the actors index (actors order is not defined and doesn't match the scene hierarchy order).
     /// </summary>
     /// <param name="type">Type of the actor to search for. Includes any actors derived from the type.</param>
     /// <returns>Found actors list.</returns>
@@ -541,6 +564,10 @@ API_CLASS(Static) class FLAXENGINE_API Level
     };
 
     static void callActorEvent(ActorEventType eventType, Actor* a, Actor* b);
+    static void addTransformUpdate(Actor* a);
+    static void removeTransformUpdate(Actor* a);
+    static void addActorToIndex(Actor* a);
+    static void removeActorFromIndex(Actor* a);
     static bool loadScene(const Guid& sceneId);
     static bool loadScene(const String& scenePath);
     static bool loadScene(JsonAsset* sceneAsset);
@@ -0,0 +1,110 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#include "Prefab.h"
+#include "PrefabTemplate.h"
+#include "Engine/Content/Content.h"
+#include "Engine/Core/Log.h"
+#include "Engine/Level/SceneObject.h"
+#include "Engine/Profiler/ProfilerCPU.h"
+#include "Engine/Scripting/Scripting.h"
+#include "Engine/Serialization/JsonTools.h"
+#include "Engine/Threading/Threading.h"
+
+// Maximum depth of the nested prefabs (protects against the cyclic references)
+#define PREFAB_TEMPLATE_MAX_NESTING 64
+
+bool PrefabTemplate::Compile(Prefab* prefab)
+{
+    PROFILE_CPU_NAMED("Prefab.Compile");
+    const auto& data = *prefab->Data;
+    const int32 objectsCount = prefab->ObjectsCount;
+    Objects.Resize(objectsCount);
+    Array<ObjectData, InlinedAllocation<8>> chain;
+    for (int32 i = 0; i < objectsCount; i++)
+    {
+        auto& obj = Objects[i];
+        obj.NestedIdsStart = NestedIds.Count();
+
+        // Follow the nested prefabs to the object data that defines the type (the same way as SceneObjectsFactory::Spawn does)
+        chain.Clear();
+        chain.Add({ &data[i], prefab->DataEngineBuild });
+        Guid prefabObjectId;
+        while (JsonTools::GetGuidIfValid(prefabObjectId, *chain.Last().Stream, "PrefabObjectID"))
+        {
+            const Guid prefabId = JsonTools::GetGuid(*chain.Last().Stream, "PrefabID");
+            auto nestedPrefab = prefabId.IsValid() ? Content::LoadAsync<Prefab>(prefabId) : nullptr;
+            if (nestedPrefab == nullptr || nestedPrefab == prefab || nestedPrefab->WaitForLoaded() || chain.Count() >= PREFAB_TEMPLATE_MAX_NESTING)
+                return true;
+            const ISerializable::DeserializeStream* nestedData;
+            if (!nestedPrefab->ObjectsDataCache.TryGet(prefabObjectId, nestedData))
+                return true;
+            Dependencies.AddUnique(nestedPrefab);
+            NestedIds.Add(prefabObjectId);
+            chain.Add({ nestedData, nestedPrefab->DataEngineBuild });
+        }
+        obj.NestedIdsCount = NestedIds.Count() - obj.NestedIdsStart;
+
+        // Resolve type (deprecated TypeID format is not supported)
+        const auto& typeData = *chain.Last().Stream;
+        const auto typeNameMember = typeData.FindMember("TypeName");
+        if (typeNameMember == typeData.MemberEnd() || !typeNameMember->value.IsString())
+            return true;
+        obj.Type = Scripting::FindScriptingType(typeNameMember->value.GetStringAnsiView());
+        if (!obj.Type || !SceneObject::TypeInitializer.IsAssignableFrom(obj.Type))
+            return true;
+
+        // Deserialize the innermost nested prefab data first
+        obj.DataStart = Data.Count();
+        obj.DataCount = chain.Count();
+        for (int32 j = chain.Count() - 1; j >= 0; j--)
+            Data.Add(chain[j]);
+    }
+
+    // Find root
+    const Guid rootId = prefab->GetRootObjectId();
+    RootIndex = prefab->ObjectsIds.Find(rootId);
+    return RootIndex == -1;
+}
+
+const PrefabTemplate* Prefab::GetTemplate()
+{
+    ScopeLock lock(Locker);
+    if (_template || _isTemplateInvalid || !IsLoaded())
+        return _template;
+
+    auto result = New<PrefabTemplate>();
+    if (result->Compile(this))
+    {
+        LOG(Info, "Prefab {0} uses data that cannot be compiled into template. Using slower instantiation path.", ToString());
+        Delete(result);
+        _isTemplateInvalid = true;
+        return nullptr;
+    }
+    _template = result;
+    for (Prefab* dependency : _template->Dependencies)
+    {
+        dependency->OnUnloaded.Bind<Prefab, &Prefab::OnTemplateDependencyUnloaded>(this);
+        dependency->OnReloading.Bind<Prefab, &Prefab::OnTemplateDependencyUnloaded>(this);
+    }
+    return _template;
+}
+
+void Prefab::DeleteTemplate()
+{
+    ScopeLock lock(Locker);
+    _isTemplateInvalid = false;
+    if (!_template)
+        return;
+    for (Prefab* dependency : _template->Dependencies)
+    {
+        dependency->OnUnloaded.Unbind<Prefab, &Prefab::OnTemplateDependencyUnloaded>(this);
+        dependency->OnReloading.Unbind<Prefab, &Prefab::OnTemplateDependencyUnloaded>(this);
+    }
+    Delete(_template);
+    _template = nullptr;
+}
+
+void Prefab::OnTemplateDependencyUnloaded(Asset* asset)
+{
+    DeleteTemplate();
+}
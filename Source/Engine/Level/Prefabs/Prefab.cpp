@@ -17,7 +17,9 @@ REGISTER_JSON_ASSET(Prefab, "FlaxEngine.Prefab", true);
 Prefab::Prefab(const SpawnParams& params, const AssetInfo* info)
     : JsonAssetBase(params, info)
     , _isCreatingDefaultInstance(false)
+    , _isTemplateInvalid(false)
     , _defaultInstance(nullptr)
+    , _template(nullptr)
     , ObjectsCount(0)
 {
 }
@@ -104,6 +106,7 @@ SceneObject* Prefab::GetDefaultInstance(const Guid& objectId)
 void Prefab::DeleteDefaultInstance()
 {
     ScopeLock lock(Locker);
+    DeleteTemplate();
     ObjectsCache.Clear();
     if (_defaultInstance)
     {
@@ -195,6 +198,7 @@ void Prefab::unload(bool isReloading)
     ObjectsDataCache.SetCapacity(0);
     ObjectsCache.Clear();
     ObjectsCache.SetCapacity(0);
+    DeleteTemplate();
     if (_defaultInstance)
     {
         _defaultInstance->DeleteObject();
@@ -8,6 +8,7 @@
 
 class Actor;
 class SceneObject;
+struct PrefabTemplate;
 
 /// <summary>
 /// Json asset that stores the collection of scene objects including actors and scripts. In general it can serve as any grouping of scene objects (for example a level) or be used as a form of a template instantiated and reused throughout the scene.
@@ -18,7 +19,9 @@ API_CLASS(NoSpawn) class FLAXENGINE_API Prefab : public JsonAssetBase
     DECLARE_ASSET_HEADER(Prefab);
 private:
     bool _isCreatingDefaultInstance;
+    bool _isTemplateInvalid;
     Actor* _defaultInstance;
+    PrefabTemplate* _template;
 
 public:
     /// <summary>
@@ -65,6 +68,12 @@ API_CLASS(NoSpawn) class FLAXENGINE_API Prefab : public JsonAssetBase
     /// <returns>The object of the prefab loaded from the prefab. Contains the default values. It's not added to gameplay but deserialized with postLoad and init event fired.</returns>
     API_FUNCTION() SceneObject* GetDefaultInstance(API_PARAM(Ref) const Guid& objectId);
 
+    /// <summary>
+    /// Gets the compiled prefab template used for the fast instantiation of the prefab objects (without resolving types and nested prefabs from the data). Compiles it on the first use.
+    /// </summary>
+    /// <returns>The prefab template or null if prefab cannot be compiled (eg. uses the deprecated data format).</returns>
+    const PrefabTemplate* GetTemplate();
+
 #if USE_EDITOR
     /// <summary>
     /// Applies the difference from the prefab object instance, saves the changes and synchronizes them with the active instances of the prefab asset.
@@ -86,6 +95,8 @@ API_CLASS(NoSpawn) class FLAXENGINE_API Prefab : public JsonAssetBase
     void SyncNestedPrefabs(const NestedPrefabsList& allPrefabs, Array<PrefabInstancesData>& allPrefabsInstancesData) const;
 #endif
     void DeleteDefaultInstance();
+    void DeleteTemplate();
+    void OnTemplateDependencyUnloaded(Asset* asset);
 
 protected:
     // [JsonAssetBase]
@@ -4,6 +4,7 @@
 #include "../Scene/Scene.h"
 #include "Engine/Debug/Exceptions/ArgumentNullException.h"
 #include "Engine/Level/Prefabs/Prefab.h"
+#include "Engine/Level/Prefabs/PrefabTemplate.h"
 #include "Engine/Level/SceneObjectsFactory.h"
 #include "Engine/Level/SceneQuery.h"
 #include "Engine/Level/ActorsCache.h"
@@ -115,65 +116,126 @@ Actor* PrefabManager::SpawnPrefab(Prefab* prefab, Actor* parent, Dictionary<Guid
     }
     auto& data = *prefab->Data;
     SceneObjectsFactory::Context context(modifier.Value);
+    Actor* root = nullptr;
 
-    // Deserialize prefab objects
-    auto prevIdMapping = Scripting::ObjectsLookupIdMapping.Get();
-    Scripting::ObjectsLookupIdMapping.Set(&modifier.Value->IdsMapping);
-    for (int32 i = 0; i < objectsCount; i++)
+    // Use compiled prefab to skip types and nested prefabs resolving from json (synchronization requires the full data processing)
+    // Note: prefab is locked while the template is in use to prevent it from being deleted by the concurrent prefab reload
+    bool spawnedFromTemplate = false;
+    if (!withSynchronization)
     {
-        auto& stream = data[i];
-        SceneObject* obj = SceneObjectsFactory::Spawn(context, stream);
-        sceneObjects->At(i) = obj;
-        if (obj)
-            obj->RegisterObject();
-        else
-            SceneObjectsFactory::HandleObjectDeserializationError(stream);
+        ScopeLock lock(prefab->Locker);
+        const PrefabTemplate* compiled = prefab->GetTemplate();
+        if (compiled)
+        {
+            spawnedFromTemplate = true;
+
+            // Map nested prefabs objects to the instance objects
+            for (int32 i = 0; i < objectsCount; i++)
+            {
+                const auto& e = compiled->Objects[i];
+                const Guid id = modifier->IdsMapping[prefab->ObjectsIds[i]];
+                for (int32 j = 0; j < e.NestedIdsCount; j++)
+                    modifier->IdsMapping[compiled->NestedIds[e.NestedIdsStart + j]] = id;
+            }
+
+            // Spawn and deserialize prefab objects
+            auto prevIdMapping = Scripting::ObjectsLookupIdMapping.Get();
+            Scripting::ObjectsLookupIdMapping.Set(&modifier.Value->IdsMapping);
+            for (int32 i = 0; i < objectsCount; i++)
+            {
+                const auto& e = compiled->Objects[i];
+                const ScriptingObjectSpawnParams params(modifier->IdsMapping[prefab->ObjectsIds[i]], e.Type);
+                SceneObject* obj = (SceneObject*)e.Type.GetType().Script.Spawn(params);
+                sceneObjects->At(i) = obj;
+                if (obj)
+                    obj->RegisterObject();
+                else
+                    LOG(Warning, "Failed to spawn object of type {0}.", e.Type.ToString(true));
+            }
+            for (int32 i = 0; i < objectsCount; i++)
+            {
+                const auto& e = compiled->Objects[i];
+                SceneObject* obj = sceneObjects->At(i);
+                if (!obj)
+                    continue;
+                for (int32 j = 0; j < e.DataCount; j++)
+                {
+                    const auto& objData = compiled->Data[e.DataStart + j];
+                    modifier->EngineBuild = objData.EngineBuild;
+                    obj->Deserialize(*(ISerializable::DeserializeStream*)objData.Stream, modifier.Value);
+                }
+            }
+            modifier->EngineBuild = prefab->DataEngineBuild;
+            Scripting::ObjectsLookupIdMapping.Set(prevIdMapping);
+
+            root = dynamic_cast<Actor*>(sceneObjects->At(compiled->RootIndex));
+            if (!root)
+            {
+                LOG(Warning, "Missing prefab root object.");
+                return nullptr;
+            }
+        }
     }
-    SceneObjectsFactory::PrefabSyncData prefabSyncData(*sceneObjects.Value, data, modifier.Value);
-    if (withSynchronization)
+    if (!spawnedFromTemplate)
     {
-        // Synchronize new prefab instances (prefab may have new objects added so deserialized instances need to synchronize with it)
-        // TODO: resave and force sync prefabs during game cooking so this step could be skipped in game
-        SceneObjectsFactory::SetupPrefabInstances(context, prefabSyncData);
-        SceneObjectsFactory::SynchronizeNewPrefabInstances(context, prefabSyncData);
+        // Deserialize prefab objects
+        auto prevIdMapping = Scripting::ObjectsLookupIdMapping.Get();
         Scripting::ObjectsLookupIdMapping.Set(&modifier.Value->IdsMapping);
-    }
-    for (int32 i = 0; i < objectsCount; i++)
-    {
-        auto& stream = data[i];
-        SceneObject* obj = sceneObjects->At(i);
-        if (obj)
-            SceneObjectsFactory::Deserialize(context, obj, stream);
-    }
-    Scripting::ObjectsLookupIdMapping.Set(prevIdMapping);
+        for (int32 i = 0; i < objectsCount; i++)
+        {
+            auto& stream = data[i];
+            SceneObject* obj = SceneObjectsFactory::Spawn(context, stream);
+            sceneObjects->At(i) = obj;
+            if (obj)
+                obj->RegisterObject();
+            else
+                SceneObjectsFactory::HandleObjectDeserializationError(stream);
+        }
+        SceneObjectsFactory::PrefabSyncData prefabSyncData(*sceneObjects.Value, data, modifier.Value);
+        if (withSynchronization)
+        {
+            // Synchronize new prefab instances (prefab may have new objects added so deserialized instances need to synchronize with it)
+            // TODO: resave and force sync prefabs during game cooking so this step could be skipped in game
+            SceneObjectsFactory::SetupPrefabInstances(context, prefabSyncData);
+            SceneObjectsFactory::SynchronizeNewPrefabInstances(context, prefabSyncData);
+            Scripting::ObjectsLookupIdMapping.Set(&modifier.Value->IdsMapping);
+        }
+        for (int32 i = 0; i < objectsCount; i++)
+        {
+            auto& stream = data[i];
+            SceneObject* obj = sceneObjects->At(i);
+            if (obj)
+                SceneObjectsFactory::Deserialize(context, obj, stream);
+        }
+        Scripting::ObjectsLookupIdMapping.Set(prevIdMapping);
 
-    // Pick prefab root object
-    if (sceneObjects->IsEmpty())
-    {
-        LOG(Warning, "No valid objects in prefab.");
-        return nullptr;
-    }
-    Actor* root = nullptr;
-    const Guid prefabRootObjectId = prefab->GetRootObjectId();
-    for (int32 i = 0; i < objectsCount; i++)
-    {
-        if (JsonTools::GetGuid(data[i], "ID") == prefabRootObjectId)
+        // Pick prefab root object
+        if (sceneObjects->IsEmpty())
         {
-            root = dynamic_cast<Actor*>(sceneObjects->At(i));
-            break;
+            LOG(Warning, "No valid objects in prefab.");
+            return nullptr;
+        }
+        const Guid prefabRootObjectId = prefab->GetRootObjectId();
+        for (int32 i = 0; i < objectsCount; i++)
+        {
+            if (JsonTools::GetGuid(data[i], "ID") == prefabRootObjectId)
+            {
+                root = dynamic_cast<Actor*>(sceneObjects->At(i));
+                break;
+            }
+        }
+        if (!root)
+        {
+            LOG(Warning, "Missing prefab root object.");
+            return nullptr;
         }
-    }
-    if (!root)
-    {
-        LOG(Warning, "Missing prefab root object.");
-        return nullptr;
-    }
 
-    // Synchronize prefab instances (prefab may have new objects added or some removed so deserialized instances need to synchronize with it)
-    if (withSynchronization)
-    {
-        // TODO: resave and force sync scenes during game cooking so this step could be skipped in game
-        SceneObjectsFactory::SynchronizePrefabInstances(context, prefabSyncData);
+        // Synchronize prefab instances (prefab may have new objects added or some removed so deserialized instances need to synchronize with it)
+        if (withSynchronization)
+        {
+            // TODO: resave and force sync scenes during game cooking so this step could be skipped in game
+            SceneObjectsFactory::SynchronizePrefabInstances(context, prefabSyncData);
+        }
     }
 
     // Prepare parent linkage for prefab root actor
@@ -255,12 +317,11 @@ Actor* PrefabManager::SpawnPrefab(Prefab* prefab, Actor* parent, Dictionary<Guid
     // Link objects to prefab (only deserialized from prefab data)
     for (int32 i = 0; i < objectsCount; i++)
     {
-        auto& stream = data[i];
         SceneObject* obj = sceneObjects->At(i);
         if (!obj)
             continue;
 
-        const Guid prefabObjectId = JsonTools::GetGuid(stream, "ID");
+        const Guid& prefabObjectId = prefab->ObjectsIds[i];
         if (objectsCache)
             objectsCache->Add(prefabObjectId, obj);
         obj->LinkPrefab(prefabId, prefabObjectId);
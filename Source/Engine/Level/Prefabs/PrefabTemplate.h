@@ -0,0 +1,73 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#include "Engine/Core/Collections/Array.h"
+#include "Engine/Core/Types/Guid.h"
+#include "Engine/Scripting/ScriptingType.h"
+#include "Engine/Serialization/ISerializable.h"
+
+class Prefab;
+
+/// <summary>
+/// The compiled prefab used for the fast instantiation. Contains the flat list of the prefab objects with resolved types, the data nodes to deserialize (including the nested prefabs defaults) and the ids remapping tables. Built on the first prefab spawn.
+/// </summary>
+struct FLAXENGINE_API PrefabTemplate
+{
+    /// <summary>
+    /// The object data node to deserialize.
+    /// </summary>
+    struct ObjectData
+    {
+        const ISerializable::DeserializeStream* Stream;
+        int32 EngineBuild;
+    };
+
+    /// <summary>
+    /// The prefab object.
+    /// </summary>
+    struct Object
+    {
+        // The object type.
+        ScriptingTypeHandle Type;
+        // The range of the Data entries to deserialize (the innermost nested prefab data first).
+        int32 DataStart;
+        int32 DataCount;
+        // The range of the NestedIds entries mapped to the object instance id (objects ids within the nested prefabs).
+        int32 NestedIdsStart;
+        int32 NestedIdsCount;
+    };
+
+    /// <summary>
+    /// The prefab objects (in the same order as prefab data).
+    /// </summary>
+    Array<Object> Objects;
+
+    /// <summary>
+    /// The objects data nodes.
+    /// </summary>
+    Array<ObjectData> Data;
+
+    /// <summary>
+    /// The nested prefabs objects ids.
+    /// </summary>
+    Array<Guid> NestedIds;
+
+    /// <summary>
+    /// The nested prefabs used by the template (data nodes are linked so template gets invalidated when any of them is unloaded).
+    /// </summary>
+    Array<Prefab*> Dependencies;
+
+    /// <summary>
+    /// The index of the prefab root object.
+    /// </summary>
+    int32 RootIndex = -1;
+
+public:
+    /// <summary>
+    /// Builds the template from the prefab data.
+    /// </summary>
+    /// <param name="prefab">The loaded prefab asset.</param>
+    /// <returns>True if prefab cannot be compiled (eg. uses deprecated data format), otherwise false.</returns>
+    bool Compile(Prefab* prefab);
+};
@@ -27,6 +27,8 @@ void LightmapSettings::Serialize(SerializeStream& stream, const void* otherObj)
     SERIALIZE(CompressLightmaps);
     SERIALIZE(UseGeometryWithNoMaterials);
     SERIALIZE(Quality);
+    SERIALIZE(Backend);
+    SERIALIZE(SamplesPerTexel);
 }
 
 void LightmapSettings::Deserialize(DeserializeStream& stream, ISerializeModifier* modifier)
@@ -39,6 +41,8 @@ void LightmapSettings::Deserialize(DeserializeStream& stream, ISerializeModifier
     DESERIALIZE(CompressLightmaps);
     DESERIALIZE(UseGeometryWithNoMaterials);
     DESERIALIZE(Quality);
+    DESERIALIZE(Backend);
+    DESERIALIZE(SamplesPerTexel);
 }
 
 Lightmap::Lightmap(SceneLightmapsData* manager, int32 index, const SavedLightmapInfo& info)
@@ -62,9 +62,11 @@ Scene::Scene(const SpawnParams& params)
     : Actor(params)
     , LightmapsData(this)
     , CSGData(this)
+    , HLODData(this)
 {
     // Default name
     _name = TEXT("Scene");
+    Rendering.HLOD = &HLODData;
 
     // Link events
     CSGData.CollisionData.Changed.Bind<Scene, &Scene::OnCsgCollisionDataChanged>(this);
@@ -98,6 +100,11 @@ void Scene::BuildCSG(float timeoutMs)
     CSGData.BuildCSG(timeoutMs);
 }
 
+void Scene::ClearHLOD()
+{
+    HLODData.Clear();
+}
+
 #if USE_EDITOR
 
 String Scene::GetPath() const
@@ -121,6 +128,11 @@ String Scene::GetDataFolderPath() const
     return Globals::ProjectContentFolder / TEXT("SceneData") / GetFilename();
 }
 
+bool Scene::BuildHLOD(float clusterSize, float distance, float triangleReduction)
+{
+    return HLODData.Build(clusterSize, distance, triangleReduction);
+}
+
 Array<Guid> Scene::GetAssetReferences() const
 {
     Array<Guid> result;
@@ -284,6 +296,12 @@ void Scene::Serialize(SerializeStream& stream, const void* otherObj)
         stream.JKEY("CSG");
         stream.Object(&CSGData, other ? &other->CSGData : nullptr);
     }
+
+    if (HLODData.HasData())
+    {
+        stream.JKEY("HLOD");
+        stream.Object(&HLODData, other ? &other->HLODData : nullptr);
+    }
 }
 
 void Scene::Deserialize(DeserializeStream& stream, ISerializeModifier* modifier)
@@ -294,6 +312,7 @@ void Scene::Deserialize(DeserializeStream& stream, ISerializeModifier* modifier)
     Info.Deserialize(stream, modifier);
     LightmapsData.LoadLightmaps(Info.Lightmaps);
     CSGData.DeserializeIfExists(stream, "CSG", modifier);
+    HLODData.DeserializeIfExists(stream, "HLOD", modifier);
 
     // [Deprecated on 13.01.2021, expires on 13.01.2023]
     if (modifier->EngineBuild <= 6215 && Navigation.Meshes.IsEmpty())
@@ -334,6 +353,7 @@ void Scene::OnDeleteObject()
     LightmapsData.UnloadLightmaps();
     CSGData.Model = nullptr;
     CSGData.CollisionData = nullptr;
+    HLODData.Clusters.Clear();
 
     // Base
     Actor::OnDeleteObject();
@@ -6,6 +6,7 @@
 #include "../SceneInfo.h"
 #include "SceneLightmapsData.h"
 #include "SceneCSGData.h"
+#include "SceneHLODData.h"
 #include "SceneRendering.h"
 #include "SceneTicking.h"
 #include "SceneNavigation.h"
@@ -67,6 +68,11 @@ API_CLASS() class FLAXENGINE_API Scene : public Actor
     /// </summary>
     CSG::SceneCSGData CSGData;
 
+    /// <summary>
+    /// The HLOD data container for this scene.
+    /// </summary>
+    SceneHLODData HLODData;
+
     /// <summary>
     /// Gets the lightmap settings (per scene).
     /// </summary>
@@ -91,6 +97,11 @@ API_CLASS() class FLAXENGINE_API Scene : public Actor
     /// <param name="timeoutMs">The timeout to wait before building CSG (in milliseconds).</param>
     API_FUNCTION() void BuildCSG(float timeoutMs = 50);
 
+    /// <summary>
+    /// Removes all HLOD clusters from the scene.
+    /// </summary>
+    API_FUNCTION() void ClearHLOD();
+
 #if USE_EDITOR
 
     /// <summary>
@@ -108,6 +119,15 @@ API_CLASS() class FLAXENGINE_API Scene : public Actor
     /// </summary>
     API_PROPERTY() String GetDataFolderPath() const;
 
+    /// <summary>
+    /// Builds the Hierarchical LOD (HLOD) for the scene. Static models are grouped into the spatial clusters which are replaced with a single merged and simplified proxy model when viewed from a distance.
+    /// </summary>
+    /// <param name="clusterSize">The size of the cluster cell (in world units).</param>
+    /// <param name="distance">The distance from the cluster bounds at which the actors are replaced with the proxy model.</param>
+    /// <param name="triangleReduction">The target amount of triangles to keep in the proxy model (normalized to 0-1 range).</param>
+    /// <returns>True if failed, otherwise false.</returns>
+    API_FUNCTION() bool BuildHLOD(float clusterSize = 10000.0f, float distance = 20000.0f, float triangleReduction = 0.25f);
+
     /// <summary>
     /// Gets the asset references (scene asset). Supported only in Editor.
     /// </summary>
@@ -0,0 +1,318 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#include "SceneHLODData.h"
+#include "Scene.h"
+#include "Engine/Core/Log.h"
+#include "Engine/Serialization/Serialization.h"
+#include "Engine/Serialization/JsonTools.h"
+#include "Engine/Threading/Threading.h"
+#include "Engine/Profiler/ProfilerCPU.h"
+#if USE_EDITOR
+#include "Engine/Core/Types/Pair.h"
+#include "Engine/Core/Types/TimeSpan.h"
+#include "Engine/Content/Content.h"
+#include "Engine/Platform/FileSystem.h"
+#include "Engine/Level/Actors/StaticModel.h"
+#include "Engine/Graphics/Models/ModelData.h"
+#if COMPILE_WITH_ASSETS_IMPORTER
+#include "Engine/ContentImporters/AssetsImportingManager.h"
+#endif
+#endif
+
+SceneHLODData::SceneHLODData(Scene* scene)
+    : _scene(scene)
+{
+}
+
+int32 SceneHLODData::GetActorCluster(const Guid& actorId) const
+{
+    int32 result;
+    if (!_actorsClusters.TryGet(actorId, result))
+        result = -1;
+    return result;
+}
+
+void SceneHLODData::Clear()
+{
+    if (Clusters.IsEmpty())
+        return;
+    {
+        ScopeLock lock(_scene->Rendering.Locker);
+        Clusters.Clear();
+    }
+    OnClustersChanged();
+}
+
+#if USE_EDITOR
+
+namespace
+{
+    struct HLODBuildCell
+    {
+        BoundingBox Bounds;
+        int32 Layer;
+        Array<StaticModel*> Actors;
+    };
+
+    uint64 GetHLODCellKey(const Vector3& position, float clusterSize, int32 layer)
+    {
+        // Pack 5-bit layer and 19-bit cell coordinates into a single key (actors from different layers are never merged)
+        const uint64 x = (uint64)(int64)Math::Floor(position.X / clusterSize) & 0x7ffff;
+        const uint64 y = (uint64)(int64)Math::Floor(position.Y / clusterSize) & 0x7ffff;
+        const uint64 z = (uint64)(int64)Math::Floor(position.Z / clusterSize) & 0x7ffff;
+        return (uint64)(layer & 0x1f) << 57 | x << 38 | y << 19 | z;
+    }
+
+    void AddHLODMesh(ModelData& modelData, Dictionary<Pair<Guid, int32>, int32>& materialsSlots, StaticModel* actor, const Mesh& mesh, const Matrix& world)
+    {
+        const int32 entryIndex = mesh.GetMaterialSlotIndex();
+        const ModelInstanceEntry* entry = entryIndex < actor->Entries.Count() ? &actor->Entries[entryIndex] : nullptr;
+        if (entry && !entry->Visible)
+            return;
+        ShadowsCastingMode shadowsMode = entry ? entry->ShadowsMode : ShadowsCastingMode::All;
+        if (!EnumHasAnyFlags(actor->DrawModes, DrawPass::Depth))
+            shadowsMode = ShadowsCastingMode::None;
+
+        // Get the mesh geometry
+        BytesContainer vb0, vb1, ib;
+        int32 vertexCount, vb1Count, indexCount;
+        if (mesh.DownloadDataCPU(MeshBufferType::Vertex0, vb0, vertexCount) ||
+            mesh.DownloadDataCPU(MeshBufferType::Vertex1, vb1, vb1Count) ||
+            mesh.DownloadDataCPU(MeshBufferType::Index, ib, indexCount) ||
+            vertexCount != vb1Count)
+        {
+            LOG(Warning, "Failed to get mesh data of actor {0} for HLOD.", actor->ToString());
+            return;
+        }
+        MeshData meshData;
+        meshData.InitFromModelVertices((VB0ElementType*)vb0.Get(), (VB1ElementType*)vb1.Get(), vertexCount);
+        meshData.Indices.Resize(indexCount);
+        if (mesh.Use16BitIndexBuffer())
+        {
+            const uint16* ib16 = (const uint16*)ib.Get();
+            for (int32 i = 0; i < indexCount; i++)
+                meshData.Indices[i] = ib16[i];
+        }
+        else
+        {
+            Platform::MemoryCopy(meshData.Indices.Get(), ib.Get(), indexCount * sizeof(uint32));
+        }
+        meshData.TransformBuffer(world);
+        if (world.GetDeterminant() < 0.0f)
+        {
+            // Mirrored actor (negative scale) has inverted triangles winding and tangent frame handedness
+            for (int32 i = 0; i + 2 < meshData.Indices.Count(); i += 3)
+                Swap(meshData.Indices[i + 1], meshData.Indices[i + 2]);
+            for (float& sign : meshData.BitangentSigns)
+                sign = -sign;
+        }
+
+        // Merge geometry that uses the same material and shadows mode into a single mesh
+        MaterialBase* material = actor->GetMaterial(entryIndex);
+        const Pair<Guid, int32> slotKey(material ? material->GetID() : Guid::Empty, (int32)shadowsMode);
+        int32 slotIndex;
+        if (!materialsSlots.TryGet(slotKey, slotIndex))
+        {
+            slotIndex = modelData.Materials.Count();
+            materialsSlots.Add(slotKey, slotIndex);
+            auto& materialSlot = modelData.Materials.AddOne();
+            materialSlot.Name = String(TEXT("Material ")) + StringUtils::ToString(slotIndex);
+            materialSlot.AssetID = slotKey.First;
+            materialSlot.ShadowsMode = shadowsMode;
+            auto proxyMesh = New<MeshData>();
+            proxyMesh->Name = String(TEXT("Mesh ")) + StringUtils::ToString(slotIndex);
+            proxyMesh->MaterialSlotIndex = slotIndex;
+            modelData.LODs[0].Meshes.Add(proxyMesh);
+        }
+        MeshData* proxyMesh = modelData.LODs[0].Meshes[slotIndex];
+        if (proxyMesh->Positions.IsEmpty())
+            proxyMesh->SwapBuffers(meshData);
+        else
+            proxyMesh->Merge(meshData);
+    }
+}
+
+bool SceneHLODData::Build(float clusterSize, float distance, float triangleReduction)
+{
+#if COMPILE_WITH_ASSETS_IMPORTER && COMPILE_WITH_MODEL_TOOL
+    PROFILE_CPU();
+    const DateTime startTime = DateTime::NowUTC();
+    clusterSize = Math::Max(clusterSize, 1.0f);
+
+    // Group static models into the uniform grid cells
+    Dictionary<uint64, HLODBuildCell> cells;
+    Function<bool(Actor*)> collectActors = [&cells, clusterSize](Actor* actor)
+    {
+        if (!actor->GetIsActive())
+            return false;
+        auto staticModel = ScriptingObject::Cast<StaticModel>(actor);
+        if (staticModel &&
+            EnumHasAnyFlags(staticModel->GetStaticFlags(), StaticFlags::Transform) &&
+            EnumHasAnyFlags(staticModel->DrawModes, DrawPass::GBuffer) &&
+            staticModel->Model &&
+            !staticModel->Model->WaitForLoaded() &&
+            !staticModel->Model->IsVirtual())
+        {
+            const BoundingBox box = staticModel->GetBox();
+            const int32 layer = staticModel->GetLayer();
+            HLODBuildCell& cell = cells[GetHLODCellKey(box.GetCenter(), clusterSize, layer)];
+            if (cell.Actors.IsEmpty())
+            {
+                cell.Bounds = box;
+                cell.Layer = layer;
+            }
+            else
+                BoundingBox::Merge(cell.Bounds, box, cell.Bounds);
+            cell.Actors.Add(staticModel);
+        }
+        return true;
+    };
+    _scene->TreeExecute(collectActors);
+
+    // Merge and simplify geometry of each cluster into the proxy model
+    const String sceneDataFolderPath = _scene->GetDataFolderPath();
+    Array<Cluster> clusters;
+    for (auto& e : cells)
+    {
+        const HLODBuildCell& cell = e.Value;
+        if (cell.Actors.Count() < 2)
+            continue;
+        const int32 clusterIndex = clusters.Count();
+        auto& cluster = clusters.AddOne();
+        cluster.Bounds = cell.Bounds;
+        cluster.Origin = cell.Bounds.GetCenter();
+        cluster.Distance = distance;
+        cluster.Layer = cell.Layer;
+
+        ModelData modelData;
+        modelData.MinScreenSize = 0.0f;
+        modelData.LODs.Resize(1);
+        Dictionary<Pair<Guid, int32>, int32> materialsSlots;
+        for (StaticModel* actor : cell.Actors)
+        {
+            cluster.Actors.Add(actor->GetID());
+            Transform transform = actor->GetTransform();
+            transform.Translation -= cluster.Origin;
+            Matrix world;
+            transform.GetWorld(world);
+            for (const Mesh& mesh : actor->Model->LODs[0].Meshes)
+                AddHLODMesh(modelData, materialsSlots, actor, mesh, world);
+        }
+        for (MeshData* mesh : modelData.LODs[0].Meshes)
+            mesh->Simplify(triangleReduction);
+
+        // Import proxy model (reuse the existing asset identifiers to reduce changes in the scene data)
+        Guid proxyId = clusterIndex < Clusters.Count() ? Clusters[clusterIndex].Proxy.GetID() : Guid::Empty;
+        if (!proxyId.IsValid())
+            proxyId = Guid::New();
+        const String proxyPath = sceneDataFolderPath / TEXT("HLOD_") + StringUtils::ToString(clusterIndex) + ASSET_FILES_EXTENSION_WITH_DOT;
+        if (AssetsImportingManager::Create(AssetsImportingManager::CreateModelTag, proxyPath, proxyId, &modelData))
+        {
+            LOG(Warning, "Failed to import HLOD proxy model.");
+
+            // Proxies of the existing clusters could be already overwritten so remove the whole HLOD data (no stale clusters mapping)
+            const int32 proxiesCount = Math::Max(Clusters.Count(), clusterIndex + 1);
+            clusters.Clear();
+            Clear();
+            for (int32 i = 0; i < proxiesCount; i++)
+            {
+                const String path = sceneDataFolderPath / TEXT("HLOD_") + StringUtils::ToString(i) + ASSET_FILES_EXTENSION_WITH_DOT;
+                if (FileSystem::FileExists(path))
+                    Content::DeleteAsset(path);
+            }
+            return true;
+        }
+        cluster.Proxy = Content::LoadAsync<Model>(proxyId);
+    }
+
+    // Remove unused proxy assets
+    for (int32 i = clusters.Count(); i < Clusters.Count(); i++)
+    {
+        if (Clusters[i].Proxy)
+            Content::DeleteAsset(Clusters[i].Proxy.Get());
+    }
+
+    {
+        ScopeLock lock(_scene->Rendering.Locker);
+        Clusters.Swap(clusters);
+    }
+    OnClustersChanged();
+    LOG(Info, "HLOD build for scene {0} created {1} clusters in {2} ms", _scene->GetName(), Clusters.Count(), (int32)(DateTime::NowUTC() - startTime).GetTotalMilliseconds());
+    return false;
+#else
+    LOG(Warning, "Building HLOD is not supported.");
+    return true;
+#endif
+}
+
+#endif
+
+void SceneHLODData::OnClustersChanged()
+{
+    // Rebuild actors lookup
+    _actorsClusters.Clear();
+    for (int32 clusterIndex = 0; clusterIndex < Clusters.Count(); clusterIndex++)
+    {
+        for (const Guid& actorId : Clusters[clusterIndex].Actors)
+            _actorsClusters[actorId] = clusterIndex;
+    }
+
+    _scene->Rendering.UpdateHLOD();
+}
+
+void SceneHLODData::Serialize(SerializeStream& stream, const void* otherObj)
+{
+    stream.JKEY("Clusters");
+    stream.StartArray();
+    for (const Cluster& cluster : Clusters)
+    {
+        stream.StartObject();
+        stream.JKEY("Bounds");
+        stream.BoundingBox(cluster.Bounds);
+        stream.JKEY("Origin");
+        stream.Vector3(cluster.Origin);
+        stream.JKEY("Distance");
+        stream.Float(cluster.Distance);
+        stream.JKEY("Layer");
+        stream.Int(cluster.Layer);
+        stream.JKEY("Proxy");
+        stream.Guid(cluster.Proxy.GetID());
+        stream.JKEY("Actors");
+        stream.StartArray();
+        for (const Guid& actorId : cluster.Actors)
+            stream.Guid(actorId);
+        stream.EndArray();
+        stream.EndObject();
+    }
+    stream.EndArray();
+}
+
+void SceneHLODData::Deserialize(DeserializeStream& stream, ISerializeModifier* modifier)
+{
+    const auto clustersMember = stream.FindMember("Clusters");
+    if (clustersMember == stream.MemberEnd() || !clustersMember->value.IsArray())
+        return;
+    auto& clustersArray = clustersMember->value;
+    {
+        ScopeLock lock(_scene->Rendering.Locker);
+        Clusters.Resize(clustersArray.Size());
+        for (rapidjson::SizeType i = 0; i < clustersArray.Size(); i++)
+        {
+            auto& value = clustersArray[i];
+            auto& cluster = Clusters[i];
+            cluster.Bounds = JsonTools::GetBoundingBox(value, "Bounds", BoundingBox::Empty);
+            cluster.Origin = JsonTools::GetVector3(value, "Origin", cluster.Bounds.GetCenter());
+            cluster.Distance = JsonTools::GetFloat(value, "Distance", 10000.0f);
+            cluster.Layer = JsonTools::GetInt(value, "Layer", 0);
+            cluster.Proxy = JsonTools::GetGuid(value, "Proxy");
+            cluster.Actors.Clear();
+            const auto actorsMember = value.FindMember("Actors");
+            if (actorsMember != value.MemberEnd() && actorsMember->value.IsArray())
+            {
+                for (rapidjson::SizeType j = 0; j < actorsMember->value.Size(); j++)
+                    cluster.Actors.Add(JsonTools::GetGuid(actorsMember->value[j]));
+            }
+        }
+    }
+    OnClustersChanged();
+}
@@ -0,0 +1,118 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#include "Engine/Core/ISerializable.h"
+#include "Engine/Core/Collections/Array.h"
+#include "Engine/Core/Collections/Dictionary.h"
+#include "Engine/Core/Math/BoundingBox.h"
+#include "Engine/Content/AssetReference.h"
+#include "Engine/Content/Assets/Model.h"
+#include "Engine/Graphics/Models/ModelInstanceEntry.h"
+#include "Engine/Renderer/DrawCall.h"
+
+class Scene;
+
+/// <summary>
+/// Hierarchical LOD (HLOD) data container (used per scene). Groups the static actors into spatial clusters that are replaced with a single merged and simplified proxy model when viewed from a distance.
+/// </summary>
+class FLAXENGINE_API SceneHLODData : public ISerializable
+{
+public:
+    /// <summary>
+    /// The cluster of static actors that share the proxy model.
+    /// </summary>
+    struct Cluster
+    {
+        /// <summary>
+        /// The world-space bounds of the clustered actors.
+        /// </summary>
+        BoundingBox Bounds;
+
+        /// <summary>
+        /// The world-space location of the proxy model origin.
+        /// </summary>
+        Vector3 Origin;
+
+        /// <summary>
+        /// The distance from the cluster bounds at which the actors are replaced with the proxy model.
+        /// </summary>
+        float Distance;
+
+        /// <summary>
+        /// The layer of the clustered actors (proxy model is drawn only if the view renders this layer).
+        /// </summary>
+        int32 Layer = 0;
+
+        /// <summary>
+        /// The proxy model (merged and simplified geometry of all clustered actors, one mesh per material).
+        /// </summary>
+        AssetReference<Model> Proxy;
+
+        /// <summary>
+        /// The identifiers of the clustered actors.
+        /// </summary>
+        Array<Guid> Actors;
+
+        // Runtime data used for the proxy drawing
+        ModelInstanceEntries Entries;
+        GeometryDrawStateData DrawState;
+    };
+
+private:
+    Scene* _scene;
+    Dictionary<Guid, int32> _actorsClusters;
+
+public:
+    /// <summary>
+    /// Initializes a new instance of the <see cref="SceneHLODData"/> class.
+    /// </summary>
+    /// <param name="scene">The parent scene.</param>
+    SceneHLODData(Scene* scene);
+
+public:
+    /// <summary>
+    /// The HLOD clusters.
+    /// </summary>
+    Array<Cluster> Clusters;
+
+public:
+    /// <summary>
+    /// Determines whether this container has HLOD data linked.
+    /// </summary>
+    FORCE_INLINE bool HasData() const
+    {
+        return Clusters.HasItems();
+    }
+
+    /// <summary>
+    /// Gets the index of the cluster that contains the given actor.
+    /// </summary>
+    /// <param name="actorId">The actor identifier.</param>
+    /// <returns>The cluster index or -1 if actor is not clustered.</returns>
+    int32 GetActorCluster(const Guid& actorId) const;
+
+    /// <summary>
+    /// Removes all HLOD clusters from the scene.
+    /// </summary>
+    void Clear();
+
+#if USE_EDITOR
+    /// <summary>
+    /// Builds the HLOD clusters and their proxy models for the scene static models. Proxy assets are saved to the scene data folder.
+    /// </summary>
+    /// <param name="clusterSize">The size of the cluster cell (in world units). Actors are grouped into the clusters of the uniform grid.</param>
+    /// <param name="distance">The distance from the cluster bounds at which the actors are replaced with the proxy model.</param>
+    /// <param name="triangleReduction">The target amount of triangles to keep in the proxy model (normalized to 0-1 range).</param>
+    /// <returns>True if failed, otherwise false.</returns>
+    bool Build(float clusterSize, float distance, float triangleReduction);
+#endif
+
+private:
+    void OnClustersChanged();
+
+public:
+    // [ISerializable]
+    void Serialize(SerializeStream& stream, const void* otherObj) override;
+    void Deserialize(DeserializeStream& stream, ISerializeModifier* modifier) override;
+};
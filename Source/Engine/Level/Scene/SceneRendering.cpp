@@ -3,8 +3,11 @@
 #define SCENE_RENDERING_USE_PROFILER_PER_ACTOR 0
 
 #include "SceneRendering.h"
+#include "SceneHLODData.h"
+#include "Engine/Engine/Engine.h"
 #include "Engine/Graphics/RenderTask.h"
 #include "Engine/Graphics/RenderView.h"
+#include "Engine/Graphics/RenderTools.h"
 #include "Engine/Renderer/RenderList.h"
 #include "Engine/Threading/JobSystem.h"
 #include "Engine/Threading/Threading.h"
@@ -68,6 +71,12 @@ void SceneRendering::Draw(RenderContextBatch& renderContextBatch, DrawCategory c
     for (int32 i = 0; i < frustumsCount; i++)
         _drawFrustumsData.Get()[i] = renderContextBatch.Contexts.Get()[i].View.CullingFrustum;
 
+    // Replace distant HLOD clusters with their proxy models
+    if (HLOD && HLOD->HasData() && (category == SceneDraw || category == SceneDrawAsync))
+        DrawHLODProxies(renderContextBatch, category);
+    else
+        _drawHLODProxies.Clear();
+
     // Draw all visual components
     _drawListIndex = -1;
     if (_drawListSize >= 64 && category == SceneDrawAsync && renderContextBatch.EnableAsync)
@@ -121,6 +130,41 @@ void SceneRendering::CollectPostFxVolumes(RenderContext& renderContext)
     }
 }
 
+void SceneRendering::CollectOccluders(RenderContext& renderContext)
+{
+#if SCENE_RENDERING_USE_PROFILER
+    PROFILE_CPU();
+#endif
+    const RenderView& view = renderContext.View;
+    ScopeLock lock(Locker);
+    for (int32 i = 0; i < Occluders.Count(); i++)
+    {
+        IOccluder* occluder = Occluders.Get()[i];
+        BoundingSphere bounds = occluder->GetOccluderBounds();
+        bounds.Center -= view.Origin;
+        if (!view.CullingFrustum.Intersects(bounds))
+            continue;
+
+        // Skip occluders that are too small on the screen to hide anything
+        const float screenSize = RenderTools::ComputeBoundsScreenRadiusSquared(bounds.Center, (float)bounds.Radius, view);
+        if (screenSize >= 0.01f)
+            renderContext.List->Occlusion.AddOccluder(occluder, screenSize);
+    }
+}
+
+void SceneRendering::UpdateHLOD()
+{
+    ScopeLock lock(Locker);
+    for (auto& list : Actors)
+    {
+        for (auto& e : list)
+        {
+            if (e.Actor)
+                e.HLODCluster = HLOD ? HLOD->GetActorCluster(e.Actor->GetID()) : -1;
+        }
+    }
+}
+
 void SceneRendering::Clear()
 {
     ScopeLock lock(Locker);
@@ -137,6 +181,18 @@ void SceneRendering::Clear()
 #endif
 }
 
+void SceneRendering::AddOccluder(IOccluder* obj)
+{
+    ScopeLock lock(Locker);
+    Occluders.Add(obj);
+}
+
+void SceneRendering::RemoveOccluder(IOccluder* obj)
+{
+    ScopeLock lock(Locker);
+    Occluders.Remove(obj);
+}
+
 void SceneRendering::AddActor(Actor* a, int32& key)
 {
     if (key != -1)
@@ -158,6 +214,7 @@ void SceneRendering::AddActor(Actor* a, int32& key)
     e.LayerMask = a->GetLayerMask();
     e.Bounds = a->GetSphere();
     e.NoCulling = a->_drawNoCulling;
+    e.HLODCluster = HLOD ? HLOD->GetActorCluster(a->GetID()) : -1;
     for (auto* listener : _listeners)
         listener->OnSceneRenderingAddActor(a);
 }
@@ -198,9 +255,57 @@ void SceneRendering::RemoveActor(Actor* a, int32& key)
     key = -1;
 }
 
+void SceneRendering::DrawHLODProxies(RenderContextBatch& renderContextBatch, DrawCategory category)
+{
+    PROFILE_CPU();
+    const RenderContext& renderContext = renderContextBatch.GetMainContext();
+    const RenderView& view = renderContext.View;
+    auto& clusters = HLOD->Clusters;
+    _drawHLODProxies.Resize(clusters.Count());
+    const bool useProxies = !view.IsOfflinePass && EnumHasAnyFlags(view.Pass, DrawPass::GBuffer);
+    const Vector3 viewPosition = view.Position + view.Origin;
+    for (int32 i = 0; i < clusters.Count(); i++)
+    {
+        auto& cluster = clusters[i];
+        const bool useProxy = useProxies && view.RenderLayersMask.HasLayer(cluster.Layer) && cluster.Proxy && cluster.Proxy->IsLoaded() && cluster.Bounds.Distance(viewPosition) > cluster.Distance;
+        _drawHLODProxies[i] = useProxy;
+        if (!useProxy || category != SceneDraw)
+            continue;
+        BoundingSphere bounds;
+        BoundingSphere::FromBox(cluster.Bounds, bounds);
+        bounds.Center -= view.Origin;
+        if (!FrustumsListCull(bounds, _drawFrustumsData))
+            continue;
+
+        // Draw proxy model instead of the clustered actors (actors are skipped in DrawActorsJob)
+        Matrix world;
+        const Float3 translation = cluster.Origin - view.Origin;
+        Matrix::Translation(translation, world);
+        GEOMETRY_DRAW_STATE_EVENT_BEGIN(cluster.DrawState, world);
+        cluster.Entries.SetupIfInvalid(cluster.Proxy);
+        Mesh::DrawInfo draw;
+        draw.Buffer = &cluster.Entries;
+        draw.World = &world;
+        draw.DrawState = &cluster.DrawState;
+        draw.Lightmap = nullptr;
+        draw.LightmapUVs = nullptr;
+        draw.Flags = StaticFlags::FullyStatic;
+        draw.DrawModes = DrawPass::Default;
+        draw.Bounds = bounds;
+        draw.PerInstanceRandom = 0.0f;
+        draw.LODBias = 0;
+        draw.ForcedLOD = -1;
+        draw.SortOrder = 0;
+        draw.VertexColors = nullptr;
+        cluster.Proxy->Draw(renderContextBatch, draw);
+        GEOMETRY_DRAW_STATE_EVENT_END(cluster.DrawState, world);
+    }
+}
+
 #define FOR_EACH_BATCH_ACTOR const int64 count = _drawListSize; while (true) { const int64 index = Platform::InterlockedIncrement(&_drawListIndex); if (index >= count) break; auto e = _drawListData[index];
-#define CHECK_ACTOR ((view.RenderLayersMask.Mask & e.LayerMask) && (e.NoCulling || FrustumsListCull(e.Bounds, _drawFrustumsData)))
-#define CHECK_ACTOR_SINGLE_FRUSTUM ((view.RenderLayersMask.Mask & e.LayerMask) && (e.NoCulling || view.CullingFrustum.Intersects(e.Bounds)))
+#define CHECK_HLOD ((uint32)e.HLODCluster >= (uint32)hlodProxiesCount || !hlodProxies[e.HLODCluster])
+#define CHECK_ACTOR ((view.RenderLayersMask.Mask & e.LayerMask) && CHECK_HLOD && (e.NoCulling || FrustumsListCull(e.Bounds, _drawFrustumsData)))
+#define CHECK_ACTOR_SINGLE_FRUSTUM ((view.RenderLayersMask.Mask & e.LayerMask) && CHECK_HLOD && (e.NoCulling || (view.CullingFrustum.Intersects(e.Bounds) && !occlusion.IsOccluded(e.Bounds))))
 #if SCENE_RENDERING_USE_PROFILER_PER_ACTOR
 #define DRAW_ACTOR(mode) PROFILE_CPU_ACTOR(e.Actor); e.Actor->Draw(mode)
 #else
@@ -212,6 +317,8 @@ void SceneRendering::DrawActorsJob(int32)
     PROFILE_CPU();
     auto& mainContext = _drawBatch->GetMainContext();
     const auto& view = mainContext.View;
+    const bool* hlodProxies = _drawHLODProxies.Get();
+    const int32 hlodProxiesCount = _drawHLODProxies.Count();
     if (view.IsOfflinePass)
     {
         // Offline pass with additional static flags culling
@@ -225,7 +332,8 @@ void SceneRendering::DrawActorsJob(int32)
     }
     else if (view.Origin.IsZero() && _drawFrustumsData.Count() == 1)
     {
-        // Fast path for no origin shifting with a single context
+        // Fast path for no origin shifting with a single context (with occlusion culling)
+        const OcclusionBuffer& occlusion = mainContext.List->Occlusion;
         FOR_EACH_BATCH_ACTOR
             if (CHECK_ACTOR_SINGLE_FRUSTUM)
             {
@@ -257,5 +365,6 @@ void SceneRendering::DrawActorsJob(int32)
 }
 
 #undef FOR_EACH_BATCH_ACTOR
+#undef CHECK_HLOD
 #undef CHECK_ACTOR
 #undef DRAW_ACTOR
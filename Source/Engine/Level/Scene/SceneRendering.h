@@ -11,6 +11,8 @@
 
 class SceneRenderTask;
 class SceneRendering;
+class OcclusionBuffer;
+class SceneHLODData;
 struct PostProcessSettings;
 struct RenderContext;
 struct RenderContextBatch;
@@ -36,6 +38,25 @@ class FLAXENGINE_API IPostFxSettingsProvider
     virtual void Blend(PostProcessSettings& other, float weight) = 0;
 };
 
+/// <summary>
+/// Interface for actors that can occlude other objects in the CPU occlusion culling (eg. large static walls or buildings).
+/// </summary>
+class FLAXENGINE_API IOccluder
+{
+public:
+    /// <summary>
+    /// Gets the occluder bounds (in world-space).
+    /// </summary>
+    virtual BoundingSphere GetOccluderBounds() const = 0;
+
+    /// <summary>
+    /// Draws the occluder geometry into the occlusion buffer.
+    /// </summary>
+    /// <param name="renderContext">The rendering context.</param>
+    /// <param name="buffer">The occlusion buffer to rasterize into.</param>
+    virtual void DrawOccluder(const RenderContext& renderContext, OcclusionBuffer& buffer) = 0;
+};
+
 /// <summary>
 /// Interface for objects to plug into Scene Rendering and listen for its evens such as static actors changes which are relevant for drawing cache.
 /// </summary>
@@ -73,6 +94,7 @@ class FLAXENGINE_API SceneRendering
     {
         Actor* Actor;
         uint32 LayerMask;
+        int32 HLODCluster;
         int8 NoCulling : 1;
         BoundingSphere Bounds;
     };
@@ -91,6 +113,8 @@ class FLAXENGINE_API SceneRendering
 
     Array<DrawActor> Actors[MAX];
     Array<IPostFxSettingsProvider*> PostFxProviders;
+    Array<IOccluder*> Occluders;
+    SceneHLODData* HLOD = nullptr;
     CriticalSection Locker;
 
 private:
@@ -118,6 +142,17 @@ class FLAXENGINE_API SceneRendering
     /// <param name="renderContext">The rendering context.</param>
     void CollectPostFxVolumes(RenderContext& renderContext);
 
+    /// <summary>
+    /// Collects the occluders visible in the given rendering view for the CPU occlusion culling.
+    /// </summary>
+    /// <param name="renderContext">The rendering context.</param>
+    void CollectOccluders(RenderContext& renderContext);
+
+    /// <summary>
+    /// Updates the HLOD clusters of the registered actors. Called after HLOD data changes.
+    /// </summary>
+    void UpdateHLOD();
+
     /// <summary>
     /// Clears this instance data.
     /// </summary>
@@ -138,6 +173,9 @@ class FLAXENGINE_API SceneRendering
         PostFxProviders.Remove(obj);
     }
 
+    void AddOccluder(IOccluder* obj);
+    void RemoveOccluder(IOccluder* obj);
+
 #if USE_EDITOR
     template<class T, void(T::*Method)(RenderView&)>
     FORCE_INLINE void AddPhysicsDebug(T* obj)
@@ -188,6 +226,8 @@ class FLAXENGINE_API SceneRendering
     int64 _drawListSize;
     volatile int64 _drawListIndex;
     RenderContextBatch* _drawBatch;
+    Array<bool> _drawHLODProxies;
 
+    void DrawHLODProxies(RenderContextBatch& renderContextBatch, DrawCategory category);
     void DrawActorsJob(int32);
 };
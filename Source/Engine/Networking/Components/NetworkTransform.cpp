@@ -4,6 +4,7 @@
 
 #include "NetworkTransform.h"
 #include "Engine/Core/Math/Transform.h"
+#include "Engine/Engine/Engine.h"
 #include "Engine/Engine/Time.h"
 #include "Engine/Level/Actor.h"
 #include "Engine/Networking/NetworkManager.h"
@@ -59,12 +60,14 @@ void NetworkTransform::OnEnable()
 
     // Register for replication
     NetworkReplicator::AddObject(this);
+    Engine::Draw.Bind<NetworkTransform, &NetworkTransform::OnDraw>(this);
 }
 
 void NetworkTransform::OnDisable()
 {
     // Unregister from replication
     NetworkReplicator::RemoveObject(this);
+    Engine::Draw.Unbind<NetworkTransform, &NetworkTransform::OnDraw>(this);
 
     _buffer.Resize(0);
 }
@@ -106,43 +109,7 @@ void NetworkTransform::OnUpdate()
     }
     else
     {
-        float lag = 0.0f;
-        // TODO: use lag from last used NetworkStream context
-        if (NetworkManager::Peer && NetworkManager::Peer->NetworkDriver)
-        {
-            // Use lag from the RTT between server and the client
-            const auto stats = NetworkManager::Peer->NetworkDriver->GetStats();
-            lag = stats.RTT / 2000.0f;
-        }
-        else
-        {
-            // Default lag is based on the network manager update rate
-            const float fps = NetworkManager::NetworkFPS;
-            lag = 1.0f / fps;
-        }
-
-        // Find the two authoritative positions surrounding the rendering timestamp
-        const float now = Time::Update.UnscaledTime.GetTotalSeconds();
-        const float gameTime = now - lag;
-
-        // Drop older positions
-        while (_buffer.Count() >= 2 && _buffer[1].Timestamp <= gameTime)
-            _buffer.RemoveAtKeepOrder(0);
-
-        // Interpolate between the two surrounding authoritative positions
-        if (_buffer.Count() >= 2 && _buffer[0].Timestamp <= gameTime && gameTime <= _buffer[1].Timestamp)
-        {
-            const auto& b0 = _buffer[0];
-            const auto& b1 = _buffer[1];
-            Transform transform;
-            const float alpha = (gameTime - b0.Timestamp) / (b1.Timestamp - b0.Timestamp);
-            Transform::Lerp(b0.Value, b1.Value, alpha, transform);
-            Set(transform);
-        }
-        else if (_buffer.Count() == 1 && _buffer[0].Timestamp <= gameTime)
-        {
-            Set(_buffer[0].Value);
-        }
+        Interpolate(Time::Update.UnscaledTime.GetTotalSeconds());
     }
 }
 
@@ -352,3 +319,55 @@ void NetworkTransform::Set(const Transform& transform)
             parent->SetTransform(transform);
     }
 }
+
+void NetworkTransform::Interpolate(float now)
+{
+    float lag = 0.0f;
+    // TODO: use lag from last used NetworkStream context
+    if (NetworkManager::Peer && NetworkManager::Peer->NetworkDriver)
+    {
+        // Use lag from the RTT between server and the client
+        const auto stats = NetworkManager::Peer->NetworkDriver->GetStats();
+        lag = stats.RTT / 2000.0f;
+    }
+    else
+    {
+        // Default lag is based on the network manager update rate
+        const float fps = NetworkManager::NetworkFPS;
+        lag = 1.0f / fps;
+    }
+
+    // Find the two authoritative positions surrounding the rendering timestamp
+    const float gameTime = now - lag;
+
+    // Drop older positions
+    while (_buffer.Count() >= 2 && _buffer[1].Timestamp <= gameTime)
+        _buffer.RemoveAtKeepOrder(0);
+
+    // Interpolate between the two surrounding authoritative positions
+    if (_buffer.Count() >= 2 && _buffer[0].Timestamp <= gameTime && gameTime <= _buffer[1].Timestamp)
+    {
+        const auto& b0 = _buffer[0];
+        const auto& b1 = _buffer[1];
+        Transform transform;
+        const float alpha = (gameTime - b0.Timestamp) / (b1.Timestamp - b0.Timestamp);
+        Transform::Lerp(b0.Value, b1.Value, alpha, transform);
+        Set(transform);
+    }
+    else if (_buffer.Count() == 1 && _buffer[0].Timestamp <= gameTime)
+    {
+        Set(_buffer[0].Value);
+    }
+}
+
+void NetworkTransform::OnDraw()
+{
+    if (Mode != ReplicationModes::Interpolation || _bufferHasDeltas)
+        return;
+    if (NetworkReplicator::GetObjectRole(this) == NetworkObjectRole::OwnedAuthoritative)
+        return;
+
+    // Interpolate for the current frame time (smooths the movement when game logic updates at a lower rate than rendering)
+    const double sinceUpdate = Math::Max(Platform::GetTimeSeconds() - Time::Update.LastBegin, 0.0);
+    Interpolate((float)(Time::Update.UnscaledTime.GetTotalSeconds() + sinceUpdate));
+}
@@ -114,6 +114,8 @@ API_CLASS(Namespace="FlaxEngine.Networking") class FLAXENGINE_API NetworkTransfo
 
 private:
     void Set(const Transform& transform);
+    void Interpolate(float now);
+    void OnDraw();
 };
 
 DECLARE_ENUM_OPERATORS(NetworkTransform::ReplicationComponents);
@@ -18,6 +18,7 @@
 #include "Engine/Renderer/DrawCall.h"
 #include "Engine/Renderer/RenderList.h"
 #include "Engine/Threading/TaskGraph.h"
+#include "Engine/Threading/FastLock.h"
 #if COMPILE_WITH_GPU_PARTICLES
 #include "Engine/Threading/Threading.h"
 #include "Engine/Content/Assets/Shader.h"
@@ -98,7 +99,7 @@ struct EmitterCache
 
 namespace ParticleManagerImpl
 {
-    CriticalSection PoolLocker;
+    FastLock PoolLocker;
     Dictionary<ParticleEmitter*, Array<EmitterCache>> Pool;
     Array<ParticleEffect*> UpdateList;
 #if COMPILE_WITH_GPU_PARTICLES
@@ -127,7 +128,7 @@ class ParticleManagerService : public EngineService
 {
 public:
     ParticleManagerService()
-        : EngineService(TEXT("Particle Manager"), 65)
+        : EngineService(TEXT("Particle Manager"), 65, true)
     {
     }
 
@@ -148,6 +149,8 @@ ParticleManagerService ParticleManagerServiceInstance;
 
 void Particles::UpdateEffect(ParticleEffect* effect)
 {
+    if (!System)
+        return; // Particles are not simulated without rendering (dedicated server)
     UpdateList.Add(effect);
 }
 
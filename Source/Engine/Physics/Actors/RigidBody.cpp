@@ -2,11 +2,18 @@
 
 #include "RigidBody.h"
 #include "Engine/Core/Log.h"
+#include "Engine/Engine/Time.h"
 #include "Engine/Physics/Colliders/Collider.h"
 #include "Engine/Physics/PhysicsBackend.h"
 #include "Engine/Physics/PhysicsScene.h"
+#include "Engine/Profiler/ProfilerCPU.h"
 #include "Engine/Serialization/Serialization.h"
 
+namespace
+{
+    Array<RigidBody*> InterpolatedBodies;
+}
+
 RigidBody::RigidBody(const SpawnParams& params)
     : Actor(params)
     , _actor(nullptr)
@@ -26,6 +33,8 @@ RigidBody::RigidBody(const SpawnParams& params)
     , _updateMassWhenScaleChanges(false)
     , _overrideMass(false)
     , _isUpdatingTransform(false)
+    , _useInterpolation(false)
+    , _interpolationTick(0)
 {
 }
 
@@ -97,6 +106,25 @@ void RigidBody::SetStartAwake(bool value)
     _startAwake = value;
 }
 
+void RigidBody::SetUseInterpolation(bool value)
+{
+    if (value == GetUseInterpolation())
+        return;
+    _useInterpolation = value;
+    if (_actor)
+    {
+        if (value)
+        {
+            _interpolationStart = _interpolationEnd = _transform;
+            InterpolatedBodies.Add(this);
+        }
+        else
+        {
+            InterpolatedBodies.Remove(this);
+        }
+    }
+}
+
 void RigidBody::SetUpdateMassWhenScaleChanges(bool value)
 {
     _updateMassWhenScaleChanges = value;
@@ -370,6 +398,7 @@ void RigidBody::Serialize(SerializeStream& stream, const void* otherObj)
     SERIALIZE_BIT_MEMBER(EnableGravity, _enableGravity);
     SERIALIZE_BIT_MEMBER(StartAwake, _startAwake);
     SERIALIZE_BIT_MEMBER(UpdateMassWhenScaleChanges, _updateMassWhenScaleChanges);
+    SERIALIZE_BIT_MEMBER(UseInterpolation, _useInterpolation);
 }
 
 void RigidBody::Deserialize(DeserializeStream& stream, ISerializeModifier* modifier)
@@ -393,6 +422,12 @@ void RigidBody::Deserialize(DeserializeStream& stream, ISerializeModifier* modif
     DESERIALIZE_BIT_MEMBER(EnableGravity, _enableGravity);
     DESERIALIZE_BIT_MEMBER(StartAwake, _startAwake);
     DESERIALIZE_BIT_MEMBER(UpdateMassWhenScaleChanges, _updateMassWhenScaleChanges);
+    {
+        // Update the interpolated bodies registration (eg. on undo or prefab apply during play)
+        bool useInterpolation = GetUseInterpolation();
+        DESERIALIZE_MEMBER(UseInterpolation, useInterpolation);
+        SetUseInterpolation(useInterpolation);
+    }
 }
 
 void* RigidBody::GetPhysicsActor() const
@@ -402,12 +437,48 @@ void* RigidBody::GetPhysicsActor() const
 
 void RigidBody::OnActiveTransformChanged()
 {
-    // Change actor transform (but with locking)
-    ASSERT(!_isUpdatingTransform);
-    _isUpdatingTransform = true;
     Transform transform;
     PhysicsBackend::GetRigidActorPose(_actor, transform.Translation, transform.Orientation);
     transform.Scale = _transform.Scale;
+    if (_useInterpolation)
+    {
+        // Cache the simulation states to interpolate between them when drawing
+        _interpolationStart = _interpolationEnd;
+        _interpolationEnd = transform;
+        _interpolationTick = Time::Physics.TicksCount;
+    }
+    SetTransformFromPhysics(transform);
+}
+
+void RigidBody::InterpolateTransforms()
+{
+    if (InterpolatedBodies.IsEmpty() || !Time::PhysicsFixedTimestep)
+        return;
+    PROFILE_CPU();
+    const float alpha = Time::GetPhysicsInterpolationAlpha();
+    const uint64 tick = Time::Physics.TicksCount;
+    for (int32 i = 0; i < InterpolatedBodies.Count(); i++)
+    {
+        RigidBody* rigidBody = InterpolatedBodies[i];
+        if (rigidBody->_interpolationTick != tick)
+        {
+            // Rigidbody was not moved by the last simulation step (eg. sleeping)
+            rigidBody->_interpolationStart = rigidBody->_interpolationEnd;
+        }
+        Transform transform;
+        Vector3::Lerp(rigidBody->_interpolationStart.Translation, rigidBody->_interpolationEnd.Translation, alpha, transform.Translation);
+        Quaternion::Slerp(rigidBody->_interpolationStart.Orientation, rigidBody->_interpolationEnd.Orientation, alpha, transform.Orientation);
+        transform.Scale = rigidBody->_transform.Scale;
+        if (transform != rigidBody->_transform)
+            rigidBody->SetTransformFromPhysics(transform);
+    }
+}
+
+void RigidBody::SetTransformFromPhysics(const Transform& transform)
+{
+    // Change actor transform (but with locking)
+    ASSERT(!_isUpdatingTransform);
+    _isUpdatingTransform = true;
     if (_parent)
     {
         _parent->GetTransform().WorldToLocal(transform, _localTransform);
@@ -470,6 +541,11 @@ void RigidBody::BeginPlay(SceneBeginData* data)
 
     // Update cached data
     UpdateBounds();
+    if (_useInterpolation)
+    {
+        _interpolationStart = _interpolationEnd = _transform;
+        InterpolatedBodies.Add(this);
+    }
 
     // Base
     Actor::BeginPlay(data);
@@ -482,6 +558,8 @@ void RigidBody::EndPlay()
 
     if (_actor)
     {
+        InterpolatedBodies.Remove(this);
+
         // Remove actor
         void* scene = GetPhysicsScene()->GetPhysicsScene();
         PhysicsBackend::RemoveSceneActor(scene, _actor);
@@ -520,6 +598,9 @@ void RigidBody::OnTransformChanged()
         const bool kinematic = GetIsKinematic() && GetEnableSimulation();
         PhysicsBackend::SetRigidActorPose(_actor, _transform.Translation, _transform.Orientation, kinematic, true);
         UpdateScale();
+
+        // Teleport without interpolation
+        _interpolationStart = _interpolationEnd = _transform;
     }
 
     UpdateBounds();
@@ -38,6 +38,11 @@ class FLAXENGINE_API RigidBody : public Actor, public IPhysicsActor
     int32 _updateMassWhenScaleChanges : 1;
     int32 _overrideMass : 1;
     int32 _isUpdatingTransform : 1;
+    int32 _useInterpolation : 1;
+
+    uint64 _interpolationTick;
+    Transform _interpolationStart;
+    Transform _interpolationEnd;
 
 public:
     /// <summary>
@@ -276,6 +281,21 @@ class FLAXENGINE_API RigidBody : public Actor, public IPhysicsActor
     /// <param name="value">The value.</param>
     API_PROPERTY() void SetConstraints(const RigidbodyConstraints value);
 
+    /// <summary>
+    /// If checked, the rigidbody transformation will be interpolated between the last two physics simulation steps when drawing. Smooths the movement when physics is simulated at a lower rate than rendering. Requires the fixed physics timestep (see Time.PhysicsFixedTimestep).
+    /// </summary>
+    API_PROPERTY(Attributes="EditorOrder(160), DefaultValue(false), EditorDisplay(\"Rigid Body\")")
+    FORCE_INLINE bool GetUseInterpolation() const
+    {
+        return _useInterpolation != 0;
+    }
+
+    /// <summary>
+    /// If checked, the rigidbody transformation will be interpolated between the last two physics simulation steps when drawing. Smooths the movement when physics is simulated at a lower rate than rendering. Requires the fixed physics timestep (see Time.PhysicsFixedTimestep).
+    /// </summary>
+    /// <param name="value">The value.</param>
+    API_PROPERTY() void SetUseInterpolation(bool value);
+
 public:
     /// <summary>
     /// Gets the linear velocity of the rigidbody.
@@ -519,6 +539,14 @@ class FLAXENGINE_API RigidBody : public Actor, public IPhysicsActor
     /// </summary>
     void UpdateScale();
 
+    /// <summary>
+    /// Interpolates the transformation of the rigidbodies with interpolation enabled between the last two physics simulation steps (called before drawing the frame).
+    /// </summary>
+    static void InterpolateTransforms();
+
+private:
+    void SetTransformFromPhysics(const Transform& transform);
+
 public:
     // [Actor]
     void Serialize(SerializeStream& stream, const void* otherObj) override;
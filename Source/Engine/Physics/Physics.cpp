@@ -6,6 +6,7 @@
 #include "PhysicalMaterial.h"
 #include "PhysicsSettings.h"
 #include "PhysicsStatistics.h"
+#include "Actors/RigidBody.h"
 #include "Engine/Engine/Time.h"
 #include "Engine/Engine/EngineService.h"
 #include "Engine/Profiler/ProfilerCPU.h"
@@ -28,6 +29,7 @@ class PhysicsService : public EngineService
 
     bool Init() override;
     void LateUpdate() override;
+    void Draw() override;
     void Dispose() override;
 };
 
@@ -105,6 +107,11 @@ void PhysicsService::LateUpdate()
     Physics::FlushRequests();
 }
 
+void PhysicsService::Draw()
+{
+    RigidBody::InterpolateTransforms();
+}
+
 void PhysicsService::Dispose()
 {
     // Ensure to finish (wait for simulation end)
@@ -726,6 +726,17 @@ void AndroidPlatform::Sleep(int32 milliseconds)
     usleep(milliseconds * 1000);
 }
 
+void AndroidPlatform::SleepUntil(double time)
+{
+    // Sleep to the absolute time to not accumulate the wake up latency
+    struct timespec ts;
+    ts.tv_sec = (time_t)time;
+    ts.tv_nsec = Math::Clamp((long)((time - (double)ts.tv_sec) * 1e9), 0L, 999999999L);
+    while (clock_nanosleep(ClockSource, TIMER_ABSTIME, &ts, nullptr) == EINTR)
+    {
+    }
+}
+
 double AndroidPlatform::GetTimeSeconds()
 {
     struct timespec ts;
@@ -91,6 +91,7 @@ class FLAXENGINE_API AndroidPlatform : public UnixPlatform
     static void SetThreadPriority(ThreadPriority priority);
     static void SetThreadAffinityMask(uint64 affinityMask);
     static void Sleep(int32 milliseconds);
+    static void SleepUntil(double time);
     static double GetTimeSeconds();
     static uint64 GetTimeCycles();
     FORCE_INLINE static uint64 GetClockFrequency()
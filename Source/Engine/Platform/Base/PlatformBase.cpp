@@ -190,6 +190,12 @@ void PlatformBase::Exit()
 
 #define TRACY_ENABLE_MEMORY (TRACY_ENABLE)
 
+void PlatformBase::SleepUntil(double time)
+{
+    while (time - Platform::GetTimeSeconds() > 0.001)
+        Platform::Sleep(1);
+}
+
 void PlatformBase::OnMemoryAlloc(void* ptr, uint64 size)
 {
     if (!ptr)
@@ -406,6 +406,12 @@ DECLARE_SCRIPTING_TYPE_MINIMAL(PlatformBase);
     /// <param name="milliseconds">The time interval for which execution is to be suspended, in milliseconds.</param>
     static void Sleep(int32 milliseconds) = delete;
 
+    /// <summary>
+    /// Suspends the execution of the current thread until the given time. Platforms without high-resolution sleep may return up to a millisecond before that time.
+    /// </summary>
+    /// <param name="time">The time to wake up at (in seconds, the same time base as <see cref="GetTimeSeconds"/>).</param>
+    static void SleepUntil(double time);
+
 public:
     /// <summary>
     /// Gets the current time in seconds.
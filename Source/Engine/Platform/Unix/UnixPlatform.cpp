@@ -5,6 +5,7 @@
 #include "Engine/Platform/Platform.h"
 #include <sys/types.h>
 #include <unistd.h>
+#include <sys/mman.h>
 #include <cstdint>
 #include <stdlib.h>
 
@@ -55,6 +56,32 @@ void UnixPlatform::Free(void* ptr)
     }
 }
 
+void* UnixPlatform::AllocatePages(uint64 numPages, uint64 pageSize)
+{
+    // Map the extra system page in front of the memory to store the mapping size (needed to unmap it)
+    const uint64 headerSize = (uint64)getpagesize();
+    const uint64 size = headerSize + numPages * pageSize;
+    void* base = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (base == MAP_FAILED)
+        return nullptr;
+#ifdef MADV_HUGEPAGE
+    // Back the large allocations with the transparent huge pages
+    if (size >= 2 * 1024 * 1024)
+        madvise(base, size, MADV_HUGEPAGE);
+#endif
+    *(uint64*)base = size;
+    return (byte*)base + headerSize;
+}
+
+void UnixPlatform::FreePages(void* ptr)
+{
+    if (ptr)
+    {
+        void* base = (byte*)ptr - getpagesize();
+        munmap(base, *(uint64*)base);
+    }
+}
+
 uint64 UnixPlatform::GetCurrentProcessId()
 {
     return getpid();
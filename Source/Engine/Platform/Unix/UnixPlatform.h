@@ -16,6 +16,8 @@ class FLAXENGINE_API UnixPlatform : public PlatformBase
     // [PlatformBase]
     static void* Allocate(uint64 size, uint64 alignment);
     static void Free(void* ptr);
+    static void* AllocatePages(uint64 numPages, uint64 pageSize);
+    static void FreePages(void* ptr);
     static uint64 GetCurrentProcessId();
 };
 
@@ -38,6 +38,21 @@ API_STRUCT() struct RenderStatsData
     /// </summary>
     API_FIELD() int64 PipelineStateChanges;
 
+    /// <summary>
+    /// The descriptor sets allocations count (Vulkan only).
+    /// </summary>
+    API_FIELD() int64 DescriptorSetAllocations;
+
+    /// <summary>
+    /// The descriptor sets updates count (Vulkan only). Descriptor sets reused from the cache are not counted.
+    /// </summary>
+    API_FIELD() int64 DescriptorSetUpdates;
+
+    /// <summary>
+    /// The objects (actors, draw calls or foliage clusters) count culled by the CPU occlusion culling.
+    /// </summary>
+    API_FIELD() int64 OccludedObjects;
+
     /// <summary>
     /// Initializes a new instance of the <see cref="RenderStatsData"/> struct.
     /// </summary>
@@ -47,6 +62,9 @@ API_STRUCT() struct RenderStatsData
         , Vertices(0)
         , Triangles(0)
         , PipelineStateChanges(0)
+        , DescriptorSetAllocations(0)
+        , DescriptorSetUpdates(0)
+        , OccludedObjects(0)
     {
     }
 
@@ -67,12 +85,18 @@ API_STRUCT() struct RenderStatsData
         MIX(Vertices);
         MIX(Triangles);
         MIX(PipelineStateChanges);
+        MIX(DescriptorSetAllocations);
+        MIX(DescriptorSetUpdates);
+        MIX(OccludedObjects);
 #undef MIX
     }
 };
 
 #define RENDER_STAT_DISPATCH_CALL() Platform::InterlockedIncrement(&RenderStatsData::Counter.DispatchCalls)
 #define RENDER_STAT_PS_STATE_CHANGE() Platform::InterlockedIncrement(&RenderStatsData::Counter.PipelineStateChanges)
+#define RENDER_STAT_DESCRIPTOR_SET_ALLOCATION(count) Platform::InterlockedAdd(&RenderStatsData::Counter.DescriptorSetAllocations, count)
+#define RENDER_STAT_DESCRIPTOR_SET_UPDATE(count) Platform::InterlockedAdd(&RenderStatsData::Counter.DescriptorSetUpdates, count)
+#define RENDER_STAT_OCCLUDED_OBJECT() Platform::InterlockedIncrement(&RenderStatsData::Counter.OccludedObjects)
 #define RENDER_STAT_DRAW_CALL(vertices, triangles) \
 	Platform::InterlockedIncrement(&RenderStatsData::Counter.DrawCalls); \
 	Platform::InterlockedAdd(&RenderStatsData::Counter.Vertices, vertices); \
@@ -82,6 +106,9 @@ API_STRUCT() struct RenderStatsData
 
 #define RENDER_STAT_DISPATCH_CALL()
 #define RENDER_STAT_PS_STATE_CHANGE()
+#define RENDER_STAT_DESCRIPTOR_SET_ALLOCATION(count)
+#define RENDER_STAT_DESCRIPTOR_SET_UPDATE(count)
+#define RENDER_STAT_OCCLUDED_OBJECT()
 #define RENDER_STAT_DRAW_CALL(vertices, primitives)
 
 #endif
@@ -118,7 +118,7 @@ class AtmospherePreComputeService : public EngineService
 public:
 
     AtmospherePreComputeService()
-        : EngineService(TEXT("Atmosphere Pre Compute"), 50)
+        : EngineService(TEXT("Atmosphere Pre Compute"), 50, true)
     {
     }
 
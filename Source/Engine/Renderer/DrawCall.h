@@ -146,6 +146,11 @@ struct DrawCall
     /// </summary>
     int32 InstanceCount;
 
+    /// <summary>
+    /// The index of the object data in the render list objects buffer (see RenderList::Objects) or -1 if not used. Set by RenderList when adding draw call.
+    /// </summary>
+    int32 ObjectIndex;
+
     union
     {
         struct
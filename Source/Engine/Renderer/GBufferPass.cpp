@@ -11,6 +11,7 @@
 #include "Engine/Core/Collections/Sorting.h"
 #include "Engine/Graphics/GPUDevice.h"
 #include "Engine/Graphics/GPUContext.h"
+#include "Engine/Graphics/DynamicBuffer.h"
 #include "Engine/Graphics/Shaders/GPUShader.h"
 #include "Engine/Graphics/RenderTask.h"
 #include "Engine/Graphics/RenderBuffers.h"
@@ -27,6 +28,21 @@ PACK_STRUCT(struct GBufferPassData{
     int32 ViewMode;
     });
 
+PACK_STRUCT(struct GBufferPassImpostorsData{
+    Matrix ViewProjectionMatrix;
+    Float3 ViewWorldPos;
+    uint32 InstanceOffset;
+    });
+
+PACK_STRUCT(struct GBufferPassImpostorData{
+    Float3 Position;
+    float Radius;
+    Quaternion Orientation;
+    float Fade;
+    float Frames;
+    Float2 Dummy0;
+    });
+
 #if USE_EDITOR
 Dictionary<GPUBuffer*, const ModelLOD*> GBufferPass::IndexBufferToModelLOD;
 CriticalSection GBufferPass::Locker;
@@ -41,6 +57,7 @@ bool GBufferPass::Init()
 {
     // Create pipeline state
     _psDebug = GPUDevice::Instance->CreatePipelineState();
+    _psImpostor = GPUDevice::Instance->CreatePipelineState();
 
     // Load assets
     _gBufferShader = Content::LoadAsyncInternal<Shader>(TEXT("Shaders/GBuffer"));
@@ -69,7 +86,7 @@ bool GBufferPass::setupResources()
     auto gbuffer = _gBufferShader->GetShader();
 
     // Validate shader constant buffers sizes
-    if (gbuffer->GetCB(0)->GetSize() != sizeof(GBufferPassData))
+    if (gbuffer->GetCB(0)->GetSize() != sizeof(GBufferPassData) || gbuffer->GetCB(1)->GetSize() != sizeof(GBufferPassImpostorsData))
     {
         LOG(Warning, "GBuffer shader has incorrct constant buffers sizes.");
         return true;
@@ -83,6 +100,15 @@ bool GBufferPass::setupResources()
         if (_psDebug->Init(psDesc))
             return true;
     }
+    if (!_psImpostor->IsValid())
+    {
+        psDesc = GPUPipelineState::Description::Default;
+        psDesc.CullMode = CullMode::TwoSided;
+        psDesc.VS = gbuffer->GetVS("VS_Impostor");
+        psDesc.PS = gbuffer->GetPS("PS_Impostor");
+        if (_psImpostor->Init(psDesc))
+            return true;
+    }
 
     return false;
 }
@@ -94,6 +120,8 @@ void GBufferPass::Dispose()
 
     // Cleanup
     SAFE_DELETE_GPU_RESOURCE(_psDebug);
+    SAFE_DELETE_GPU_RESOURCE(_psImpostor);
+    SAFE_DELETE(_impostorsBuffer);
     _gBufferShader = nullptr;
     _skyModel = nullptr;
     _boxModel = nullptr;
@@ -207,6 +235,9 @@ void GBufferPass::Fill(RenderContext& renderContext, GPUTexture* lightBuffer)
     context->SetRenderTarget(*renderContext.Buffers->DepthBuffer, ToSpan(targetBuffers, ARRAY_COUNT(targetBuffers)));
     renderContext.List->ExecuteDrawCalls(renderContext, DrawCallsListType::GBuffer);
 
+    // Draw impostors (distant models)
+    DrawImpostors(renderContext, context);
+
     // Draw decals
     DrawDecals(renderContext, lightBuffer->View());
 
@@ -233,6 +264,11 @@ bool SortDecal(Decal* const& a, Decal* const& b)
     return a->SortOrder < b->SortOrder;
 }
 
+bool SortImpostor(const RendererImpostorData& a, const RendererImpostorData& b)
+{
+    return a.Albedo < b.Albedo || (a.Albedo == b.Albedo && a.Normal < b.Normal);
+}
+
 void GBufferPass::RenderDebug(RenderContext& renderContext)
 {
     // Check if has resources loaded
@@ -426,6 +462,61 @@ void GBufferPass::DrawSky(RenderContext& renderContext, GPUContext* context)
     model->Render(context);
 }
 
+void GBufferPass::DrawImpostors(RenderContext& renderContext, GPUContext* context)
+{
+    // Skip if no impostors to render
+    auto& impostors = renderContext.List->Impostors;
+    const int32 count = impostors.Count();
+    if (count == 0 || !_psImpostor->IsValid())
+        return;
+
+    PROFILE_GPU_CPU("Impostors");
+
+    // Sort impostors by the atlas textures to draw them in batches
+    Sorting::QuickSort(impostors.Get(), count, &SortImpostor);
+
+    // Upload instances data
+    if (!_impostorsBuffer)
+        _impostorsBuffer = New<DynamicStructuredBuffer>(64u * (uint32)sizeof(GBufferPassImpostorData), (uint32)sizeof(GBufferPassImpostorData), false, TEXT("GBuffer.Impostors"));
+    _impostorsBuffer->Clear();
+    for (int32 i = 0; i < count; i++)
+    {
+        const RendererImpostorData& impostor = impostors.Get()[i];
+        GBufferPassImpostorData data;
+        data.Position = impostor.Position;
+        data.Radius = impostor.Radius;
+        data.Orientation = impostor.Orientation;
+        data.Fade = impostor.Fade;
+        data.Frames = (float)impostor.Frames;
+        data.Dummy0 = Float2::Zero;
+        _impostorsBuffer->Write(data);
+    }
+    _impostorsBuffer->Flush(context);
+
+    // Draw all instances that share the same atlases with a single draw call
+    GBufferPassImpostorsData data;
+    Matrix::Transpose(renderContext.View.ViewProjection(), data.ViewProjectionMatrix);
+    data.ViewWorldPos = renderContext.View.Position;
+    auto cb = _gBufferShader->GetShader()->GetCB(1);
+    context->SetState(_psImpostor);
+    context->BindSR(7, _impostorsBuffer->GetBuffer()->View());
+    for (int32 start = 0; start < count;)
+    {
+        const RendererImpostorData& first = impostors.Get()[start];
+        int32 end = start + 1;
+        while (end < count && impostors.Get()[end].Albedo == first.Albedo && impostors.Get()[end].Normal == first.Normal)
+            end++;
+        data.InstanceOffset = start;
+        context->UpdateCB(cb, &data);
+        context->BindCB(1, cb);
+        context->BindSR(5, first.Albedo);
+        context->BindSR(6, first.Normal);
+        context->DrawInstanced(6, end - start);
+        start = end;
+    }
+    context->ResetSR();
+}
+
 void GBufferPass::DrawDecals(RenderContext& renderContext, GPUTextureView* lightBuffer)
 {
     // Skip if no decals to render
@@ -16,6 +16,8 @@ class GBufferPass : public RendererPass<GBufferPass>
 
     AssetReference<Shader> _gBufferShader;
     GPUPipelineState* _psDebug = nullptr;
+    GPUPipelineState* _psImpostor = nullptr;
+    class DynamicStructuredBuffer* _impostorsBuffer = nullptr;
     AssetReference<Model> _skyModel;
     AssetReference<Model> _boxModel;
 #if USE_EDITOR
@@ -79,11 +81,13 @@ class GBufferPass : public RendererPass<GBufferPass>
 
     void DrawSky(RenderContext& renderContext, GPUContext* context);
     void DrawDecals(RenderContext& renderContext, GPUTextureView* lightBuffer);
+    void DrawImpostors(RenderContext& renderContext, GPUContext* context);
 
 #if COMPILE_WITH_DEV_ENV
     void OnShaderReloading(Asset* obj)
     {
         _psDebug->ReleaseGPU();
+        _psImpostor->ReleaseGPU();
         invalidateResources();
     }
 #endif
@@ -0,0 +1,460 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#if USE_EDITOR
+
+#include "ImpostorsRenderer.h"
+#include "Renderer.h"
+#include "Engine/Core/Log.h"
+#include "Engine/Core/Types/StringView.h"
+#include "Engine/Threading/Threading.h"
+#include "Engine/Threading/ThreadPoolTask.h"
+#include "Engine/Content/Content.h"
+#include "Engine/Content/Assets/Model.h"
+#include "Engine/Engine/Engine.h"
+#include "Engine/Engine/EngineService.h"
+#include "Engine/Foliage/Foliage.h"
+#include "Engine/Foliage/FoliageType.h"
+#include "Engine/Level/Level.h"
+#include "Engine/Level/Actors/StaticModel.h"
+#include "Engine/Graphics/GPUDevice.h"
+#include "Engine/Graphics/GPUContext.h"
+#include "Engine/Graphics/RenderTask.h"
+#include "Engine/Graphics/RenderBuffers.h"
+#include "Engine/Graphics/Models/ModelImpostor.h"
+#include "Engine/Graphics/Textures/GPUTexture.h"
+#include "Engine/Graphics/Textures/TextureData.h"
+#include "Engine/Profiler/Profiler.h"
+#if COMPILE_WITH_ASSETS_IMPORTER
+#include "Engine/ContentImporters/AssetsImportingManager.h"
+#include "Engine/ContentImporters/ImportTexture.h"
+#endif
+
+// The captured atlases (depth is copied from the depth buffer after rendering the normals)
+#define IMPOSTORS_ATLAS_ALBEDO 0
+#define IMPOSTORS_ATLAS_NORMAL 1
+#define IMPOSTORS_ATLAS_DEPTH 2
+#define IMPOSTORS_ATLAS_COUNT 3
+
+namespace ImpostorsRendererImpl
+{
+    Array<ImpostorsRenderer::Entry> _queue;
+    ImpostorsRenderer::Entry _current;
+    bool _isBaking = false;
+    volatile int64 _isDownloading = 0;
+
+    SceneRenderTask* _task = nullptr;
+    GPUTexture* _output = nullptr;
+    GPUTexture* _atlases[IMPOSTORS_ATLAS_COUNT] = {};
+    uint64 _updateFrameNumber = 0;
+
+    bool _drawPending = false;
+    Model* _drawModel = nullptr;
+    ModelInstanceEntries* _drawEntries = nullptr;
+    GeometryDrawStateData _drawState;
+
+    FORCE_INLINE bool isUpdateSynced()
+    {
+        return _updateFrameNumber > 0 && _updateFrameNumber + IMPOSTORS_RENDERER_LATENCY_FRAMES <= Engine::FrameCount;
+    }
+
+    bool GetTarget(const ImpostorsRenderer::Entry& entry, Model*& model, ModelInstanceEntries*& entries, ModelImpostor*& impostor)
+    {
+        if (entry.FoliageTypeIndex == -1)
+        {
+            auto staticModel = ScriptingObject::Cast<StaticModel>(entry.Actor.Get());
+            if (!staticModel || !staticModel->Model)
+                return false;
+            model = staticModel->Model.Get();
+            entries = &staticModel->Entries;
+            impostor = &staticModel->Impostor;
+        }
+        else
+        {
+            auto foliage = ScriptingObject::Cast<Foliage>(entry.Actor.Get());
+            auto type = foliage ? foliage->GetFoliageType(entry.FoliageTypeIndex) : nullptr;
+            if (!type || !type->Model)
+                return false;
+            model = type->Model.Get();
+            entries = &type->Entries;
+            impostor = &type->Impostor;
+        }
+        return true;
+    }
+
+    // Matches GetOctahedralDirection from Octahedral.hlsl
+    Float3 GetOctahedralDirection(const Float2& coords)
+    {
+        Float3 direction(coords.X, coords.Y, 1.0f - Math::Abs(coords.X) - Math::Abs(coords.Y));
+        if (direction.Z < 0.0f)
+        {
+            const float x = (1.0f - Math::Abs(direction.Y)) * (direction.X >= 0.0f ? 1.0f : -1.0f);
+            const float y = (1.0f - Math::Abs(direction.X)) * (direction.Y >= 0.0f ? 1.0f : -1.0f);
+            direction.X = x;
+            direction.Y = y;
+        }
+        return Float3::Normalize(direction);
+    }
+}
+
+using namespace ImpostorsRendererImpl;
+
+/// <summary>
+/// Custom task called after downloading impostor atlases to compose and import them.
+/// </summary>
+class DownloadImpostorTask : public ThreadPoolTask
+{
+private:
+    ImpostorsRenderer::Entry _entry;
+
+public:
+    TextureData Data[IMPOSTORS_ATLAS_COUNT];
+
+    DownloadImpostorTask(const ImpostorsRenderer::Entry& entry)
+        : _entry(entry)
+    {
+    }
+
+    ~DownloadImpostorTask()
+    {
+        Platform::AtomicStore(&_isDownloading, 0);
+    }
+
+    bool ComposeAtlas(TextureData& image, bool albedo) const
+    {
+        const TextureData& src = Data[albedo ? IMPOSTORS_ATLAS_ALBEDO : IMPOSTORS_ATLAS_NORMAL];
+        const TextureMipData* srcMip = src.GetData(0, 0);
+        const TextureMipData* depthMip = Data[IMPOSTORS_ATLAS_DEPTH].GetData(0, 0);
+
+        // Setup image
+        image.Width = src.Width;
+        image.Height = src.Height;
+        image.Depth = 1;
+        image.Format = PixelFormat::R8G8B8A8_UNorm;
+        image.Items.Resize(1);
+        image.Items[0].Mips.Resize(1);
+        auto& mip = image.Items[0].Mips[0];
+        mip.RowPitch = image.Width * sizeof(Color32);
+        mip.DepthPitch = mip.RowPitch * image.Height;
+        mip.Lines = image.Height;
+        mip.Data.Allocate(mip.DepthPitch);
+
+        // Albedo atlas stores opacity in alpha (background has the far plane depth), normals atlas stores depth in alpha
+        for (int32 y = 0; y < image.Height; y++)
+        {
+            for (int32 x = 0; x < image.Width; x++)
+            {
+                const byte depth = depthMip->Get<Color32>(x, y).R;
+                Color32 color = srcMip->Get<Color32>(x, y);
+                color.A = albedo ? (depth < 255 ? 255 : 0) : depth;
+                mip.Get<Color32>(x, y) = color;
+            }
+        }
+        return false;
+    }
+
+    bool Run() override
+    {
+        for (const TextureData& data : Data)
+        {
+            if (data.GetArraySize() != 1 || data.Format != PixelFormat::R8G8B8A8_UNorm || data.Width != Data[0].Width || data.Height != Data[0].Height)
+            {
+                LOG(Error, "Invalid impostor atlas data.");
+                return true;
+            }
+        }
+#if COMPILE_WITH_ASSETS_IMPORTER
+        Model* model;
+        ModelInstanceEntries* entries;
+        ModelImpostor* impostor;
+        String basePath;
+        Guid albedoId, normalId;
+        {
+            ScopeLock lock(Level::ScenesLock);
+            if (!GetTarget(_entry, model, entries, impostor))
+                return true;
+            if (model->IsVirtual())
+            {
+                LOG(Warning, "Cannot bake impostor for virtual model {0}.", model->ToString());
+                return true;
+            }
+            basePath = String(StringUtils::GetPathWithoutExtension(model->GetPath()));
+            albedoId = impostor->Albedo.GetID();
+            normalId = impostor->Normal.GetID();
+        }
+
+        // Import atlases next to the model asset (reuse the existing asset identifiers)
+        ImportTexture::Options options;
+        options.Type = TextureFormatType::ColorRGBA;
+        options.IsAtlas = false;
+        options.sRGB = false;
+        options.NeverStream = false;
+        options.GenerateMipMaps = true;
+        options.Compress = true;
+        options.InternalLoad.Bind([this](TextureData& image)
+        {
+            return ComposeAtlas(image, true);
+        });
+        if (AssetsImportingManager::Create(AssetsImportingManager::CreateTextureTag, basePath + TEXT("_ImpostorAlbedo") + ASSET_FILES_EXTENSION_WITH_DOT, albedoId, &options))
+        {
+            LOG(Error, "Cannot import impostor albedo atlas for {0}.", basePath);
+            return true;
+        }
+        options.Compress = false; // Keep the depth precision
+        options.InternalLoad.Bind([this](TextureData& image)
+        {
+            return ComposeAtlas(image, false);
+        });
+        if (AssetsImportingManager::Create(AssetsImportingManager::CreateTextureTag, basePath + TEXT("_ImpostorNormal") + ASSET_FILES_EXTENSION_WITH_DOT, normalId, &options))
+        {
+            LOG(Error, "Cannot import impostor normal atlas for {0}.", basePath);
+            return true;
+        }
+
+        // Link atlases
+        {
+            ScopeLock lock(Level::ScenesLock);
+            if (!GetTarget(_entry, model, entries, impostor))
+                return true;
+            impostor->Albedo = Content::LoadAsync<Texture>(albedoId);
+            impostor->Normal = Content::LoadAsync<Texture>(normalId);
+            impostor->Frames = _entry.Frames;
+        }
+        ImpostorsRenderer::OnFinishBake(_entry);
+        return false;
+#else
+        LOG(Warning, "Baking impostors is not supported.");
+        return true;
+#endif
+    }
+};
+
+class ImpostorsRendererService : public EngineService
+{
+public:
+    ImpostorsRendererService()
+        : EngineService(TEXT("Impostors Renderer"), 70, true)
+    {
+    }
+
+    void Update() override;
+    void Dispose() override;
+};
+
+ImpostorsRendererService ImpostorsRendererServiceInstance;
+
+Delegate<const ImpostorsRenderer::Entry&> ImpostorsRenderer::OnFinishBake;
+
+int32 ImpostorsRenderer::GetBakeQueueSize()
+{
+    return _queue.Count() + (_isBaking ? 1 : 0);
+}
+
+void ImpostorsRenderer::Bake(StaticModel* actor, int32 frames, int32 resolution)
+{
+    if (!actor)
+        return;
+    Entry e;
+    e.Actor = actor;
+    e.Frames = Math::Clamp(frames, 2, 32);
+    e.Resolution = Math::Clamp(resolution, 16, 1024);
+    _queue.Add(e);
+}
+
+void ImpostorsRenderer::Bake(Foliage* foliage, int32 foliageTypeIndex, int32 frames, int32 resolution)
+{
+    if (!foliage || foliageTypeIndex < 0 || foliageTypeIndex >= foliage->GetFoliageTypesCount())
+        return;
+    Entry e;
+    e.Actor = foliage;
+    e.FoliageTypeIndex = foliageTypeIndex;
+    e.Frames = Math::Clamp(frames, 2, 32);
+    e.Resolution = Math::Clamp(resolution, 16, 1024);
+    _queue.Add(e);
+}
+
+void ImpostorsRenderer::Release()
+{
+    ASSERT(_updateFrameNumber == 0);
+    SAFE_DELETE(_task);
+    SAFE_DELETE_GPU_RESOURCE(_output);
+    for (auto& atlas : _atlases)
+        SAFE_DELETE_GPU_RESOURCE(atlas);
+}
+
+void ImpostorsRendererService::Update()
+{
+    // Check if render job is done
+    if (isUpdateSynced())
+    {
+        // Create async job to gather atlases from the GPU
+        auto taskB = New<DownloadImpostorTask>(_current);
+        Task* taskA = nullptr;
+        for (int32 i = IMPOSTORS_ATLAS_COUNT - 1; i >= 0; i--)
+        {
+            Task* task = _atlases[i]->DownloadDataAsync(taskB->Data[i]);
+            if (task == nullptr)
+            {
+                LOG(Fatal, "Failed to create async task to download impostor atlas data from the GPU.");
+            }
+            task->ContinueWith(taskA ? taskA : taskB);
+            taskA = task;
+        }
+        Platform::AtomicStore(&_isDownloading, 1);
+        taskA->Start();
+
+        // Clear flag
+        _updateFrameNumber = 0;
+        _isBaking = false;
+    }
+    else if (!_isBaking && _queue.HasItems() && Platform::AtomicRead(&_isDownloading) == 0)
+    {
+        // Init service
+        if (!_task)
+        {
+            _output = GPUDevice::Instance->CreateTexture(TEXT("Impostors.Output"));
+            for (auto& atlas : _atlases)
+                atlas = GPUDevice::Instance->CreateTexture(TEXT("Impostors.Atlas"));
+            _task = New<SceneRenderTask>();
+            _task->Enabled = false;
+            _task->IsCustomRendering = true;
+            _task->ActorsSource = ActorsSources::None;
+            _task->Output = _output;
+            auto& view = _task->View;
+            view.Flags = ViewFlags::None;
+            view.IsOfflinePass = true;
+            view.IsSingleFrame = true;
+            view.Origin = Vector3::Zero;
+            _task->Render.Bind(ImpostorsRenderer::OnRender);
+            _task->CollectDrawCalls.Bind(ImpostorsRenderer::OnCollectDrawCalls);
+        }
+
+        // Pick the next impostor to bake
+        _current = _queue[0];
+        _queue.RemoveAtKeepOrder(0);
+        _isBaking = true;
+        _task->Enabled = true;
+        _updateFrameNumber = 0;
+    }
+}
+
+void ImpostorsRendererService::Dispose()
+{
+    _queue.Clear();
+    _updateFrameNumber = 0;
+    ImpostorsRenderer::Release();
+}
+
+void ImpostorsRenderer::OnRender(RenderTask* task, GPUContext* context)
+{
+    ASSERT(_isBaking && _updateFrameNumber == 0);
+    _task->Enabled = false;
+    Model* model;
+    ModelInstanceEntries* entries;
+    ModelImpostor* impostor;
+    if (!GetTarget(_current, model, entries, impostor) || !model->CanBeRendered())
+    {
+        // Target has been unlinked (or deleted) or model is not ready
+        LOG(Warning, "Cannot bake impostor. Missing or not loaded model.");
+        _isBaking = false;
+        return;
+    }
+    PROFILE_GPU_CPU("Render Impostor");
+
+    // Resize buffers
+    const int32 frames = _current.Frames;
+    const int32 resolution = _current.Resolution;
+    bool resizeFailed = _output->Resize(resolution, resolution, PixelFormat::R8G8B8A8_UNorm);
+    for (auto& atlas : _atlases)
+        resizeFailed |= atlas->Resize(resolution * frames, resolution * frames, PixelFormat::R8G8B8A8_UNorm);
+    resizeFailed |= _task->Resize(resolution, resolution);
+    if (resizeFailed)
+    {
+        LOG(Error, "Failed to resize impostor atlases");
+        _isBaking = false;
+        return;
+    }
+    _drawModel = model;
+    _drawEntries = entries;
+
+    // Capture model from the directions around it using orthographic projection that fits the model bounds (model is drawn at the origin)
+    BoundingSphere sphere;
+    BoundingSphere::FromBox(model->GetBox(), sphere);
+    const Float3 center = sphere.Center;
+    const float radius = Math::Max((float)sphere.Radius, 0.01f);
+    Matrix view, projection;
+    Matrix::Ortho(radius * 2.0f, radius * 2.0f, radius, radius * 3.0f, projection);
+    auto& renderView = _task->View;
+    for (int32 y = 0; y < frames; y++)
+    {
+        for (int32 x = 0; x < frames; x++)
+        {
+            // Setup view (the same basis is used by the impostor shader to build the quad)
+            const Float3 direction = GetOctahedralDirection(Float2((float)x, (float)y) / (float)(frames - 1) * 2.0f - 1.0f);
+            const Float3 position = center + direction * (radius * 2.0f);
+            Matrix::LookAt(position, center, Math::Abs(direction.Y) > 0.999f ? Float3::Forward : Float3::Up, view);
+            renderView.Position = position;
+            renderView.Direction = -direction;
+            renderView.Near = radius;
+            renderView.Far = radius * 3.0f;
+            renderView.SetUp(view, projection);
+            _task->CameraCut();
+            const Viewport viewport((float)(x * resolution), (float)(y * resolution), (float)resolution, (float)resolution);
+
+            // Render the base color and normals (GBuffer debug views)
+            for (int32 atlasIndex = IMPOSTORS_ATLAS_ALBEDO; atlasIndex <= IMPOSTORS_ATLAS_NORMAL; atlasIndex++)
+            {
+                renderView.Mode = atlasIndex == IMPOSTORS_ATLAS_ALBEDO ? ViewMode::Diffuse : ViewMode::Normals;
+                _drawPending = true;
+                Renderer::Render(_task);
+                context->ClearState();
+
+                // Copy frame to the atlas
+                context->SetRenderTarget(_atlases[atlasIndex]->View());
+                context->SetViewportAndScissors(viewport);
+                context->Draw(_output->View());
+                context->ResetRenderTarget();
+            }
+
+            // Copy depth (orthographic projection uses linear depth)
+            context->SetRenderTarget(_atlases[IMPOSTORS_ATLAS_DEPTH]->View());
+            context->SetViewportAndScissors(viewport);
+            context->Draw(_task->Buffers->DepthBuffer);
+            context->ResetRenderTarget();
+        }
+    }
+
+    // Cleanup
+    context->ClearState();
+    _drawModel = nullptr;
+    _drawEntries = nullptr;
+
+    // Mark as rendered
+    _updateFrameNumber = Engine::FrameCount;
+}
+
+void ImpostorsRenderer::OnCollectDrawCalls(RenderContext& renderContext)
+{
+    // Draw model once per frame rendering (event is called for each draw category)
+    if (!_drawPending || !_drawModel)
+        return;
+    _drawPending = false;
+
+    Matrix world = Matrix::Identity;
+    Mesh::DrawInfo draw;
+    draw.Buffer = _drawEntries;
+    draw.World = &world;
+    draw.DrawState = &_drawState;
+    draw.Lightmap = nullptr;
+    draw.LightmapUVs = nullptr;
+    draw.Flags = StaticFlags::None;
+    draw.DrawModes = DrawPass::GBuffer;
+    BoundingSphere::FromBox(_drawModel->GetBox(), draw.Bounds);
+    draw.PerInstanceRandom = 0.0f;
+    draw.LODBias = 0;
+    draw.ForcedLOD = 0;
+    draw.SortOrder = 0;
+    draw.VertexColors = nullptr;
+    _drawModel->Draw(renderContext, draw);
+}
+
+#endif
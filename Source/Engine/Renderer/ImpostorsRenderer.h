@@ -0,0 +1,72 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#if USE_EDITOR
+
+#include "Engine/Scripting/ScriptingObjectReference.h"
+#include "Engine/Level/Actor.h"
+
+// Amount of frames to wait for the impostor atlases rendering before downloading them
+#define IMPOSTORS_RENDERER_LATENCY_FRAMES 1
+
+class StaticModel;
+class Foliage;
+class RenderTask;
+class GPUContext;
+struct RenderContext;
+
+/// <summary>
+/// Impostors baking service. Captures the model albedo, normals and depth from multiple directions (octahedral layout) into the atlas textures used to draw the distant models as camera-facing quads.
+/// </summary>
+class ImpostorsRenderer
+{
+public:
+    struct Entry
+    {
+        ScriptingObjectReference<Actor> Actor;
+        int32 FoliageTypeIndex = -1;
+        int32 Frames = 8;
+        int32 Resolution = 128;
+    };
+
+public:
+    /// <summary>
+    /// Action fired when impostor baking ends (atlases have been imported and assigned to the target).
+    /// </summary>
+    static Delegate<const Entry&> OnFinishBake;
+
+    /// <summary>
+    /// Gets the amount of impostors waiting for the baking.
+    /// </summary>
+    static int32 GetBakeQueueSize();
+
+    /// <summary>
+    /// Registers the static model to the baking service. Atlases are saved next to the model asset and assigned to the actor impostor.
+    /// </summary>
+    /// <param name="actor">The static model actor.</param>
+    /// <param name="frames">The amount of captured frames in each atlas row and column.</param>
+    /// <param name="resolution">The resolution of the single frame (in pixels).</param>
+    static void Bake(StaticModel* actor, int32 frames = 8, int32 resolution = 128);
+
+    /// <summary>
+    /// Registers the foliage type to the baking service. Atlases are saved next to the model asset and assigned to the foliage type impostor.
+    /// </summary>
+    /// <param name="foliage">The foliage actor.</param>
+    /// <param name="foliageTypeIndex">The foliage type index.</param>
+    /// <param name="frames">The amount of captured frames in each atlas row and column.</param>
+    /// <param name="resolution">The resolution of the single frame (in pixels).</param>
+    static void Bake(Foliage* foliage, int32 foliageTypeIndex, int32 frames = 8, int32 resolution = 128);
+
+    /// <summary>
+    /// Releases the baking service resources.
+    /// </summary>
+    static void Release();
+
+private:
+    friend class ImpostorsRendererService;
+    static void OnRender(RenderTask* task, GPUContext* context);
+    static void OnCollectDrawCalls(RenderContext& renderContext);
+};
+
+#endif
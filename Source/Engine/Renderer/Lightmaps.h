@@ -107,6 +107,22 @@ DECLARE_SCRIPTING_TYPE_MINIMAL(LightmapSettings);
         _4096 = 4096,
     };
 
+    /// <summary>
+    /// Lightmaps baking backends.
+    /// </summary>
+    API_ENUM() enum class BakingBackends
+    {
+        /// <summary>
+        /// Renders the hemisphere for every lightmap texel on the GPU (requires compute shaders support).
+        /// </summary>
+        GPU = 0,
+
+        /// <summary>
+        /// Path-traces the irradiance for every lightmap texel on the CPU (uses all job system threads, doesn't need the GPU).
+        /// </summary>
+        CPU = 1,
+    };
+
     /// <summary>
     /// Controls how much all lights will contribute indirect lighting.
     /// </summary>
@@ -155,6 +171,18 @@ DECLARE_SCRIPTING_TYPE_MINIMAL(LightmapSettings);
     API_FIELD(Attributes="EditorOrder(60), Limit(0, 100, 0.1f)")
     int32 Quality = 10;
 
+    /// <summary>
+    /// The lightmaps baking backend. CPU backend can be used on machines without GPU (eg. build servers) and it's used as a fallback if GPU doesn't support compute shaders.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(70)")
+    BakingBackends Backend = BakingBackends::GPU;
+
+    /// <summary>
+    /// The maximum amount of rays traced per lightmap texel (in every bounce) by the CPU backend. Texels with converged irradiance stop tracing earlier.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(80), Limit(16, 65536)")
+    int32 SamplesPerTexel = 256;
+
 public:
 
     // [ISerializable]
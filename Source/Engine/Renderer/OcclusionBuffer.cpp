@@ -0,0 +1,433 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#include "OcclusionBuffer.h"
+#include "RenderList.h"
+#include "Engine/Core/SIMD.h"
+#include "Engine/Core/Collections/Dictionary.h"
+#include "Engine/Core/Collections/Sorting.h"
+#include "Engine/Core/Types/Pair.h"
+#include "Engine/Core/Math/BoundingBox.h"
+#include "Engine/Core/Math/BoundingSphere.h"
+#include "Engine/Content/AssetReference.h"
+#include "Engine/Content/Assets/Model.h"
+#include "Engine/Content/Content.h"
+#include "Engine/Engine/EngineService.h"
+#include "Engine/Graphics/RenderTask.h"
+#include "Engine/Level/Scene/SceneRendering.h"
+#include "Engine/Profiler/ProfilerCPU.h"
+#include "Engine/Profiler/RenderStats.h"
+#include "Engine/Threading/JobSystem.h"
+#include "Engine/Threading/Task.h"
+#include "Engine/Threading/Threading.h"
+
+// The amount of rows rasterized by a single job
+#define OCCLUSION_BUFFER_BAND_HEIGHT (OCCLUSION_BUFFER_TILE_SIZE * 2)
+#define OCCLUSION_BUFFER_TILES_X (OCCLUSION_BUFFER_WIDTH / OCCLUSION_BUFFER_TILE_SIZE)
+#define OCCLUSION_BUFFER_TILES_Y (OCCLUSION_BUFFER_HEIGHT / OCCLUSION_BUFFER_TILE_SIZE)
+
+namespace
+{
+    struct OccluderMeshData
+    {
+        Array<Float3> Vertices;
+        Array<byte> Indices;
+        int32 IndicesCount;
+        bool Use16BitIndices;
+    };
+
+    struct OccluderLOD
+    {
+        // CPU copy of the LOD meshes geometry (empty if failed to load) or null if still loading
+        Array<OccluderMeshData>* Meshes;
+        int64 RequestId;
+    };
+
+    // Occluder models geometry (by model ID and LOD index) loaded on a thread pool to prevent hitches during rendering. Released on model unload or reload (on the main thread, so not during rendering).
+    CriticalSection OccluderLODsLocker;
+    Dictionary<Pair<Guid, int32>, OccluderLOD> OccluderLODs;
+    int64 OccluderLODsRequests = 0;
+
+    void LoadOccluderLOD(const AssetReference<Model>& model, const Guid& modelId, int32 lodIndex, int64 requestId)
+    {
+        auto meshes = New<Array<OccluderMeshData>>();
+        if (model && model->IsLoaded() && lodIndex < model->LODs.Count())
+        {
+            const ModelLOD& lod = model->LODs[lodIndex];
+            meshes->Resize(lod.Meshes.Count());
+            for (int32 i = 0; i < lod.Meshes.Count(); i++)
+            {
+                const Mesh& mesh = lod.Meshes[i];
+                BytesContainer vertices, indices;
+                int32 verticesCount, indicesCount;
+                if (mesh.DownloadDataCPU(MeshBufferType::Vertex0, vertices, verticesCount) ||
+                    mesh.DownloadDataCPU(MeshBufferType::Index, indices, indicesCount))
+                {
+                    meshes->Clear();
+                    break;
+                }
+                auto& e = meshes->At(i);
+                e.Vertices.Set((const Float3*)vertices.Get(), verticesCount);
+                e.Indices.Set(indices.Get(), indices.Length());
+                e.IndicesCount = indicesCount;
+                e.Use16BitIndices = mesh.Use16BitIndexBuffer();
+            }
+        }
+        ScopeLock lock(OccluderLODsLocker);
+        OccluderLOD* e = OccluderLODs.TryGet(ToPair(modelId, lodIndex));
+        if (e && e->RequestId == requestId)
+            e->Meshes = meshes;
+        else
+            Delete(meshes); // Model got unloaded or reloaded in the meantime
+    }
+
+    void OnModelUnload(Asset* asset)
+    {
+        const Guid id = asset->GetID();
+        ScopeLock lock(OccluderLODsLocker);
+        for (auto it = OccluderLODs.Begin(); it.IsNotEnd(); ++it)
+        {
+            if (it->Key.First == id)
+            {
+                if (it->Value.Meshes)
+                    Delete(it->Value.Meshes);
+                OccluderLODs.Remove(it);
+            }
+        }
+    }
+}
+
+class OcclusionBufferService : public EngineService
+{
+public:
+    OcclusionBufferService()
+        : EngineService(TEXT("Occlusion Buffer"), 80, true)
+    {
+    }
+
+    bool Init() override
+    {
+        Content::AssetDisposing.Bind(OnModelUnload);
+        Content::AssetReloading.Bind(OnModelUnload);
+        return false;
+    }
+
+    void Dispose() override
+    {
+        Content::AssetDisposing.Unbind(OnModelUnload);
+        Content::AssetReloading.Unbind(OnModelUnload);
+        ScopeLock lock(OccluderLODsLocker);
+        for (auto it = OccluderLODs.Begin(); it.IsNotEnd(); ++it)
+        {
+            if (it->Value.Meshes)
+                Delete(it->Value.Meshes);
+        }
+        OccluderLODs.Clear();
+    }
+};
+
+OcclusionBufferService OcclusionBufferServiceInstance;
+
+void OcclusionBuffer::AddOccluder(IOccluder* occluder, float screenSize)
+{
+    auto& e = _occluders.AddOne();
+    e.Object = occluder;
+    e.ScreenSize = screenSize;
+}
+
+void OcclusionBuffer::AddModel(const Matrix& world, Model* model, int32 lodIndex)
+{
+    if (model->IsVirtual())
+        return;
+
+    // Ensure that model geometry is ready on a CPU
+    const auto key = ToPair(model->GetID(), lodIndex);
+    ScopeLock lock(OccluderLODsLocker);
+    const OccluderLOD* e = OccluderLODs.TryGet(key);
+    if (!e)
+    {
+        const int64 requestId = ++OccluderLODsRequests;
+        OccluderLODs.Add(key, { nullptr, requestId });
+        const AssetReference<Model> modelRef = model;
+        const Guid modelId = key.First;
+        Function<void()> action = [modelRef, modelId, lodIndex, requestId]
+        {
+            LoadOccluderLOD(modelRef, modelId, lodIndex, requestId);
+        };
+        Task::StartNew(action);
+        return;
+    }
+    if (!e->Meshes)
+        return;
+    for (const OccluderMeshData& mesh : *e->Meshes)
+        AddGeometry(world, mesh.Vertices.Get(), mesh.Vertices.Count(), mesh.Indices.Get(), mesh.IndicesCount, mesh.Use16BitIndices);
+}
+
+void OcclusionBuffer::AddGeometry(const Matrix& world, const Float3* vertices, int32 verticesCount, const void* indices, int32 indicesCount, bool use16BitIndices)
+{
+    if (_trianglesCount + indicesCount / 3 > OCCLUSION_BUFFER_MAX_TRIANGLES)
+        return;
+    auto& e = _meshes.AddOne();
+    e.World = world;
+    e.Vertices = vertices;
+    e.VerticesCount = verticesCount;
+    e.Indices = indices;
+    e.IndicesCount = indicesCount;
+    e.Use16BitIndices = use16BitIndices;
+    _trianglesCount += indicesCount / 3;
+}
+
+void OcclusionBuffer::Render(const RenderContext& renderContext)
+{
+    _valid = false;
+    _meshes.Clear();
+    _trianglesCount = 0;
+    if (_occluders.IsEmpty())
+        return;
+    PROFILE_CPU();
+
+    // Pick the largest occluders on the screen
+    Sorting::QuickSort(_occluders.Get(), _occluders.Count());
+    const int32 occludersCount = Math::Min(_occluders.Count(), OCCLUSION_BUFFER_MAX_OCCLUDERS);
+    for (int32 i = 0; i < occludersCount; i++)
+        _occluders.Get()[i].Object->DrawOccluder(renderContext, *this);
+
+    Rasterize(renderContext.View.ViewProjection());
+}
+
+void OcclusionBuffer::Rasterize(const Matrix& viewProjection)
+{
+    _valid = false;
+    _viewProjection = viewProjection;
+    if (_meshes.IsEmpty())
+        return;
+
+    // Setup triangles and rasterize them into the depth buffer
+    if (_triangles.Count() < _meshes.Count())
+        _triangles.Resize(_meshes.Count());
+    _depth.Resize(OCCLUSION_BUFFER_WIDTH * OCCLUSION_BUFFER_HEIGHT, false);
+    _tilesDepth.Resize(OCCLUSION_BUFFER_TILES_X * OCCLUSION_BUFFER_TILES_Y, false);
+    Function<void(int32)> func;
+    func.Bind<OcclusionBuffer, &OcclusionBuffer::SetupTriangles>(this);
+    JobSystem::Execute(func, _meshes.Count());
+    func.Bind<OcclusionBuffer, &OcclusionBuffer::RasterizeBand>(this);
+    JobSystem::Execute(func, OCCLUSION_BUFFER_HEIGHT / OCCLUSION_BUFFER_BAND_HEIGHT);
+    _valid = true;
+}
+
+void OcclusionBuffer::Clear()
+{
+    _valid = false;
+    _occluders.Clear();
+    _meshes.Clear();
+    _trianglesCount = 0;
+}
+
+bool OcclusionBuffer::IsOccluded(const BoundingBox& bounds) const
+{
+    if (!_valid)
+        return false;
+
+    // Project bounds into the screen space to get the covered rectangle and the closest depth
+    Float3 corners[8];
+    bounds.GetCorners(corners);
+    const Matrix& m = _viewProjection;
+    float minX = MAX_float, minY = MAX_float, maxX = -MAX_float, maxY = -MAX_float, minZ = 1.0f;
+    for (const Float3& c : corners)
+    {
+        const float z = c.X * m.M13 + c.Y * m.M23 + c.Z * m.M33 + m.M43;
+        if (z < 0.0f)
+            return false; // Crosses the near plane
+        const float invW = 1.0f / (c.X * m.M14 + c.Y * m.M24 + c.Z * m.M34 + m.M44);
+        const float x = ((c.X * m.M11 + c.Y * m.M21 + c.Z * m.M31 + m.M41) * invW * 0.5f + 0.5f) * OCCLUSION_BUFFER_WIDTH;
+        const float y = (0.5f - (c.X * m.M12 + c.Y * m.M22 + c.Z * m.M32 + m.M42) * invW * 0.5f) * OCCLUSION_BUFFER_HEIGHT;
+        minX = Math::Min(minX, x);
+        minY = Math::Min(minY, y);
+        maxX = Math::Max(maxX, x);
+        maxY = Math::Max(maxY, y);
+        minZ = Math::Min(minZ, z * invW);
+    }
+    const int32 x0 = Math::Max((int32)minX, 0);
+    const int32 y0 = Math::Max((int32)minY, 0);
+    const int32 x1 = Math::Min((int32)maxX, OCCLUSION_BUFFER_WIDTH - 1);
+    const int32 y1 = Math::Min((int32)maxY, OCCLUSION_BUFFER_HEIGHT - 1);
+    if (x0 > x1 || y0 > y1)
+        return false; // Outside the screen (frustum culling handles it)
+
+    // Hierarchical depth test (tiles with the farthest depth, then pixels)
+    const float* depth = _depth.Get();
+    const float* tilesDepth = _tilesDepth.Get();
+    for (int32 ty = y0 / OCCLUSION_BUFFER_TILE_SIZE; ty <= y1 / OCCLUSION_BUFFER_TILE_SIZE; ty++)
+    {
+        for (int32 tx = x0 / OCCLUSION_BUFFER_TILE_SIZE; tx <= x1 / OCCLUSION_BUFFER_TILE_SIZE; tx++)
+        {
+            if (tilesDepth[ty * OCCLUSION_BUFFER_TILES_X + tx] < minZ)
+                continue;
+            const int32 px0 = Math::Max(x0, tx * OCCLUSION_BUFFER_TILE_SIZE);
+            const int32 px1 = Math::Min(x1, tx * OCCLUSION_BUFFER_TILE_SIZE + OCCLUSION_BUFFER_TILE_SIZE - 1);
+            const int32 py0 = Math::Max(y0, ty * OCCLUSION_BUFFER_TILE_SIZE);
+            const int32 py1 = Math::Min(y1, ty * OCCLUSION_BUFFER_TILE_SIZE + OCCLUSION_BUFFER_TILE_SIZE - 1);
+            for (int32 y = py0; y <= py1; y++)
+            {
+                const float* depthRow = depth + y * OCCLUSION_BUFFER_WIDTH;
+                for (int32 x = px0; x <= px1; x++)
+                {
+                    if (depthRow[x] >= minZ)
+                        return false;
+                }
+            }
+        }
+    }
+
+    RENDER_STAT_OCCLUDED_OBJECT();
+    return true;
+}
+
+bool OcclusionBuffer::IsOccluded(const BoundingSphere& bounds) const
+{
+    if (!_valid)
+        return false;
+    BoundingBox box;
+    BoundingBox::FromSphere(bounds, box);
+    return IsOccluded(box);
+}
+
+void OcclusionBuffer::SetupTriangles(int32 meshIndex)
+{
+    const OccluderMesh& mesh = _meshes.Get()[meshIndex];
+    auto& triangles = _triangles.Get()[meshIndex];
+    triangles.Clear();
+
+    // Transform vertices into the screen space (W is negative for vertices in front of the near plane)
+    Matrix worldViewProjection;
+    Matrix::Multiply(mesh.World, _viewProjection, worldViewProjection);
+    const SimdVector4 row0 = SIMD::LoadUnaligned(&worldViewProjection.M11);
+    const SimdVector4 row1 = SIMD::LoadUnaligned(&worldViewProjection.M21);
+    const SimdVector4 row2 = SIMD::LoadUnaligned(&worldViewProjection.M31);
+    const SimdVector4 row3 = SIMD::LoadUnaligned(&worldViewProjection.M41);
+    Array<Float4> vertices;
+    vertices.Resize(mesh.VerticesCount, false);
+    for (int32 i = 0; i < mesh.VerticesCount; i++)
+    {
+        const Float3& position = mesh.Vertices[i];
+        const SimdVector4 clip = SIMD::Add(SIMD::Add(SIMD::Mul(SIMD::Splat(position.X), row0), SIMD::Mul(SIMD::Splat(position.Y), row1)), SIMD::Add(SIMD::Mul(SIMD::Splat(position.Z), row2), row3));
+        Float4& v = vertices.Get()[i];
+        SIMD::StoreUnaligned(&v, clip);
+        if (v.Z < 0.0f)
+        {
+            v.W = -1.0f;
+            continue;
+        }
+        const float invW = 1.0f / v.W;
+        v.X = (v.X * invW * 0.5f + 0.5f) * OCCLUSION_BUFFER_WIDTH;
+        v.Y = (0.5f - v.Y * invW * 0.5f) * OCCLUSION_BUFFER_HEIGHT;
+        v.Z = Math::Min(v.Z * invW, 1.0f);
+    }
+
+    // Setup triangles
+    triangles.EnsureCapacity(mesh.IndicesCount / 3);
+    for (int32 i = 0; i + 2 < mesh.IndicesCount; i += 3)
+    {
+        const Float4* v[3];
+        for (int32 j = 0; j < 3; j++)
+        {
+            const uint32 index = mesh.Use16BitIndices ? ((const uint16*)mesh.Indices)[i + j] : ((const uint32*)mesh.Indices)[i + j];
+            v[j] = index < (uint32)mesh.VerticesCount ? &vertices.Get()[index] : nullptr;
+        }
+        if (!v[0] || !v[1] || !v[2] || v[0]->W < 0.0f || v[1]->W < 0.0f || v[2]->W < 0.0f)
+            continue; // Skip triangles crossing the near plane (conservative)
+
+        // Rasterize both sides (use counter-clockwise winding in the screen space)
+        const float area = (v[1]->X - v[0]->X) * (v[2]->Y - v[0]->Y) - (v[1]->Y - v[0]->Y) * (v[2]->X - v[0]->X);
+        if (Math::Abs(area) < ZeroTolerance)
+            continue;
+        if (area < 0.0f)
+            Swap(v[1], v[2]);
+
+        Triangle t;
+        t.MinX = Math::Max((int32)Math::Floor(Math::Min(v[0]->X, v[1]->X, v[2]->X)), 0);
+        t.MinY = Math::Max((int32)Math::Floor(Math::Min(v[0]->Y, v[1]->Y, v[2]->Y)), 0);
+        t.MaxX = Math::Min((int32)Math::Ceil(Math::Max(v[0]->X, v[1]->X, v[2]->X)), OCCLUSION_BUFFER_WIDTH - 1);
+        t.MaxY = Math::Min((int32)Math::Ceil(Math::Max(v[0]->Y, v[1]->Y, v[2]->Y)), OCCLUSION_BUFFER_HEIGHT - 1);
+        if (t.MinX > t.MaxX || t.MinY > t.MaxY)
+            continue;
+        for (int32 j = 0; j < 3; j++)
+        {
+            const Float4& a = *v[j];
+            const Float4& b = *v[(j + 1) % 3];
+            t.A[j] = a.Y - b.Y;
+            t.B[j] = b.X - a.X;
+            t.C[j] = (b.Y - a.Y) * a.X - (b.X - a.X) * a.Y;
+        }
+
+        // Use the farthest depth for the whole triangle (conservative)
+        t.Depth = Math::Max(v[0]->Z, v[1]->Z, v[2]->Z);
+        triangles.Add(t);
+    }
+}
+
+void OcclusionBuffer::RasterizeBand(int32 bandIndex)
+{
+    const int32 bandMinY = bandIndex * OCCLUSION_BUFFER_BAND_HEIGHT;
+    const int32 bandMaxY = bandMinY + OCCLUSION_BUFFER_BAND_HEIGHT - 1;
+    float* depth = _depth.Get();
+
+    // Clear depth
+    for (int32 i = bandMinY * OCCLUSION_BUFFER_WIDTH; i < (bandMaxY + 1) * OCCLUSION_BUFFER_WIDTH; i++)
+        depth[i] = 1.0f;
+
+    // Rasterize triangles overlapping this band (4 pixels at once)
+    const SimdVector4 pixelOffsets = SIMD::Load(0.5f, 1.5f, 2.5f, 3.5f);
+    for (int32 meshIndex = 0; meshIndex < _meshes.Count(); meshIndex++)
+    {
+        for (const Triangle& t : _triangles.Get()[meshIndex])
+        {
+            const int32 y0 = Math::Max(t.MinY, bandMinY);
+            const int32 y1 = Math::Min(t.MaxY, bandMaxY);
+            if (y0 > y1)
+                continue;
+            const int32 x0 = t.MinX & ~3;
+            const SimdVector4 a0 = SIMD::Splat(t.A[0]);
+            const SimdVector4 a1 = SIMD::Splat(t.A[1]);
+            const SimdVector4 a2 = SIMD::Splat(t.A[2]);
+            for (int32 y = y0; y <= y1; y++)
+            {
+                const float py = (float)y + 0.5f;
+                const SimdVector4 row0 = SIMD::Splat(t.B[0] * py + t.C[0]);
+                const SimdVector4 row1 = SIMD::Splat(t.B[1] * py + t.C[1]);
+                const SimdVector4 row2 = SIMD::Splat(t.B[2] * py + t.C[2]);
+                float* depthRow = depth + y * OCCLUSION_BUFFER_WIDTH;
+                for (int32 x = x0; x <= t.MaxX; x += 4)
+                {
+                    const SimdVector4 px = SIMD::Add(SIMD::Splat((float)x), pixelOffsets);
+                    const SimdVector4 e0 = SIMD::Add(SIMD::Mul(a0, px), row0);
+                    const SimdVector4 e1 = SIMD::Add(SIMD::Mul(a1, px), row1);
+                    const SimdVector4 e2 = SIMD::Add(SIMD::Mul(a2, px), row2);
+                    const int32 outside = SIMD::MoveMask(SIMD::Min(SIMD::Min(e0, e1), e2));
+                    if (outside == 0xf)
+                        continue;
+                    for (int32 lane = 0; lane < 4; lane++)
+                    {
+                        if ((outside & (1 << lane)) == 0 && depthRow[x + lane] > t.Depth)
+                            depthRow[x + lane] = t.Depth;
+                    }
+                }
+            }
+        }
+    }
+
+    // Update the tiles with the farthest depth
+    for (int32 ty = bandMinY / OCCLUSION_BUFFER_TILE_SIZE; ty <= bandMaxY / OCCLUSION_BUFFER_TILE_SIZE; ty++)
+    {
+        for (int32 tx = 0; tx < OCCLUSION_BUFFER_TILES_X; tx++)
+        {
+            float tileDepth = 0.0f;
+            for (int32 y = ty * OCCLUSION_BUFFER_TILE_SIZE; y < (ty + 1) * OCCLUSION_BUFFER_TILE_SIZE; y++)
+            {
+                const float* depthRow = depth + y * OCCLUSION_BUFFER_WIDTH + tx * OCCLUSION_BUFFER_TILE_SIZE;
+                for (int32 x = 0; x < OCCLUSION_BUFFER_TILE_SIZE; x++)
+                    tileDepth = Math::Max(tileDepth, depthRow[x]);
+            }
+            _tilesDepth.Get()[ty * OCCLUSION_BUFFER_TILES_X + tx] = tileDepth;
+        }
+    }
+}
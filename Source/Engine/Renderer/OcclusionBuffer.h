@@ -0,0 +1,141 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#include "Engine/Core/Collections/Array.h"
+#include "Engine/Core/Math/Matrix.h"
+
+struct BoundingBox;
+struct BoundingSphere;
+struct RenderContext;
+class IOccluder;
+class Model;
+
+// The resolution of the occlusion culling depth buffer (width has to be multiple of 4 for SIMD rasterization).
+#define OCCLUSION_BUFFER_WIDTH 256
+#define OCCLUSION_BUFFER_HEIGHT 128
+
+// The size (in pixels) of the occlusion buffer tiles used for the hierarchical depth test.
+#define OCCLUSION_BUFFER_TILE_SIZE 8
+
+// The maximum amount of occluders rasterized per view (the largest ones on the screen are picked).
+#define OCCLUSION_BUFFER_MAX_OCCLUDERS 64
+
+// The maximum amount of triangles rasterized per view.
+#define OCCLUSION_BUFFER_MAX_TRIANGLES 65536
+
+/// <summary>
+/// Low-resolution depth buffer rasterized on a CPU from the large occluders (eg. walls or buildings). Used to cull objects hidden behind the occluders before emitting draw calls.
+/// </summary>
+class FLAXENGINE_API OcclusionBuffer
+{
+private:
+    struct Occluder
+    {
+        IOccluder* Object;
+        float ScreenSize;
+
+        bool operator<(const Occluder& other) const
+        {
+            // Sort from the largest
+            return ScreenSize > other.ScreenSize;
+        }
+    };
+
+    struct OccluderMesh
+    {
+        Matrix World;
+        const Float3* Vertices;
+        int32 VerticesCount;
+        const void* Indices;
+        int32 IndicesCount;
+        bool Use16BitIndices;
+    };
+
+    struct Triangle
+    {
+        // Edge functions coefficients (E = A * x + B * y + C, positive inside the triangle)
+        float A[3], B[3], C[3];
+        float Depth;
+        int32 MinX, MinY, MaxX, MaxY;
+    };
+
+    bool _valid = false;
+    int32 _trianglesCount = 0;
+    Matrix _viewProjection;
+    Array<Occluder> _occluders;
+    Array<OccluderMesh> _meshes;
+    Array<Array<Triangle>> _triangles;
+    Array<float> _depth;
+    Array<float> _tilesDepth;
+
+public:
+    /// <summary>
+    /// Returns true if buffer contains rasterized occluders and can be used for the culling.
+    /// </summary>
+    FORCE_INLINE bool IsValid() const
+    {
+        return _valid;
+    }
+
+    /// <summary>
+    /// Adds the occluder for the rasterization. Only the largest occluders on the screen will be rasterized.
+    /// </summary>
+    /// <param name="occluder">The occluder object.</param>
+    /// <param name="screenSize">The occluder size on the screen (eg. squared screen radius of the bounds).</param>
+    void AddOccluder(IOccluder* occluder, float screenSize);
+
+    /// <summary>
+    /// Adds the model LOD geometry to rasterize. Called by the occluders during rendering. Uses the CPU copy of the model geometry that is loaded asynchronously (model is skipped until it's ready) and released when model gets unloaded or reloaded.
+    /// </summary>
+    /// <param name="world">The model world matrix (relative to the view origin).</param>
+    /// <param name="model">The model.</param>
+    /// <param name="lodIndex">The model LOD index.</param>
+    void AddModel(const Matrix& world, Model* model, int32 lodIndex);
+
+    /// <summary>
+    /// Adds the triangles geometry to rasterize. Data has to be valid until the rasterization ends.
+    /// </summary>
+    /// <param name="world">The geometry world matrix (relative to the view origin).</param>
+    /// <param name="vertices">The vertex positions.</param>
+    /// <param name="verticesCount">The vertices count.</param>
+    /// <param name="indices">The triangle indices.</param>
+    /// <param name="indicesCount">The indices count.</param>
+    /// <param name="use16BitIndices">True if indices are 16-bit, otherwise 32-bit.</param>
+    void AddGeometry(const Matrix& world, const Float3* vertices, int32 verticesCount, const void* indices, int32 indicesCount, bool use16BitIndices);
+
+    /// <summary>
+    /// Draws the largest occluders and rasterizes them into the depth buffer.
+    /// </summary>
+    /// <param name="renderContext">The rendering context.</param>
+    void Render(const RenderContext& renderContext);
+
+    /// <summary>
+    /// Rasterizes the added geometry into the depth buffer (in parallel via Job System).
+    /// </summary>
+    /// <param name="viewProjection">The view-projection matrix (relative to the view origin).</param>
+    void Rasterize(const Matrix& viewProjection);
+
+    /// <summary>
+    /// Clears the occluders and disables the culling until the next rendering.
+    /// </summary>
+    void Clear();
+
+    /// <summary>
+    /// Checks if the given bounds are fully hidden behind the rasterized occluders. Thread-safe.
+    /// </summary>
+    /// <param name="bounds">The object bounds (relative to the view origin).</param>
+    /// <returns>True if object is occluded and can be culled, otherwise false.</returns>
+    bool IsOccluded(const BoundingBox& bounds) const;
+
+    /// <summary>
+    /// Checks if the given bounds are fully hidden behind the rasterized occluders. Thread-safe.
+    /// </summary>
+    /// <param name="bounds">The object bounds (relative to the view origin).</param>
+    /// <returns>True if object is occluded and can be culled, otherwise false.</returns>
+    bool IsOccluded(const BoundingSphere& bounds) const;
+
+private:
+    void SetupTriangles(int32 meshIndex);
+    void RasterizeBand(int32 bandIndex);
+};
@@ -6,6 +6,7 @@
 #include "Engine/Graphics/RenderTask.h"
 #include "Engine/Graphics/GPUContext.h"
 #include "Engine/Graphics/GPUDevice.h"
+#include "Engine/Graphics/GPUDeferredContext.h"
 #include "Engine/Graphics/GPULimits.h"
 #include "Engine/Graphics/RenderTargetPool.h"
 #include "Engine/Graphics/RenderTools.h"
@@ -15,6 +16,11 @@
 #include "Engine/Content/Assets/CubeTexture.h"
 #include "Engine/Level/Scene/Lightmap.h"
 #include "Engine/Level/Actors/PostFxVolume.h"
+#include "Engine/Threading/FastLock.h"
+#include "Engine/Threading/JobSystem.h"
+
+// Minimum amount of the draw call batches per job to record draw calls in parallel (see Graphics::ParallelDrawCalls)
+#define PARALLEL_DRAW_MIN_BATCHES 128
 
 static_assert(sizeof(DrawCall) <= 288, "Too big draw call data size.");
 static_assert(sizeof(DrawCall::Surface) >= sizeof(DrawCall::Terrain), "Wrong draw call data size.");
@@ -35,7 +41,10 @@ namespace
     };
 
     Array<MemPoolEntry> MemPool;
-    CriticalSection MemPoolLocker;
+    FastLock MemPoolLocker;
+
+    // Contexts used to record draw calls on multiple threads
+    Array<GPUDeferredContext*> DeferredContexts;
 }
 
 void RendererDirectionalLightData::SetupLightData(LightData* data, bool useShadow) const
@@ -168,6 +177,7 @@ void RenderList::CleanupCache()
     for (auto& e : MemPool)
         Platform::Free(e.Ptr);
     MemPool.Clear();
+    DeferredContexts.ClearDelete();
 }
 
 bool RenderList::BlendableSettings::operator<(const BlendableSettings& other) const
@@ -378,6 +388,7 @@ RenderList::RenderList(const SpawnParams& params)
     , Fog(nullptr)
     , Blendable(32)
     , _instanceBuffer(1024 * sizeof(InstanceData), sizeof(InstanceData), TEXT("Instance Buffer"))
+    , _objectBuffer(1024 * sizeof(InstanceData), sizeof(InstanceData), TEXT("Object Buffer"))
 {
 }
 
@@ -393,15 +404,18 @@ void RenderList::Clear()
     Scenes.Clear();
     DrawCalls.Clear();
     BatchedDrawCalls.Clear();
+    Objects.Clear();
     for (auto& list : DrawCallsLists)
         list.Clear();
     ShadowDepthDrawCallsList.Clear();
+    Occlusion.Clear();
     PointLights.Clear();
     SpotLights.Clear();
     SkyLights.Clear();
     DirectionalLights.Clear();
     EnvironmentProbes.Clear();
     Decals.Clear();
+    Impostors.Clear();
     VolumetricFogParticles.Clear();
     Sky = nullptr;
     AtmosphericFog = nullptr;
@@ -410,6 +424,8 @@ void RenderList::Clear()
     Settings = PostProcessSettings();
     Blendable.Clear();
     _instanceBuffer.Clear();
+    _objectBuffer.Clear();
+    _objectBufferCount = 0;
 }
 
 struct PackedSortKey
@@ -458,6 +474,7 @@ void RenderList::AddDrawCall(const RenderContext& renderContext, DrawPass drawMo
 
     // Append draw call data
     CalculateSortKey(renderContext, drawCall, sortOrder);
+    AddObject(drawCall);
     const int32 index = DrawCalls.Add(drawCall);
 
     // Add draw call to proper draw lists
@@ -486,7 +503,7 @@ void RenderList::AddDrawCall(const RenderContext& renderContext, DrawPass drawMo
     }
 }
 
-void RenderList::AddDrawCall(const RenderContextBatch& renderContextBatch, DrawPass drawModes, StaticFlags staticFlags, ShadowsCastingMode shadowsMode, const BoundingSphere& bounds, DrawCall& drawCall, bool receivesDecals, int16 sortOrder)
+void RenderList::AddDrawCall(const RenderContextBatch& renderContextBatch, DrawPass drawModes, StaticFlags staticFlags, ShadowsCastingMode shadowsMode, const BoundingSphere& bounds, DrawCall& drawCall, bool receivesDecals, int16 sortOrder, const Span<MeshCluster>& clusters)
 {
 #if ENABLE_ASSERTION_LOW_LAYERS
     // Ensure that draw modes are non-empty and in conjunction with material draw modes
@@ -497,12 +514,13 @@ void RenderList::AddDrawCall(const RenderContextBatch& renderContextBatch, DrawP
 
     // Append draw call data
     CalculateSortKey(mainRenderContext, drawCall, sortOrder);
+    AddObject(drawCall);
     const int32 index = DrawCalls.Add(drawCall);
 
     // Add draw call to proper draw lists
     DrawPass modes = drawModes & mainRenderContext.View.GetShadowsDrawPassMask(shadowsMode);
     drawModes = modes & mainRenderContext.View.Pass;
-    if (drawModes != DrawPass::None && mainRenderContext.View.CullingFrustum.Intersects(bounds))
+    if (drawModes != DrawPass::None && mainRenderContext.View.CullingFrustum.Intersects(bounds) && !Occlusion.IsOccluded(bounds))
     {
         if ((drawModes & DrawPass::Depth) != DrawPass::None)
         {
@@ -535,11 +553,59 @@ void RenderList::AddDrawCall(const RenderContextBatch& renderContextBatch, DrawP
         drawModes = modes & renderContext.View.Pass;
         if (drawModes != DrawPass::None && renderContext.View.CullingFrustum.Intersects(bounds))
         {
-            renderContext.List->ShadowDepthDrawCallsList.Indices.Add(index);
+            Array<Int2, InlinedAllocation<MESH_CLUSTER_CULLING_MAX_RANGES>> ranges;
+            if (clusters.Length() != 0 && RenderTools::CullMeshClusters(clusters, renderContext.View, drawCall.World, drawCall.Material->GetInfo().CullMode, ranges))
+            {
+                // Draw only the visible clusters of the mesh
+                for (const Int2& range : ranges)
+                {
+                    DrawCall rangeDrawCall = drawCall;
+                    rangeDrawCall.Draw.StartIndex = range.X;
+                    rangeDrawCall.Draw.IndicesCount = range.Y;
+                    renderContext.List->ShadowDepthDrawCallsList.Indices.Add(DrawCalls.Add(rangeDrawCall));
+                }
+            }
+            else
+            {
+                renderContext.List->ShadowDepthDrawCallsList.Indices.Add(index);
+            }
         }
     }
 }
 
+void RenderList::AddObject(DrawCall& drawCall)
+{
+    // Store per-object data of the single-instance draw calls that can be drawn with instancing (draw call references it so material doesn't need to be bound again for each object)
+    IMaterial::InstancingHandler handler;
+    if (drawCall.InstanceCount == 1 && drawCall.Material->CanUseInstancing(handler) && handler.CanBatch(drawCall, drawCall))
+    {
+        InstanceData object;
+        handler.WriteDrawCall(&object, drawCall);
+        drawCall.ObjectIndex = Objects.Add(object);
+    }
+    else
+    {
+        drawCall.ObjectIndex = -1;
+    }
+}
+
+GPUBuffer* RenderList::FlushObjectBuffer(GPUContext* context)
+{
+    const int32 count = Objects.Count();
+    if (count == 0)
+        return nullptr;
+    if (_objectBufferCount != count)
+    {
+        // Upload objects data once (unless more objects were added after the last upload)
+        PROFILE_CPU_NAMED("Upload Objects");
+        _objectBufferCount = count;
+        _objectBuffer.Clear();
+        _objectBuffer.Write(Objects.Get(), count * sizeof(InstanceData));
+        _objectBuffer.Flush(context);
+    }
+    return _objectBuffer.GetBuffer();
+}
+
 namespace
 {
     /// <summary>
@@ -554,6 +620,8 @@ namespace
         return a.Material == b.Material &&
                 a.Material->CanUseInstancing(handler) &&
                 Platform::MemoryCompare(&a.Geometry, &b.Geometry, sizeof(a.Geometry)) == 0 &&
+                a.Draw.StartIndex == b.Draw.StartIndex &&
+                a.Draw.IndicesCount == b.Draw.IndicesCount &&
                 a.InstanceCount != 0 &&
                 b.InstanceCount != 0 &&
                 handler.CanBatch(a, b) &&
@@ -642,11 +710,188 @@ FORCE_INLINE bool CanUseInstancing(DrawPass pass)
     return pass == DrawPass::GBuffer || pass == DrawPass::Depth;
 }
 
-void RenderList::ExecuteDrawCalls(const RenderContext& renderContext, DrawCallsList& list, const RenderListBuffer<DrawCall>& drawCalls, GPUTextureView* input)
+FORCE_INLINE void DrawObject(GPUContext* context, MaterialBase::BindParameters& bindParams, const DrawCall& drawCall, GPUBuffer* objectBuffer, const DrawCall*& prevObject)
+{
+    // Per-object data is provided via instance buffer so material needs to be bound only if the previous object used different state
+    if (!prevObject || prevObject->Material != drawCall.Material || prevObject->WorldDeterminantSign != drawCall.WorldDeterminantSign || prevObject->Surface.GeometrySize != drawCall.Surface.GeometrySize)
+    {
+        bindParams.FirstDrawCall = &drawCall;
+        bindParams.DrawCallsCount = 1;
+        bindParams.Instanced = true;
+        drawCall.Material->Bind(bindParams);
+        bindParams.Instanced = false;
+    }
+    prevObject = &drawCall;
+
+    GPUBuffer* vb[4] = { drawCall.Geometry.VertexBuffers[0], drawCall.Geometry.VertexBuffers[1], drawCall.Geometry.VertexBuffers[2], objectBuffer };
+    uint32 vbOffsets[4] = { drawCall.Geometry.VertexBuffersOffsets[0], drawCall.Geometry.VertexBuffersOffsets[1], drawCall.Geometry.VertexBuffersOffsets[2], 0 };
+    context->BindIB(drawCall.Geometry.IndexBuffer);
+    context->BindVB(ToSpan(vb, 4), vbOffsets);
+    context->DrawIndexedInstanced(drawCall.Draw.IndicesCount, 1, drawCall.ObjectIndex, 0, drawCall.Draw.StartIndex);
+}
+
+namespace
+{
+    // Draw calls batches data shared by the recording threads
+    struct DrawBatchesData
+    {
+        const DrawCall* DrawCalls;
+        const int32* Indices;
+        const DrawBatch* Batches;
+        GPUBuffer* InstanceBuffer;
+        GPUBuffer* ObjectBuffer;
+    };
+
+    // Draws the range of the batches (returns the instance buffer offset after the last batch)
+    int32 DrawBatches(GPUContext* context, MaterialBase::BindParameters& bindParams, const DrawBatchesData& data, int32 start, int32 end, int32 instanceBufferOffset)
+    {
+        const DrawCall* prevObject = nullptr;
+        if (data.InstanceBuffer)
+        {
+            GPUBuffer* vb[4];
+            uint32 vbOffsets[4];
+            for (int32 i = start; i < end; i++)
+            {
+                auto& batch = data.Batches[i];
+                const DrawCall& drawCall = data.DrawCalls[data.Indices[batch.StartIndex]];
+                if (batch.BatchSize == 1 && data.ObjectBuffer && drawCall.ObjectIndex != -1)
+                {
+                    DrawObject(context, bindParams, drawCall, data.ObjectBuffer, prevObject);
+                    continue;
+                }
+                prevObject = nullptr;
+
+                int32 vbCount = 0;
+                while (vbCount < ARRAY_COUNT(drawCall.Geometry.VertexBuffers) && drawCall.Geometry.VertexBuffers[vbCount])
+                {
+                    vb[vbCount] = drawCall.Geometry.VertexBuffers[vbCount];
+                    vbOffsets[vbCount] = drawCall.Geometry.VertexBuffersOffsets[vbCount];
+                    vbCount++;
+                }
+                for (int32 j = vbCount; j < ARRAY_COUNT(drawCall.Geometry.VertexBuffers); j++)
+                {
+                    vb[vbCount] = nullptr;
+                    vbOffsets[vbCount] = 0;
+                }
+
+                bindParams.FirstDrawCall = &drawCall;
+                bindParams.DrawCallsCount = batch.BatchSize;
+                drawCall.Material->Bind(bindParams);
+
+                context->BindIB(drawCall.Geometry.IndexBuffer);
+
+                if (drawCall.InstanceCount == 0)
+                {
+                    // No support for batching indirect draw calls
+                    ASSERT_LOW_LAYER(batch.BatchSize == 1);
+
+                    context->BindVB(ToSpan(vb, vbCount), vbOffsets);
+                    context->DrawIndexedInstancedIndirect(drawCall.Draw.IndirectArgsBuffer, drawCall.Draw.IndirectArgsOffset);
+                }
+                else
+                {
+                    if (batch.BatchSize == 1)
+                    {
+                        context->BindVB(ToSpan(vb, vbCount), vbOffsets);
+                        context->DrawIndexedInstanced(drawCall.Draw.IndicesCount, batch.InstanceCount, 0, 0, drawCall.Draw.StartIndex);
+                    }
+                    else
+                    {
+                        vbCount = 3;
+                        vb[vbCount] = data.InstanceBuffer;
+                        vbOffsets[vbCount] = 0;
+                        vbCount++;
+                        context->BindVB(ToSpan(vb, vbCount), vbOffsets);
+                        context->DrawIndexedInstanced(drawCall.Draw.IndicesCount, batch.InstanceCount, instanceBufferOffset, 0, drawCall.Draw.StartIndex);
+                        instanceBufferOffset += batch.BatchSize;
+                    }
+                }
+            }
+        }
+        else
+        {
+            bindParams.DrawCallsCount = 1;
+            for (int32 i = start; i < end; i++)
+            {
+                auto& batch = data.Batches[i];
+
+                for (int32 j = 0; j < batch.BatchSize; j++)
+                {
+                    const DrawCall& drawCall = data.DrawCalls[data.Indices[batch.StartIndex + j]];
+                    if (data.ObjectBuffer && drawCall.ObjectIndex != -1)
+                    {
+                        DrawObject(context, bindParams, drawCall, data.ObjectBuffer, prevObject);
+                        continue;
+                    }
+                    prevObject = nullptr;
+                    bindParams.FirstDrawCall = &drawCall;
+                    drawCall.Material->Bind(bindParams);
+
+                    context->BindIB(drawCall.Geometry.IndexBuffer);
+                    context->BindVB(ToSpan(drawCall.Geometry.VertexBuffers, 3), drawCall.Geometry.VertexBuffersOffsets);
+
+                    if (drawCall.InstanceCount == 0)
+                    {
+                        context->DrawIndexedInstancedIndirect(drawCall.Draw.IndirectArgsBuffer, drawCall.Draw.IndirectArgsOffset);
+                    }
+                    else
+                    {
+                        context->DrawIndexedInstanced(drawCall.Draw.IndicesCount, drawCall.InstanceCount, 0, 0, drawCall.Draw.StartIndex);
+                    }
+                }
+            }
+        }
+        return instanceBufferOffset;
+    }
+
+    int32 GetInstanceBufferOffset(const DrawBatchesData& data, int32 batchIndex)
+    {
+        int32 result = 0;
+        if (data.InstanceBuffer)
+        {
+            for (int32 i = 0; i < batchIndex; i++)
+            {
+                if (data.Batches[i].BatchSize > 1)
+                    result += data.Batches[i].BatchSize;
+            }
+        }
+        return result;
+    }
+
+    int32 ExecuteBatches(GPUContext* context, MaterialBase::BindParameters& bindParams, const DrawBatchesData& data, int32 count)
+    {
+        // Split large lists into chunks recorded on job system threads (the main context executes them in order after that)
+        const int32 chunks = Math::Min(count / PARALLEL_DRAW_MIN_BATCHES, JobSystem::GetThreadsCount());
+        if (!Graphics::ParallelDrawCalls || chunks <= 1 || !CanUseInstancing(bindParams.RenderContext.View.Pass))
+            return DrawBatches(context, bindParams, data, 0, count, 0);
+        PROFILE_CPU_NAMED("Parallel Draw");
+        while (DeferredContexts.Count() < chunks)
+            DeferredContexts.Add(New<GPUDeferredContext>(GPUDevice::Instance));
+        for (int32 i = 0; i < chunks; i++)
+            DeferredContexts[i]->Begin(context);
+        Function<void(int32)> job = [&bindParams, &data, count, chunks](int32 chunkIndex)
+        {
+            PROFILE_CPU_NAMED("Record Draw Calls");
+            const int32 start = count * chunkIndex / chunks;
+            const int32 end = count * (chunkIndex + 1) / chunks;
+            GPUDeferredContext* deferred = DeferredContexts[chunkIndex];
+            MaterialBase::BindParameters chunkBindParams(deferred, bindParams.RenderContext);
+            chunkBindParams.Input = bindParams.Input;
+            DrawBatches(deferred, chunkBindParams, data, start, end, GetInstanceBufferOffset(data, start));
+        };
+        JobSystem::Execute(job, chunks);
+        for (int32 i = 0; i < chunks; i++)
+            DeferredContexts[i]->Execute(context);
+        return GetInstanceBufferOffset(data, count);
+    }
+}
+
+void RenderList::ExecuteDrawCalls(const RenderContext& renderContext, DrawCallsList& list, RenderList* drawCallsList, GPUTextureView* input)
 {
     if (list.IsEmpty())
         return;
     PROFILE_GPU_CPU("Drawing");
+    const auto& drawCalls = drawCallsList->DrawCalls;
     const auto* drawCallsData = drawCalls.Get();
     const auto* listData = list.Indices.Get();
     const auto* batchesData = list.Batches.Get();
@@ -656,6 +901,13 @@ void RenderList::ExecuteDrawCalls(const RenderContext& renderContext, DrawCallsL
     // Clear SR slots to prevent any resources binding issues (leftovers from the previous passes)
     context->ResetSR();
 
+    // Scene materials can skip drawing until their pipelines are ready but single-frame and offline views need all draws
+    context->AllowAsyncPipelines = !renderContext.View.IsOfflinePass && !renderContext.View.IsSingleFrame;
+
+    // Draw calls that are not batched read per-object data from the objects buffer
+    GPUBuffer* objectBuffer = useInstancing ? drawCallsList->FlushObjectBuffer(context) : nullptr;
+    const DrawCall* prevObject = nullptr;
+
     // Prepare instance buffer
     if (useInstancing)
     {
@@ -719,62 +971,12 @@ void RenderList::ExecuteDrawCalls(const RenderContext& renderContext, DrawCallsL
     MaterialBase::BindParameters bindParams(context, renderContext);
     bindParams.Input = input;
     bindParams.BindViewData();
+    const DrawBatchesData batchesDrawData = { drawCallsData, listData, batchesData, useInstancing ? _instanceBuffer.GetBuffer() : nullptr, objectBuffer };
     if (useInstancing)
     {
-        int32 instanceBufferOffset = 0;
+        int32 instanceBufferOffset = ExecuteBatches(context, bindParams, batchesDrawData, list.Batches.Count());
         GPUBuffer* vb[4];
         uint32 vbOffsets[4];
-        for (int32 i = 0; i < list.Batches.Count(); i++)
-        {
-            auto& batch = batchesData[i];
-            const DrawCall& drawCall = drawCallsData[listData[batch.StartIndex]];
-
-            int32 vbCount = 0;
-            while (vbCount < ARRAY_COUNT(drawCall.Geometry.VertexBuffers) && drawCall.Geometry.VertexBuffers[vbCount])
-            {
-                vb[vbCount] = drawCall.Geometry.VertexBuffers[vbCount];
-                vbOffsets[vbCount] = drawCall.Geometry.VertexBuffersOffsets[vbCount];
-                vbCount++;
-            }
-            for (int32 j = vbCount; j < ARRAY_COUNT(drawCall.Geometry.VertexBuffers); j++)
-            {
-                vb[vbCount] = nullptr;
-                vbOffsets[vbCount] = 0;
-            }
-
-            bindParams.FirstDrawCall = &drawCall;
-            bindParams.DrawCallsCount = batch.BatchSize;
-            drawCall.Material->Bind(bindParams);
-
-            context->BindIB(drawCall.Geometry.IndexBuffer);
-
-            if (drawCall.InstanceCount == 0)
-            {
-                // No support for batching indirect draw calls
-                ASSERT_LOW_LAYER(batch.BatchSize == 1);
-
-                context->BindVB(ToSpan(vb, vbCount), vbOffsets);
-                context->DrawIndexedInstancedIndirect(drawCall.Draw.IndirectArgsBuffer, drawCall.Draw.IndirectArgsOffset);
-            }
-            else
-            {
-                if (batch.BatchSize == 1)
-                {
-                    context->BindVB(ToSpan(vb, vbCount), vbOffsets);
-                    context->DrawIndexedInstanced(drawCall.Draw.IndicesCount, batch.InstanceCount, 0, 0, drawCall.Draw.StartIndex);
-                }
-                else
-                {
-                    vbCount = 3;
-                    vb[vbCount] = _instanceBuffer.GetBuffer();
-                    vbOffsets[vbCount] = 0;
-                    vbCount++;
-                    context->BindVB(ToSpan(vb, vbCount), vbOffsets);
-                    context->DrawIndexedInstanced(drawCall.Draw.IndicesCount, batch.InstanceCount, instanceBufferOffset, 0, drawCall.Draw.StartIndex);
-                    instanceBufferOffset += batch.BatchSize;
-                }
-            }
-        }
         for (int32 i = 0; i < list.PreBatchedDrawCalls.Count(); i++)
         {
             auto& batch = BatchedDrawCalls.Get()[list.PreBatchedDrawCalls.Get()[i]];
@@ -796,6 +998,7 @@ void RenderList::ExecuteDrawCalls(const RenderContext& renderContext, DrawCallsL
             bindParams.FirstDrawCall = &drawCall;
             bindParams.DrawCallsCount = batch.Instances.Count();
             drawCall.Material->Bind(bindParams);
+            prevObject = nullptr;
 
             context->BindIB(drawCall.Geometry.IndexBuffer);
 
@@ -827,30 +1030,8 @@ void RenderList::ExecuteDrawCalls(const RenderContext& renderContext, DrawCallsL
     }
     else
     {
+        ExecuteBatches(context, bindParams, batchesDrawData, list.Batches.Count());
         bindParams.DrawCallsCount = 1;
-        for (int32 i = 0; i < list.Batches.Count(); i++)
-        {
-            auto& batch = batchesData[i];
-
-            for (int32 j = 0; j < batch.BatchSize; j++)
-            {
-                const DrawCall& drawCall = drawCalls[listData[batch.StartIndex + j]];
-                bindParams.FirstDrawCall = &drawCall;
-                drawCall.Material->Bind(bindParams);
-
-                context->BindIB(drawCall.Geometry.IndexBuffer);
-                context->BindVB(ToSpan(drawCall.Geometry.VertexBuffers, 3), drawCall.Geometry.VertexBuffersOffsets);
-
-                if (drawCall.InstanceCount == 0)
-                {
-                    context->DrawIndexedInstancedIndirect(drawCall.Draw.IndirectArgsBuffer, drawCall.Draw.IndirectArgsOffset);
-                }
-                else
-                {
-                    context->DrawIndexedInstanced(drawCall.Draw.IndicesCount, drawCall.InstanceCount, 0, 0, drawCall.Draw.StartIndex);
-                }
-            }
-        }
         for (int32 i = 0; i < list.PreBatchedDrawCalls.Count(); i++)
         {
             auto& batch = BatchedDrawCalls.Get()[list.PreBatchedDrawCalls.Get()[i]];
@@ -872,6 +1053,7 @@ void RenderList::ExecuteDrawCalls(const RenderContext& renderContext, DrawCallsL
                 drawCall.World.SetRow3(Float4(instance.InstanceTransform3, 0.0f));
                 drawCall.World.SetRow4(Float4(instance.InstanceOrigin, 1.0f));
                 drawCall.Material->Bind(bindParams);
+                prevObject = nullptr;
 
                 context->BindIB(drawCall.Geometry.IndexBuffer);
                 context->BindVB(ToSpan(drawCall.Geometry.VertexBuffers, 3), drawCall.Geometry.VertexBuffersOffsets);
@@ -884,6 +1066,12 @@ void RenderList::ExecuteDrawCalls(const RenderContext& renderContext, DrawCallsL
             for (int32 j = 0; j < list.Indices.Count(); j++)
             {
                 const DrawCall& drawCall = drawCalls[listData[j]];
+                if (objectBuffer && drawCall.ObjectIndex != -1)
+                {
+                    DrawObject(context, bindParams, drawCall, objectBuffer, prevObject);
+                    continue;
+                }
+                prevObject = nullptr;
                 bindParams.FirstDrawCall = &drawCall;
                 drawCall.Material->Bind(bindParams);
 
@@ -901,6 +1089,8 @@ void RenderList::ExecuteDrawCalls(const RenderContext& renderContext, DrawCallsL
             }
         }
     }
+
+    context->AllowAsyncPipelines = false;
 }
 
 void SurfaceDrawCallHandler::GetHash(const DrawCall& drawCall, uint32& batchKey)
@@ -4,13 +4,17 @@
 
 #include "Engine/Core/Collections/Array.h"
 #include "Engine/Core/Math/Half.h"
+#include "Engine/Core/Math/Quaternion.h"
+#include "Engine/Core/Types/Span.h"
 #include "Engine/Graphics/PostProcessSettings.h"
 #include "Engine/Graphics/DynamicBuffer.h"
+#include "Engine/Graphics/Models/Types.h"
 #include "Engine/Scripting/ScriptingObject.h"
 #include "DrawCall.h"
 #include "RenderListBuffer.h"
 #include "RendererAllocation.h"
 #include "RenderSetup.h"
+#include "OcclusionBuffer.h"
 
 enum class StaticFlags;
 class RenderBuffers;
@@ -155,6 +159,20 @@ struct RendererSkyLightData
     void SetupLightData(LightData* data, bool useShadow) const;
 };
 
+struct RendererImpostorData
+{
+    GPUTexture* Albedo;
+    GPUTexture* Normal;
+
+    Float3 Position;
+    float Radius;
+
+    Quaternion Orientation;
+
+    float Fade;
+    int32 Frames;
+};
+
 /// <summary>
 /// The draw calls list types.
 /// </summary>
@@ -193,6 +211,20 @@ API_ENUM() enum class DrawCallsListType
     MAX,
 };
 
+/// <summary>
+/// Represents data per instance element used for instanced rendering.
+/// </summary>
+PACK_STRUCT(struct FLAXENGINE_API InstanceData
+    {
+    Float3 InstanceOrigin;
+    float PerInstanceRandom;
+    Float3 InstanceTransform1;
+    float LODDitherFactor;
+    Float3 InstanceTransform2;
+    Float3 InstanceTransform3;
+    Half4 InstanceLightmapArea;
+    });
+
 /// <summary>
 /// Represents a patch of draw calls that can be submitted to rendering.
 /// </summary>
@@ -227,7 +259,7 @@ struct DrawBatch
 struct BatchedDrawCall
 {
     DrawCall DrawCall;
-    Array<struct InstanceData, RendererAllocation> Instances;
+    Array<InstanceData, RendererAllocation> Instances;
 };
 
 /// <summary>
@@ -299,11 +331,21 @@ API_CLASS(Sealed) class FLAXENGINE_API RenderList : public ScriptingObject
     /// </summary>
     RenderListBuffer<BatchedDrawCall> BatchedDrawCalls;
 
+    /// <summary>
+    /// Per-object data of the draw calls (transformation, LOD dither factor, etc.) referenced by DrawCall::ObjectIndex. Filled during draw calls collection and uploaded to the GPU once before drawing so draw calls of the different objects don't need to update material constants.
+    /// </summary>
+    RenderListBuffer<InstanceData> Objects;
+
     /// <summary>
     /// The draw calls lists. Each for the separate draw pass.
     /// </summary>
     DrawCallsList DrawCallsLists[(int32)DrawCallsListType::MAX];
 
+    /// <summary>
+    /// The CPU occlusion culling buffer with occluders rasterized for the main view (valid only for the main render context list).
+    /// </summary>
+    OcclusionBuffer Occlusion;
+
     /// <summary>
     /// The additional draw calls list for Depth drawing into Shadow Projections that use DrawCalls from main render context. This assumes that RenderContextBatch contains main context and shadow projections only.
     /// </summary>
@@ -339,6 +381,11 @@ API_CLASS(Sealed) class FLAXENGINE_API RenderList : public ScriptingObject
     /// </summary>
     Array<Decal*> Decals;
 
+    /// <summary>
+    /// Impostors registered for the rendering (distant models replaced with the camera-facing quads that use the baked atlases).
+    /// </summary>
+    RenderListBuffer<RendererImpostorData> Impostors;
+
     /// <summary>
     /// Local volumetric fog particles registered for the rendering.
     /// </summary>
@@ -403,6 +450,8 @@ API_CLASS(Sealed) class FLAXENGINE_API RenderList : public ScriptingObject
 
 private:
     DynamicVertexBuffer _instanceBuffer;
+    DynamicVertexBuffer _objectBuffer;
+    int32 _objectBufferCount = 0;
 
 public:
     /// <summary>
@@ -503,7 +552,8 @@ API_CLASS(Sealed) class FLAXENGINE_API RenderList : public ScriptingObject
     /// <param name="drawCall">The draw call data.</param>
     /// <param name="receivesDecals">True if the rendered mesh can receive decals.</param>
     /// <param name="sortOrder">Object sorting key.</param>
-    void AddDrawCall(const RenderContextBatch& renderContextBatch, DrawPass drawModes, StaticFlags staticFlags, ShadowsCastingMode shadowsMode, const BoundingSphere& bounds, DrawCall& drawCall, bool receivesDecals = true, int16 sortOrder = 0);
+    /// <param name="clusters">The optional mesh clusters used to draw only the visible parts of the mesh in the shadow projections.</param>
+    void AddDrawCall(const RenderContextBatch& renderContextBatch, DrawPass drawModes, StaticFlags staticFlags, ShadowsCastingMode shadowsMode, const BoundingSphere& bounds, DrawCall& drawCall, bool receivesDecals = true, int16 sortOrder = 0, const Span<MeshCluster>& clusters = Span<MeshCluster>());
 
     /// <summary>
     /// Sorts the collected draw calls list.
@@ -533,7 +583,7 @@ API_CLASS(Sealed) class FLAXENGINE_API RenderList : public ScriptingObject
     /// <param name="input">The input scene color. It's optional and used in forward/postFx rendering.</param>
     API_FUNCTION() FORCE_INLINE void ExecuteDrawCalls(API_PARAM(Ref) const RenderContext& renderContext, DrawCallsListType listType, GPUTextureView* input = nullptr)
     {
-        ExecuteDrawCalls(renderContext, DrawCallsLists[(int32)listType], DrawCalls, input);
+        ExecuteDrawCalls(renderContext, DrawCallsLists[(int32)listType], this, input);
     }
 
     /// <summary>
@@ -544,7 +594,7 @@ API_CLASS(Sealed) class FLAXENGINE_API RenderList : public ScriptingObject
     /// <param name="input">The input scene color. It's optional and used in forward/postFx rendering.</param>
     FORCE_INLINE void ExecuteDrawCalls(const RenderContext& renderContext, DrawCallsList& list, GPUTextureView* input = nullptr)
     {
-        ExecuteDrawCalls(renderContext, list, DrawCalls, input);
+        ExecuteDrawCalls(renderContext, list, this, input);
     }
 
     /// <summary>
@@ -552,24 +602,14 @@ API_CLASS(Sealed) class FLAXENGINE_API RenderList : public ScriptingObject
     /// </summary>
     /// <param name="renderContext">The rendering context.</param>
     /// <param name="list">The collected draw calls indices list.</param>
-    /// <param name="drawCalls">The collected draw calls list.</param>
+    /// <param name="drawCallsList">The render list that contains the collected draw calls (and their objects data).</param>
     /// <param name="input">The input scene color. It's optional and used in forward/postFx rendering.</param>
-    void ExecuteDrawCalls(const RenderContext& renderContext, DrawCallsList& list, const RenderListBuffer<DrawCall>& drawCalls, GPUTextureView* input);
-};
+    void ExecuteDrawCalls(const RenderContext& renderContext, DrawCallsList& list, RenderList* drawCallsList, GPUTextureView* input);
 
-/// <summary>
-/// Represents data per instance element used for instanced rendering.
-/// </summary>
-PACK_STRUCT(struct FLAXENGINE_API InstanceData
-    {
-    Float3 InstanceOrigin;
-    float PerInstanceRandom;
-    Float3 InstanceTransform1;
-    float LODDitherFactor;
-    Float3 InstanceTransform2;
-    Float3 InstanceTransform3;
-    Half4 InstanceLightmapArea;
-    });
+private:
+    void AddObject(DrawCall& drawCall);
+    GPUBuffer* FlushObjectBuffer(GPUContext* context);
+};
 
 struct SurfaceDrawCallHandler
 {
@@ -3,7 +3,7 @@
 #pragma once
 
 #include "Engine/Platform/Platform.h"
-#include "Engine/Platform/CriticalSection.h"
+#include "Engine/Threading/FastLock.h"
 #include "Engine/Core/Memory/Memory.h"
 #include "Engine/Core/Memory/Allocation.h"
 
@@ -26,7 +26,7 @@ class RenderListBuffer
     volatile int64 _threadsAdding = 0;
     volatile int64 _threadsResizing = 0;
     AllocationData _allocation;
-    CriticalSection _locker;
+    FastLock _locker;
 
 public:
     /// <summary>
@@ -161,9 +161,9 @@ class RenderListBuffer
     }
 
     /// <summary>
-    /// Gets the critical section locking the collection during resizing.
+    /// Gets the lock locking the collection during resizing.
     /// </summary>
-    FORCE_INLINE const CriticalSection& Locker() const
+    FORCE_INLINE const FastLock& Locker() const
     {
         return _locker;
     }
@@ -269,7 +269,16 @@ class RenderListBuffer
         }
         else
         {
-            EnsureCapacity(size, preserveContents);
+            // Lock is not recursive so grow the capacity here (instead of calling EnsureCapacity)
+            int32 capacity = (int32)Platform::AtomicRead(&_capacity);
+            if (capacity < size)
+            {
+                capacity = _allocation.CalculateCapacityGrow(capacity, size);
+                const int32 count = preserveContents ? (int32)_count : 0;
+                _allocation.Relocate(capacity, (int32)_count, count);
+                Platform::AtomicStore(&_capacity, capacity);
+                _count = count;
+            }
             Memory::ConstructItems(_allocation.Get() + _count, size - (int32)_count);
         }
         _count = size;
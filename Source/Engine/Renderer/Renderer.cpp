@@ -2,6 +2,7 @@
 
 #include "Renderer.h"
 #include "Engine/Graphics/GPUContext.h"
+#include "Engine/Graphics/Graphics.h"
 #include "Engine/Graphics/RenderTargetPool.h"
 #include "Engine/Graphics/RenderBuffers.h"
 #include "Engine/Graphics/RenderTask.h"
@@ -53,7 +54,7 @@ class RendererService : public EngineService
 {
 public:
     RendererService()
-        : EngineService(TEXT("Renderer"), 20)
+        : EngineService(TEXT("Renderer"), 20, true)
     {
     }
 
@@ -367,6 +368,13 @@ void RenderInner(SceneRenderTask* task, RenderContext& renderContext, RenderCont
         }
         if (drawShadows)
             ShadowsPass::Instance()->SetupShadows(renderContext, renderContextBatch);
+
+        // Rasterize occluders for the CPU occlusion culling of the main view
+        if (Graphics::OcclusionCulling && !view.IsOfflinePass && EnumHasAllFlags(task->ActorsSource, ActorsSources::Scenes))
+        {
+            Level::CollectOccluders(renderContext);
+            renderContext.List->Occlusion.Render(renderContext);
+        }
 #if USE_EDITOR
         GBufferPass::Instance()->PreOverrideDrawCalls(renderContext);
 #endif
@@ -632,7 +632,7 @@ void ShadowsPass::RenderShadow(RenderContextBatch& renderContextBatch, RendererP
         context->ClearDepth(rt);
         auto& shadowContext = renderContextBatch.Contexts[shadowData.ContextIndex + faceIndex];
         shadowContext.List->ExecuteDrawCalls(shadowContext, DrawCallsListType::Depth);
-        shadowContext.List->ExecuteDrawCalls(shadowContext, shadowContext.List->ShadowDepthDrawCallsList, renderContext.List->DrawCalls, nullptr);
+        shadowContext.List->ExecuteDrawCalls(shadowContext, shadowContext.List->ShadowDepthDrawCallsList, renderContext.List, nullptr);
     }
 
     // Restore GPU context
@@ -710,7 +710,7 @@ void ShadowsPass::RenderShadow(RenderContextBatch& renderContextBatch, RendererS
         context->ClearDepth(rt);
         auto& shadowContext = renderContextBatch.Contexts[shadowData.ContextIndex + faceIndex];
         shadowContext.List->ExecuteDrawCalls(shadowContext, DrawCallsListType::Depth);
-        shadowContext.List->ExecuteDrawCalls(shadowContext, shadowContext.List->ShadowDepthDrawCallsList, renderContext.List->DrawCalls, nullptr);
+        shadowContext.List->ExecuteDrawCalls(shadowContext, shadowContext.List->ShadowDepthDrawCallsList, renderContext.List, nullptr);
     }
 
     // Restore GPU context
@@ -780,7 +780,7 @@ void ShadowsPass::RenderShadow(RenderContextBatch& renderContextBatch, RendererD
         context->ClearDepth(rt);
         auto& shadowContext = renderContextBatch.Contexts[shadowData.ContextIndex + cascadeIndex];
         shadowContext.List->ExecuteDrawCalls(shadowContext, DrawCallsListType::Depth);
-        shadowContext.List->ExecuteDrawCalls(shadowContext, shadowContext.List->ShadowDepthDrawCallsList, renderContext.List->DrawCalls, nullptr);
+        shadowContext.List->ExecuteDrawCalls(shadowContext, shadowContext.List->ShadowDepthDrawCallsList, renderContext.List, nullptr);
     }
 
     // Restore GPU context
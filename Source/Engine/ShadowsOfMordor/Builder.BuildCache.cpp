@@ -17,12 +17,18 @@ ShadowsOfMordor::Builder::LightmapBuildCache::~LightmapBuildCache()
     SAFE_DELETE_GPU_RESOURCE(LightmapData);
 }
 
-bool ShadowsOfMordor::Builder::LightmapBuildCache::Init(const LightmapSettings* settings)
+bool ShadowsOfMordor::Builder::LightmapBuildCache::Init(const LightmapSettings* settings, bool useCPU)
 {
+    const auto elementsCount = (int32)settings->AtlasSize * (int32)settings->AtlasSize * NUM_SH_TARGETS;
+    if (useCPU)
+    {
+        LightmapDataCPU.Resize(elementsCount);
+        Platform::MemoryClear(LightmapDataCPU.Get(), LightmapDataCPU.Count() * sizeof(IrradianceTexel));
+        return false;
+    }
     if (LightmapData)
         return false;
     LightmapData = GPUDevice::Instance->CreateBuffer(TEXT("LightmapBuildCache"));
-    const auto elementsCount = (int32)settings->AtlasSize * (int32)settings->AtlasSize * NUM_SH_TARGETS;
     if (LightmapData->Init(GPUBufferDescription::Typed(elementsCount, HemispheresFormatToPixelFormat[HEMISPHERES_IRRADIANCE_FORMAT], true)))
         return true;
     return false;
@@ -100,8 +106,12 @@ void ShadowsOfMordor::Builder::SceneBuildCache::UpdateLightmaps()
         ASSERT(lightmap);
         lightmap->GetTextures(lightmaps);
 
-        // Download buffer data
-        if (lightmapEntry.LightmapData->DownloadData(ImportLightmapTextureData))
+        // Download buffer data (or use the data baked on CPU)
+        if (lightmapEntry.LightmapDataCPU.HasItems())
+        {
+            ImportLightmapTextureData.Link((const byte*)lightmapEntry.LightmapDataCPU.Get(), lightmapEntry.LightmapDataCPU.Count() * sizeof(IrradianceTexel));
+        }
+        else if (lightmapEntry.LightmapData->DownloadData(ImportLightmapTextureData))
         {
             LOG(Error, "Cannot download LightmapData.");
             return;
@@ -172,11 +182,14 @@ bool ShadowsOfMordor::Builder::SceneBuildCache::Init(ShadowsOfMordor::Builder* b
     Builder = builder;
     SceneIndex = index;
     Scene = scene;
-    const int32 atlasSize = (int32)GetSettings().AtlasSize;
-    TempLightmapData = GPUDevice::Instance->CreateBuffer(TEXT("LightmapBuildCache"));
-    const auto elementsCount = atlasSize * atlasSize * NUM_SH_TARGETS;
-    if (TempLightmapData->Init(GPUBufferDescription::Typed(elementsCount, HemispheresFormatToPixelFormat[HEMISPHERES_IRRADIANCE_FORMAT], true)))
-        return true;
+    if (!builder->_useCPU)
+    {
+        const int32 atlasSize = (int32)GetSettings().AtlasSize;
+        TempLightmapData = GPUDevice::Instance->CreateBuffer(TEXT("LightmapBuildCache"));
+        const auto elementsCount = atlasSize * atlasSize * NUM_SH_TARGETS;
+        if (TempLightmapData->Init(GPUBufferDescription::Typed(elementsCount, HemispheresFormatToPixelFormat[HEMISPHERES_IRRADIANCE_FORMAT], true)))
+            return true;
+    }
 
     LOG(Info, "Scene \'{0}\' quality: {1}", scene->GetName(), scene->Info.LightmapSettings.Quality);
     return false;
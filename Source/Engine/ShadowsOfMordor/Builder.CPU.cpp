@@ -0,0 +1,751 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#include "Builder.h"
+#include "LightmapTracer.h"
+#include "Engine/Core/Log.h"
+#include "Engine/Core/Math/Math.h"
+#include "Engine/Core/RandomStream.h"
+#include "Engine/Core/Types/Variant.h"
+#include "Engine/Level/Scene/Scene.h"
+#include "Engine/Level/Actors/StaticModel.h"
+#include "Engine/Level/Actors/DirectionalLight.h"
+#include "Engine/Level/Actors/PointLight.h"
+#include "Engine/Level/Actors/SpotLight.h"
+#include "Engine/Level/Actors/SkyLight.h"
+#include "Engine/Foliage/Foliage.h"
+#include "Engine/Content/Assets/MaterialBase.h"
+#include "Engine/Graphics/Models/Types.h"
+#include "Engine/Graphics/PixelFormatExtensions.h"
+#include "Engine/Threading/JobSystem.h"
+#include "Engine/Threading/Threading.h"
+#include "Engine/Profiler/ProfilerCPU.h"
+
+// Matches the values used by the BakeLightmap shader
+#define USED_TEXELS_BIAS 0.001f
+#define BACKGROUND_TEXELS_MARK -1.0f
+
+namespace
+{
+    using ShadowsOfMordor::Builder;
+    using ShadowsOfMordor::LightmapTracer;
+
+    struct EntryMesh
+    {
+        const Mesh* Geometry;
+        MaterialBase* Material;
+        Matrix World;
+        Rectangle UVsArea;
+        int32 LightmapIndex;
+    };
+
+    struct MeshData
+    {
+        BytesContainer IB, VB0, VB1;
+        int32 IndicesCount;
+        int32 VerticesCount;
+
+        bool Load(const Mesh* mesh)
+        {
+            int32 vb1Count;
+            if (mesh->DownloadDataCPU(MeshBufferType::Index, IB, IndicesCount)
+                || mesh->DownloadDataCPU(MeshBufferType::Vertex0, VB0, VerticesCount)
+                || mesh->DownloadDataCPU(MeshBufferType::Vertex1, VB1, vb1Count))
+                return true;
+            return vb1Count != VerticesCount;
+        }
+
+        FORCE_INLINE int32 GetIndex(int32 i) const
+        {
+            return IndicesCount <= MAX_uint16 ? ((const uint16*)IB.Get())[i] : ((const uint32*)IB.Get())[i];
+        }
+
+        FORCE_INLINE const VB0ElementType& GetVB0(int32 i) const
+        {
+            return ((const VB0ElementType*)VB0.Get())[i];
+        }
+
+        FORCE_INLINE const VB1ElementType& GetVB1(int32 i) const
+        {
+            return ((const VB1ElementType*)VB1.Get())[i];
+        }
+    };
+
+    struct PrevLightmap
+    {
+        const Builder::IrradianceTexel* Data;
+        int32 AtlasSize;
+    };
+
+    struct TraceContext
+    {
+        const LightmapTracer* Tracer;
+        Array<PrevLightmap> Lightmaps;
+        Array<int32> ScenesLightmapsStart;
+    };
+
+    void GetEntryMeshes(const Builder::GeometryEntry& entry, Array<EntryMesh, InlinedAllocation<8>>& meshes)
+    {
+        switch (entry.Type)
+        {
+        case Builder::GeometryType::StaticModel:
+        {
+            auto staticModel = entry.AsStaticModel.Actor;
+            if (!staticModel->Model || staticModel->Lightmap.TextureIndex == INVALID_INDEX)
+                break;
+            Matrix world;
+            staticModel->GetTransform().GetWorld(world);
+            auto& lod = staticModel->Model->LODs[0];
+            for (int32 meshIndex = 0; meshIndex < lod.Meshes.Count(); meshIndex++)
+            {
+                auto& mesh = lod.Meshes[meshIndex];
+                const int32 slotIndex = mesh.GetMaterialSlotIndex();
+                if (!staticModel->Entries[slotIndex].Visible || !mesh.HasLightmapUVs())
+                    continue;
+                auto& e = meshes.AddOne();
+                e.Geometry = &mesh;
+                e.Material = staticModel->GetMaterial(slotIndex);
+                e.World = world;
+                e.UVsArea = staticModel->Lightmap.UVsArea;
+                e.LightmapIndex = staticModel->Lightmap.TextureIndex;
+            }
+            break;
+        }
+        case Builder::GeometryType::Foliage:
+        {
+            auto foliage = entry.AsFoliage.Actor;
+            auto& instance = foliage->Instances[entry.AsFoliage.InstanceIndex];
+            auto& type = foliage->FoliageTypes[entry.AsFoliage.TypeIndex];
+            if (!type.Model || instance.Lightmap.TextureIndex == INVALID_INDEX)
+                break;
+            auto& mesh = type.Model->LODs[0].Meshes[entry.AsFoliage.MeshIndex];
+            const int32 slotIndex = mesh.GetMaterialSlotIndex();
+            auto& e = meshes.AddOne();
+            e.Geometry = &mesh;
+            e.Material = slotIndex < type.Entries.Count() && type.Entries[slotIndex].Material ? type.Entries[slotIndex].Material.Get() : type.Model->MaterialSlots[slotIndex].Material.Get();
+            foliage->GetTransform().LocalToWorld(instance.Transform).GetWorld(e.World);
+            e.UVsArea = instance.Lightmap.UVsArea;
+            e.LightmapIndex = instance.Lightmap.TextureIndex;
+            break;
+        }
+        default:
+            // Terrain is not supported by the CPU backend
+            break;
+        }
+    }
+
+    void GetMaterialSurface(MaterialBase* material, LightmapTracer::Surface& surface)
+    {
+        // Approximate the surface with the material color parameters (the material graph is not evaluated on CPU)
+        surface.Albedo = Float3(CPU_BAKE_DEFAULT_ALBEDO);
+        surface.Emissive = Float3::Zero;
+        if (!material || material->WaitForLoaded())
+            return;
+        for (const MaterialParameter& param : material->GetParameters())
+        {
+            if (param.GetParameterType() != MaterialParameterType::Color)
+                continue;
+            const String& name = param.GetName();
+            const Color color = (Color)param.GetValue();
+            if (name.Contains(TEXT("Emissive"), StringSearchCase::IgnoreCase))
+                surface.Emissive = color.ToFloat3();
+            else if (name.Contains(TEXT("Color"), StringSearchCase::IgnoreCase) || name.Contains(TEXT("Albedo"), StringSearchCase::IgnoreCase) || name.Contains(TEXT("Diffuse"), StringSearchCase::IgnoreCase))
+                surface.Albedo = Float3::Min(color.ToFloat3(), Float3(0.95f)); // Energy-conserving to keep the bounces stable
+        }
+    }
+
+    bool cacheLightsTree(Actor* actor, LightmapTracer* tracer)
+    {
+        if (!actor->GetIsActive())
+            return false;
+        const auto light = dynamic_cast<Light*>(actor);
+        if (!light)
+            return true;
+        const float intensity = light->IndirectLightingIntensity * light->GetScene()->Info.LightmapSettings.IndirectLightingIntensity;
+
+        if (const auto skyLight = dynamic_cast<SkyLight*>(light))
+        {
+            // Sky is approximated with a constant radiance
+            tracer->SkyRadiance += (skyLight->Color.ToFloat3() * skyLight->Brightness + skyLight->AdditiveColor.ToFloat3()) * intensity;
+            return true;
+        }
+
+        LightmapTracer::Light data;
+        Platform::MemoryClear(&data, sizeof(data));
+        float brightness = light->Brightness;
+        if (dynamic_cast<DirectionalLight*>(light))
+        {
+            data.Type = LightmapTracer::LightType::Directional;
+        }
+        else if (const auto pointLight = dynamic_cast<PointLight*>(light))
+        {
+            data.Type = LightmapTracer::LightType::Point;
+            brightness = pointLight->ComputeBrightness();
+            data.Radius = pointLight->GetScaledRadius();
+            data.FallOffExponent = pointLight->FallOffExponent;
+            data.UseInverseSquaredFalloff = pointLight->UseInverseSquaredFalloff;
+        }
+        else if (const auto spotLight = dynamic_cast<SpotLight*>(light))
+        {
+            data.Type = LightmapTracer::LightType::Spot;
+            brightness = spotLight->ComputeBrightness();
+            data.Radius = spotLight->GetScaledRadius();
+            data.FallOffExponent = spotLight->FallOffExponent;
+            data.UseInverseSquaredFalloff = spotLight->UseInverseSquaredFalloff;
+            const float cosOuterCone = Math::Cos(spotLight->GetOuterConeAngle() * DegreesToRadians);
+            const float cosInnerCone = Math::Cos(spotLight->GetInnerConeAngle() * DegreesToRadians);
+            data.CosOuterCone = cosOuterCone;
+            data.InvCosConeDifference = 1.0f / Math::Max(cosInnerCone - cosOuterCone, 0.0001f);
+        }
+        else
+        {
+            return true;
+        }
+        data.Color = light->Color.ToFloat3() * (brightness * intensity);
+        data.Position = (Float3)light->GetPosition();
+        data.Direction = light->GetDirection();
+        data.CastShadows = EnumHasAnyFlags(static_cast<LightWithShadow*>(light)->ShadowsMode, ShadowsCastingMode::StaticOnly);
+        if (data.Color.MaxValue() > ZeroTolerance && (data.Type == LightmapTracer::LightType::Directional || data.Radius > ZeroTolerance))
+            tracer->Lights.Add(data);
+        return true;
+    }
+
+    FORCE_INLINE Float4 ToFloat4(const Half4& v)
+    {
+        return v.ToFloat4();
+    }
+
+    FORCE_INLINE Float4 ToFloat4(const Float4& v)
+    {
+        return v;
+    }
+
+    FORCE_INLINE float EdgeFunction(const Float2& a, const Float2& b, const Float2& p)
+    {
+        return (b.X - a.X) * (p.Y - a.Y) - (b.Y - a.Y) * (p.X - a.X);
+    }
+
+    void InitCache(TextureData& data, int32 atlasSize, PixelFormat format)
+    {
+        data.Width = atlasSize;
+        data.Height = atlasSize;
+        data.Depth = 1;
+        data.Format = format;
+        data.Items.Resize(1);
+        data.Items[0].Mips.Resize(1);
+        auto& mip = data.Items[0].Mips[0];
+        mip.RowPitch = atlasSize * PixelFormatExtensions::SizeInBytes(format);
+        mip.DepthPitch = mip.RowPitch * atlasSize;
+        mip.Lines = atlasSize;
+        mip.Data.Allocate(mip.DepthPitch);
+        Platform::MemoryClear(mip.Data.Get(), mip.DepthPitch);
+    }
+
+    void WriteCache(ShadowsOfMordor::GenerateHemispheresData& data, int32 texelX, int32 texelY, const Float3& position, const Float3& normal)
+    {
+        const auto mipDataPositions = data.PositionsData.GetData(0, 0);
+#if CACHE_POSITIONS_FORMAT == HEMISPHERES_FORMAT_R32G32B32A32
+        mipDataPositions->Get<Float4>(texelX, texelY) = Float4(position, 1.0f);
+#elif CACHE_POSITIONS_FORMAT == HEMISPHERES_FORMAT_R16G16B16A16
+        mipDataPositions->Get<Half4>(texelX, texelY) = Half4(Float4(position, 1.0f));
+#else
+#error "Unknown format."
+#endif
+
+        const auto mipDataNormals = data.NormalsData.GetData(0, 0);
+#if CACHE_NORMALS_FORMAT == HEMISPHERES_FORMAT_R32G32B32A32
+        mipDataNormals->Get<Float4>(texelX, texelY) = Float4(normal, 1.0f);
+#elif CACHE_NORMALS_FORMAT == HEMISPHERES_FORMAT_R16G16B16A16
+        mipDataNormals->Get<Half4>(texelX, texelY) = Half4(Float4(normal, 1.0f));
+#else
+#error "Unknown format."
+#endif
+    }
+
+    Float3 SamplePrevIrradiance(const TraceContext& context, const LightmapTracer::Surface& surface, const Float2& lightmapUVs)
+    {
+        if (surface.LightmapIndex == INVALID_INDEX)
+            return Float3::Zero;
+        const auto& lightmap = context.Lightmaps[context.ScenesLightmapsStart[surface.SceneIndex] + surface.LightmapIndex];
+        if (!lightmap.Data)
+            return Float3::Zero;
+        const int32 x = Math::Clamp((int32)(lightmapUVs.X * lightmap.AtlasSize), 0, lightmap.AtlasSize - 1);
+        const int32 y = Math::Clamp((int32)(lightmapUVs.Y * lightmap.AtlasSize), 0, lightmap.AtlasSize - 1);
+        const auto texel = lightmap.Data + (y * lightmap.AtlasSize + x) * NUM_SH_TARGETS;
+
+        // Evaluate H-basis in the surface normal direction (see GetHBasisIrradiance in lightmap material feature)
+        const float h0Scale = 1.0f / Math::Sqrt(2.0f * PI);
+        const float h2Scale = Math::Sqrt(1.5f / PI);
+        Float3 result;
+        for (int32 i = 0; i < NUM_SH_TARGETS; i++)
+        {
+            const Float4 h = ToFloat4(texel[i]);
+            result.Raw[i] = Math::Max(h.X * h0Scale + h.Z * h2Scale, 0.0f);
+        }
+        return result;
+    }
+
+    Float3 ComputeDirectIrradiance(const LightmapTracer* tracer, const Float3& position, const Float3& normal)
+    {
+        Float3 result = Float3::Zero;
+        for (const auto& light : tracer->Lights)
+        {
+            Float3 L;
+            float distance = HEMISPHERES_FAR_PLANE;
+            float attenuation = 1.0f;
+            if (light.Type == LightmapTracer::LightType::Directional)
+            {
+                L = -light.Direction;
+            }
+            else
+            {
+                // Match the radial attenuation from LightingCommon.hlsl
+                const Float3 toLight = light.Position - position;
+                const float distanceSqr = toLight.LengthSquared();
+                const float radiusSqr = light.Radius * light.Radius;
+                if (distanceSqr >= radiusSqr)
+                    continue;
+                distance = Math::Sqrt(distanceSqr);
+                L = toLight / Math::Max(distance, ZeroTolerance);
+                if (light.UseInverseSquaredFalloff)
+                    attenuation = 1.0f / (distanceSqr + 1.0f) * Math::Square(Math::Saturate(1.0f - Math::Square(distanceSqr / radiusSqr)));
+                else
+                    attenuation = Math::Pow(1.0f - Math::Saturate(distanceSqr / radiusSqr), light.FallOffExponent);
+                if (light.Type == LightmapTracer::LightType::Spot)
+                    attenuation *= Math::Square(Math::Saturate((Float3::Dot(-L, light.Direction) - light.CosOuterCone) * light.InvCosConeDifference));
+            }
+            const float NoL = Float3::Dot(normal, L);
+            if (NoL <= 0.0f || attenuation <= ZeroTolerance)
+                continue;
+            if (light.CastShadows && tracer->Occluded(position, L, distance))
+                continue;
+            result += light.Color * (NoL * attenuation);
+        }
+        return result;
+    }
+
+    Float3 TraceRadiance(const TraceContext& context, const Float3& origin, const Float3& direction)
+    {
+        LightmapTracer::Hit hit;
+        if (!context.Tracer->Intersect(origin, direction, HEMISPHERES_FAR_PLANE, hit))
+            return context.Tracer->SkyRadiance;
+        Float3 normal;
+        Float2 lightmapUVs;
+        const auto& surface = context.Tracer->GetHitSurface(hit, normal, lightmapUVs);
+
+        // Backfaces are treated as black occluders to prevent light leaking through the geometry
+        if (Float3::Dot(normal, direction) > 0.0f)
+            return Float3::Zero;
+
+        const Float3 position = origin + direction * hit.Distance + normal * CPU_BAKE_RAY_BIAS;
+        const Float3 irradiance = ComputeDirectIrradiance(context.Tracer, position, normal) + SamplePrevIrradiance(context, surface, lightmapUVs);
+        return surface.Emissive + surface.Albedo * irradiance * (1.0f / PI);
+    }
+
+    void BakeHemisphere(const TraceContext& context, const Builder::HemisphereData& hemisphere, int32 seed, int32 maxSamples, Builder::IrradianceTexel* output)
+    {
+        // Create tangent frame (the same as the GPU backend uses so lightmaps decode the same way)
+        const Float3 normal = hemisphere.Normal;
+        const Float3 c1 = Float3::Cross(normal, Float3(0.0f, 0.0f, 1.0f));
+        const Float3 c2 = Float3::Cross(normal, Float3(0.0f, 1.0f, 0.0f));
+        const Float3 tangent = Float3::Normalize(c1.LengthSquared() > c2.LengthSquared() ? c1 : c2);
+        const Float3 binormal = Float3::Cross(tangent, normal);
+        const Float3 origin = hemisphere.Position + normal * CPU_BAKE_RAY_BIAS;
+
+        // SH3 projection with cosine kernel converted into H-basis (see ProjectOntoSH3 and ConvertSH3ToHBasis in SH.hlsl)
+        const float A0 = 3.141593f;
+        const float A1 = 2.095395f;
+        const float A2 = 0.785398f;
+        const float rt2 = Math::Sqrt(2.0f);
+        const float rt32 = Math::Sqrt(3.0f / 2.0f);
+        const float rt52 = Math::Sqrt(5.0f / 2.0f);
+        const float rt152 = Math::Sqrt(15.0f / 2.0f);
+
+        // Progressive stratified sampling of the uniform hemisphere, stops once the irradiance estimate converges
+        RandomStream rand(seed);
+        Float3 hBasis[4] = { Float3::Zero, Float3::Zero, Float3::Zero, Float3::Zero };
+        const float gridInv = 1.0f / CPU_BAKE_SAMPLES_GRID;
+        int32 samples = 0;
+        float prevEstimate = -1.0f;
+        while (samples < maxSamples)
+        {
+            for (int32 s = 0; s < CPU_BAKE_SAMPLES_GRID * CPU_BAKE_SAMPLES_GRID; s++)
+            {
+                const float z = ((float)(s % CPU_BAKE_SAMPLES_GRID) + rand.GetFraction()) * gridInv;
+                const float phi = ((float)(s / CPU_BAKE_SAMPLES_GRID) + rand.GetFraction()) * gridInv * (2.0f * PI);
+                const float r = Math::Sqrt(Math::Max(1.0f - z * z, 0.0f));
+                const float x = r * Math::Cos(phi);
+                const float y = r * Math::Sin(phi);
+                const Float3 direction = tangent * x + binormal * y + normal * z;
+
+                Float3 radiance = TraceRadiance(context, origin, direction);
+                const float radianceMax = radiance.MaxValue();
+                if (radianceMax > CPU_BAKE_SAMPLE_RADIANCE_MAX)
+                    radiance *= CPU_BAKE_SAMPLE_RADIANCE_MAX / radianceMax;
+
+                const float sh0 = 0.282095f * A0;
+                const float sh1 = 0.488603f * y * A1;
+                const float sh2 = 0.488603f * z * A1;
+                const float sh3 = 0.488603f * x * A1;
+                const float sh5 = 1.092548f * y * z * A2;
+                const float sh6 = 0.315392f * (3.0f * z * z - 1.0f) * A2;
+                const float sh7 = 1.092548f * x * z * A2;
+                hBasis[0] += radiance * (sh0 / rt2 + 0.5f * rt32 * sh2);
+                hBasis[1] += radiance * (sh1 / rt2 + (3.0f / 8.0f) * rt52 * sh5);
+                hBasis[2] += radiance * (sh2 / (2.0f * rt2) + 0.25f * rt152 * sh6);
+                hBasis[3] += radiance * (sh3 / rt2 + (3.0f / 8.0f) * rt52 * sh7);
+            }
+            samples += CPU_BAKE_SAMPLES_GRID * CPU_BAKE_SAMPLES_GRID;
+            if (samples >= CPU_BAKE_MIN_SAMPLES)
+            {
+                const float estimate = (hBasis[0].X + hBasis[0].Y + hBasis[0].Z) / (float)samples;
+                if (prevEstimate >= 0.0f && Math::Abs(estimate - prevEstimate) <= CPU_BAKE_CONVERGENCE_THRESHOLD * Math::Max(estimate, ZeroTolerance))
+                    break;
+                prevEstimate = estimate;
+            }
+        }
+
+        // Uniform hemisphere pdf is 1/(2*PI)
+        const float weight = 2.0f * PI / (float)samples;
+        for (int32 i = 0; i < NUM_SH_TARGETS; i++)
+        {
+            // Note: we add some bias to indicate that this texel has been used
+            Float4 value(hBasis[0].Raw[i], hBasis[1].Raw[i], hBasis[2].Raw[i], hBasis[3].Raw[i]);
+            value = value * weight + Float4(USED_TEXELS_BIAS);
+            value = Float4::Clamp(value, Float4::Zero, Float4(10000.0f));
+            output[i] = Builder::IrradianceTexel(value);
+        }
+    }
+}
+
+void ShadowsOfMordor::Builder::buildTracer()
+{
+    PROFILE_CPU();
+    if (_tracer)
+        _tracer->Clear();
+    else
+        _tracer = New<LightmapTracer>();
+
+    // Collect the lightmapped geometry
+    bool hasTerrain = false;
+    Array<EntryMesh, InlinedAllocation<8>> meshes;
+    MeshData meshData;
+    for (int32 sceneIndex = 0; sceneIndex < _scenes.Count(); sceneIndex++)
+    {
+        auto scene = _scenes[sceneIndex];
+        ScopeLock lock(scene->EntriesLocker);
+        for (int32 entryIndex = 0; entryIndex < scene->Entries.Count(); entryIndex++)
+        {
+            const auto& entry = scene->Entries[entryIndex];
+            hasTerrain |= entry.Type == GeometryType::Terrain;
+            meshes.Clear();
+            GetEntryMeshes(entry, meshes);
+            for (const auto& e : meshes)
+            {
+                if (meshData.Load(e.Geometry))
+                {
+                    LOG(Warning, "Cannot access mesh data for the lightmap baking.");
+                    continue;
+                }
+                const int32 surfaceIndex = _tracer->Surfaces.Count();
+                auto& surface = _tracer->Surfaces.AddOne();
+                GetMaterialSurface(e.Material, surface);
+                surface.SceneIndex = sceneIndex;
+                surface.LightmapIndex = e.LightmapIndex;
+
+                for (int32 i = 0; i + 2 < meshData.IndicesCount; i += 3)
+                {
+                    int32 indices[3] = { meshData.GetIndex(i + 0), meshData.GetIndex(i + 1), meshData.GetIndex(i + 2) };
+                    Float3 positions[3];
+                    Float2 uvs[3];
+                    Float3 normalsSum = Float3::Zero;
+                    for (int32 j = 0; j < 3; j++)
+                    {
+                        const auto& vb1 = meshData.GetVB1(indices[j]);
+                        Float3::Transform(meshData.GetVB0(indices[j]).Position, e.World, positions[j]);
+                        uvs[j] = vb1.LightmapUVs.ToFloat2() * e.UVsArea.Size + e.UVsArea.Location;
+                        normalsSum += vb1.Normal.ToFloat3() * 2.0f - 1.0f;
+                    }
+
+                    // Orient triangle to face the same side as the mesh normals (backfaces are black for the tracer)
+                    Float3 normalWS;
+                    Float3::TransformNormal(normalsSum, e.World, normalWS);
+                    if (Float3::Dot(Float3::Cross(positions[1] - positions[0], positions[2] - positions[0]), normalWS) < 0.0f)
+                    {
+                        Swap(positions[1], positions[2]);
+                        Swap(uvs[1], uvs[2]);
+                    }
+
+                    _tracer->AddTriangle(positions[0], positions[1], positions[2], uvs[0], uvs[1], uvs[2], surfaceIndex);
+                }
+            }
+        }
+    }
+    if (hasTerrain)
+        LOG(Warning, "Terrain is not supported by the CPU lightmaps baking backend and will be skipped.");
+
+    // Collect the light sources
+    Function<bool(Actor*, LightmapTracer*)> cacheLightsFunc = cacheLightsTree;
+    for (int32 sceneIndex = 0; sceneIndex < _scenes.Count(); sceneIndex++)
+        _scenes[sceneIndex]->Scene->TreeExecute<LightmapTracer*>(cacheLightsFunc, _tracer);
+
+    _tracer->Build();
+    LOG(Info, "Lightmaps tracer scene built. Triangles: {0}, Surfaces: {1}, Lights: {2}", _tracer->GetTrianglesCount(), _tracer->Surfaces.Count(), _tracer->Lights.Count());
+}
+
+void ShadowsOfMordor::Builder::renderCacheCPU(SceneBuildCache* scene, LightmapBuildCache& lightmapEntry, GenerateHemispheresData& cacheData)
+{
+    PROFILE_CPU();
+    const int32 atlasSize = (int32)scene->GetSettings().AtlasSize;
+    InitCache(cacheData.PositionsData, atlasSize, HemispheresFormatToPixelFormat[CACHE_POSITIONS_FORMAT]);
+    InitCache(cacheData.NormalsData, atlasSize, HemispheresFormatToPixelFormat[CACHE_NORMALS_FORMAT]);
+
+    // Coverage per texel: 0 - empty, 1 - covered by the triangle edge, 2 - texel center inside the triangle
+    Array<byte> coverage;
+    coverage.Resize(atlasSize * atlasSize);
+    Platform::MemoryClear(coverage.Get(), coverage.Count());
+
+    ScopeLock lock(scene->EntriesLocker);
+    Array<EntryMesh, InlinedAllocation<8>> meshes;
+    MeshData meshData;
+    const float atlasSizeFloat = (float)atlasSize;
+    for (int32 entryIndex : lightmapEntry.Entries)
+    {
+        meshes.Clear();
+        GetEntryMeshes(scene->Entries[entryIndex], meshes);
+        for (const auto& e : meshes)
+        {
+            if (meshData.Load(e.Geometry))
+                continue;
+            Matrix normalMatrix;
+            Matrix::Invert(e.World, normalMatrix);
+            normalMatrix.Transpose();
+
+            // Rasterize triangles in the lightmap texels space (conservatively to cover the texels on the chart edges)
+            for (int32 i = 0; i + 2 < meshData.IndicesCount; i += 3)
+            {
+                Float3 positions[3], normals[3];
+                Float2 uvs[3];
+                for (int32 j = 0; j < 3; j++)
+                {
+                    const int32 index = meshData.GetIndex(i + j);
+                    const auto& vb1 = meshData.GetVB1(index);
+                    Float3::Transform(meshData.GetVB0(index).Position, e.World, positions[j]);
+                    Float3::TransformNormal(vb1.Normal.ToFloat3() * 2.0f - 1.0f, normalMatrix, normals[j]);
+                    uvs[j] = (vb1.LightmapUVs.ToFloat2() * e.UVsArea.Size + e.UVsArea.Location) * atlasSizeFloat;
+                }
+                const float area = EdgeFunction(uvs[0], uvs[1], uvs[2]);
+                if (Math::Abs(area) < ZeroTolerance)
+                    continue;
+                const float invArea = 1.0f / area;
+                const float edgeLengths[3] = { Float2::Distance(uvs[1], uvs[2]), Float2::Distance(uvs[2], uvs[0]), Float2::Distance(uvs[0], uvs[1]) };
+                const Float2 min = Float2::Min(Float2::Min(uvs[0], uvs[1]), uvs[2]) - CPU_BAKE_CACHE_EDGE_DISTANCE;
+                const Float2 max = Float2::Max(Float2::Max(uvs[0], uvs[1]), uvs[2]) + CPU_BAKE_CACHE_EDGE_DISTANCE;
+                const int32 minX = Math::Max((int32)Math::Floor(min.X), 0), minY = Math::Max((int32)Math::Floor(min.Y), 0);
+                const int32 maxX = Math::Min((int32)Math::Ceil(max.X), atlasSize - 1), maxY = Math::Min((int32)Math::Ceil(max.Y), atlasSize - 1);
+                for (int32 y = minY; y <= maxY; y++)
+                {
+                    for (int32 x = minX; x <= maxX; x++)
+                    {
+                        const Float2 p((float)x + 0.5f, (float)y + 0.5f);
+                        float w[3] = { EdgeFunction(uvs[1], uvs[2], p) * invArea, EdgeFunction(uvs[2], uvs[0], p) * invArea, EdgeFunction(uvs[0], uvs[1], p) * invArea };
+                        byte texelCoverage = 2;
+                        float outsideDistance = 0.0f;
+                        for (int32 j = 0; j < 3; j++)
+                        {
+                            if (w[j] < 0.0f)
+                            {
+                                texelCoverage = 1;
+                                outsideDistance = Math::Max(outsideDistance, -w[j] * Math::Abs(area) / Math::Max(edgeLengths[j], ZeroTolerance));
+                                w[j] = 0.0f;
+                            }
+                        }
+                        byte& texel = coverage[y * atlasSize + x];
+                        if (texel >= texelCoverage || outsideDistance > CPU_BAKE_CACHE_EDGE_DISTANCE)
+                            continue;
+                        texel = texelCoverage;
+                        const float wSumInv = 1.0f / Math::Max(w[0] + w[1] + w[2], ZeroTolerance);
+                        const Float3 position = (positions[0] * w[0] + positions[1] * w[1] + positions[2] * w[2]) * wSumInv;
+                        Float3 normal = normals[0] * w[0] + normals[1] * w[1] + normals[2] * w[2];
+                        if (normal.IsZero())
+                            continue;
+                        normal.Normalize();
+                        WriteCache(cacheData, x, y, position, normal);
+                    }
+                }
+            }
+        }
+    }
+}
+
+bool ShadowsOfMordor::Builder::renderHemispheresCPU()
+{
+    PROFILE_CPU();
+
+    // Keep the previous bounce results to compute the indirect lighting from them
+    TraceContext context;
+    context.Tracer = _tracer;
+    for (int32 sceneIndex = 0; sceneIndex < _scenes.Count(); sceneIndex++)
+    {
+        auto scene = _scenes[sceneIndex];
+        const int32 atlasSize = (int32)scene->GetSettings().AtlasSize;
+        context.ScenesLightmapsStart.Add(context.Lightmaps.Count());
+        for (auto& lightmapEntry : scene->Lightmaps)
+        {
+            if (_giBounceRunningIndex == 0)
+                lightmapEntry.LightmapDataCPUPrev.Clear();
+            else
+                lightmapEntry.LightmapDataCPU.Swap(lightmapEntry.LightmapDataCPUPrev);
+            lightmapEntry.LightmapDataCPU.Resize(atlasSize * atlasSize * NUM_SH_TARGETS);
+            Platform::MemoryClear(lightmapEntry.LightmapDataCPU.Get(), lightmapEntry.LightmapDataCPU.Count() * sizeof(IrradianceTexel));
+            auto& prev = context.Lightmaps.AddOne();
+            prev.Data = lightmapEntry.LightmapDataCPUPrev.HasItems() ? lightmapEntry.LightmapDataCPUPrev.Get() : nullptr;
+            prev.AtlasSize = atlasSize;
+        }
+    }
+
+    for (_workerActiveSceneIndex = 0; _workerActiveSceneIndex < _scenes.Count(); _workerActiveSceneIndex++)
+    {
+        auto scene = _scenes[_workerActiveSceneIndex];
+        const int32 atlasSize = (int32)scene->GetSettings().AtlasSize;
+        const int32 maxSamples = Math::Max(scene->GetSettings().SamplesPerTexel, CPU_BAKE_MIN_SAMPLES);
+        for (_workerStagePosition0 = 0; _workerStagePosition0 < scene->Lightmaps.Count(); _workerStagePosition0++)
+        {
+            auto& lightmapEntry = scene->Lightmaps[_workerStagePosition0];
+            IrradianceTexel* lightmapData = lightmapEntry.LightmapDataCPU.Get();
+            const int32 bounce = _giBounceRunningIndex;
+
+            // Trace hemispheres in batches to report progress and handle the build cancel
+            for (_workerStagePosition1 = 0; _workerStagePosition1 < lightmapEntry.Hemispheres.Count();)
+            {
+                const int32 start = _workerStagePosition1;
+                const int32 count = Math::Min(lightmapEntry.Hemispheres.Count() - start, CPU_BAKE_HEMISPHERES_PER_BATCH);
+                Function<void(int32)> job = [this, &context, &lightmapEntry, lightmapData, start, count, atlasSize, maxSamples, bounce](int32 jobIndex)
+                {
+                    PROFILE_CPU_NAMED("Lightmap Hemispheres Job");
+                    const int32 end = Math::Min((jobIndex + 1) * CPU_BAKE_HEMISPHERES_PER_JOB, count) + start;
+                    for (int32 i = jobIndex * CPU_BAKE_HEMISPHERES_PER_JOB + start; i < end; i++)
+                    {
+                        if (Platform::AtomicRead(&_wasBuildCancelled))
+                            return;
+                        const auto& hemisphere = lightmapEntry.Hemispheres[i];
+                        const int32 texelIndex = hemisphere.TexelY * atlasSize + hemisphere.TexelX;
+                        BakeHemisphere(context, hemisphere, texelIndex * 31 + bounce, maxSamples, lightmapData + texelIndex * NUM_SH_TARGETS);
+                    }
+                };
+                JobSystem::Execute(job, Math::DivideAndRoundUp(count, CPU_BAKE_HEMISPHERES_PER_JOB));
+                _workerStagePosition1 += count;
+
+                // Report progress
+                float hemispheresProgress = static_cast<float>(_workerStagePosition1) / Math::Max(lightmapEntry.Hemispheres.Count(), 1);
+                float lightmapsProgress = static_cast<float>(_workerStagePosition0 + hemispheresProgress) / scene->Lightmaps.Count();
+                float bouncesProgress = static_cast<float>(_giBounceRunningIndex) / _bounceCount;
+                reportProgress(BuildProgressStep::RenderHemispheres, lightmapsProgress / _bounceCount + bouncesProgress);
+                if (checkBuildCancelled())
+                    return true;
+            }
+
+            // Fill black holes with blurred data to prevent artifacts on the edges
+            postprocessLightmapCPU(lightmapEntry, atlasSize);
+        }
+
+        // Update lightmaps textures (the next bounces use the data baked on CPU directly)
+        if (_giBounceRunningIndex == _bounceCount - 1)
+            scene->UpdateLightmaps();
+    }
+
+    return false;
+}
+
+void ShadowsOfMordor::Builder::postprocessLightmapCPU(LightmapBuildCache& lightmapEntry, int32 atlasSize)
+{
+    PROFILE_CPU();
+    Array<Float4> input, output;
+    const int32 count = lightmapEntry.LightmapDataCPU.Count();
+    input.Resize(count);
+    output.Resize(count);
+    for (int32 i = 0; i < count; i++)
+        input[i] = ToFloat4(lightmapEntry.LightmapDataCPU[i]);
+
+    // Blur empty lightmap texels (uses only valid samples and marks texels without any data, see CS_BlurEmpty)
+    Function<void(int32)> blurEmptyJob = [&input, &output, atlasSize](int32 y)
+    {
+        const int32 blurRadius = 2;
+        for (int32 x = 0; x < atlasSize; x++)
+        {
+            float weight = 0.0f;
+            Float4 total[NUM_SH_TARGETS] = { Float4::Zero, Float4::Zero, Float4::Zero };
+            for (int32 sx = -blurRadius; sx <= blurRadius; sx++)
+            {
+                for (int32 sy = -blurRadius; sy <= blurRadius; sy++)
+                {
+                    const int32 sampleAddress = (Math::Clamp(y + sy, 0, atlasSize - 1) * atlasSize + Math::Clamp(x + sx, 0, atlasSize - 1)) * NUM_SH_TARGETS;
+                    if (input[sampleAddress].IsZero())
+                        continue;
+                    for (int32 i = 0; i < NUM_SH_TARGETS; i++)
+                        total[i] += input[sampleAddress + i] - USED_TEXELS_BIAS;
+                    weight++;
+                }
+            }
+            const int32 texelAddress = (y * atlasSize + x) * NUM_SH_TARGETS;
+            for (int32 i = 0; i < NUM_SH_TARGETS; i++)
+                output[texelAddress + i] = weight > 0.0001f ? total[i] / weight : Float4(BACKGROUND_TEXELS_MARK);
+        }
+    };
+    JobSystem::Execute(blurEmptyJob, atlasSize);
+    input.Swap(output);
+
+    // Keep blurring the empty lightmap texels (from background, see CS_Dilate)
+    volatile int64 hasBackground = 1;
+    Function<void(int32)> dilateJob = [&input, &output, &hasBackground, atlasSize](int32 y)
+    {
+        for (int32 x = 0; x < atlasSize; x++)
+        {
+            const int32 texelAddress = (y * atlasSize + x) * NUM_SH_TARGETS;
+            for (int32 i = 0; i < NUM_SH_TARGETS; i++)
+                output[texelAddress + i] = input[texelAddress + i];
+            if (Math::Abs(input[texelAddress].X - BACKGROUND_TEXELS_MARK) > 0.001f)
+                continue;
+            float weight = 0.0f;
+            Float4 total[NUM_SH_TARGETS] = { Float4::Zero, Float4::Zero, Float4::Zero };
+            for (int32 sy = Math::Max(y - 1, 0); sy <= Math::Min(y + 1, atlasSize - 1); sy++)
+            {
+                for (int32 sx = Math::Max(x - 1, 0); sx <= Math::Min(x + 1, atlasSize - 1); sx++)
+                {
+                    const int32 sampleAddress = (sy * atlasSize + sx) * NUM_SH_TARGETS;
+                    if (Math::Abs(input[sampleAddress].X - BACKGROUND_TEXELS_MARK) <= 0.001f)
+                        continue;
+                    for (int32 i = 0; i < NUM_SH_TARGETS; i++)
+                        total[i] += input[sampleAddress + i];
+                    weight++;
+                }
+            }
+            if (weight > 0.0f)
+            {
+                for (int32 i = 0; i < NUM_SH_TARGETS; i++)
+                    output[texelAddress + i] = total[i] / weight;
+            }
+            else
+            {
+                Platform::AtomicStore(&hasBackground, 1);
+            }
+        }
+    };
+    for (int32 blurPassIndex = 0; blurPassIndex < 24 && hasBackground; blurPassIndex++)
+    {
+        hasBackground = 0;
+        JobSystem::Execute(dilateJob, atlasSize);
+        input.Swap(output);
+    }
+
+    // Remove the BACKGROUND_TEXELS_MARK from the unused texels (see CS_Finalize)
+    for (int32 i = 0; i < count; i += NUM_SH_TARGETS)
+    {
+        if (Math::Abs(input[i].X - BACKGROUND_TEXELS_MARK) <= 0.001f)
+        {
+            for (int32 j = 0; j < NUM_SH_TARGETS; j++)
+                input[i + j] = Float4::Zero;
+        }
+    }
+    for (int32 i = 0; i < count; i++)
+        lightmapEntry.LightmapDataCPU[i] = IrradianceTexel(input[i]);
+}
@@ -138,7 +138,7 @@ void ShadowsOfMordor::Builder::updateLightmaps()
     scene->Lightmaps.Resize(lightmapsCount, false);
     for (int32 lightmapIndex = 0; lightmapIndex < lightmapsCount; lightmapIndex++)
     {
-        if (scene->Lightmaps[lightmapIndex].Init(&settings))
+        if (scene->Lightmaps[lightmapIndex].Init(&settings, _useCPU))
             return;
     }
 
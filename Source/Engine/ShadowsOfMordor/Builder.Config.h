@@ -49,6 +49,15 @@ namespace ShadowsOfMordor
 #define CACHE_ENTRIES_PER_JOB 10
 #define CACHE_POSITIONS_FORMAT HEMISPHERES_FORMAT_R32G32B32A32
 #define CACHE_NORMALS_FORMAT HEMISPHERES_FORMAT_R16G16B16A16
+#define CPU_BAKE_SAMPLES_GRID 4
+#define CPU_BAKE_MIN_SAMPLES 64
+#define CPU_BAKE_CONVERGENCE_THRESHOLD 0.02f
+#define CPU_BAKE_HEMISPHERES_PER_JOB 32
+#define CPU_BAKE_HEMISPHERES_PER_BATCH 4096
+#define CPU_BAKE_RAY_BIAS 0.1f
+#define CPU_BAKE_SAMPLE_RADIANCE_MAX 1000.0f
+#define CPU_BAKE_DEFAULT_ALBEDO 0.5f
+#define CPU_BAKE_CACHE_EDGE_DISTANCE 0.7071f
 
 // Debugging tools settings
 // Note: debug images will be exported to the temporary folder ('<project-root>\Cache\ShadowsOfMordor_Debug')
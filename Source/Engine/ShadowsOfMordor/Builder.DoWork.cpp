@@ -1,6 +1,7 @@
 // Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
 
 #include "Builder.h"
+#include "LightmapTracer.h"
 #include "Engine/Core/Log.h"
 #include "Engine/Core/Types/TimeSpan.h"
 #include "Engine/Core/Math/Math.h"
@@ -20,7 +21,7 @@ bool ShadowsOfMordor::Builder::doWorkInner(DateTime buildStart)
     _firstStateSave = true;
 
     // Try to load the state that was cached during hemispheres rendering (restore rendering in case of GPU driver crash)
-    if (loadState())
+    if (!_useCPU && loadState())
     {
         reportProgress(BuildProgressStep::RenderHemispheres, 0.0f);
         const int32 firstScene = _workerActiveSceneIndex;
@@ -168,11 +169,28 @@ bool ShadowsOfMordor::Builder::doWorkInner(DateTime buildStart)
         RUN_STEP(updateEntries);
     }
 
+    // Prepare the scene geometry for ray tracing on CPU
+    if (_useCPU)
+    {
+        buildTracer();
+        if (checkBuildCancelled())
+            return true;
+    }
+
     // TODO: if settings require wait for asset dependencies to all materials and models be loaded (maybe only for higher quality profiles)
 
     // Generate hemispheres cache and prepare for baking
     for (_workerActiveSceneIndex = 0; _workerActiveSceneIndex < _scenes.Count(); _workerActiveSceneIndex++)
     {
+        if (_useCPU)
+        {
+            // Cache is rasterized on CPU
+            generateHemispheres();
+            if (checkBuildCancelled())
+                return true;
+            continue;
+        }
+
         // Wait for lightmaps to be fully loaded
         if (_scenes[_workerActiveSceneIndex]->WaitForLightmaps())
         {
@@ -246,6 +264,14 @@ bool ShadowsOfMordor::Builder::doWorkInner(DateTime buildStart)
     {
         _giBounceRunningIndex = bounce;
 
+        if (_useCPU)
+        {
+            // Trace all scenes at once (the previous bounce data of any scene can be hit by rays)
+            if (renderHemispheresCPU())
+                return true;
+            continue;
+        }
+
         // Wait for lightmaps to be fully loaded
         for (_workerActiveSceneIndex = 0; _workerActiveSceneIndex < _scenes.Count(); _workerActiveSceneIndex++)
         {
@@ -337,7 +363,7 @@ int32 ShadowsOfMordor::Builder::doWork()
     reportProgress(BuildProgressStep::Initialize, 0.1f);
 
     // Check resources and state
-    if (checkBuildCancelled() || initResources())
+    if (checkBuildCancelled() || (!_useCPU && initResources()))
     {
         _wasBuildCalled = false;
 
@@ -351,7 +377,7 @@ int32 ShadowsOfMordor::Builder::doWork()
 
     // Wait for the scene rendering service to be ready
     reportProgress(BuildProgressStep::Initialize, 0.5f);
-    if (!Renderer::IsReady())
+    if (!_useCPU && !Renderer::IsReady())
     {
         const int32 stepSize = 5;
         const int32 maxWaitTime = 30000;
@@ -428,6 +454,7 @@ int32 ShadowsOfMordor::Builder::doWork()
 
     // Cleanup
     releaseResources();
+    SAFE_DELETE(_tracer);
 
     // Fire events
     reportProgress(BuildProgressStep::Cleanup, 1.0f);
@@ -49,7 +49,7 @@ void ShadowsOfMordor::Builder::generateHemispheres()
 
     // Clear all lightmaps
     _workerStagePosition0 = 0;
-    if (runStage(CleanLightmaps))
+    if (!_useCPU && runStage(CleanLightmaps))
         return;
 
     auto scene = _scenes[_workerActiveSceneIndex];
@@ -76,31 +76,41 @@ void ShadowsOfMordor::Builder::generateHemispheres()
         lightmapEntry.Hemispheres.EnsureCapacity(Math::Square(atlasSize / 2));
         Float3 position, normal;
 
-        // Fill cache
-        if (runStage(RenderCache))
-            return;
-        if (waitForJobDataSync())
-            return;
-
-        // Post-process cache
-        if (runStage(PostprocessCache))
-            return;
-
-        // Wait for GPU commands to sync
-        if (waitForJobDataSync())
-            return;
-        if (checkBuildCancelled())
-            return;
-
-        // Download cache to CPU memory from GPU memory
-        if (_cachePositions->DownloadData(cacheData.PositionsData)
-            || _cacheNormals->DownloadData(cacheData.NormalsData))
+        if (_useCPU)
         {
-            LOG(Fatal, "Cannot download data from the GPU. Target: ShadowsOfMordor::Builder::RenderPositionsAndNormals");
-            return;
+            // Rasterize cache on CPU
+            renderCacheCPU(scene, lightmapEntry, cacheData);
+            if (checkBuildCancelled())
+                return;
+        }
+        else
+        {
+            // Fill cache
+            if (runStage(RenderCache))
+                return;
+            if (waitForJobDataSync())
+                return;
+
+            // Post-process cache
+            if (runStage(PostprocessCache))
+                return;
+
+            // Wait for GPU commands to sync
+            if (waitForJobDataSync())
+                return;
+            if (checkBuildCancelled())
+                return;
+
+            // Download cache to CPU memory from GPU memory
+            if (_cachePositions->DownloadData(cacheData.PositionsData)
+                || _cacheNormals->DownloadData(cacheData.NormalsData))
+            {
+                LOG(Fatal, "Cannot download data from the GPU. Target: ShadowsOfMordor::Builder::RenderPositionsAndNormals");
+                return;
+            }
+            if (checkBuildCancelled())
+                return;
         }
-        if (checkBuildCancelled())
-            return;
 
 #if DEBUG_EXPORT_CACHE_PREVIEW
         // Here we can export cache to drive
@@ -1,6 +1,7 @@
 // Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
 
 #include "Builder.h"
+#include "LightmapTracer.h"
 #include "Engine/Engine/Engine.h"
 #include "Engine/Level/Scene/Scene.h"
 #include "Engine/Level/Level.h"
@@ -85,14 +86,12 @@ ShadowsOfMordor::Builder::Builder()
     : _wasBuildCalled(false)
     , _isActive(false)
     , _wasBuildCancelled(false)
+    , _useCPU(false)
 {
 }
 
 void ShadowsOfMordor::Builder::Build()
 {
-    // To bake static lighting we have to support compute shaders
-    ASSERT_LOW_LAYER(GPUDevice::Instance && GPUDevice::Instance->Limits.HasCompute);
-
     _locker.Lock();
 
     if (!_wasBuildCalled)
@@ -103,6 +102,13 @@ void ShadowsOfMordor::Builder::Build()
         // Ensure any scene has been loaded
         ASSERT(Level::IsAnySceneLoaded());
 
+        // Pick the backend (bake on CPU if all scenes use it or if GPU cannot bake static lighting due to missing compute shaders support)
+        _useCPU = true;
+        for (Scene* scene : Level::Scenes)
+            _useCPU &= scene->Info.LightmapSettings.Backend == LightmapSettings::BakingBackends::CPU;
+        if (!GPUDevice::Instance || !GPUDevice::Instance->Limits.HasCompute || !GPUDevice::Instance->Limits.HasTypedUAVLoad)
+            _useCPU = true;
+
         // Register background work
         Function<int32()> f;
         f.Bind<Builder, &Builder::doWork>(this);
@@ -138,6 +144,7 @@ void ShadowsOfMordor::Builder::Dispose()
     }
 
     releaseResources();
+    SAFE_DELETE(_tracer);
 }
 
 #if HEMISPHERES_BAKE_STATE_SAVE
@@ -11,6 +11,7 @@
 
 #include "Engine/Graphics/RenderTask.h"
 #include "Engine/Core/Singleton.h"
+#include "Engine/Core/Math/Half.h"
 
 // Forward declarations
 #if COMPILE_WITH_ASSETS_IMPORTER
@@ -28,6 +29,8 @@ class GPUPipelineState;
 
 namespace ShadowsOfMordor
 {
+    class LightmapTracer;
+
     /// <summary>
     /// Shadows Of Mordor lightmaps builder utility.
     /// </summary>
@@ -110,6 +113,12 @@ namespace ShadowsOfMordor
             int16 TexelY;
         };
 
+#if HEMISPHERES_IRRADIANCE_FORMAT == HEMISPHERES_FORMAT_R32G32B32A32
+        typedef Float4 IrradianceTexel;
+#elif HEMISPHERES_IRRADIANCE_FORMAT == HEMISPHERES_FORMAT_R16G16B16A16
+        typedef Half4 IrradianceTexel;
+#endif
+
         /// <summary>
         /// Per lightmap cache data
         /// </summary>
@@ -124,10 +133,13 @@ namespace ShadowsOfMordor
             // Restored data for the lightmap from the loaded state (copied to the LightmapData on first hemispheres render job)
             Array<byte> LightmapDataInit;
 #endif
+            // Lightmap data baked by the CPU backend (the same layout as LightmapData) and the data from the previous bounce (used to compute the next bounce)
+            Array<IrradianceTexel> LightmapDataCPU;
+            Array<IrradianceTexel> LightmapDataCPUPrev;
 
             ~LightmapBuildCache();
 
-            bool Init(const LightmapSettings* settings);
+            bool Init(const LightmapSettings* settings, bool useCPU = false);
         };
 
         /// <summary>
@@ -222,6 +234,7 @@ namespace ShadowsOfMordor
         bool _wasBuildCalled;
         bool _isActive;
         volatile int64 _wasBuildCancelled;
+        bool _useCPU;
 
         Array<SceneBuildCache*> _scenes;
 
@@ -253,6 +266,7 @@ namespace ShadowsOfMordor
         GPUBuffer* _irradianceReduction = nullptr;
         GPUTexture* _cachePositions = nullptr;
         GPUTexture* _cacheNormals = nullptr;
+        LightmapTracer* _tracer = nullptr;
 
     public:
 
@@ -328,6 +342,12 @@ namespace ShadowsOfMordor
         void updateEntries();
         void generateHemispheres();
 
+        // CPU backend
+        void buildTracer();
+        void renderCacheCPU(SceneBuildCache* scene, LightmapBuildCache& lightmapEntry, GenerateHemispheresData& cacheData);
+        bool renderHemispheresCPU();
+        void postprocessLightmapCPU(LightmapBuildCache& lightmapEntry, int32 atlasSize);
+
 #if DEBUG_EXPORT_LIGHTMAPS_PREVIEW
         static void exportLightmapPreview(SceneBuildCache* scene, int32 lightmapIndex);
 #endif
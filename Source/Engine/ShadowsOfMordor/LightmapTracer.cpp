@@ -0,0 +1,375 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#include "LightmapTracer.h"
+
+#if COMPILE_WITH_GI_BAKING
+
+#include "Engine/Core/Math/Math.h"
+#include "Engine/Core/SIMD.h"
+#include "Engine/Profiler/ProfilerCPU.h"
+
+#define TRACER_MAX_LEAF_TRIANGLES 4
+#define TRACER_SAH_BINS 16
+#define TRACER_STACK_SIZE 128
+// Max depth of the inner nodes (each traversal step pops one node and pushes up to 4 children so deeper trees could overflow the stack)
+#define TRACER_MAX_DEPTH ((TRACER_STACK_SIZE - 4) / 3)
+
+void ShadowsOfMordor::LightmapTracer::AddTriangle(const Float3& v0, const Float3& v1, const Float3& v2, const Float2& uv0, const Float2& uv1, const Float2& uv2, int32 surface)
+{
+    auto& triangle = _triangles.AddOne();
+    triangle.V0 = v0;
+    triangle.Edge1 = v1 - v0;
+    triangle.Edge2 = v2 - v0;
+    triangle.Surface = surface;
+    auto& attributes = _attributes.AddOne();
+    attributes.Normal = Float3::Normalize(Float3::Cross(triangle.Edge1, triangle.Edge2));
+    attributes.LightmapUVs[0] = uv0;
+    attributes.LightmapUVs[1] = uv1;
+    attributes.LightmapUVs[2] = uv2;
+}
+
+void ShadowsOfMordor::LightmapTracer::Build()
+{
+    PROFILE_CPU();
+    _nodes.Clear();
+    const int32 count = _triangles.Count();
+    if (count == 0)
+        return;
+
+    // Cache triangles bounds
+    Array<BuildItem> items;
+    items.Resize(count);
+    for (int32 i = 0; i < count; i++)
+    {
+        const auto& triangle = _triangles[i];
+        const Float3 v1 = triangle.V0 + triangle.Edge1;
+        const Float3 v2 = triangle.V0 + triangle.Edge2;
+        auto& item = items[i];
+        item.Box.Min = Float3::Min(triangle.V0, Float3::Min(v1, v2));
+        item.Box.Max = Float3::Max(triangle.V0, Float3::Max(v1, v2));
+        item.Center = (item.Box.Min + item.Box.Max) * 0.5f;
+        item.Index = i;
+    }
+
+    // Build the tree (leaves reference the continuous ranges of the reordered triangles)
+    Array<int32> order;
+    order.EnsureCapacity(count);
+    _nodes.EnsureCapacity(count / 2);
+    buildNode(items.Get(), count, order, 0);
+
+    // Reorder triangles to match the leaves
+    Array<Triangle> triangles;
+    Array<TriangleAttributes> attributes;
+    triangles.Resize(count);
+    attributes.Resize(count);
+    for (int32 i = 0; i < count; i++)
+    {
+        triangles[i] = _triangles[order[i]];
+        attributes[i] = _attributes[order[i]];
+    }
+    _triangles.Swap(triangles);
+    _attributes.Swap(attributes);
+}
+
+void ShadowsOfMordor::LightmapTracer::Clear()
+{
+    _triangles.Resize(0);
+    _attributes.Resize(0);
+    _nodes.Resize(0);
+    Surfaces.Resize(0);
+    Lights.Resize(0);
+    SkyRadiance = Float3::Zero;
+}
+
+bool ShadowsOfMordor::LightmapTracer::Intersect(const Float3& origin, const Float3& direction, float maxDistance, Hit& hit) const
+{
+    return traverse<false>(origin, direction, maxDistance, hit);
+}
+
+bool ShadowsOfMordor::LightmapTracer::Occluded(const Float3& origin, const Float3& direction, float maxDistance) const
+{
+    Hit hit;
+    return traverse<true>(origin, direction, maxDistance, hit);
+}
+
+const ShadowsOfMordor::LightmapTracer::Surface& ShadowsOfMordor::LightmapTracer::GetHitSurface(const Hit& hit, Float3& normal, Float2& lightmapUVs) const
+{
+    const auto& attributes = _attributes[hit.Triangle];
+    normal = attributes.Normal;
+    lightmapUVs = attributes.LightmapUVs[0] * (1.0f - hit.U - hit.V) + attributes.LightmapUVs[1] * hit.U + attributes.LightmapUVs[2] * hit.V;
+    return Surfaces[_triangles[hit.Triangle].Surface];
+}
+
+int32 ShadowsOfMordor::LightmapTracer::buildNode(BuildItem* items, int32 count, Array<int32>& order, int32 depth)
+{
+    const int32 nodeIndex = _nodes.Count();
+    _nodes.AddUninitialized(1);
+
+    // Split items into up to 4 children (two levels of the binary split)
+    int32 rangesStart[4], rangesCount[4], rangesUsed = 0;
+    if (count <= TRACER_MAX_LEAF_TRIANGLES)
+    {
+        rangesStart[0] = 0;
+        rangesCount[0] = count;
+        rangesUsed = 1;
+    }
+    else
+    {
+        const int32 split = splitItems(items, count);
+        const int32 halvesStart[2] = { 0, split };
+        const int32 halvesCount[2] = { split, count - split };
+        for (int32 half = 0; half < 2; half++)
+        {
+            if (halvesCount[half] > TRACER_MAX_LEAF_TRIANGLES)
+            {
+                const int32 quarterSplit = splitItems(items + halvesStart[half], halvesCount[half]);
+                rangesStart[rangesUsed] = halvesStart[half];
+                rangesCount[rangesUsed++] = quarterSplit;
+                rangesStart[rangesUsed] = halvesStart[half] + quarterSplit;
+                rangesCount[rangesUsed++] = halvesCount[half] - quarterSplit;
+            }
+            else
+            {
+                rangesStart[rangesUsed] = halvesStart[half];
+                rangesCount[rangesUsed++] = halvesCount[half];
+            }
+        }
+    }
+
+    for (int32 i = 0; i < 4; i++)
+    {
+        float boundsMin[3] = { MAX_float, MAX_float, MAX_float };
+        float boundsMax[3] = { -MAX_float, -MAX_float, -MAX_float };
+        int32 child = -1, childCount = 0;
+        if (i < rangesUsed)
+        {
+            BuildItem* childItems = items + rangesStart[i];
+            const int32 childItemsCount = rangesCount[i];
+            BuildBox box = childItems[0].Box;
+            for (int32 j = 1; j < childItemsCount; j++)
+                box.Merge(childItems[j].Box);
+            boundsMin[0] = box.Min.X;
+            boundsMin[1] = box.Min.Y;
+            boundsMin[2] = box.Min.Z;
+            boundsMax[0] = box.Max.X;
+            boundsMax[1] = box.Max.Y;
+            boundsMax[2] = box.Max.Z;
+            if (childItemsCount <= TRACER_MAX_LEAF_TRIANGLES || depth >= TRACER_MAX_DEPTH)
+            {
+                // Leaf (degenerate geometry that reaches the max depth ends up in larger leaves)
+                child = order.Count();
+                childCount = childItemsCount;
+                for (int32 j = 0; j < childItemsCount; j++)
+                    order.Add(childItems[j].Index);
+            }
+            else
+            {
+                // Inner node (note: nodes array can be resized during building)
+                child = buildNode(childItems, childItemsCount, order, depth + 1);
+            }
+        }
+        auto& node = _nodes[nodeIndex];
+        for (int32 axis = 0; axis < 3; axis++)
+        {
+            node.Bounds[axis][i] = boundsMin[axis];
+            node.Bounds[axis + 3][i] = boundsMax[axis];
+        }
+        node.Children[i] = child;
+        node.Counts[i] = childCount;
+    }
+
+    return nodeIndex;
+}
+
+int32 ShadowsOfMordor::LightmapTracer::splitItems(BuildItem* items, int32 count)
+{
+    // Find the split axis
+    BuildBox centersBox = { items[0].Center, items[0].Center };
+    for (int32 i = 1; i < count; i++)
+        centersBox.Merge({ items[i].Center, items[i].Center });
+    const Float3 centersSize = centersBox.Max - centersBox.Min;
+    const int32 axis = centersSize.X > centersSize.Y ? (centersSize.X > centersSize.Z ? 0 : 2) : (centersSize.Y > centersSize.Z ? 1 : 2);
+    const float axisMin = centersBox.Min.Raw[axis];
+    const float axisSize = centersSize.Raw[axis];
+    if (axisSize <= ZeroTolerance)
+        return count / 2;
+
+    // Bin items using the centers
+    struct Bin
+    {
+        BuildBox Box;
+        int32 Count = 0;
+    } bins[TRACER_SAH_BINS];
+    const float binScale = (float)TRACER_SAH_BINS / axisSize;
+#define GET_BIN(item) Math::Min((int32)((item.Center.Raw[axis] - axisMin) * binScale), TRACER_SAH_BINS - 1)
+    for (int32 i = 0; i < count; i++)
+    {
+        auto& bin = bins[GET_BIN(items[i])];
+        if (bin.Count++ == 0)
+            bin.Box = items[i].Box;
+        else
+            bin.Box.Merge(items[i].Box);
+    }
+
+    // Evaluate the Surface Area Heuristic for every split plane
+    float rightAreas[TRACER_SAH_BINS];
+    int32 rightCounts[TRACER_SAH_BINS];
+    {
+        BuildBox box;
+        int32 rightCount = 0;
+        for (int32 i = TRACER_SAH_BINS - 1; i > 0; i--)
+        {
+            if (bins[i].Count != 0)
+            {
+                if (rightCount == 0)
+                    box = bins[i].Box;
+                else
+                    box.Merge(bins[i].Box);
+                rightCount += bins[i].Count;
+            }
+            rightAreas[i] = rightCount != 0 ? box.GetSurfaceArea() : 0.0f;
+            rightCounts[i] = rightCount;
+        }
+    }
+    int32 bestSplit = -1;
+    float bestCost = MAX_float;
+    {
+        BuildBox box;
+        int32 leftCount = 0;
+        for (int32 i = 1; i < TRACER_SAH_BINS; i++)
+        {
+            const auto& bin = bins[i - 1];
+            if (bin.Count != 0)
+            {
+                if (leftCount == 0)
+                    box = bin.Box;
+                else
+                    box.Merge(bin.Box);
+                leftCount += bin.Count;
+            }
+            if (leftCount == 0 || rightCounts[i] == 0)
+                continue;
+            const float cost = box.GetSurfaceArea() * (float)leftCount + rightAreas[i] * (float)rightCounts[i];
+            if (cost < bestCost)
+            {
+                bestCost = cost;
+                bestSplit = i;
+            }
+        }
+    }
+    if (bestSplit == -1)
+        return count / 2;
+
+    // Partition items
+    int32 left = 0, right = count - 1;
+    while (left <= right)
+    {
+        if (GET_BIN(items[left]) < bestSplit)
+        {
+            left++;
+        }
+        else
+        {
+            Swap(items[left], items[right]);
+            right--;
+        }
+    }
+#undef GET_BIN
+    if (left == 0 || left == count)
+        return count / 2;
+    return left;
+}
+
+template<bool AnyHit>
+bool ShadowsOfMordor::LightmapTracer::traverse(const Float3& origin, const Float3& direction, float maxDistance, Hit& hit) const
+{
+    if (_nodes.IsEmpty())
+        return false;
+
+    // Prepare ray data (pick near/far bounds planes based on the direction sign to use a single slab test per axis)
+    Float3 invDirection;
+    for (int32 axis = 0; axis < 3; axis++)
+    {
+        const float d = direction.Raw[axis];
+        invDirection.Raw[axis] = 1.0f / (Math::Abs(d) > 1e-12f ? d : (d >= 0.0f ? 1e-12f : -1e-12f));
+    }
+    const int32 nearX = direction.X >= 0.0f ? 0 : 3, farX = 3 - nearX;
+    const int32 nearY = direction.Y >= 0.0f ? 1 : 4, farY = 5 - nearY;
+    const int32 nearZ = direction.Z >= 0.0f ? 2 : 5, farZ = 7 - nearZ;
+    const SimdVector4 originX = SIMD::Splat(origin.X);
+    const SimdVector4 originY = SIMD::Splat(origin.Y);
+    const SimdVector4 originZ = SIMD::Splat(origin.Z);
+    const SimdVector4 invDirX = SIMD::Splat(invDirection.X);
+    const SimdVector4 invDirY = SIMD::Splat(invDirection.Y);
+    const SimdVector4 invDirZ = SIMD::Splat(invDirection.Z);
+    const SimdVector4 zero = SIMD::Splat(0.0f);
+
+    float closest = maxDistance;
+    bool result = false;
+    int32 stack[TRACER_STACK_SIZE];
+    int32 stackSize = 1;
+    stack[0] = 0;
+    while (stackSize != 0)
+    {
+        const Node& node = _nodes.Get()[stack[--stackSize]];
+
+        // Test ray against 4 child boxes at once
+        const SimdVector4 tNearX = SIMD::Mul(SIMD::Sub(SIMD::Load(node.Bounds[nearX]), originX), invDirX);
+        const SimdVector4 tNearY = SIMD::Mul(SIMD::Sub(SIMD::Load(node.Bounds[nearY]), originY), invDirY);
+        const SimdVector4 tNearZ = SIMD::Mul(SIMD::Sub(SIMD::Load(node.Bounds[nearZ]), originZ), invDirZ);
+        const SimdVector4 tFarX = SIMD::Mul(SIMD::Sub(SIMD::Load(node.Bounds[farX]), originX), invDirX);
+        const SimdVector4 tFarY = SIMD::Mul(SIMD::Sub(SIMD::Load(node.Bounds[farY]), originY), invDirY);
+        const SimdVector4 tFarZ = SIMD::Mul(SIMD::Sub(SIMD::Load(node.Bounds[farZ]), originZ), invDirZ);
+        const SimdVector4 tMin = SIMD::Max(SIMD::Max(tNearX, tNearY), SIMD::Max(tNearZ, zero));
+        const SimdVector4 tMax = SIMD::Min(SIMD::Min(tFarX, tFarY), SIMD::Min(tFarZ, SIMD::Splat(closest)));
+        int32 mask = ~SIMD::MoveMask(SIMD::Sub(tMax, tMin)) & 0xf;
+
+        while (mask != 0)
+        {
+            const int32 i = mask & 1 ? 0 : mask & 2 ? 1 : mask & 4 ? 2 : 3;
+            mask &= ~(1 << i);
+            const int32 child = node.Children[i];
+            const int32 childCount = node.Counts[i];
+            if (childCount == 0)
+            {
+                ASSERT_LOW_LAYER(stackSize < TRACER_STACK_SIZE);
+                stack[stackSize++] = child;
+                continue;
+            }
+
+            // Test ray against leaf triangles (two-sided)
+            for (int32 triangleIndex = child; triangleIndex < child + childCount; triangleIndex++)
+            {
+                const Triangle& triangle = _triangles.Get()[triangleIndex];
+                const Float3 p = Float3::Cross(direction, triangle.Edge2);
+                const float det = Float3::Dot(triangle.Edge1, p);
+                if (Math::Abs(det) < 1e-12f)
+                    continue;
+                const float invDet = 1.0f / det;
+                const Float3 t = origin - triangle.V0;
+                const float u = Float3::Dot(t, p) * invDet;
+                if (u < 0.0f || u > 1.0f)
+                    continue;
+                const Float3 q = Float3::Cross(t, triangle.Edge1);
+                const float v = Float3::Dot(direction, q) * invDet;
+                if (v < 0.0f || u + v > 1.0f)
+                    continue;
+                const float distance = Float3::Dot(triangle.Edge2, q) * invDet;
+                if (distance <= 0.0f || distance >= closest)
+                    continue;
+                if (AnyHit)
+                    return true;
+                closest = distance;
+                hit.Distance = distance;
+                hit.Triangle = triangleIndex;
+                hit.U = u;
+                hit.V = v;
+                result = true;
+            }
+        }
+    }
+
+    return result;
+}
+
+#endif
@@ -0,0 +1,209 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#include "Builder.Config.h"
+
+#if COMPILE_WITH_GI_BAKING
+
+#include "Engine/Core/Collections/Array.h"
+#include "Engine/Core/Math/Vector2.h"
+#include "Engine/Core/Math/Vector3.h"
+
+namespace ShadowsOfMordor
+{
+    /// <summary>
+    /// The static scene representation used by the CPU lightmaps baking backend. Contains the world-space triangles of the lightmapped geometry (organized in 4-wide BVH traversed with SIMD), the surfaces and the light sources.
+    /// </summary>
+    class LightmapTracer
+    {
+    public:
+
+        /// <summary>
+        /// The surface properties of the geometry (shared by all triangles of the mesh).
+        /// </summary>
+        struct Surface
+        {
+            Float3 Albedo;
+            Float3 Emissive;
+            int32 SceneIndex;
+            int32 LightmapIndex;
+        };
+
+        enum class LightType
+        {
+            Directional,
+            Point,
+            Spot,
+        };
+
+        /// <summary>
+        /// The light source (with brightness already scaled by the indirect lighting intensity).
+        /// </summary>
+        struct Light
+        {
+            LightType Type;
+            Float3 Color;
+            Float3 Position;
+            Float3 Direction;
+            float Radius;
+            float FallOffExponent;
+            bool UseInverseSquaredFalloff;
+            bool CastShadows;
+            float CosOuterCone;
+            float InvCosConeDifference;
+        };
+
+        /// <summary>
+        /// The ray intersection result.
+        /// </summary>
+        struct Hit
+        {
+            float Distance;
+            int32 Triangle;
+            float U;
+            float V;
+        };
+
+    private:
+
+        struct Triangle
+        {
+            Float3 V0;
+            Float3 Edge1;
+            Float3 Edge2;
+            int32 Surface;
+        };
+
+        struct TriangleAttributes
+        {
+            Float3 Normal;
+            Float2 LightmapUVs[3];
+        };
+
+        ALIGN_BEGIN(16) struct Node
+        {
+            // Per-child bounds in SoA layout: MinX, MinY, MinZ, MaxX, MaxY, MaxZ
+            float Bounds[6][4];
+            // Child node index (or the first triangle index for the leaves), -1 for the unused slots
+            int32 Children[4];
+            // Amount of triangles in the child leaf, 0 for the inner nodes
+            int32 Counts[4];
+        } ALIGN_END(16);
+
+        struct BuildBox
+        {
+            Float3 Min;
+            Float3 Max;
+
+            void Merge(const BuildBox& other)
+            {
+                Min = Float3::Min(Min, other.Min);
+                Max = Float3::Max(Max, other.Max);
+            }
+
+            float GetSurfaceArea() const
+            {
+                const Float3 size = Max - Min;
+                return 2.0f * (size.X * size.Y + size.X * size.Z + size.Y * size.Z);
+            }
+        };
+
+        struct BuildItem
+        {
+            BuildBox Box;
+            Float3 Center;
+            int32 Index;
+        };
+
+        Array<Triangle> _triangles;
+        Array<TriangleAttributes> _attributes;
+        Array<Node> _nodes;
+
+    public:
+
+        /// <summary>
+        /// The surfaces of the scene geometry.
+        /// </summary>
+        Array<Surface> Surfaces;
+
+        /// <summary>
+        /// The light sources.
+        /// </summary>
+        Array<Light> Lights;
+
+        /// <summary>
+        /// The constant radiance of the sky visible by the rays that miss the scene geometry.
+        /// </summary>
+        Float3 SkyRadiance = Float3::Zero;
+
+    public:
+
+        /// <summary>
+        /// Gets the amount of triangles in the scene.
+        /// </summary>
+        FORCE_INLINE int32 GetTrianglesCount() const
+        {
+            return _triangles.Count();
+        }
+
+        /// <summary>
+        /// Adds the triangle to the scene. Call Build after adding all the geometry.
+        /// </summary>
+        /// <param name="v0">The first vertex position (in world-space).</param>
+        /// <param name="v1">The second vertex position (in world-space).</param>
+        /// <param name="v2">The third vertex position (in world-space).</param>
+        /// <param name="uv0">The first vertex lightmap UVs (in lightmap atlas space).</param>
+        /// <param name="uv1">The second vertex lightmap UVs (in lightmap atlas space).</param>
+        /// <param name="uv2">The third vertex lightmap UVs (in lightmap atlas space).</param>
+        /// <param name="surface">The surface index.</param>
+        void AddTriangle(const Float3& v0, const Float3& v1, const Float3& v2, const Float2& uv0, const Float2& uv1, const Float2& uv2, int32 surface);
+
+        /// <summary>
+        /// Builds the acceleration structure for the added triangles.
+        /// </summary>
+        void Build();
+
+        /// <summary>
+        /// Clears the scene data.
+        /// </summary>
+        void Clear();
+
+        /// <summary>
+        /// Finds the closest intersection of the ray with the scene geometry.
+        /// </summary>
+        /// <param name="origin">The ray origin.</param>
+        /// <param name="direction">The ray direction (normalized).</param>
+        /// <param name="maxDistance">The maximum distance to trace.</param>
+        /// <param name="hit">The result hit data.</param>
+        /// <returns>True if ray hits anything, otherwise false.</returns>
+        bool Intersect(const Float3& origin, const Float3& direction, float maxDistance, Hit& hit) const;
+
+        /// <summary>
+        /// Checks if the ray hits any of the scene geometry (used for shadow rays).
+        /// </summary>
+        /// <param name="origin">The ray origin.</param>
+        /// <param name="direction">The ray direction (normalized).</param>
+        /// <param name="maxDistance">The maximum distance to trace.</param>
+        /// <returns>True if ray is occluded, otherwise false.</returns>
+        bool Occluded(const Float3& origin, const Float3& direction, float maxDistance) const;
+
+        /// <summary>
+        /// Gets the surface data at the ray hit location.
+        /// </summary>
+        /// <param name="hit">The ray hit.</param>
+        /// <param name="normal">The result geometry normal (world-space).</param>
+        /// <param name="lightmapUVs">The result lightmap UVs (in lightmap atlas space).</param>
+        /// <returns>The hit surface.</returns>
+        const Surface& GetHitSurface(const Hit& hit, Float3& normal, Float2& lightmapUVs) const;
+
+    private:
+
+        int32 buildNode(BuildItem* items, int32 count, Array<int32>& order, int32 depth);
+        static int32 splitItems(BuildItem* items, int32 count);
+        template<bool AnyHit>
+        bool traverse(const Float3& origin, const Float3& direction, float maxDistance, Hit& hit) const;
+    };
+};
+
+#endif
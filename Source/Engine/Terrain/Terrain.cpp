@@ -4,6 +4,9 @@
 #include "TerrainPatch.h"
 #include "Engine/Core/Log.h"
 #include "Engine/Core/Math/Ray.h"
+#include "Engine/Core/Math/CollisionsHelper.h"
+#include "Engine/Core/Collections/Sorting.h"
+#include "Engine/Core/Types/Span.h"
 #include "Engine/Level/Scene/SceneRendering.h"
 #include "Engine/Serialization/Serialization.h"
 #include "Engine/Physics/Physics.h"
@@ -97,18 +100,54 @@ void Terrain::RemoveLightmap()
     }
 }
 
+namespace
+{
+    struct PatchHit
+    {
+        float Distance;
+        TerrainPatch* Patch;
+
+        bool operator<(const PatchHit& other) const
+        {
+            return Distance < other.Distance;
+        }
+    };
+
+    typedef Array<PatchHit, InlinedAllocation<64>> PatchHits;
+
+    // Gets the patches which bounds are hit by the ray, sorted by the distance to the bounds so the ray cast can stop once the closer hit has been found
+    void GetPatchesHitByRay(const Array<TerrainPatch*, InlinedAllocation<64>>& patches, const Vector3& origin, const Vector3& direction, float maxDistance, PatchHits& result)
+    {
+        Array<BoundingBox, InlinedAllocation<64>> bounds;
+        bounds.Resize(patches.Count());
+        for (int32 i = 0; i < patches.Count(); i++)
+            bounds[i] = patches[i]->GetBounds();
+        Array<float, InlinedAllocation<64>> distances;
+        distances.Resize(bounds.Count());
+        const Ray ray(origin, Vector3::Normalize(direction));
+        if (CollisionsHelper::RayIntersectsBoxes(ray, ToSpan(bounds), ToSpan(distances)) == 0)
+            return;
+        for (int32 i = 0; i < patches.Count(); i++)
+        {
+            if (distances[i] < MAX_float && distances[i] <= maxDistance)
+                result.Add({ distances[i], patches[i] });
+        }
+        Sorting::QuickSort(result.Get(), result.Count());
+    }
+}
+
 bool Terrain::RayCast(const Vector3& origin, const Vector3& direction, float& resultHitDistance, float maxDistance) const
 {
     float minDistance = MAX_float;
     bool result = false;
-    const Ray ray(origin, direction);
+    PatchHits hits;
+    GetPatchesHitByRay(_patches, origin, direction, maxDistance, hits);
 
-    for (int32 pathIndex = 0; pathIndex < _patches.Count(); pathIndex++)
+    for (const PatchHit& hit : hits)
     {
-        const auto patch = _patches[pathIndex];
-        if (patch->HasCollision() &&
-            patch->_bounds.Intersects(ray) &&
-            patch->RayCast(origin, direction, resultHitDistance, maxDistance) &&
+        if (hit.Distance >= minDistance)
+            break;
+        if (hit.Patch->RayCast(origin, direction, resultHitDistance, maxDistance) &&
             resultHitDistance < minDistance)
         {
             minDistance = resultHitDistance;
@@ -125,14 +164,14 @@ bool Terrain::RayCast(const Vector3& origin, const Vector3& direction, float& re
     float minDistance = MAX_float;
     TerrainChunk* minChunk = nullptr;
     bool result = false;
-    const Ray ray(origin, direction);
+    PatchHits hits;
+    GetPatchesHitByRay(_patches, origin, direction, maxDistance, hits);
 
-    for (int32 pathIndex = 0; pathIndex < _patches.Count(); pathIndex++)
+    for (const PatchHit& hit : hits)
     {
-        const auto patch = _patches[pathIndex];
-        if (patch->HasCollision() &&
-            patch->_bounds.Intersects(ray) &&
-            patch->RayCast(origin, direction, resultHitDistance, resultChunk, maxDistance) &&
+        if (hit.Distance >= minDistance)
+            break;
+        if (hit.Patch->RayCast(origin, direction, resultHitDistance, resultChunk, maxDistance) &&
             resultHitDistance < minDistance)
         {
             minDistance = resultHitDistance;
@@ -168,13 +207,13 @@ bool Terrain::RayCast(const Vector3& origin, const Vector3& direction, RayCastHi
     float minDistance = MAX_float;
     bool result = false;
     RayCastHit tmpHit;
-    const Ray ray(origin, direction);
-    for (int32 pathIndex = 0; pathIndex < _patches.Count(); pathIndex++)
+    PatchHits hits;
+    GetPatchesHitByRay(_patches, origin, direction, maxDistance, hits);
+    for (const PatchHit& hit : hits)
     {
-        const auto patch = _patches[pathIndex];
-        if (patch->HasCollision() &&
-            patch->_bounds.Intersects(ray) &&
-            patch->RayCast(origin, direction, tmpHit, maxDistance) &&
+        if (hit.Distance >= minDistance)
+            break;
+        if (hit.Patch->RayCast(origin, direction, tmpHit, maxDistance) &&
             tmpHit.Distance < minDistance)
         {
             minDistance = tmpHit.Distance;
@@ -634,13 +673,14 @@ bool Terrain::IntersectsItself(const Ray& ray, Real& distance, Vector3& normal)
     float tmpDistance;
     Vector3 tmpNormal;
     bool result = false;
+    PatchHits hits;
+    GetPatchesHitByRay(_patches, ray.Position, ray.Direction, MAX_float, hits);
 
-    for (int32 pathIndex = 0; pathIndex < _patches.Count(); pathIndex++)
+    for (const PatchHit& hit : hits)
     {
-        const auto patch = _patches[pathIndex];
-        if (patch->HasCollision() &&
-            patch->_bounds.Intersects(ray) &&
-            patch->RayCast(ray.Position, ray.Direction, tmpDistance, tmpNormal) &&
+        if (hit.Distance >= minDistance)
+            break;
+        if (hit.Patch->RayCast(ray.Position, ray.Direction, tmpDistance, tmpNormal) &&
             tmpDistance < minDistance)
         {
             minDistance = tmpDistance;
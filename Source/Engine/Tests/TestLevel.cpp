@@ -1,12 +1,31 @@
 // Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
 
+#include "TestLevel.h"
 #include "Engine/Core/Math/Vector3.h"
 #include "Engine/Core/Types/String.h"
 #include "Engine/Core/Types/StringView.h"
+#include "Engine/Level/Level.h"
 #include "Engine/Level/LargeWorlds.h"
 #include "Engine/Level/Tags.h"
 #include <ThirdParty/catch2/catch.hpp>
 
+TestTransformActor::TestTransformActor(const SpawnParams& params)
+    : EmptyActor(params)
+{
+}
+
+void TestTransformActor::OnTransformChanged()
+{
+    EmptyActor::OnTransformChanged();
+
+    if (MoveTarget)
+    {
+        Actor* target = MoveTarget;
+        MoveTarget = nullptr;
+        target->SetLocalPosition(MovePosition);
+    }
+}
+
 TEST_CASE("LargeWorlds")
 {
     SECTION("UpdateOrigin")
@@ -68,3 +87,38 @@ TEST_CASE("Tags")
         Tags::List = prevTags;
     }
 }
+
+TEST_CASE("Transforms")
+{
+    SECTION("Deferred Move From Sibling Notification")
+    {
+        const bool prevDeferTransformUpdates = Level::DeferTransformUpdates;
+        Level::DeferTransformUpdates = true;
+
+        // Hierarchy: root -> (a -> child, mover); mover is notified before a and moves it within the same batch
+        auto root = New<EmptyActor>();
+        auto a = New<EmptyActor>();
+        auto mover = New<TestTransformActor>();
+        auto child = New<EmptyActor>();
+        a->SetParent(root, false);
+        mover->SetParent(root, false);
+        child->SetParent(a, false);
+        child->SetLocalPosition(Vector3(0, 0, 10));
+        for (Actor* e : { (Actor*)root, (Actor*)a, (Actor*)mover, (Actor*)child })
+            e->Flags |= ObjectFlags::IsDuringPlay;
+
+        mover->MoveTarget = a;
+        mover->MovePosition = Vector3(100, 0, 0);
+        root->SetLocalPosition(Vector3(0, 50, 0));
+        Level::FlushTransformUpdates();
+
+        CHECK(!Level::HasTransformUpdates());
+        CHECK(a->GetPosition() == Vector3(100, 50, 0));
+        CHECK(child->GetPosition() == Vector3(100, 50, 10));
+
+        for (Actor* e : { (Actor*)root, (Actor*)a, (Actor*)mover, (Actor*)child })
+            e->Flags &= ~ObjectFlags::IsDuringPlay;
+        root->DeleteObjectNow();
+        Level::DeferTransformUpdates = prevDeferTransformUpdates;
+    }
+}
@@ -0,0 +1,21 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#include "Engine/Level/Actors/EmptyActor.h"
+
+// Test actor that moves the other actor when its own transformation changes.
+API_CLASS(Sealed) class TestTransformActor : public EmptyActor
+{
+    DECLARE_SCENE_OBJECT(TestTransformActor);
+
+public:
+    // Actor to move from the transformation change notification (once)
+    Actor* MoveTarget = nullptr;
+    // Local position to assign to the target
+    Vector3 MovePosition = Vector3::Zero;
+
+protected:
+    // [EmptyActor]
+    void OnTransformChanged() override;
+};
@@ -1,12 +1,18 @@
 // Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
 
+#include "Engine/Core/Math/BoundingBox.h"
+#include "Engine/Core/Math/BoundingFrustum.h"
+#include "Engine/Core/Math/BoundingSphere.h"
+#include "Engine/Core/Math/CollisionsHelper.h"
 #include "Engine/Core/Math/Matrix.h"
+#include "Engine/Core/Math/Ray.h"
 #include "Engine/Core/Math/Packed.h"
 #include "Engine/Core/Math/Vector3.h"
 #include "Engine/Core/Math/Vector4.h"
 #include "Engine/Core/Math/Quaternion.h"
 #include "Engine/Core/Math/Transform.h"
 #include "Engine/Core/RandomStream.h"
+#include "Engine/Core/Types/Span.h"
 #include <ThirdParty/catch2/catch.hpp>
 
 static Quaternion RotationX(float angle)
@@ -68,6 +74,45 @@ TEST_CASE("FloatR11G11B10")
     }
 }
 
+TEST_CASE("Matrix")
+{
+    SECTION("Test Multiply Invert")
+    {
+        RandomStream rand(10);
+        for (int32 i = 0; i < 10; i++)
+        {
+            Matrix m, inv, identity;
+            Matrix::Transformation(Float3(rand.GetVector3()) + 0.5f, Quaternion::Euler((float)i * 10, 5, (float)i), Float3(rand.GetVector3()) * 100.0f, m);
+            Matrix::Invert(m, inv);
+            Matrix::Multiply(m, inv, identity);
+            for (int32 j = 0; j < 16; j++)
+                CHECK(Math::NearEqual(identity.Raw[j], Matrix::Identity.Raw[j], 0.0001f));
+        }
+        Matrix inv;
+        Matrix::Invert(Matrix::Zero, inv);
+        CHECK(inv == Matrix::Zero);
+    }
+    SECTION("Test Batch")
+    {
+        RandomStream rand(10);
+        Matrix m, matrices[7], results[7];
+        Float3 points[7], transformed[7];
+        Matrix::Transformation(Float3(rand.GetVector3()), Quaternion::Euler(45, 0, -15), Float3(rand.GetVector3()) * 10.0f, m);
+        for (int32 i = 0; i < ARRAY_COUNT(matrices); i++)
+        {
+            Matrix::Transformation(Float3(rand.GetVector3()), Quaternion::Euler((float)i * 10, 0, (float)i), Float3(rand.GetVector3()), matrices[i]);
+            points[i] = Float3(rand.GetVector3()) * 10.0f;
+        }
+        Matrix::Multiply(ToSpan(matrices, ARRAY_COUNT(matrices)), m, ToSpan(results, ARRAY_COUNT(results)));
+        Matrix::TransformPoints(ToSpan(points, ARRAY_COUNT(points)), m, ToSpan(transformed, ARRAY_COUNT(transformed)));
+        for (int32 i = 0; i < ARRAY_COUNT(matrices); i++)
+        {
+            CHECK(results[i] == matrices[i] * m);
+            CHECK(Float3::NearEqual(transformed[i], Float3::Transform(points[i], m)));
+        }
+    }
+}
+
 TEST_CASE("Quaternion")
 {
     SECTION("Test Euler")
@@ -85,6 +130,26 @@ TEST_CASE("Quaternion")
             q *= delta;
         CHECK(Quaternion::NearEqual(Quaternion::Euler(0, 90, 0), q, 0.00001f));
     }
+    SECTION("Test Batch")
+    {
+        Quaternion start[5], end[5], results[5];
+        for (int32 i = 0; i < ARRAY_COUNT(start); i++)
+        {
+            start[i] = Quaternion::Euler((float)i * 10, 0, 5);
+            end[i] = Quaternion::Euler(0, (float)i * -30, 90);
+        }
+        const Quaternion delta = Quaternion::Euler(0, 10, 0);
+        Quaternion::Multiply(ToSpan(start, ARRAY_COUNT(start)), delta, ToSpan(results, ARRAY_COUNT(results)));
+        for (int32 i = 0; i < ARRAY_COUNT(start); i++)
+            CHECK(Quaternion::NearEqual(start[i] * delta, results[i], 0.00001f));
+        Quaternion::Slerp(ToSpan(start, ARRAY_COUNT(start)), ToSpan(end, ARRAY_COUNT(end)), 0.3f, ToSpan(results, ARRAY_COUNT(results)));
+        for (int32 i = 0; i < ARRAY_COUNT(start); i++)
+        {
+            Quaternion expected;
+            Quaternion::Slerp(start[i], end[i], 0.3f, expected);
+            CHECK(Quaternion::NearEqual(expected, results[i], 0.00001f));
+        }
+    }
 }
 
 TEST_CASE("Transform")
@@ -208,6 +273,21 @@ TEST_CASE("Transform")
             CHECK(Transform::NearEqual(b, ba, 0.00001f));
         }
     }
+    SECTION("Test Batch")
+    {
+        Transform t1 = Transform(Vector3(10, 1, 10), Quaternion::Euler(45, 0, -15), Float3(1.5f, 0.5f, 0.1f));
+        RandomStream rand(10);
+        Transform local[10], world[10], results[10];
+        for (int32 i = 0; i < ARRAY_COUNT(local); i++)
+            local[i] = Transform(rand.GetVector3(), Quaternion::Euler((float)i, 1, 22), rand.GetVector3() * 0.3f);
+        Transform::LocalToWorld(t1, ToSpan(local, ARRAY_COUNT(local)), ToSpan(world, ARRAY_COUNT(world)));
+        Transform::WorldToLocal(t1, ToSpan(world, ARRAY_COUNT(world)), ToSpan(results, ARRAY_COUNT(results)));
+        for (int32 i = 0; i < ARRAY_COUNT(local); i++)
+        {
+            CHECK(Transform::NearEqual(t1.LocalToWorld(local[i]), world[i], 0.00001f));
+            CHECK(Transform::NearEqual(local[i], results[i], 0.00001f));
+        }
+    }
     SECTION("Test Add Subtract")
     {
         RandomStream rand(10);
@@ -226,3 +306,73 @@ TEST_CASE("Transform")
         }
     }
 }
+
+TEST_CASE("CollisionsHelper")
+{
+    SECTION("Test Batch")
+    {
+        RandomStream rand(10);
+        BoundingBox boxes[11];
+        BoundingSphere spheres[11];
+        for (int32 i = 0; i < ARRAY_COUNT(boxes); i++)
+        {
+            const Vector3 center = (rand.GetVector3() - 0.5f) * 20.0f;
+            const Vector3 extents = rand.GetVector3() * 4.0f + 0.1f;
+            boxes[i] = BoundingBox(center - extents, center + extents);
+            spheres[i] = BoundingSphere(center, extents.X);
+        }
+        const Ray rays[] =
+        {
+            Ray(Vector3(-20, 0.3f, 0.2f), Vector3::Normalize(boxes[0].GetCenter() - Vector3(-20, 0.3f, 0.2f))),
+            Ray(boxes[3].GetCenter() + Vector3(0, 30, 0), Vector3::Down),
+            Ray(boxes[5].GetCenter(), Vector3::Normalize(Vector3(-1, 1, 1))),
+        };
+        float distances[11];
+        Real distance;
+        for (const Ray& ray : rays)
+        {
+            int32 hits = CollisionsHelper::RayIntersectsBoxes(ray, ToSpan(boxes, ARRAY_COUNT(boxes)), ToSpan(distances, ARRAY_COUNT(distances)));
+            for (int32 i = 0; i < ARRAY_COUNT(boxes); i++)
+            {
+                const bool hit = CollisionsHelper::RayIntersectsBox(ray, boxes[i], distance);
+                CHECK((distances[i] < MAX_float) == hit);
+                CHECK((!hit || Math::NearEqual(distances[i], (float)distance, 0.001f)));
+                hits -= hit ? 1 : 0;
+            }
+            CHECK(hits == 0);
+            hits = CollisionsHelper::RayIntersectsSpheres(ray, ToSpan(spheres, ARRAY_COUNT(spheres)), ToSpan(distances, ARRAY_COUNT(distances)));
+            for (int32 i = 0; i < ARRAY_COUNT(spheres); i++)
+            {
+                const bool hit = CollisionsHelper::RayIntersectsSphere(ray, spheres[i], distance);
+                CHECK((distances[i] < MAX_float) == hit);
+                CHECK((!hit || Math::NearEqual(distances[i], (float)distance, 0.001f)));
+                hits -= hit ? 1 : 0;
+            }
+            CHECK(hits == 0);
+        }
+
+        Matrix view, projection;
+        BoundingFrustum frustums[5];
+        bool results[11];
+        for (int32 i = 0; i < ARRAY_COUNT(frustums); i++)
+        {
+            Matrix::LookAt(Float3((float)i * 3.0f, 2.0f, -20.0f), Float3((float)i, 0.0f, 0.0f), Float3::Up, view);
+            Matrix::PerspectiveFov(0.5f + (float)i * 0.2f, 1.0f, 0.1f, 25.0f, projection);
+            frustums[i].SetMatrix(view, projection);
+        }
+        int32 visible = CollisionsHelper::FrustumIntersectsSpheres(frustums[0], ToSpan(spheres, ARRAY_COUNT(spheres)), ToSpan(results, ARRAY_COUNT(results)));
+        for (int32 i = 0; i < ARRAY_COUNT(spheres); i++)
+        {
+            CHECK(results[i] == frustums[0].Intersects(spheres[i]));
+            visible -= results[i] ? 1 : 0;
+        }
+        CHECK(visible == 0);
+        for (int32 i = 0; i < ARRAY_COUNT(boxes); i++)
+        {
+            const Vector3 point = boxes[i].GetCenter();
+            CollisionsHelper::FrustumsContainPoint(ToSpan(frustums, ARRAY_COUNT(frustums)), point, ToSpan(results, ARRAY_COUNT(frustums)));
+            for (int32 j = 0; j < ARRAY_COUNT(frustums); j++)
+                CHECK(results[j] == (frustums[j].Contains(point) != ContainmentType::Disjoint));
+        }
+    }
+}
@@ -0,0 +1,156 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#include "Engine/Core/Log.h"
+#include "Engine/Core/Memory/Memory.h"
+#include "Engine/Core/Collections/Array.h"
+#include "Engine/Core/Collections/Dictionary.h"
+#include "Engine/Core/Types/Guid.h"
+#include "Engine/Core/Types/String.h"
+#include "Engine/Core/Types/Variant.h"
+#include "Engine/Threading/JobSystem.h"
+#include <ThirdParty/catch2/catch.hpp>
+
+#if USE_SMALL_OBJECT_ALLOCATOR
+
+namespace
+{
+    struct BenchmarkActor
+    {
+        String Name;
+        Array<String> Tags;
+        Array<Variant> Properties;
+        Dictionary<Guid, int32> References;
+    };
+
+    // Mimics the scene loading (lots of small objects with names, lists and lookups)
+    void SceneLoadWorkload()
+    {
+        Array<BenchmarkActor*> actors;
+        for (int32 i = 0; i < 20000; i++)
+        {
+            auto actor = New<BenchmarkActor>();
+            actor->Name = String::Format(TEXT("Actor {0}"), i);
+            actor->Tags.Add(TEXT("Tag"));
+            for (int32 j = 0; j < 8; j++)
+            {
+                actor->Properties.Add(Variant(String::Format(TEXT("Property{0}"), j)));
+                actor->References[Guid(i, j, 0, 1)] = j;
+            }
+            actors.Add(actor);
+        }
+        actors.ClearDelete();
+    }
+
+    // Mimics the particles spawn (jobs allocate particles data and the other jobs release it)
+    void ParticleSpawnWorkload()
+    {
+        const int32 jobs = 64, particlesPerJob = 2000;
+        Array<void*> particles;
+        particles.Resize(jobs * particlesPerJob);
+        for (int32 iteration = 0; iteration < 4; iteration++)
+        {
+            Function<void(int32)> spawnJob = [&particles](int32 jobIndex)
+            {
+                for (int32 i = 0; i < particlesPerJob; i++)
+                    particles[jobIndex * particlesPerJob + i] = Allocator::Allocate(16 + (i % 16) * 16);
+            };
+            JobSystem::Execute(spawnJob, jobs);
+            Function<void(int32)> releaseJob = [&particles](int32 jobIndex)
+            {
+                // Free data allocated by the other job
+                jobIndex = jobs - jobIndex - 1;
+                for (int32 i = 0; i < particlesPerJob; i++)
+                    Allocator::Free(particles[jobIndex * particlesPerJob + i]);
+            };
+            JobSystem::Execute(releaseJob, jobs);
+        }
+    }
+
+    double Measure(void (*workload)(), bool smallObjectAllocator)
+    {
+        const bool prevEnabled = SmallObjectAllocator::Enabled;
+        SmallObjectAllocator::Enabled = smallObjectAllocator;
+        workload(); // Warmup
+        const double startTime = Platform::GetTimeSeconds();
+        for (int32 i = 0; i < 4; i++)
+            workload();
+        const double time = (Platform::GetTimeSeconds() - startTime) * 1000.0 / 4;
+        SmallObjectAllocator::Enabled = prevEnabled;
+        return time;
+    }
+}
+
+TEST_CASE("SmallObjectAllocator")
+{
+    SECTION("Test Allocation")
+    {
+        Array<void*> allocations;
+        for (uint64 size = 1; size <= SMALL_OBJECT_MAX_SIZE + 256; size += 7)
+        {
+            void* ptr = Allocator::Allocate(size);
+            CHECK(((uintptr)ptr & (SMALL_OBJECT_ALIGNMENT - 1)) == 0);
+            CHECK(SmallObjectAllocator::IsSmallObject(ptr) == (SmallObjectAllocator::Enabled && size <= SMALL_OBJECT_MAX_SIZE));
+            Platform::MemorySet(ptr, size, (int32)(size & 0xff));
+            allocations.Add(ptr);
+        }
+        for (int32 i = 0; i < allocations.Count(); i++)
+        {
+            const uint64 size = 1 + i * 7;
+            CHECK(((byte*)allocations[i])[size - 1] == (byte)(size & 0xff));
+            Allocator::Free(allocations[i]);
+        }
+    }
+
+    SECTION("Test Over-aligned And System Memory")
+    {
+        void* ptr = Allocator::Allocate(64, 64);
+        CHECK(((uintptr)ptr & 63) == 0);
+        CHECK(!SmallObjectAllocator::IsSmallObject(ptr));
+        Allocator::Free(ptr);
+        ptr = Platform::Allocate(64, 16);
+        CHECK(!SmallObjectAllocator::IsSmallObject(ptr));
+        Allocator::Free(ptr);
+    }
+
+    SECTION("Test Remote Free")
+    {
+        SmallObjectAllocatorStats statsBefore, statsAfter;
+        SmallObjectAllocator::GetStats(statsBefore);
+        const int32 jobs = 16, count = 1000;
+        Array<int32*> values;
+        values.Resize(jobs * count);
+        Function<void(int32)> job = [&values](int32 jobIndex)
+        {
+            for (int32 i = 0; i < count; i++)
+            {
+                const int32 index = jobIndex * count + i;
+                values[index] = (int32*)Allocator::Allocate(sizeof(int32));
+                *values[index] = index;
+            }
+        };
+        JobSystem::Execute(job, jobs);
+        for (int32 i = 0; i < values.Count(); i++)
+        {
+            CHECK(*values[i] == i);
+            Allocator::Free(values[i]);
+        }
+        SmallObjectAllocator::GetStats(statsAfter);
+        CHECK(statsAfter.Frees >= statsBefore.Frees + values.Count());
+    }
+}
+
+TEST_CASE("SmallObjectAllocator Benchmark", "[.][benchmark]")
+{
+    const double sceneLoadCrt = Measure(SceneLoadWorkload, false);
+    const double sceneLoad = Measure(SceneLoadWorkload, true);
+    LOG(Info, "Scene load workload: {0} ms (system allocator: {1} ms)", sceneLoad, sceneLoadCrt);
+    const double particleSpawnCrt = Measure(ParticleSpawnWorkload, false);
+    const double particleSpawn = Measure(ParticleSpawnWorkload, true);
+    LOG(Info, "Particle spawn workload: {0} ms (system allocator: {1} ms)", particleSpawn, particleSpawnCrt);
+
+    SmallObjectAllocatorStats stats;
+    SmallObjectAllocator::GetStats(stats);
+    LOG(Info, "Small objects allocator: used {0} kB, reserved {1} kB, allocations: {2}, frees: {3} (remote: {4}), system allocations: {5}, threads: {6}", stats.UsedMemory / 1024, stats.ReservedMemory / 1024, stats.Allocations, stats.Frees, stats.RemoteFrees, stats.SystemAllocations, stats.Threads);
+}
+
+#endif
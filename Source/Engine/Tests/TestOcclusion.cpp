@@ -0,0 +1,41 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#include "Engine/Core/Math/BoundingBox.h"
+#include "Engine/Core/Math/BoundingSphere.h"
+#include "Engine/Renderer/OcclusionBuffer.h"
+#include <ThirdParty/catch2/catch.hpp>
+
+TEST_CASE("Occlusion")
+{
+    SECTION("Rasterized Quad")
+    {
+        // Camera at the origin looking along +Z, quad 10 units wide at distance 10
+        Matrix viewProjection;
+        Matrix::PerspectiveFov(PI_OVER_2, (float)OCCLUSION_BUFFER_WIDTH / OCCLUSION_BUFFER_HEIGHT, 1.0f, 100.0f, viewProjection);
+        const Float3 vertices[] = { Float3(-5, -5, 10), Float3(5, -5, 10), Float3(5, 5, 10), Float3(-5, 5, 10) };
+        const uint16 indices[] = { 0, 1, 2, 0, 2, 3 };
+
+        OcclusionBuffer buffer;
+        CHECK(!buffer.IsOccluded(BoundingBox(Float3(-0.5f, -0.5f, 19.5f), Float3(0.5f, 0.5f, 20.5f))));
+        buffer.AddGeometry(Matrix::Identity, vertices, ARRAY_COUNT(vertices), indices, ARRAY_COUNT(indices), true);
+        buffer.Rasterize(viewProjection);
+        CHECK(buffer.IsValid());
+
+        // Behind the quad
+        CHECK(buffer.IsOccluded(BoundingBox(Float3(-0.5f, -0.5f, 19.5f), Float3(0.5f, 0.5f, 20.5f))));
+        CHECK(buffer.IsOccluded(BoundingSphere(Float3(2.0f, -2.0f, 30.0f), 1.0f)));
+
+        // In front of the quad
+        CHECK(!buffer.IsOccluded(BoundingBox(Float3(-0.5f, -0.5f, 4.5f), Float3(0.5f, 0.5f, 5.5f))));
+
+        // Behind the quad but visible on the side or partially covered
+        CHECK(!buffer.IsOccluded(BoundingBox(Float3(14.5f, -0.5f, 19.5f), Float3(15.5f, 0.5f, 20.5f))));
+        CHECK(!buffer.IsOccluded(BoundingBox(Float3(-0.5f, -0.5f, 19.5f), Float3(15.5f, 0.5f, 20.5f))));
+
+        // Intersecting the quad
+        CHECK(!buffer.IsOccluded(BoundingBox(Float3(-0.5f, -0.5f, 9.0f), Float3(0.5f, 0.5f, 11.0f))));
+
+        buffer.Clear();
+        CHECK(!buffer.IsOccluded(BoundingBox(Float3(-0.5f, -0.5f, 19.5f), Float3(0.5f, 0.5f, 20.5f))));
+    }
+}
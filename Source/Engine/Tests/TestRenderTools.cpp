@@ -0,0 +1,56 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#include "Engine/Graphics/RenderTools.h"
+#include "Engine/Graphics/RenderView.h"
+#include "Engine/Graphics/Enums.h"
+#include "Engine/Graphics/Models/Types.h"
+#include <ThirdParty/catch2/catch.hpp>
+
+TEST_CASE("RenderTools")
+{
+    SECTION("Test CullMeshClusters")
+    {
+        // Camera looking along +Z at the row of clusters (first half faces away from the camera, second half faces it)
+        RenderView view;
+        Matrix viewMatrix, projection;
+        view.Position = Float3(0, 0, -20);
+        view.Direction = Float3::Forward;
+        Matrix::LookAt(view.Position, Float3::Zero, Float3::Up, viewMatrix);
+        Matrix::PerspectiveFov(PI_OVER_2, 1.0f, 0.1f, 100.0f, projection);
+        view.SetUp(viewMatrix, projection);
+        MeshCluster clusters[MESH_CLUSTER_CULLING_MIN_CLUSTERS];
+        const int32 halfCount = ARRAY_COUNT(clusters) / 2;
+        for (int32 i = 0; i < ARRAY_COUNT(clusters); i++)
+        {
+            MeshCluster& cluster = clusters[i];
+            cluster.Center = Float3((float)i - halfCount + 0.5f, 0, 0);
+            cluster.Radius = 0.5f;
+            cluster.ConeAxis = i < halfCount ? Float3::Forward : Float3::Backward;
+            cluster.ConeCutoff = 0.5f;
+            cluster.FirstIndex = i * 3;
+            cluster.IndicesCount = 3;
+        }
+        const Span<MeshCluster> clustersSpan(clusters, ARRAY_COUNT(clusters));
+        Array<Int2, InlinedAllocation<MESH_CLUSTER_CULLING_MAX_RANGES>> ranges;
+
+        // Two-sided materials draw the whole mesh
+        CHECK(!RenderTools::CullMeshClusters(clustersSpan, view, Matrix::Identity, CullMode::TwoSided, ranges));
+
+        // Back-facing clusters are culled
+        CHECK(RenderTools::CullMeshClusters(clustersSpan, view, Matrix::Identity, CullMode::Normal, ranges));
+        CHECK(ranges.Count() == 1);
+        CHECK(ranges[0] == Int2(halfCount * 3, halfCount * 3));
+
+        // Inverted culling draws the other half
+        CHECK(RenderTools::CullMeshClusters(clustersSpan, view, Matrix::Identity, CullMode::Inverted, ranges));
+        CHECK(ranges.Count() == 1);
+        CHECK(ranges[0] == Int2(0, halfCount * 3));
+
+        // Mirrored instance keeps the same clusters (materials flip the triangles culling via WorldDeterminantSign)
+        Matrix mirrored;
+        Matrix::Scaling(Float3(-1, 1, 1), mirrored);
+        CHECK(RenderTools::CullMeshClusters(clustersSpan, view, mirrored, CullMode::Normal, ranges));
+        CHECK(ranges.Count() == 1);
+        CHECK(ranges[0] == Int2(halfCount * 3, halfCount * 3));
+    }
+}
@@ -0,0 +1,172 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#include "Engine/Core/Log.h"
+#include "Engine/Core/Collections/Dictionary.h"
+#include "Engine/Threading/Threading.h"
+#include "Engine/Threading/FastLock.h"
+#include "Engine/Threading/JobSystem.h"
+#include <ThirdParty/catch2/catch.hpp>
+
+namespace
+{
+    const int32 BenchmarkJobs = 64;
+    const int32 BenchmarkIterations = 20000;
+
+    struct BenchmarkData
+    {
+        CriticalSection Section;
+        FastLock Lock;
+        ReadWriteLock RWLock;
+        Dictionary<int32, int32> Values;
+        volatile int64 Counter = 0;
+    };
+
+    BenchmarkData* Data;
+
+    // Mimics the short critical sections of the engine (eg. pool or queue access)
+    template<typename LockType>
+    void LockWorkload(const LockType& lock)
+    {
+        Function<void(int32)> job = [&lock](int32 jobIndex)
+        {
+            for (int32 i = 0; i < BenchmarkIterations; i++)
+            {
+                lock.Lock();
+                Data->Counter++;
+                lock.Unlock();
+            }
+        };
+        JobSystem::Execute(job, BenchmarkJobs);
+    }
+
+    // Mimics the read-mostly lookups (eg. objects registry)
+    void ReadMostlyWorkload(bool readWriteLock)
+    {
+        Function<void(int32)> job = [readWriteLock](int32 jobIndex)
+        {
+            int32 sum = 0;
+            for (int32 i = 0; i < BenchmarkIterations; i++)
+            {
+                const int32 key = (jobIndex * BenchmarkIterations + i) % 1024;
+                if (i % 64 == 0)
+                {
+                    if (readWriteLock)
+                        Data->RWLock.WriteLock();
+                    else
+                        Data->Section.Lock();
+                    Data->Values[key] = i;
+                    if (readWriteLock)
+                        Data->RWLock.WriteUnlock();
+                    else
+                        Data->Section.Unlock();
+                }
+                else
+                {
+                    int32 value = 0;
+                    if (readWriteLock)
+                        Data->RWLock.ReadLock();
+                    else
+                        Data->Section.Lock();
+                    Data->Values.TryGet(key, value);
+                    if (readWriteLock)
+                        Data->RWLock.ReadUnlock();
+                    else
+                        Data->Section.Unlock();
+                    sum += value;
+                }
+            }
+        };
+        JobSystem::Execute(job, BenchmarkJobs);
+    }
+
+    template<typename Workload>
+    double Measure(Workload workload)
+    {
+        workload(); // Warmup
+        const double startTime = Platform::GetTimeSeconds();
+        for (int32 i = 0; i < 4; i++)
+            workload();
+        return (Platform::GetTimeSeconds() - startTime) * 1000.0 / 4;
+    }
+}
+
+TEST_CASE("FastLock")
+{
+    SECTION("Test Lock")
+    {
+        FastLock lock;
+        CHECK(lock.TryLock());
+        CHECK(!lock.TryLock());
+        lock.Unlock();
+        {
+            ScopeFastLock scopeLock(lock);
+            CHECK(!lock.TryLock());
+        }
+        CHECK(lock.TryLock());
+        lock.Unlock();
+    }
+
+    SECTION("Test Contention")
+    {
+        FastLock lock;
+        const int32 jobs = 16, count = 10000;
+        int64 counter = 0;
+        Function<void(int32)> job = [&lock, &counter](int32 jobIndex)
+        {
+            for (int32 i = 0; i < count; i++)
+            {
+                ScopeFastLock scopeLock(lock);
+                counter++;
+            }
+        };
+        JobSystem::Execute(job, jobs);
+        CHECK(counter == jobs * count);
+    }
+}
+
+TEST_CASE("ReadWriteLock")
+{
+    SECTION("Test Contention")
+    {
+        ReadWriteLock lock;
+        const int32 jobs = 16, count = 10000;
+        int32 values[8] = {};
+        volatile int64 errors = 0;
+        Function<void(int32)> job = [&lock, &values, &errors](int32 jobIndex)
+        {
+            for (int32 i = 0; i < count; i++)
+            {
+                if (i % 8 == 0)
+                {
+                    ScopeWriteLock scopeLock(lock);
+                    for (int32& value : values)
+                        value = i;
+                }
+                else
+                {
+                    ScopeReadLock scopeLock(lock);
+                    for (const int32 value : values)
+                    {
+                        if (value != values[0])
+                            Platform::InterlockedIncrement(&errors);
+                    }
+                }
+            }
+        };
+        JobSystem::Execute(job, jobs);
+        CHECK(errors == 0);
+    }
+}
+
+TEST_CASE("Locks Benchmark", "[.][benchmark]")
+{
+    Data = New<BenchmarkData>();
+    const double criticalSection = Measure([] { LockWorkload(Data->Section); });
+    const double fastLock = Measure([] { LockWorkload(Data->Lock); });
+    LOG(Info, "Short lock workload: FastLock {0} ms, CriticalSection {1} ms", fastLock, criticalSection);
+    const double readMostlyCriticalSection = Measure([] { ReadMostlyWorkload(false); });
+    const double readMostlyReadWriteLock = Measure([] { ReadMostlyWorkload(true); });
+    LOG(Info, "Read-mostly workload: ReadWriteLock {0} ms, CriticalSection {1} ms", readMostlyReadWriteLock, readMostlyCriticalSection);
+    CHECK(Data->Counter == 2 * 5 * BenchmarkJobs * BenchmarkIterations);
+    Delete(Data);
+}
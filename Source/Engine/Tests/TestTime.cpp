@@ -0,0 +1,33 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#include "Engine/Core/Math/Math.h"
+#include "Engine/Engine/Time.h"
+#include <ThirdParty/catch2/catch.hpp>
+
+TEST_CASE("Time")
+{
+    SECTION("Fixed Timestep")
+    {
+        const float fps = 50.0f;
+        Time::FixedStepTickData data;
+        data.OnBeforeRun(fps, 10.0);
+
+        // Half of the step accumulated
+        CHECK(!data.OnFixedStep(10.01, fps, 4));
+        CHECK(Math::NearEqual(data.GetInterpolationAlpha(10.01, fps), 0.5f));
+
+        // Single step consumed and the remaining time kept
+        CHECK(data.OnFixedStep(10.03, fps, 4));
+        CHECK(Math::NearEqual(data.UnscaledDeltaTime.GetTotalSeconds(), 0.02f));
+        CHECK(!data.OnFixedStep(10.03, fps, 4));
+        CHECK(Math::NearEqual(data.GetInterpolationAlpha(10.03, fps), 0.5f));
+        CHECK(Math::NearEqual(data.GetInterpolationAlpha(10.035, fps), 0.75f));
+
+        // Long hitch is clamped to the max steps (excess time dropped)
+        int32 steps = 0;
+        while (data.OnFixedStep(11.03, fps, 4))
+            steps++;
+        CHECK(steps == 4);
+        CHECK(Math::NearEqual(data.GetInterpolationAlpha(11.03, fps), 0.0f));
+    }
+}
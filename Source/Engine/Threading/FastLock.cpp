@@ -0,0 +1,174 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#include "FastLock.h"
+#include "Engine/Core/Math/Math.h"
+#if FAST_LOCK_USE_FUTEX
+#include <unistd.h>
+#include <limits.h>
+#include <sys/syscall.h>
+#include <linux/futex.h>
+#else
+#include "Threading.h"
+#endif
+#if PLATFORM_SIMD_SSE2
+#include <emmintrin.h>
+#endif
+
+namespace
+{
+    // Hints the CPU that the thread is spinning (saves power and lets the other hyper-thread run)
+    FORCE_INLINE void CpuPause()
+    {
+#if PLATFORM_SIMD_SSE2
+        _mm_pause();
+#elif defined(__aarch64__) || defined(__arm__)
+        __asm__ __volatile__("yield");
+#endif
+    }
+
+    FORCE_INLINE int32 AtomicExchange(volatile int32* dst, int32 exchange)
+    {
+        int32 value;
+        do
+        {
+            value = Platform::AtomicRead(dst);
+        } while (Platform::InterlockedCompareExchange(dst, exchange, value) != value);
+        return value;
+    }
+
+    FORCE_INLINE void AtomicAdd(volatile int32* dst, int32 value)
+    {
+        int32 prev;
+        do
+        {
+            prev = Platform::AtomicRead(dst);
+        } while (Platform::InterlockedCompareExchange(dst, prev + value, prev) != prev);
+    }
+}
+
+#if FAST_LOCK_USE_FUTEX
+
+void ThreadParker::Wait(volatile int32* address, int32 expected) const
+{
+    syscall(SYS_futex, (int32*)address, FUTEX_WAIT_PRIVATE, expected, nullptr, nullptr, 0);
+}
+
+void ThreadParker::WakeOne(volatile int32* address) const
+{
+    syscall(SYS_futex, (int32*)address, FUTEX_WAKE_PRIVATE, 1, nullptr, nullptr, 0);
+}
+
+void ThreadParker::WakeAll(volatile int32* address) const
+{
+    syscall(SYS_futex, (int32*)address, FUTEX_WAKE_PRIVATE, INT_MAX, nullptr, nullptr, 0);
+}
+
+#else
+
+void ThreadParker::Wait(volatile int32* address, int32 expected) const
+{
+    ScopeLock lock(_locker);
+    if (Platform::AtomicRead(address) == expected)
+        _signal.Wait(_locker);
+}
+
+void ThreadParker::WakeOne(volatile int32* address) const
+{
+    // Sync with the thread that checked the value but didn't start waiting yet
+    _locker.Lock();
+    _locker.Unlock();
+    _signal.NotifyOne();
+}
+
+void ThreadParker::WakeAll(volatile int32* address) const
+{
+    _locker.Lock();
+    _locker.Unlock();
+    _signal.NotifyAll();
+}
+
+#endif
+
+void FastLock::LockSlow() const
+{
+    // Spin for a while as the lock is usually held for a short time (adapt spins count to the previous locks)
+    const int32 spins = Platform::AtomicRead(&_spins);
+    const int32 maxSpins = Math::Min(spins * 2 + 10, FAST_LOCK_MAX_SPINS);
+    for (int32 spin = 0; spin < maxSpins; spin++)
+    {
+        CpuPause();
+        if (Platform::AtomicRead(&_state) == 0 && Platform::InterlockedCompareExchange(&_state, 1, 0) == 0)
+        {
+            Platform::AtomicStore(&_spins, spins + (spin - spins) / 8);
+            return;
+        }
+    }
+    Platform::AtomicStore(&_spins, spins + (maxSpins - spins) / 8);
+
+    // Sleep until the lock gets unlocked (mark it as contended so unlocking thread will wake up the waiting one)
+    while (AtomicExchange(&_state, 2) != 0)
+        _parker.Wait(&_state, 2);
+}
+
+void FastLock::UnlockSlow() const
+{
+    Platform::AtomicStore(&_state, 0);
+    _parker.WakeOne(&_state);
+}
+
+void ReadWriteLock::ReadLockSlow() const
+{
+    for (int32 spin = 0;; spin++)
+    {
+        const int32 state = Platform::AtomicRead(&_state);
+        if (state >= 0 && Platform::AtomicRead(&_writersWaiting) == 0)
+        {
+            if (Platform::InterlockedCompareExchange(&_state, state + 1, state) == state)
+                return;
+        }
+        else if (spin < FAST_LOCK_MAX_SPINS)
+        {
+            CpuPause();
+        }
+        else
+        {
+            WaitForUnlock(false);
+        }
+    }
+}
+
+void ReadWriteLock::WriteLockSlow() const
+{
+    // Block the new readers
+    AtomicAdd(&_writersWaiting, 1);
+    for (int32 spin = 0;; spin++)
+    {
+        if (Platform::AtomicRead(&_state) == 0 && Platform::InterlockedCompareExchange(&_state, -1, 0) == 0)
+            break;
+        if (spin < FAST_LOCK_MAX_SPINS)
+            CpuPause();
+        else
+            WaitForUnlock(true);
+    }
+    AtomicAdd(&_writersWaiting, -1);
+}
+
+void ReadWriteLock::WaitForUnlock(bool writer) const
+{
+    const int32 epoch = Platform::AtomicRead(&_epoch);
+    AtomicAdd(&_sleeping, 1);
+
+    // Check again after registering as sleeping thread (unlocking thread might have missed it)
+    const int32 state = Platform::AtomicRead(&_state);
+    const bool locked = writer ? state != 0 : state < 0 || Platform::AtomicRead(&_writersWaiting) != 0;
+    if (locked)
+        _parker.Wait(&_epoch, epoch);
+
+    AtomicAdd(&_sleeping, -1);
+}
+
+void ReadWriteLock::WakeAll() const
+{
+    AtomicAdd(&_epoch, 1);
+    _parker.WakeAll(&_epoch);
+}
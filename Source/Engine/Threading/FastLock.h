@@ -0,0 +1,267 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#include "Engine/Platform/Platform.h"
+
+// True if locks put the waiting threads to sleep with the futex syscall, otherwise critical section and condition variable are used for that
+#define FAST_LOCK_USE_FUTEX (PLATFORM_LINUX || PLATFORM_ANDROID)
+
+// The maximum amount of spins on the locked lock before putting the thread to sleep
+#define FAST_LOCK_MAX_SPINS 100
+
+#if !FAST_LOCK_USE_FUTEX
+#include "Engine/Platform/CriticalSection.h"
+#include "Engine/Platform/ConditionVariable.h"
+#endif
+
+/// <summary>
+/// Puts the threads to sleep until the value at the given address changes (used by the locks to wait on contention).
+/// </summary>
+class FLAXENGINE_API ThreadParker
+{
+private:
+#if !FAST_LOCK_USE_FUTEX
+    mutable CriticalSection _locker;
+    mutable ConditionVariable _signal;
+#endif
+
+public:
+    /// <summary>
+    /// Blocks the current thread if the value at the address is equal to the expected value. Can wake up spuriously so the caller needs to check its condition again.
+    /// </summary>
+    /// <param name="address">The address of the value to wait on.</param>
+    /// <param name="expected">The expected value.</param>
+    void Wait(volatile int32* address, int32 expected) const;
+
+    /// <summary>
+    /// Wakes up one thread waiting on the address. The value has to be modified before.
+    /// </summary>
+    /// <param name="address">The address of the value.</param>
+    void WakeOne(volatile int32* address) const;
+
+    /// <summary>
+    /// Wakes up all threads waiting on the address. The value has to be modified before.
+    /// </summary>
+    /// <param name="address">The address of the value.</param>
+    void WakeAll(volatile int32* address) const;
+};
+
+/// <summary>
+/// Lightweight non-recursive lock. On contention it spins for a while (the amount of spins adapts to how long the lock is usually held) before putting the thread to sleep (futex on Linux). Use it instead of the CriticalSection for the hot locks that are never locked recursively and not used with the ConditionVariable.
+/// </summary>
+class FLAXENGINE_API FastLock
+{
+private:
+    // 0 - unlocked, 1 - locked, 2 - locked and other threads might be sleeping on it
+    mutable volatile int32 _state = 0;
+    mutable volatile int32 _spins = 0;
+    ThreadParker _parker;
+
+    FastLock(const FastLock&) = delete;
+    FastLock& operator=(const FastLock&) = delete;
+
+public:
+    /// <summary>
+    /// Initializes a new instance of the <see cref="FastLock"/> class.
+    /// </summary>
+    FastLock() = default;
+
+public:
+    /// <summary>
+    /// Locks the lock. Calling it again on the same thread before unlocking causes a deadlock.
+    /// </summary>
+    FORCE_INLINE void Lock() const
+    {
+        if (Platform::InterlockedCompareExchange(&_state, 1, 0) != 0)
+            LockSlow();
+    }
+
+    /// <summary>
+    /// Attempts to lock the lock without blocking.
+    /// </summary>
+    /// <returns>True if calling thread took ownership of the lock.</returns>
+    FORCE_INLINE bool TryLock() const
+    {
+        return Platform::InterlockedCompareExchange(&_state, 1, 0) == 0;
+    }
+
+    /// <summary>
+    /// Unlocks the lock.
+    /// </summary>
+    FORCE_INLINE void Unlock() const
+    {
+        if (Platform::InterlockedCompareExchange(&_state, 0, 1) != 1)
+            UnlockSlow();
+    }
+
+private:
+    void LockSlow() const;
+    void UnlockSlow() const;
+};
+
+/// <summary>
+/// Lightweight non-recursive reader-writer lock. Allows multiple threads to read at once or a single thread to write. Waiting writers block the new readers so writers don't starve. On contention it spins for a while before putting the thread to sleep (futex on Linux).
+/// </summary>
+class FLAXENGINE_API ReadWriteLock
+{
+private:
+    // The amount of threads reading or -1 if locked for writing
+    mutable volatile int32 _state = 0;
+    mutable volatile int32 _writersWaiting = 0;
+    mutable volatile int32 _sleeping = 0;
+    mutable volatile int32 _epoch = 0;
+    ThreadParker _parker;
+
+    ReadWriteLock(const ReadWriteLock&) = delete;
+    ReadWriteLock& operator=(const ReadWriteLock&) = delete;
+
+public:
+    /// <summary>
+    /// Initializes a new instance of the <see cref="ReadWriteLock"/> class.
+    /// </summary>
+    ReadWriteLock() = default;
+
+public:
+    /// <summary>
+    /// Locks the lock for reading (shared with the other readers).
+    /// </summary>
+    FORCE_INLINE void ReadLock() const
+    {
+        const int32 state = Platform::AtomicRead(&_state);
+        if (state < 0 || Platform::AtomicRead(&_writersWaiting) != 0 || Platform::InterlockedCompareExchange(&_state, state + 1, state) != state)
+            ReadLockSlow();
+    }
+
+    /// <summary>
+    /// Unlocks the lock locked for reading.
+    /// </summary>
+    FORCE_INLINE void ReadUnlock() const
+    {
+        int32 state;
+        do
+        {
+            state = Platform::AtomicRead(&_state);
+        } while (Platform::InterlockedCompareExchange(&_state, state - 1, state) != state);
+        if (state == 1 && Platform::AtomicRead(&_sleeping) != 0)
+            WakeAll();
+    }
+
+    /// <summary>
+    /// Locks the lock for writing (exclusive).
+    /// </summary>
+    FORCE_INLINE void WriteLock() const
+    {
+        if (Platform::InterlockedCompareExchange(&_state, -1, 0) != 0)
+            WriteLockSlow();
+    }
+
+    /// <summary>
+    /// Unlocks the lock locked for writing.
+    /// </summary>
+    FORCE_INLINE void WriteUnlock() const
+    {
+        Platform::AtomicStore(&_state, 0);
+        if (Platform::AtomicRead(&_sleeping) != 0)
+            WakeAll();
+    }
+
+private:
+    void ReadLockSlow() const;
+    void WriteLockSlow() const;
+    void WaitForUnlock(bool writer) const;
+    void WakeAll() const;
+};
+
+/// <summary>
+/// Scope locker for the fast lock.
+/// </summary>
+class ScopeFastLock
+{
+private:
+    const FastLock* _lock;
+
+    ScopeFastLock(const ScopeFastLock&) = delete;
+    ScopeFastLock& operator=(const ScopeFastLock&) = delete;
+
+public:
+    /// <summary>
+    /// Init, locks the lock.
+    /// </summary>
+    /// <param name="lock">The synchronization object to lock.</param>
+    ScopeFastLock(const FastLock& lock)
+        : _lock(&lock)
+    {
+        _lock->Lock();
+    }
+
+    /// <summary>
+    /// Destructor, unlocks the lock.
+    /// </summary>
+    ~ScopeFastLock()
+    {
+        _lock->Unlock();
+    }
+};
+
+/// <summary>
+/// Scope locker for the reader-writer lock (locked for reading).
+/// </summary>
+class ScopeReadLock
+{
+private:
+    const ReadWriteLock* _lock;
+
+    ScopeReadLock(const ScopeReadLock&) = delete;
+    ScopeReadLock& operator=(const ScopeReadLock&) = delete;
+
+public:
+    /// <summary>
+    /// Init, locks the lock for reading.
+    /// </summary>
+    /// <param name="lock">The synchronization object to lock.</param>
+    ScopeReadLock(const ReadWriteLock& lock)
+        : _lock(&lock)
+    {
+        _lock->ReadLock();
+    }
+
+    /// <summary>
+    /// Destructor, unlocks the lock.
+    /// </summary>
+    ~ScopeReadLock()
+    {
+        _lock->ReadUnlock();
+    }
+};
+
+/// <summary>
+/// Scope locker for the reader-writer lock (locked for writing).
+/// </summary>
+class ScopeWriteLock
+{
+private:
+    const ReadWriteLock* _lock;
+
+    ScopeWriteLock(const ScopeWriteLock&) = delete;
+    ScopeWriteLock& operator=(const ScopeWriteLock&) = delete;
+
+public:
+    /// <summary>
+    /// Init, locks the lock for writing.
+    /// </summary>
+    /// <param name="lock">The synchronization object to lock.</param>
+    ScopeWriteLock(const ReadWriteLock& lock)
+        : _lock(&lock)
+    {
+        _lock->WriteLock();
+    }
+
+    /// <summary>
+    /// Destructor, unlocks the lock.
+    /// </summary>
+    ~ScopeWriteLock()
+    {
+        _lock->WriteUnlock();
+    }
+};
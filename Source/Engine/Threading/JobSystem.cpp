@@ -2,6 +2,7 @@
 
 #include "JobSystem.h"
 #include "IRunnable.h"
+#include "FastLock.h"
 #include "Engine/Platform/CPUInfo.h"
 #include "Engine/Platform/Thread.h"
 #include "Engine/Platform/ConditionVariable.h"
@@ -103,7 +104,7 @@ namespace
     CriticalSection JobsMutex;
     ConditionVariable WaitSignal;
     CriticalSection WaitMutex;
-    CriticalSection JobsLocker;
+    FastLock JobsLocker;
 #if JOB_SYSTEM_USE_MUTEX
     RingBuffer<JobData, InlinedAllocation<256>> Jobs;
 #else
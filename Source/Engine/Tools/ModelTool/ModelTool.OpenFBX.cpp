@@ -11,6 +11,8 @@
 #include "Engine/Platform/FileSystem.h"
 #include "Engine/Tools/TextureTool/TextureTool.h"
 #include "Engine/Platform/File.h"
+#include "Engine/Profiler/ProfilerCPU.h"
+#include "Engine/Threading/JobSystem.h"
 
 // Import OpenFBX library
 // Source: https://github.com/nem0/OpenFBX
@@ -77,6 +79,15 @@ struct FbxBone
     }
 };
 
+struct FbxMeshImport
+{
+    const ofbx::Mesh* FbxMesh;
+    MeshData* Mesh;
+    int32 TriangleStart;
+    int32 TriangleEnd;
+    String ErrorMsg;
+};
+
 struct OpenFbxImporterData
 {
     const ofbx::IScene* Scene;
@@ -96,6 +107,7 @@ struct OpenFbxImporterData
     Array<FbxBone> Bones;
     Array<const ofbx::Material*> Materials;
     Array<MaterialSlotEntry> ImportedMaterials;
+    Array<FbxMeshImport> MeshImports;
 
     OpenFbxImporterData(const char* path, const ModelTool::Options& options, ofbx::IScene* scene)
         : Scene(scene)
@@ -306,7 +318,7 @@ struct OpenFbxImporterData
         return result.Materials.Count() - 1;
     }
 
-    int32 FindNode(const ofbx::Object* link)
+    int32 FindNode(const ofbx::Object* link) const
     {
         for (int32 i = 0; i < Nodes.Count(); i++)
         {
@@ -316,7 +328,7 @@ struct OpenFbxImporterData
         return -1;
     }
 
-    int32 FindNode(const String& name, StringSearchCase caseSensitivity = StringSearchCase::CaseSensitive)
+    int32 FindNode(const String& name, StringSearchCase caseSensitivity = StringSearchCase::CaseSensitive) const
     {
         for (int32 i = 0; i < Nodes.Count(); i++)
         {
@@ -326,7 +338,7 @@ struct OpenFbxImporterData
         return -1;
     }
 
-    int32 FindBone(const int32 nodeIndex)
+    int32 FindBone(const int32 nodeIndex) const
     {
         for (int32 i = 0; i < Bones.Count(); i++)
         {
@@ -336,7 +348,7 @@ struct OpenFbxImporterData
         return -1;
     }
 
-    int32 FindBone(const ofbx::Object* link)
+    int32 FindBone(const ofbx::Object* link) const
     {
         for (int32 i = 0; i < Bones.Count(); i++)
         {
@@ -516,8 +528,11 @@ bool ImportBones(OpenFbxImporterData& data, String& errorMsg)
     return false;
 }
 
-bool ProcessMesh(ImportedModelData& result, OpenFbxImporterData& data, const ofbx::Mesh* aMesh, MeshData& mesh, String& errorMsg, int32 triangleStart, int32 triangleEnd)
+// Converts the mesh geometry data. Called from the job system so it can only read the shared importer data (nodes, bones and materials are setup before).
+bool ProcessMesh(const ImportedModelData& result, const OpenFbxImporterData& data, const ofbx::Mesh* aMesh, MeshData& mesh, String& errorMsg, int32 triangleStart, int32 triangleEnd)
 {
+    PROFILE_CPU();
+
     // Prepare
     const int32 firstVertexOffset = triangleStart * 3;
     const int32 lastVertexOffset = triangleEnd * 3;
@@ -532,18 +547,6 @@ bool ProcessMesh(ImportedModelData& result, OpenFbxImporterData& data, const ofb
     const ofbx::Skin* skin = aGeometry->getSkin();
     const ofbx::BlendShape* blendShape = aGeometry->getBlendShape();
 
-    // Properties
-    mesh.Name = aMesh->name;
-    const ofbx::Material* aMaterial = nullptr;
-    if (aMesh->getMaterialCount() > 0)
-    {
-        if (aGeometry->getMaterials())
-            aMaterial = aMesh->getMaterial(aGeometry->getMaterials()[triangleStart]);
-        else
-            aMaterial = aMesh->getMaterial(0);
-    }
-    mesh.MaterialSlotIndex = data.AddMaterial(result, aMaterial);
-
     // Vertex positions
     mesh.Positions.Resize(vertexCount, false);
     for (int i = 0; i < vertexCount; i++)
@@ -902,10 +905,19 @@ bool ImportMesh(ImportedModelData& result, OpenFbxImporterData& data, const ofbx
         return false;
     }
 
-    // Import mesh data
+    // Setup mesh properties
     MeshData* meshData = New<MeshData>();
-    if (ProcessMesh(result, data, aMesh, *meshData, errorMsg, triangleStart, triangleEnd))
-        return true;
+    const ofbx::Geometry* aGeometry = aMesh->getGeometry();
+    meshData->Name = aMesh->name;
+    const ofbx::Material* aMaterial = nullptr;
+    if (aMesh->getMaterialCount() > 0)
+    {
+        if (aGeometry->getMaterials())
+            aMaterial = aMesh->getMaterial(aGeometry->getMaterials()[triangleStart]);
+        else
+            aMaterial = aMesh->getMaterial(0);
+    }
+    meshData->MaterialSlotIndex = data.AddMaterial(result, aMaterial);
 
     // Link mesh
     auto& node = data.Nodes[nodeIndex];
@@ -915,6 +927,42 @@ bool ImportMesh(ImportedModelData& result, OpenFbxImporterData& data, const ofbx
         result.LODs.Resize(lodIndex + 1);
     result.LODs[lodIndex].Meshes.Add(meshData);
 
+    // Geometry gets imported later (see ProcessMeshes)
+    auto& meshImport = data.MeshImports.AddOne();
+    meshImport.FbxMesh = aMesh;
+    meshImport.Mesh = meshData;
+    meshImport.TriangleStart = triangleStart;
+    meshImport.TriangleEnd = triangleEnd;
+
+    return false;
+}
+
+bool ProcessMeshes(ImportedModelData& result, OpenFbxImporterData& data, String& errorMsg)
+{
+    if (data.MeshImports.IsEmpty())
+        return false;
+    PROFILE_CPU();
+
+    // Meshes are independent so convert them in parallel (each job writes only to its own mesh data)
+    Function<void(int32)> job = [&result, &data](int32 i)
+    {
+        auto& e = data.MeshImports[i];
+        if (ProcessMesh(result, data, e.FbxMesh, *e.Mesh, e.ErrorMsg, e.TriangleStart, e.TriangleEnd) && e.ErrorMsg.IsEmpty())
+            e.ErrorMsg = TEXT("Failed to process mesh.");
+    };
+    JobSystem::Execute(job, data.MeshImports.Count());
+
+    // Report the first failure (in the import order)
+    for (const auto& e : data.MeshImports)
+    {
+        if (e.ErrorMsg.HasChars())
+        {
+            errorMsg = e.ErrorMsg;
+            data.MeshImports.Clear();
+            return true;
+        }
+    }
+    data.MeshImports.Clear();
     return false;
 }
 
@@ -1296,6 +1344,8 @@ bool ModelTool::ImportDataOpenFBX(const char* path, ImportedModelData& data, Opt
                     return true;
             }
         }
+        if (ProcessMeshes(data, *context, errorMsg))
+            return true;
     }
 
     // Import skeleton
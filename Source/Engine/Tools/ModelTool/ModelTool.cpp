@@ -366,6 +366,9 @@ void ModelTool::Options::Serialize(SerializeStream& stream, const void* otherObj
     SERIALIZE(ImportVertexColors);
     SERIALIZE(ImportBlendShapes);
     SERIALIZE(LightmapUVsSource);
+    SERIALIZE(GenerateClusters);
+    SERIALIZE(CompressGeometry);
+    SERIALIZE(QuantizePositions);
     SERIALIZE(CollisionMeshesPrefix);
     SERIALIZE(Scale);
     SERIALIZE(Rotation);
@@ -409,6 +412,9 @@ void ModelTool::Options::Deserialize(DeserializeStream& stream, ISerializeModifi
     DESERIALIZE(ImportVertexColors);
     DESERIALIZE(ImportBlendShapes);
     DESERIALIZE(LightmapUVsSource);
+    DESERIALIZE(GenerateClusters);
+    DESERIALIZE(CompressGeometry);
+    DESERIALIZE(QuantizePositions);
     DESERIALIZE(CollisionMeshesPrefix);
     DESERIALIZE(Scale);
     DESERIALIZE(Rotation);
@@ -1526,11 +1532,15 @@ bool ModelTool::ImportModel(const String& path, ModelData& meshData, Options& op
             auto& dstLod = data.LODs[lodIndex];
             const auto& srcLod = data.LODs[lodIndex - 1];
 
-            int32 lodTriangleCount = 0, lodVertexCount = 0;
             dstLod.Meshes.Resize(srcLod.Meshes.Count());
             for (int32 meshIndex = 0; meshIndex < dstLod.Meshes.Count(); meshIndex++)
+                dstLod.Meshes[meshIndex] = New<MeshData>();
+
+            // Simplify meshes in parallel (each LOD is generated from the previous one so LODs are processed in order)
+            Function<void(int32)> lodJob = [&dstLod, &srcLod, &options, triangleReduction](int32 meshIndex)
             {
-                auto& dstMesh = dstLod.Meshes[meshIndex] = New<MeshData>();
+                PROFILE_CPU_NAMED("Generate LOD Job");
+                auto& dstMesh = dstLod.Meshes[meshIndex];
                 const auto& srcMesh = srcLod.Meshes[meshIndex];
 
                 // Setup mesh
@@ -1551,7 +1561,7 @@ bool ModelTool::ImportModel(const String& path, ModelData& meshData, Options& op
                     dstMeshIndexCount = (int32)meshopt_simplify(indices.Get(), srcMesh->Indices.Get(), srcMeshIndexCount, (const float*)srcMesh->Positions.Get(), srcMeshVertexCount, sizeof(Float3), dstMeshIndexCountTarget, options.LODTargetError);
                 indices.Resize(dstMeshIndexCount);
                 if (dstMeshIndexCount == 0)
-                    continue;
+                    return;
 
                 // Generate simplified vertex buffer remapping table (use only vertices from LOD index buffer)
                 Array<unsigned int> remap;
@@ -1612,17 +1622,23 @@ bool ModelTool::ImportModel(const String& path, ModelData& meshData, Options& op
                 // Optimize generated LOD
                 meshopt_optimizeVertexCache(dstMesh->Indices.Get(), dstMesh->Indices.Get(), dstMeshIndexCount, dstMeshVertexCount);
                 meshopt_optimizeOverdraw(dstMesh->Indices.Get(), dstMesh->Indices.Get(), dstMeshIndexCount, (const float*)dstMesh->Positions.Get(), dstMeshVertexCount, sizeof(Float3), 1.05f);
-
-                lodTriangleCount += dstMeshIndexCount / 3;
-                lodVertexCount += dstMeshVertexCount;
-                generatedLod++;
-            }
+            };
+            JobSystem::Execute(lodJob, dstLod.Meshes.Count());
 
             // Remove empty meshes
+            int32 lodTriangleCount = 0, lodVertexCount = 0;
             for (int32 i = dstLod.Meshes.Count() - 1; i >= 0; i--)
             {
-                if (dstLod.Meshes[i]->Indices.IsEmpty())
-                    dstLod.Meshes.RemoveAt(i--);
+                auto mesh = dstLod.Meshes[i];
+                if (mesh->Indices.IsEmpty())
+                {
+                    dstLod.Meshes.RemoveAt(i);
+                    Delete(mesh);
+                    continue;
+                }
+                lodTriangleCount += mesh->Indices.Count() / 3;
+                lodVertexCount += mesh->Positions.Count();
+                generatedLod++;
             }
 
             LOG(Info, "Generated LOD{0}: triangles: {1} ({2}% of base LOD), verticies: {3} ({4}% of base LOD)",
@@ -1637,6 +1653,27 @@ bool ModelTool::ImportModel(const String& path, ModelData& meshData, Options& op
         }
     }
 
+    // Generate meshes clusters for the fine-grained culling (after LODs generation so all LODs have optimized index buffers)
+    if (options.GenerateClusters && options.Type == ModelType::Model && data.LODs.HasItems())
+    {
+        auto clustersStartTime = DateTime::NowUTC();
+        meshopt_setAllocator(MeshOptAllocate, MeshOptDeallocate);
+        Array<MeshData*> meshes;
+        for (auto& lod : data.LODs)
+            meshes.Add(lod.Meshes);
+        Function<void(int32)> clustersJob = [&meshes](int32 meshIndex)
+        {
+            PROFILE_CPU_NAMED("Generate Clusters Job");
+            meshes[meshIndex]->GenerateClusters();
+        };
+        JobSystem::Execute(clustersJob, meshes.Count());
+        int32 clustersCount = 0;
+        for (auto mesh : meshes)
+            clustersCount += mesh->Clusters.Count();
+        auto clustersEndTime = DateTime::NowUTC();
+        LOG(Info, "Generated {1} clusters for {2} meshes in {0} ms", static_cast<int32>((clustersEndTime - clustersStartTime).GetTotalMilliseconds()), clustersCount, meshes.Count());
+    }
+
     // Export imported data to the output container (we reduce vertex data copy operations to minimum)
     {
         meshData.Textures.Swap(data.Textures);
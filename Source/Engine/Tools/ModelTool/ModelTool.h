@@ -259,6 +259,15 @@ API_CLASS(Namespace="FlaxEngine.Tools", Static) class FLAXENGINE_API ModelTool
         // The lightmap UVs source.
         API_FIELD(Attributes="EditorOrder(90), EditorDisplay(\"Geometry\", \"Lightmap UVs Source\"), VisibleIf(nameof(ShowModel))")
         ModelLightmapUVsSource LightmapUVsSource = ModelLightmapUVsSource::Disable;
+        // If checked, the meshes will be split into clusters (meshlets) with bounds and normal cones used for the fine-grained culling of the large meshes in shadow and depth passes.
+        API_FIELD(Attributes="EditorOrder(95), EditorDisplay(\"Geometry\"), VisibleIf(nameof(ShowModel))")
+        bool GenerateClusters = true;
+        // If checked, the meshes vertex and index buffers will be compressed in the asset file (lossless, decoded on load). Reduces the asset size and the streaming I/O.
+        API_FIELD(Attributes="EditorOrder(96), EditorDisplay(\"Geometry\"), VisibleIf(nameof(ShowModel))")
+        bool CompressGeometry = true;
+        // If checked, the compressed meshes vertex positions will be quantized to 16-bit per component (relative to the mesh bounds). Reduces the asset size further at the cost of the positions precision.
+        API_FIELD(Attributes="EditorOrder(97), EditorDisplay(\"Geometry\"), VisibleIf(nameof(ShowModel))")
+        bool QuantizePositions = false;
         // If specified, all meshes which name starts with this prefix will be imported as a separate collision data (excluded used for rendering).
         API_FIELD(Attributes="EditorOrder(100), EditorDisplay(\"Geometry\"), VisibleIf(nameof(ShowGeometry))")
         String CollisionMeshesPrefix = TEXT("");
@@ -5,6 +5,8 @@
 #include "./Flax/Common.hlsl"
 #include "./Flax/GBuffer.hlsl"
 #include "./Flax/BRDF.hlsl"
+#include "./Flax/Quaternion.hlsl"
+#include "./Flax/Octahedral.hlsl"
 
 META_CB_BEGIN(0, Data)
 GBufferData GBuffer;
@@ -12,8 +14,28 @@ float3 Dummy0;
 int ViewMode;
 META_CB_END
 
+META_CB_BEGIN(1, ImpostorsData)
+float4x4 ViewProjectionMatrix;
+float3 ViewWorldPos;
+uint InstanceOffset;
+META_CB_END
+
 DECLARE_GBUFFERDATA_ACCESS(GBuffer)
 
+struct ImpostorInstance
+{
+	float3 Position;
+	float Radius;
+	float4 Orientation;
+	float Fade;
+	float Frames;
+	float2 Dummy0;
+};
+
+Texture2D ImpostorAlbedo : register(t5);
+Texture2D ImpostorNormal : register(t6);
+StructuredBuffer<ImpostorInstance> Impostors : register(t7);
+
 // View modes
 #define View_Mode_Default 0
 #define View_Mode_Fast 1
@@ -69,3 +91,69 @@ float4 PS_DebugView(Quad_VS2PS input) : SV_Target
 	}
 	return float4(result, 1);
 }
+
+struct ImpostorVSOutput
+{
+	float4 Position : SV_Position;
+	float3 WorldPosition : TEXCOORD0;
+	float2 TexCoord : TEXCOORD1;
+	nointerpolation float4 Orientation : TEXCOORD2;
+	nointerpolation float4 Forward : TEXCOORD3;
+	nointerpolation float Fade : TEXCOORD4;
+};
+
+// Vertex shader for impostors rendering (camera-facing quad per instance generated from the vertex index)
+META_VS(true, FEATURE_LEVEL_SM5)
+ImpostorVSOutput VS_Impostor(uint vertexID : SV_VertexID, uint instanceID : SV_InstanceID)
+{
+	ImpostorInstance instance = Impostors[InstanceOffset + instanceID];
+	float4 invOrientation = float4(-instance.Orientation.xyz, instance.Orientation.w);
+
+	// Pick the atlas frame captured from the direction that is the closest to the view direction (in model-space)
+	float frames = instance.Frames;
+	float3 viewDir = QuaternionRotate(invOrientation, normalize(ViewWorldPos - instance.Position));
+	float2 frame = clamp(round((GetOctahedralCoords(viewDir) * 0.5f + 0.5f) * (frames - 1.0f)), 0.0f, frames - 1.0f);
+	float3 frameDir = GetOctahedralDirection(frame / (frames - 1.0f) * 2.0f - 1.0f);
+
+	// Build quad with the same basis as the view used to capture the frame
+	float3 forward = -frameDir;
+	float3 up = abs(forward.y) > 0.999f ? float3(0, 0, 1) : float3(0, 1, 0);
+	float3 right = normalize(cross(up, forward));
+	up = cross(forward, right);
+	float2 corner = float2(vertexID == 1 || vertexID == 2 || vertexID == 4 ? 1.0f : -1.0f, vertexID == 2 || vertexID == 4 || vertexID == 5 ? 1.0f : -1.0f);
+	float3 localPosition = (right * corner.x + up * corner.y) * instance.Radius;
+
+	ImpostorVSOutput output;
+	output.WorldPosition = instance.Position + QuaternionRotate(instance.Orientation, localPosition);
+	output.Position = mul(float4(output.WorldPosition, 1), ViewProjectionMatrix);
+	output.TexCoord = (frame + float2(corner.x * 0.5f + 0.5f, 0.5f - corner.y * 0.5f)) / frames;
+	output.Orientation = instance.Orientation;
+	output.Forward = float4(QuaternionRotate(instance.Orientation, forward), instance.Radius);
+	output.Fade = instance.Fade;
+	return output;
+}
+
+// Pixel shader for impostors rendering into GBuffer
+META_PS(true, FEATURE_LEVEL_SM5)
+void PS_Impostor(ImpostorVSOutput input, out float4 Light : SV_Target0, out float4 RT0 : SV_Target1, out float4 RT1 : SV_Target2, out float4 RT2 : SV_Target3, out float4 RT3 : SV_Target4, out float OutDepth : SV_Depth)
+{
+	float4 albedo = ImpostorAlbedo.Sample(SamplerLinearClamp, input.TexCoord);
+	clip(albedo.a - 0.5f);
+
+	// Cross-fade with the model (dithering pattern is complementary to the model LOD transition)
+	float randGrid = cos(dot(floor(input.Position.xy), float2(347.83452793, 3343.28371863)));
+	clip(input.Fade - frac(randGrid * 1000.0) - 0.001f);
+
+	// Offset pixel depth by the captured depth (0.5 is at the quad plane which goes through the model bounds center)
+	float4 normal = ImpostorNormal.Sample(SamplerLinearClamp, input.TexCoord);
+	float3 worldPosition = input.WorldPosition + input.Forward.xyz * ((normal.a * 2.0f - 1.0f) * input.Forward.w);
+	float4 clipPosition = mul(float4(worldPosition, 1), ViewProjectionMatrix);
+	OutDepth = clipPosition.z / clipPosition.w;
+
+	float3 worldNormal = normalize(QuaternionRotate(input.Orientation, normal.xyz * 2.0f - 1.0f));
+	Light = float4(0, 0, 0, 1);
+	RT0 = float4(albedo.rgb, 1);
+	RT1 = float4(worldNormal * 0.5f + 0.5f, SHADING_MODEL_LIT * (1.0 / 3.0));
+	RT2 = float4(1, 0, 0.5f, 0);
+	RT3 = float4(0, 0, 0, 0);
+}